@@ -84,6 +84,8 @@ DEPipeline::DEPipeline() : iterator_(nullptr) {
     num_classes_ = 0;
     temp_batch_size_ = 1;
     temp_drop_remainder_ = false;
+    start_epochs_ = 0;
+    start_rows_ = 0;
   } catch (const std::exception &err) {
     MS_LOG(ERROR) << "Dataset pipeline exception caught on init: " << err.what() << ".";
     return;
@@ -127,12 +129,20 @@ Status DEPipeline::AssignRootNode(const DsOpPtr &dataset_op) { return (tree_->As
 // Function to launch the tree execution.
 Status DEPipeline::LaunchTreeExec() {
   RETURN_IF_NOT_OK(tree_->Prepare());
+  if (start_epochs_ > 0 || start_rows_ > 0) {
+    RETURN_IF_NOT_OK(tree_->FastForward(start_epochs_, start_rows_));
+  }
   RETURN_IF_NOT_OK(tree_->Launch());
   iterator_ = std::make_unique<DatasetIterator>(tree_);
   if (iterator_ == nullptr) RETURN_STATUS_UNEXPECTED("Cannot create an Iterator.");
   return Status::OK();
 }
 
+void DEPipeline::SetStartPosition(int64_t num_epochs, int64_t num_rows) {
+  start_epochs_ = num_epochs;
+  start_rows_ = num_rows;
+}
+
 void DEPipeline::PrintTree() {
   for (auto itr = tree_->begin(); itr != tree_->end(); ++itr) {
     std::stringstream ss;
@@ -554,11 +564,14 @@ Status DEPipeline::ParseFilterOp(const py::dict &args, std::shared_ptr<DatasetOp
         (void)builder->SetNumWorkers(ToInt(value));
       } else if (key == "predicate") {
         py::handle op = args["predicate"];
-        if (!py::isinstance<py::function>(op)) {
-          RETURN_STATUS_UNEXPECTED("Error: predicate is not recognised (not pyfunc).");
+        if (py::isinstance<FilterPredicate>(op)) {
+          (void)builder->SetNativePredicate(op.cast<std::shared_ptr<FilterPredicate>>());
+        } else if (py::isinstance<py::function>(op)) {
+          py::function predicate_func = op.cast<py::function>();
+          (void)builder->SetPredicateFunc(std::move(predicate_func));
+        } else {
+          RETURN_STATUS_UNEXPECTED("Error: predicate is not recognised (not pyfunc or native predicate).");
         }
-        py::function predicate_func = op.cast<py::function>();
-        (void)builder->SetPredicateFunc(std::move(predicate_func));
       } else if (key == "input_columns") {
         std::vector<std::string> in_col_names = ToStringVector(args["input_columns"]);
         (void)builder->SetInColNames(in_col_names);
@@ -84,6 +84,9 @@ class DEPipeline {
   // Function to launch the tree execution.
   Status LaunchTreeExec();
 
+  // Function to set the position of the leaf ops the tree starts from when it is launched.
+  void SetStartPosition(int64_t num_epochs, int64_t num_rows);
+
   // Get a row of data as dictionary of column name to the value.
   Status GetNextAsMap(py::dict *output);
 
@@ -176,6 +179,9 @@ class DEPipeline {
 
   int temp_batch_size_;
   bool temp_drop_remainder_;
+
+  int64_t start_epochs_;
+  int64_t start_rows_;
 };
 }  // namespace dataset
 }  // namespace mindspore
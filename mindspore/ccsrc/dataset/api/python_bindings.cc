@@ -16,6 +16,7 @@
 #include <exception>
 
 #include "dataset/api/de_pipeline.h"
+#include "dataset/core/python_gil.h"
 #include "dataset/kernels/no_op.h"
 #include "dataset/kernels/data/one_hot_op.h"
 #include "dataset/kernels/image/center_crop_op.h"
@@ -38,6 +39,7 @@
 #include "dataset/kernels/image/resize_op.h"
 #include "dataset/kernels/image/uniform_aug_op.h"
 #include "dataset/kernels/data/type_cast_op.h"
+#include "dataset/engine/datasetops/filter_predicate.h"
 #include "dataset/engine/datasetops/source/cifar_op.h"
 #include "dataset/engine/datasetops/source/image_folder_op.h"
 #include "dataset/engine/datasetops/source/io_block.h"
@@ -101,6 +103,7 @@ void bindDEPipeline(py::module *m) {
          [](DEPipeline &de, const DsOpPtr &dataset_op) { THROW_IF_ERROR(de.AssignRootNode(dataset_op)); })
     .def("SetBatchParameters",
          [](DEPipeline &de, const py::dict &args) { THROW_IF_ERROR(de.SetBatchParameters(args)); })
+    .def("SetStartPosition", &DEPipeline::SetStartPosition)
     .def("LaunchTreeExec", [](DEPipeline &de) { THROW_IF_ERROR(de.LaunchTreeExec()); })
     .def("GetNextAsMap",
          [](DEPipeline &de) {
@@ -219,6 +222,11 @@ void bindTensor(py::module *m) {
   (void)py::class_<GlobalContext>(*m, "GlobalContext")
     .def_static("config_manager", &GlobalContext::config_manager, py::return_value_policy::reference);
 
+  (void)py::class_<GilMonitor>(*m, "GilMonitor")
+    .def_static("get_instance", &GilMonitor::GetInstance, py::return_value_policy::reference)
+    .def("get_stats", &GilMonitor::GetStats)
+    .def("reset", &GilMonitor::Reset);
+
   (void)py::class_<ConfigManager, std::shared_ptr<ConfigManager>>(*m, "ConfigManager")
     .def("__str__", &ConfigManager::ToString)
     .def("set_rows_per_buffer", &ConfigManager::set_rows_per_buffer)
@@ -226,11 +234,13 @@ void bindTensor(py::module *m) {
     .def("set_worker_connector_size", &ConfigManager::set_worker_connector_size)
     .def("set_op_connector_size", &ConfigManager::set_op_connector_size)
     .def("set_seed", &ConfigManager::set_seed)
+    .def("set_epoch_pipelining", &ConfigManager::set_epoch_pipelining)
     .def("get_rows_per_buffer", &ConfigManager::rows_per_buffer)
     .def("get_num_parallel_workers", &ConfigManager::num_parallel_workers)
     .def("get_worker_connector_size", &ConfigManager::worker_connector_size)
     .def("get_op_connector_size", &ConfigManager::op_connector_size)
     .def("get_seed", &ConfigManager::seed)
+    .def("get_epoch_pipelining", &ConfigManager::epoch_pipelining)
     .def("load", [](ConfigManager &c, std::string s) { (void)c.LoadFile(s); });
 
   (void)py::class_<Tensor, std::shared_ptr<Tensor>>(*m, "Tensor", py::buffer_protocol())
@@ -497,6 +507,32 @@ void bindInfoObjects(py::module *m) {
     .def(py::init<int64_t, int64_t, int64_t>())
     .def("get_epoch_num", &BatchOp::CBatchInfo::get_epoch_num)
     .def("get_batch_num", &BatchOp::CBatchInfo::get_batch_num);
+
+  (void)py::class_<FilterPredicate, std::shared_ptr<FilterPredicate>>(*m, "FilterPredicate")
+    .def(py::init<>())
+    .def("add_length_range",
+         [](FilterPredicate &p, const std::string &column, int64_t min_len, int64_t max_len) {
+           THROW_IF_ERROR(p.AddLengthRange(column, min_len, max_len));
+         })
+    .def("add_value_range",
+         [](FilterPredicate &p, const std::string &column, double min_value, double max_value) {
+           THROW_IF_ERROR(p.AddValueRange(column, min_value, max_value));
+         })
+    .def("add_integer_range",
+         [](FilterPredicate &p, const std::string &column, int64_t min_value, int64_t max_value) {
+           THROW_IF_ERROR(p.AddIntegerRange(column, min_value, max_value));
+         })
+    .def("add_value_in",
+         [](FilterPredicate &p, const std::string &column, const std::vector<double> &values) {
+           THROW_IF_ERROR(p.AddValueIn(column, values));
+         })
+    .def("add_integer_in",
+         [](FilterPredicate &p, const std::string &column, const std::vector<int64_t> &values) {
+           THROW_IF_ERROR(p.AddIntegerIn(column, values));
+         })
+    .def("add_string_in", [](FilterPredicate &p, const std::string &column, const std::vector<std::string> &values) {
+      THROW_IF_ERROR(p.AddStringIn(column, values));
+    });
 }
 
 void bindVocabObjects(py::module *m) {
@@ -544,7 +580,9 @@ void bindGraphData(py::module *m) {
            TensorRow out;
            THROW_IF_ERROR(g.GetNodeFeature(node_list, feature_types, &out));
            return out;
-         });
+         })
+    .def("save_snapshot",
+         [](gnn::Graph &g, std::string snapshot_file) { THROW_IF_ERROR(g.SaveSnapshot(snapshot_file)); });
 }
 
 // This is where we externalize the C logic as python modules
@@ -31,7 +31,8 @@ void ConfigManager::Print(std::ostream &out) const {
       << "\nDataCache Rows per buffer    : " << rows_per_buffer_
       << "\nParallelOp workers           : " << num_parallel_workers_
       << "\nParallelOp worker connector size    : " << worker_connector_size_
-      << "\nSize of each Connector : " << op_connector_size_ << std::endl;
+      << "\nSize of each Connector : " << op_connector_size_
+      << "\nEpoch pipelining             : " << (epoch_pipelining_ ? "true" : "false") << std::endl;
 }
 
 // Private helper function that taks a nlohmann json format and populates the settings
@@ -41,6 +42,7 @@ Status ConfigManager::FromJson(const nlohmann::json &j) {
   set_worker_connector_size(j.value("workerConnectorSize", worker_connector_size_));
   set_op_connector_size(j.value("opConnectorSize", op_connector_size_));
   set_seed(j.value("seed", seed_));
+  set_epoch_pipelining(j.value("epochPipelining", epoch_pipelining_));
   return Status::OK();
 }
 
@@ -88,5 +90,8 @@ void ConfigManager::set_op_connector_size(int32_t connector_size) { op_connector
 uint32_t ConfigManager::seed() const { return seed_; }
 
 void ConfigManager::set_seed(uint32_t seed) { seed_ = seed; }
+
+// Setter function
+void ConfigManager::set_epoch_pipelining(bool epoch_pipelining) { epoch_pipelining_ = epoch_pipelining; }
 }  // namespace dataset
 }  // namespace mindspore
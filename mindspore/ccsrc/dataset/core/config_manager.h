@@ -105,6 +105,14 @@ class ConfigManager {
   // @param connector_size - The setting to apply to the config
   void set_op_connector_size(int32_t connector_size);
 
+  // getter function
+  // @return True if the leaf operators start the next epoch while the current one is still draining
+  bool epoch_pipelining() const { return epoch_pipelining_; }
+
+  // setter function
+  // @param epoch_pipelining - The setting to apply to the config
+  void set_epoch_pipelining(bool epoch_pipelining);
+
   uint32_t seed() const;
 
   // setter function
@@ -117,6 +125,7 @@ class ConfigManager {
   int32_t worker_connector_size_{kCfgWorkerConnectorSize};
   int32_t op_connector_size_{kCfgOpConnectorSize};
   uint32_t seed_{kCfgDefaultSeed};
+  bool epoch_pipelining_{kCfgEpochPipelining};
 
   // Private helper function that taks a nlohmann json format and populates the settings
   // @param j - The json nlohmann json info
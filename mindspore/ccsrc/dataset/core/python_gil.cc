@@ -0,0 +1,52 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "dataset/core/python_gil.h"
+
+#include <utility>
+
+namespace mindspore {
+namespace dataset {
+GilMonitor &GilMonitor::GetInstance() {
+  static GilMonitor instance;
+  return instance;
+}
+
+GilWaitCounter *GilMonitor::GetCounter(const std::string &name) {
+  std::lock_guard<std::mutex> lock(mux_);
+  auto &counter = counters_[name];
+  if (counter == nullptr) {
+    counter = std::make_unique<GilWaitCounter>();
+  }
+  return counter.get();
+}
+
+std::map<std::string, std::pair<int64_t, int64_t>> GilMonitor::GetStats() {
+  std::lock_guard<std::mutex> lock(mux_);
+  std::map<std::string, std::pair<int64_t, int64_t>> stats;
+  for (const auto &itr : counters_) {
+    stats[itr.first] = std::make_pair(itr.second->wait_us(), itr.second->acquisitions());
+  }
+  return stats;
+}
+
+void GilMonitor::Reset() {
+  std::lock_guard<std::mutex> lock(mux_);
+  for (auto &itr : counters_) {
+    itr.second->Reset();
+  }
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,102 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef DATASET_CORE_PYTHON_GIL_H_
+#define DATASET_CORE_PYTHON_GIL_H_
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "dataset/core/pybind_support.h"
+
+namespace mindspore {
+namespace dataset {
+// Time that the threads of one kind of op spent waiting for the Python GIL
+class GilWaitCounter {
+ public:
+  GilWaitCounter() = default;
+
+  ~GilWaitCounter() = default;
+
+  // Add one acquisition
+  // @param int64_t wait_us - time spent waiting, in microseconds
+  void Add(int64_t wait_us) {
+    wait_us_ += wait_us;
+    acquisitions_++;
+  }
+
+  // @return int64_t - Returned total waiting time in microseconds
+  int64_t wait_us() const { return wait_us_; }
+
+  // @return int64_t - Returned number of acquisitions
+  int64_t acquisitions() const { return acquisitions_; }
+
+  void Reset() {
+    wait_us_ = 0;
+    acquisitions_ = 0;
+  }
+
+ private:
+  std::atomic<int64_t> wait_us_{0};
+  std::atomic<int64_t> acquisitions_{0};
+};
+
+// Process wide registry of GIL wait counters, one per kind of op that calls into Python.
+// A high wait time relative to the run time means that the Python parts of the pipeline are serialized on the GIL.
+class GilMonitor {
+ public:
+  static GilMonitor &GetInstance();
+
+  // Get the counter of a kind of op, created on first use. The counter lives as long as the process.
+  // @param const std::string &name - name of the op
+  // @return GilWaitCounter * - Returned counter
+  GilWaitCounter *GetCounter(const std::string &name);
+
+  // @return std::map<std::string, std::pair<int64_t, int64_t>> - Returned (wait us, acquisitions) of every counter
+  std::map<std::string, std::pair<int64_t, int64_t>> GetStats();
+
+  // Clear all counters
+  void Reset();
+
+ private:
+  GilMonitor() = default;
+
+  std::mutex mux_;
+  std::map<std::string, std::unique_ptr<GilWaitCounter>> counters_;
+};
+
+// Acquire the GIL as py::gil_scoped_acquire does, and add the time spent waiting for it to a counter
+class TimedGilAcquire {
+ public:
+  // @param GilWaitCounter *counter - counter to add to
+  explicit TimedGilAcquire(GilWaitCounter *counter) : start_(std::chrono::steady_clock::now()) {
+    auto wait = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_);
+    counter->Add(wait.count());
+  }
+
+  ~TimedGilAcquire() = default;
+
+ private:
+  std::chrono::steady_clock::time_point start_;
+  py::gil_scoped_acquire gil_;  // Declared after start_, so it is acquired between the two time stamps
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // DATASET_CORE_PYTHON_GIL_H_
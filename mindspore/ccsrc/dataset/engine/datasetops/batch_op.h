@@ -169,6 +169,12 @@ class BatchOp : public ParallelOp {
   // @param show_all - A bool to control if you want to show all info or just a summary
   void Print(std::ostream &out, bool show_all) const override;
 
+  // Base-class override for fast forward. Positions are counted in rows of the leaf ops, before batching.
+  // @return Status - The error code return
+  Status FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) override {
+    return child_[0]->FastForward(num_epochs, num_rows, out_epochs);
+  }
+
   // << Stream output operator overload
   // @notes This allows you to write the debug print info using stream operators
   // @param out - reference to the output stream being overloaded
@@ -21,6 +21,7 @@
 #include <utility>
 #include <string>
 
+#include "dataset/core/global_context.h"
 #include "dataset/engine/execution_tree.h"
 #include "dataset/engine/datasetops/device_queue_op.h"
 #include "dataset/engine/data_buffer.h"
@@ -176,9 +177,45 @@ Status DatasetOp::EofReceived(int32_t worker_id) {
 // During tree prepare phase, operators may have specific pre-operations to perform depending on
 // their role.
 Status DatasetOp::PrepareNodePreAction() {
-  if (BitTest(tree_->PrepareFlags(), ExecutionTree::kDePrepRepeat)) set_control_flag(kDeOpRepeated);
+  if (BitTest(tree_->PrepareFlags(), ExecutionTree::kDePrepRepeat)) {
+    set_control_flag(kDeOpRepeated);
+    if (GlobalContext::config_manager()->epoch_pipelining()) {
+      set_control_flag(kDeOpEpochPipelined);
+    }
+  }
+  return Status::OK();
+}
+// Waits for the acknowledgement of the eoe sent in the previous epoch, if any
+Status DatasetOp::SyncPendingEoe(WaitPost *eoe_ack) {
+  if (eoe_pending_) {
+    RETURN_IF_NOT_OK(eoe_ack->Wait());
+    eoe_ack->Clear();
+    eoe_pending_ = false;
+  }
   return Status::OK();
 }
+
+// Resets the op at once with epoch pipelining, otherwise waits for Reset()
+Status DatasetOp::StartNextEpoch(WaitPost *eoe_ack, const std::function<Status()> &reset_epoch) {
+  if (BitTest(op_ctrl_flags_, kDeOpEpochPipelined)) {
+    RETURN_IF_NOT_OK(reset_epoch());
+    eoe_pending_ = true;
+  } else {
+    RETURN_IF_NOT_OK(eoe_ack->Wait());
+    eoe_ack->Clear();
+  }
+  return Status::OK();
+}
+
+// Resets the op unless the master thread already did, then wakes it up
+Status DatasetOp::AcknowledgeEoe(WaitPost *eoe_ack, const std::function<Status()> &reset_epoch) {
+  if (!BitTest(op_ctrl_flags_, kDeOpEpochPipelined)) {
+    RETURN_IF_NOT_OK(reset_epoch());
+  }
+  eoe_ack->Set();
+  return Status::OK();
+}
+
 // During tree prepare phase, operators may have specific post-operations to perform depending on
 // their role.
 Status DatasetOp::PrepareNodePostAction() {
@@ -214,6 +251,12 @@ Status DatasetOp::Reset() {
   return Status::OK();
 }
 
+// Ops that can start from a later position override this, the others can not be fast forwarded.
+Status DatasetOp::FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) {
+  std::string err_msg = "Operator " + std::to_string(operator_id_) + " does not support fast forward.";
+  RETURN_STATUS_UNEXPECTED(err_msg);
+}
+
 // gives a string output for the column map for handy debug printing
 std::string DatasetOp::ColumnNameMapAsString() const {
   std::string outStr = "Column name id map: ";
@@ -16,6 +16,7 @@
 #ifndef DATASET_ENGINE_DATASETOPS_DATASET_OP_H_
 #define DATASET_ENGINE_DATASETOPS_DATASET_OP_H_
 
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -24,6 +25,7 @@
 #include "dataset/core/constants.h"
 #include "dataset/engine/db_connector.h"
 #include "dataset/util/status.h"
+#include "dataset/util/wait_post.h"
 
 namespace mindspore {
 namespace dataset {
@@ -46,8 +48,9 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
   // Flags that control operator runtime behaviours
   enum OpControlFlags {
     kDeOpNone = 0,
-    kDeOpRepeated = 1,        // Operator is a leaf node in a repeat path
-    kDeOpLastRepeat = 1 << 1  // We are in the last repeat loop
+    kDeOpRepeated = 1,            // Operator is a leaf node in a repeat path
+    kDeOpLastRepeat = 1 << 1,     // We are in the last repeat loop
+    kDeOpEpochPipelined = 1 << 2  // Leaf node starts the next repeat without waiting for the reset of the repeat op
   };
 
   // Flags that control operator runtime behaviours
@@ -155,6 +158,15 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
     return Status::OK();
   }
 
+  // Move this subtree to a position of its leaf ops, so that the pipeline starts from there instead of from the
+  // first row. Called between the tree prepare phase and the launch. Ops that do not keep a one to one mapping
+  // between the rows of their child and their own rows do not support it.
+  // @param int64_t num_epochs - number of epochs the leaf ops have already done
+  // @param int64_t num_rows - number of rows of their current epoch the leaf ops have already done
+  // @param int64_t *out_epochs - Returned number of epochs this op has already done
+  // @return Status - The error code return
+  virtual Status FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs);
+
   // During tree prepare phase, operators may have specific pre-operations to perform depending on
   // their role.
   // @notes Derived versions of this function should always call it's superclass version first
@@ -249,6 +261,27 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
   // @return - Status
   Status AssignColMapFromChild();
 
+  // Epoch pipelining helpers of the leaf ops, see kDeOpEpochPipelined. eoe_ack is the WaitPost that Reset() sets for
+  // the master thread, reset_epoch resets the op for its next epoch.
+  // Waits until the repeat op has acknowledged the previous eoe, so the last repeat flag is read in the same state as
+  // without pipelining. The master thread calls it before checking kDeOpLastRepeat.
+  // @param eoe_ack - the WaitPost set by Reset()
+  // @return Status
+  Status SyncPendingEoe(WaitPost *eoe_ack);
+
+  // The master thread calls it after sending the eoe of a repeat that is not the last one. With pipelining the op is
+  // reset right away, otherwise the master thread sleeps until Reset() has been called.
+  // @param eoe_ack - the WaitPost set by Reset()
+  // @param reset_epoch - resets the op for its next epoch
+  // @return Status
+  Status StartNextEpoch(WaitPost *eoe_ack, const std::function<Status()> &reset_epoch);
+
+  // Reset() calls it to reset the op, unless the master thread already did, and wake up the master thread.
+  // @param eoe_ack - the WaitPost set by Reset()
+  // @param reset_epoch - resets the op for its next epoch
+  // @return Status
+  Status AcknowledgeEoe(WaitPost *eoe_ack, const std::function<Status()> &reset_epoch);
+
   std::vector<std::shared_ptr<DatasetOp>> child_;                // Child nodes
   std::vector<const DatasetOp *> parent_;                        // Parent nodes. No ownership and read-only
   int32_t oc_queue_size_;                                        // Capacity for each out_connector_
@@ -260,6 +293,7 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
   std::unordered_map<std::string, int32_t> column_name_id_map_;  // Mapping between col index and col name
   bool first_fetch_;                                             // For use when setting column map
   std::mutex column_name_map_mutex_;                             // For protecting shared access to the column map
+  bool eoe_pending_ = false;  // An eoe was sent that the repeat op has not acknowledged yet, master thread only
 
  private:
   // Sets the operator id.
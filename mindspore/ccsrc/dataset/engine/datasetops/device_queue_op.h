@@ -126,6 +126,12 @@ class DeviceQueueOp : public PipelineOp {
   void Print(std::ostream &out,              // In: The output stream to print to
              bool show_all) const override;  // In: T/F if it should print everything
 
+  // Base-class override for fast forward. Every row of the child is sent, so the position is the child's.
+  // @return Status - The error code return
+  Status FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) override {
+    return child_[0]->FastForward(num_epochs, num_rows, out_epochs);
+  }
+
   // Provide stream operator for displaying it
   friend std::ostream &operator<<(std::ostream &out, const DeviceQueueOp &to) {
     to.Print(out, false);
@@ -51,13 +51,17 @@ FilterOp::Builder::Builder() {
 Status FilterOp::Builder::Build(std::shared_ptr<FilterOp> *ptr) {
   RETURN_IF_NOT_OK(SanityCheck());
   *ptr = std::make_shared<FilterOp>(std::move(build_in_col_names_), builder_num_workers_, builder_op_connector_size_,
-                                    builder_predicate_func_);
+                                    builder_predicate_func_, builder_native_predicate_);
   return Status::OK();
 }
 
 FilterOp::FilterOp(const std::vector<std::string> &in_col_names, int32_t num_workers, int32_t op_queue_size,
-                   py::function predicate_func)
-    : ParallelOp(num_workers, op_queue_size), predicate_func_(std::move(predicate_func)), in_columns_(in_col_names) {}
+                   py::function predicate_func, std::shared_ptr<FilterPredicate> native_predicate)
+    : ParallelOp(num_workers, op_queue_size),
+      predicate_func_(std::move(predicate_func)),
+      native_predicate_(std::move(native_predicate)),
+      gil_counter_(GilMonitor::GetInstance().GetCounter("FilterOp")),
+      in_columns_(in_col_names) {}
 
 Status FilterOp::operator()() {
   // The operator class just starts off threads by calling the tree_ function.
@@ -105,6 +109,9 @@ void FilterOp::Print(std::ostream &out, bool show_all) const {
     for (size_t i = 0; i < in_columns_.size(); i++) {
       out << " " << in_columns_[i];
     }
+    if (native_predicate_ != nullptr) {
+      out << "\nNative predicate: " << *native_predicate_;
+    }
     out << "\n\n";
   }
 }
@@ -157,22 +164,23 @@ Status FilterOp::WorkerEntry(int32_t worker_id) {
 Status FilterOp::WorkerCompute(DataBuffer *in_buffer, std::unique_ptr<TensorQTable> *out) {
   *out = std::make_unique<TensorQTable>();
   int32_t num_rows = in_buffer->NumRows();
+  TensorTable rows;
+  rows.reserve(num_rows);
   for (int32_t i = 0; i < num_rows; i++) {
-    TensorRow to_process;
     TensorRow cur_row;
     RETURN_IF_NOT_OK(in_buffer->PopRow(&cur_row));
-    if (in_columns_.empty() == true) {
-      MS_LOG(INFO) << "Input columns in filter operator is empty, will apply to the all column in the current table.";
-      to_process = cur_row;
-    } else {
-      (void)std::transform(
-        in_columns_.begin(), in_columns_.end(), std::back_inserter(to_process),
-        [&cur_row, this](const auto &it) -> std::shared_ptr<Tensor> { return cur_row[column_name_id_map_[it]]; });
-    }
-    bool predicate = true;
-    RETURN_IF_NOT_OK(InvokePredicateFunc(to_process, &predicate));
-    if (predicate) {
-      (*out)->push_back(std::move(cur_row));
+    rows.push_back(std::move(cur_row));
+  }
+  std::vector<uint8_t> selected;
+  if (native_predicate_ != nullptr) {
+    RETURN_IF_NOT_OK(native_predicate_->Evaluate(rows, column_name_id_map_, &selected));
+  } else {
+    RETURN_IF_NOT_OK(InvokePredicateFunc(rows, &selected));
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(selected.size() == rows.size(), "Filter predicate result size mismatch.");
+  for (size_t i = 0; i < rows.size(); i++) {
+    if (selected[i] != 0) {
+      (*out)->push_back(std::move(rows[i]));
     }
   }
   return Status::OK();
@@ -234,13 +242,34 @@ Status FilterOp::CheckInput(const TensorRow &input) const {
   return Status::OK();
 }
 
-Status FilterOp::InvokePredicateFunc(const TensorRow &input, bool *out_predicate) {
-  RETURN_IF_NOT_OK(CheckInput(input));
+Status FilterOp::InvokePredicateFunc(const TensorTable &table, std::vector<uint8_t> *selected) {
+  if (in_columns_.empty() == true) {
+    MS_LOG(INFO) << "Input columns in filter operator is empty, will apply to the all column in the current table.";
+  }
+  selected->assign(table.size(), 0);
   // Acquire Python GIL.
-  py::gil_scoped_acquire gil_acquire;
+  TimedGilAcquire gil_acquire(gil_counter_);
   if (Py_IsInitialized() == 0) {
     return Status(StatusCode::kPythonInterpreterFailure, "Python Interpreter is finalized");
   }
+  for (size_t i = 0; i < table.size(); i++) {
+    TensorRow to_process;
+    if (in_columns_.empty() == true) {
+      to_process = table[i];
+    } else {
+      (void)std::transform(
+        in_columns_.begin(), in_columns_.end(), std::back_inserter(to_process),
+        [&table, i, this](const auto &it) -> std::shared_ptr<Tensor> { return table[i][column_name_id_map_[it]]; });
+    }
+    bool predicate = true;
+    RETURN_IF_NOT_OK(InvokePredicateFunc(to_process, &predicate));
+    (*selected)[i] = predicate ? 1 : 0;
+  }
+  return Status::OK();
+}
+
+Status FilterOp::InvokePredicateFunc(const TensorRow &input, bool *out_predicate) {
+  RETURN_IF_NOT_OK(CheckInput(input));
   try {
     // Transform input tensor vector into numpy array vector.
     py::tuple input_args(input.size());
@@ -258,7 +287,7 @@ Status FilterOp::InvokePredicateFunc(const TensorRow &input, bool *out_predicate
     ss << "The type of the return value of python predicate function is not bool, or can not be convert to bool.";
     return Status(StatusCode::kPyFuncException, ss.str());
   }
-  return Status(StatusCode::kOK, "FilterOp predicate func call succeed");
+  return Status::OK();
 }
 
 // Visitor accept method for NodePass
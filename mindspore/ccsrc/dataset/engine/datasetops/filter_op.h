@@ -21,6 +21,8 @@
 #include <string>
 #include <utility>
 #include <vector>
+#include "dataset/core/python_gil.h"
+#include "dataset/engine/datasetops/filter_predicate.h"
 #include "dataset/engine/datasetops/parallel_op.h"
 #include "dataset/kernels/tensor_op.h"
 #include "dataset/util/queue.h"
@@ -51,6 +53,13 @@ class FilterOp : public ParallelOp {
       return *this;
     }
 
+    // Setter method.
+    // @return Builder setter method returns reference to the builder.
+    Builder &SetNativePredicate(std::shared_ptr<FilterPredicate> predicate) {
+      builder_native_predicate_ = std::move(predicate);
+      return *this;
+    }
+
     // Setter method.
     // @return Builder setter method returns reference to the builder.
     Builder &SetInColNames(const std::vector<std::string> &in_col_names) {
@@ -83,6 +92,7 @@ class FilterOp : public ParallelOp {
     Status SanityCheck();
     std::vector<std::string> build_in_col_names_;
     py::function builder_predicate_func_;
+    std::shared_ptr<FilterPredicate> builder_native_predicate_;
     int32_t builder_num_workers_;
     int32_t builder_op_connector_size_;
   };
@@ -96,8 +106,9 @@ class FilterOp : public ParallelOp {
   // @param num_workers The number of worker threads.
   // @param op_connector_size The size of each queue in the connector.
   // @param predicate_func python callable which returns a boolean value.
+  // @param native_predicate predicate evaluated in C++, used instead of predicate_func when not null.
   FilterOp(const std::vector<std::string> &in_col_names, int32_t num_workers, int32_t op_queue_size,
-           py::function predicate_func);
+           py::function predicate_func, std::shared_ptr<FilterPredicate> native_predicate = nullptr);
 
   // Destructor
   ~FilterOp() = default;
@@ -131,6 +142,12 @@ class FilterOp : public ParallelOp {
   // predicate_func python callable which returns a boolean value.
   py::function predicate_func_;
 
+  // Predicate evaluated in C++ over a whole buffer, null if the python predicate is used.
+  std::shared_ptr<FilterPredicate> native_predicate_;
+
+  // Time spent waiting for the GIL by the python predicate.
+  GilWaitCounter *gil_counter_;
+
   // Variable to store the column name that will feed to predicate function.
   std::vector<std::string> in_columns_;
 
@@ -145,8 +162,9 @@ class FilterOp : public ParallelOp {
   Status WorkerEntry(int32_t worker_id) override;  //  In: workerId assigned by tree_
 
   // Filter the data by  predicate function .
+  // The predicate is evaluated on all the rows of the buffer into a selection bitmap, then the selected rows are
+  // moved to the output in one pass.
   // @param in_buffer input data buffer.
-  // @param to_proess_indices Indices of columns to be processed.
   // @param out data buffer that are filtered by predicate.
   // @return Status The error code return.
   Status WorkerCompute(DataBuffer *in_buffer, std::unique_ptr<TensorQTable> *out);
@@ -159,7 +177,13 @@ class FilterOp : public ParallelOp {
   // @return Status - The error code return.
   Status CheckInput(const TensorRow &input) const;
 
-  // Invoke python func.
+  // Invoke python func on every row, taking the GIL once for the whole table.
+  // @param table rows of the buffer.
+  // @param selected the result of predicate, one flag per row.
+  // @return Status - The error code return.
+  Status InvokePredicateFunc(const TensorTable &table, std::vector<uint8_t> *selected);
+
+  // Invoke python func on one row, the GIL must be held.
   // @param input tensor vector.
   // @param the result of predicate.
   // @return Status - The error code return.
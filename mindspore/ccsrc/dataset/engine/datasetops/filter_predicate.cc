@@ -0,0 +1,322 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "dataset/engine/datasetops/filter_predicate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string_view>
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// Value of a numeric tensor with a single element. Integers are kept as int64 so that they compare exactly, uint64
+// values above the int64 range are kept as double.
+struct Scalar {
+  bool is_integer = false;
+  int64_t integer = 0;
+  double real = 0;
+};
+
+template <typename T>
+void ReadInteger(const uchar *data, Scalar *out) {
+  out->is_integer = true;
+  out->integer = static_cast<int64_t>(*reinterpret_cast<const T *>(data));
+}
+
+template <typename T>
+void ReadReal(const uchar *data, Scalar *out) {
+  out->is_integer = false;
+  out->real = static_cast<double>(*reinterpret_cast<const T *>(data));
+}
+
+Status GetScalar(const std::shared_ptr<Tensor> &tensor, Scalar *out) {
+  CHECK_FAIL_RETURN_UNEXPECTED(tensor->Size() == 1,
+                               "Filter predicate expects a single value, got shape:" + tensor->shape().ToString());
+  const uchar *data = tensor->GetBuffer();
+  RETURN_UNEXPECTED_IF_NULL(data);
+  switch (tensor->type().value()) {
+    case DataType::DE_BOOL:
+      ReadInteger<bool>(data, out);
+      break;
+    case DataType::DE_INT8:
+      ReadInteger<int8_t>(data, out);
+      break;
+    case DataType::DE_UINT8:
+      ReadInteger<uint8_t>(data, out);
+      break;
+    case DataType::DE_INT16:
+      ReadInteger<int16_t>(data, out);
+      break;
+    case DataType::DE_UINT16:
+      ReadInteger<uint16_t>(data, out);
+      break;
+    case DataType::DE_INT32:
+      ReadInteger<int32_t>(data, out);
+      break;
+    case DataType::DE_UINT32:
+      ReadInteger<uint32_t>(data, out);
+      break;
+    case DataType::DE_INT64:
+      ReadInteger<int64_t>(data, out);
+      break;
+    case DataType::DE_UINT64:
+      if (*reinterpret_cast<const uint64_t *>(data) > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+        ReadReal<uint64_t>(data, out);
+      } else {
+        ReadInteger<uint64_t>(data, out);
+      }
+      break;
+    case DataType::DE_FLOAT16:
+      out->is_integer = false;
+      out->real = static_cast<double>(static_cast<float>(*reinterpret_cast<const float16 *>(data)));
+      break;
+    case DataType::DE_FLOAT32:
+      ReadReal<float>(data, out);
+      break;
+    case DataType::DE_FLOAT64:
+      ReadReal<double>(data, out);
+      break;
+    default:
+      RETURN_STATUS_UNEXPECTED("Filter predicate expects a numeric value, got type:" + tensor->type().ToString());
+  }
+  return Status::OK();
+}
+
+// Sign of real - integer, exact for any magnitude. real must not be NaN.
+int CompareRealInteger(double real, int64_t integer) {
+  constexpr double kTwoPow63 = 9223372036854775808.0;
+  if (real >= kTwoPow63) {
+    return 1;
+  }
+  if (real < -kTwoPow63) {
+    return -1;
+  }
+  // real is in [-2^63, 2^63), so its floor fits in int64
+  double floor_real = std::floor(real);
+  int64_t floor_integer = static_cast<int64_t>(floor_real);
+  if (floor_integer != integer) {
+    return floor_integer < integer ? -1 : 1;
+  }
+  return real > floor_real ? 1 : 0;
+}
+
+bool InRange(const Scalar &value, bool integer_bounds, int64_t min_integer, int64_t max_integer, double min_value,
+             double max_value) {
+  if (integer_bounds) {
+    if (value.is_integer) {
+      return value.integer >= min_integer && value.integer <= max_integer;
+    }
+    return !std::isnan(value.real) && CompareRealInteger(value.real, min_integer) >= 0 &&
+           CompareRealInteger(value.real, max_integer) <= 0;
+  }
+  if (value.is_integer) {
+    return CompareRealInteger(min_value, value.integer) <= 0 && CompareRealInteger(max_value, value.integer) >= 0;
+  }
+  return value.real >= min_value && value.real <= max_value;
+}
+
+bool IsIn(const Scalar &value, const std::vector<int64_t> &integer_values, const std::vector<double> &values,
+          bool integer_values_used) {
+  if (integer_values_used) {
+    if (value.is_integer) {
+      return std::binary_search(integer_values.begin(), integer_values.end(), value.integer);
+    }
+    if (std::isnan(value.real)) {
+      return false;
+    }
+    auto itr = std::lower_bound(integer_values.begin(), integer_values.end(), value.real,
+                                [](int64_t lhs, double rhs) { return CompareRealInteger(rhs, lhs) > 0; });
+    return itr != integer_values.end() && CompareRealInteger(value.real, *itr) == 0;
+  }
+  if (value.is_integer) {
+    auto itr = std::lower_bound(values.begin(), values.end(), value.integer,
+                                [](double lhs, int64_t rhs) { return CompareRealInteger(lhs, rhs) < 0; });
+    return itr != values.end() && CompareRealInteger(*itr, value.integer) == 0;
+  }
+  return std::binary_search(values.begin(), values.end(), value.real);
+}
+}  // namespace
+
+Status FilterPredicate::AddLengthRange(const std::string &column, int64_t min_len, int64_t max_len) {
+  CHECK_FAIL_RETURN_UNEXPECTED(min_len <= max_len, "Invalid length range for column:" + column);
+  Clause clause;
+  clause.type = ClauseType::kLengthRange;
+  clause.column = column;
+  clause.integer = true;
+  clause.min_integer = min_len;
+  clause.max_integer = max_len;
+  clauses_.push_back(std::move(clause));
+  return Status::OK();
+}
+
+Status FilterPredicate::AddValueRange(const std::string &column, double min_value, double max_value) {
+  CHECK_FAIL_RETURN_UNEXPECTED(!std::isnan(min_value) && !std::isnan(max_value) && min_value <= max_value,
+                               "Invalid value range for column:" + column);
+  Clause clause;
+  clause.type = ClauseType::kValueRange;
+  clause.column = column;
+  clause.min_value = min_value;
+  clause.max_value = max_value;
+  clauses_.push_back(std::move(clause));
+  return Status::OK();
+}
+
+Status FilterPredicate::AddIntegerRange(const std::string &column, int64_t min_value, int64_t max_value) {
+  CHECK_FAIL_RETURN_UNEXPECTED(min_value <= max_value, "Invalid value range for column:" + column);
+  Clause clause;
+  clause.type = ClauseType::kValueRange;
+  clause.column = column;
+  clause.integer = true;
+  clause.min_integer = min_value;
+  clause.max_integer = max_value;
+  clauses_.push_back(std::move(clause));
+  return Status::OK();
+}
+
+Status FilterPredicate::AddValueIn(const std::string &column, const std::vector<double> &values) {
+  bool has_nan = std::any_of(values.begin(), values.end(), [](double value) { return std::isnan(value); });
+  CHECK_FAIL_RETURN_UNEXPECTED(!has_nan, "Invalid NaN value for column:" + column);
+  Clause clause;
+  clause.type = ClauseType::kValueIn;
+  clause.column = column;
+  clause.values = values;
+  std::sort(clause.values.begin(), clause.values.end());
+  clauses_.push_back(std::move(clause));
+  return Status::OK();
+}
+
+Status FilterPredicate::AddIntegerIn(const std::string &column, const std::vector<int64_t> &values) {
+  Clause clause;
+  clause.type = ClauseType::kValueIn;
+  clause.column = column;
+  clause.integer = true;
+  clause.integer_values = values;
+  std::sort(clause.integer_values.begin(), clause.integer_values.end());
+  clauses_.push_back(std::move(clause));
+  return Status::OK();
+}
+
+Status FilterPredicate::AddStringIn(const std::string &column, const std::vector<std::string> &values) {
+  Clause clause;
+  clause.type = ClauseType::kStringIn;
+  clause.column = column;
+  clause.string_values = values;
+  std::sort(clause.string_values.begin(), clause.string_values.end());
+  clauses_.push_back(std::move(clause));
+  return Status::OK();
+}
+
+Status FilterPredicate::Evaluate(const TensorTable &table,
+                                 const std::unordered_map<std::string, int32_t> &column_name_id_map,
+                                 std::vector<uint8_t> *selected) const {
+  RETURN_UNEXPECTED_IF_NULL(selected);
+  selected->assign(table.size(), 1);
+  for (const auto &clause : clauses_) {
+    auto itr = column_name_id_map.find(clause.column);
+    if (itr == column_name_id_map.end()) {
+      RETURN_STATUS_UNEXPECTED("Filter predicate column: " + clause.column + " doesn't exist in the dataset columns.");
+    }
+    RETURN_IF_NOT_OK(EvaluateClause(clause, table, itr->second, selected));
+  }
+  return Status::OK();
+}
+
+Status FilterPredicate::EvaluateClause(const Clause &clause, const TensorTable &table, int32_t col_id,
+                                       std::vector<uint8_t> *selected) {
+  // An empty set of values keeps no row, whatever the type of the column
+  if ((clause.type == ClauseType::kValueIn && clause.integer_values.empty() && clause.values.empty()) ||
+      (clause.type == ClauseType::kStringIn && clause.string_values.empty())) {
+    selected->assign(selected->size(), 0);
+    return Status::OK();
+  }
+  for (size_t i = 0; i < table.size(); ++i) {
+    if ((*selected)[i] == 0) {
+      continue;
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(col_id >= 0 && static_cast<size_t>(col_id) < table[i].size(),
+                                 "Invalid column index in filter predicate");
+    const std::shared_ptr<Tensor> &tensor = table[i][col_id];
+    RETURN_UNEXPECTED_IF_NULL(tensor);
+    bool keep = false;
+    switch (clause.type) {
+      case ClauseType::kLengthRange: {
+        int64_t length = static_cast<int64_t>(tensor->Size());
+        if (tensor->type() == DataType::DE_STRING && tensor->Rank() == 0) {
+          std::string_view value;
+          RETURN_IF_NOT_OK(tensor->GetItemAt(&value, {}));
+          length = static_cast<int64_t>(value.size());
+        }
+        keep = length >= clause.min_integer && length <= clause.max_integer;
+        break;
+      }
+      case ClauseType::kValueRange: {
+        Scalar value;
+        RETURN_IF_NOT_OK(GetScalar(tensor, &value));
+        keep = InRange(value, clause.integer, clause.min_integer, clause.max_integer, clause.min_value,
+                       clause.max_value);
+        break;
+      }
+      case ClauseType::kValueIn: {
+        Scalar value;
+        RETURN_IF_NOT_OK(GetScalar(tensor, &value));
+        keep = IsIn(value, clause.integer_values, clause.values, clause.integer);
+        break;
+      }
+      case ClauseType::kStringIn: {
+        CHECK_FAIL_RETURN_UNEXPECTED(tensor->type() == DataType::DE_STRING && tensor->Size() == 1,
+                                     "Filter predicate expects a single string in column:" + clause.column);
+        std::string_view value;
+        RETURN_IF_NOT_OK(tensor->GetItemAt(&value, std::vector<dsize_t>(tensor->Rank(), 0)));
+        auto itr = std::lower_bound(clause.string_values.begin(), clause.string_values.end(), value,
+                                    [](const std::string &lhs, std::string_view rhs) { return lhs < rhs; });
+        keep = itr != clause.string_values.end() && *itr == value;
+        break;
+      }
+    }
+    (*selected)[i] = keep ? 1 : 0;
+  }
+  return Status::OK();
+}
+
+void FilterPredicate::Print(std::ostream &out) const {
+  for (size_t i = 0; i < clauses_.size(); ++i) {
+    const Clause &clause = clauses_[i];
+    out << (i == 0 ? "" : " and ");
+    switch (clause.type) {
+      case ClauseType::kLengthRange:
+        out << clause.min_integer << " <= len(" << clause.column << ") <= " << clause.max_integer;
+        break;
+      case ClauseType::kValueRange:
+        if (clause.integer) {
+          out << clause.min_integer << " <= " << clause.column << " <= " << clause.max_integer;
+        } else {
+          out << clause.min_value << " <= " << clause.column << " <= " << clause.max_value;
+        }
+        break;
+      case ClauseType::kValueIn:
+        out << clause.column << " in " << (clause.integer ? clause.integer_values.size() : clause.values.size())
+            << " values";
+        break;
+      case ClauseType::kStringIn:
+        out << clause.column << " in " << clause.string_values.size() << " strings";
+        break;
+    }
+  }
+}
+}  // namespace dataset
+}  // namespace mindspore
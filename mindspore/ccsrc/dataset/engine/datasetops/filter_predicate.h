@@ -0,0 +1,127 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef DATASET_ENGINE_DATASETOPS_FILTER_PREDICATE_H_
+#define DATASET_ENGINE_DATASETOPS_FILTER_PREDICATE_H_
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dataset/core/tensor.h"
+#include "dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// A filter predicate evaluated in C++ without calling into Python. It is a conjunction of simple conditions on
+// single columns, a row is kept when all of them hold. Conditions are evaluated one after the other over a whole
+// table, each one only looks at the rows that all the previous ones kept.
+class FilterPredicate {
+ public:
+  FilterPredicate() = default;
+
+  ~FilterPredicate() = default;
+
+  // Keep rows whose column has a length in [min_len, max_len]. The length of a string scalar is its number of bytes,
+  // the length of any other tensor is its number of elements.
+  // @param std::string column - column name
+  // @param int64_t min_len - smallest length kept
+  // @param int64_t max_len - largest length kept
+  // @return Status - The error code return
+  Status AddLengthRange(const std::string &column, int64_t min_len, int64_t max_len);
+
+  // Keep rows whose column, a numeric tensor with one element, is in [min_value, max_value]
+  // @param std::string column - column name
+  // @param double min_value - smallest value kept
+  // @param double max_value - largest value kept
+  // @return Status - The error code return
+  Status AddValueRange(const std::string &column, double min_value, double max_value);
+
+  // Same as AddValueRange with integer bounds, which integer columns are compared to without going through double
+  // @param std::string column - column name
+  // @param int64_t min_value - smallest value kept
+  // @param int64_t max_value - largest value kept
+  // @return Status - The error code return
+  Status AddIntegerRange(const std::string &column, int64_t min_value, int64_t max_value);
+
+  // Keep rows whose column, a numeric tensor with one element, equals one of the values. Like AddIntegerIn and
+  // AddStringIn, an empty set of values keeps no row whatever the type of the column.
+  // @param std::string column - column name
+  // @param std::vector<double> values - values kept
+  // @return Status - The error code return
+  Status AddValueIn(const std::string &column, const std::vector<double> &values);
+
+  // Same as AddValueIn with integer values, which integer columns are compared to without going through double
+  // @param std::string column - column name
+  // @param std::vector<int64_t> values - values kept
+  // @return Status - The error code return
+  Status AddIntegerIn(const std::string &column, const std::vector<int64_t> &values);
+
+  // Keep rows whose column, a string tensor with one element, equals one of the values
+  // @param std::string column - column name
+  // @param std::vector<std::string> values - values kept
+  // @return Status - The error code return
+  Status AddStringIn(const std::string &column, const std::vector<std::string> &values);
+
+  // Evaluate the predicate on every row of a table
+  // @param TensorTable table - rows to evaluate
+  // @param std::unordered_map<std::string, int32_t> column_name_id_map - column name to index in a row
+  // @param std::vector<uint8_t> *selected - Returned one flag per row, non zero if the row is kept
+  // @return Status - The error code return
+  Status Evaluate(const TensorTable &table, const std::unordered_map<std::string, int32_t> &column_name_id_map,
+                  std::vector<uint8_t> *selected) const;
+
+  // @return bool - Returned true if the predicate has no condition and keeps every row
+  bool empty() const { return clauses_.empty(); }
+
+  void Print(std::ostream &out) const;
+
+  friend std::ostream &operator<<(std::ostream &out, const FilterPredicate &predicate) {
+    predicate.Print(out);
+    return out;
+  }
+
+ private:
+  enum class ClauseType { kLengthRange, kValueRange, kValueIn, kStringIn };
+
+  struct Clause {
+    ClauseType type;
+    std::string column;
+    bool integer = false;  // Bounds or values are the int64 ones, always for kLengthRange
+    int64_t min_integer = 0;
+    int64_t max_integer = 0;
+    double min_value = 0;
+    double max_value = 0;
+    std::vector<int64_t> integer_values;     // Sorted, for kValueIn of integers
+    std::vector<double> values;              // Sorted, for kValueIn
+    std::vector<std::string> string_values;  // Sorted, for kStringIn
+  };
+
+  // Clear the flags of the selected rows that fail one clause
+  // @param Clause clause - condition to check
+  // @param TensorTable table - rows to evaluate
+  // @param int32_t col_id - index of the column of the clause
+  // @param std::vector<uint8_t> *selected - In/Out: flags of the rows
+  // @return Status - The error code return
+  static Status EvaluateClause(const Clause &clause, const TensorTable &table, int32_t col_id,
+                               std::vector<uint8_t> *selected);
+
+  std::vector<Clause> clauses_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // DATASET_ENGINE_DATASETOPS_FILTER_PREDICATE_H_
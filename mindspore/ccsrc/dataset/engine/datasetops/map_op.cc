@@ -204,33 +204,45 @@ Status MapOp::WorkerCompute(DataBuffer *in_buffer, TensorQTable *new_tensor_tabl
   int32_t num_rows = in_buffer->NumRows();
   int32_t num_cols = in_buffer->NumCols();
 
+  // cur_rows     : The rows holding all the columns from DataBuffer.
+  // to_process   : The rows holding only the cols in input_columns.
+  // result_table : The rows holding the result after Compute().
+  std::vector<TensorRow> cur_rows(num_rows);
+  TensorTable to_process(num_rows), result_table;
   for (int32_t r = 0; r < num_rows; r++) {
-    // to_process   : A vector of Tensors only holding cols in input_columns.
-    // result_row;  : A vector of Tensors to hold the result after Compute().
-    // cur_row      : A vector of Tensors holding all the columns from DataBuffer.
-    TensorRow to_process, result_row, cur_row;
-    RETURN_IF_NOT_OK(in_buffer->PopRow(&cur_row));
+    RETURN_IF_NOT_OK(in_buffer->PopRow(&cur_rows[r]));
 
     // Populate the Tensor from the current row to be processed by TensorOp
     for (const auto &idx : to_process_indices_) {
-      to_process.push_back(std::move(cur_row[idx]));
+      to_process[r].push_back(std::move(cur_rows[r][idx]));
     }
+  }
 
-    // Looping over multiple TensorOps supplied in to MapOp.
-    // The assumption is that the result of one TensorOp matches the required input to the next TensorOp.
-    for (size_t i = 0; i < tfuncs_.size(); i++) {
-      // TensorOp can operate on single col or multiple cols. MapOp always call compute for multiple cols.
-      // TensorOp base class will call the single column Compute() depending on the ops.
-      // Note: The columns of the result_row is not preallocated, the compute function of each tensor op are
-      // required to resize/push back the result_row
-      RETURN_IF_NOT_OK(tfuncs_[i]->Compute(to_process, &result_row));
-
-      // Assign result_row to to_process for the next TensorOp processing, except for the last TensorOp in the list.
-      if (i + 1 < tfuncs_.size()) {
-        to_process = std::move(result_row);
-      }
+  // Looping over multiple TensorOps supplied in to MapOp.
+  // The assumption is that the result of one TensorOp matches the required input to the next TensorOp.
+  // Each TensorOp processes all rows of the buffer in one call, so that ops with a cost per call (e.g. taking the
+  // Python GIL) pay it once per buffer.
+  for (size_t i = 0; i < tfuncs_.size(); i++) {
+    // TensorOp can operate on single col or multiple cols. MapOp always call compute for multiple cols.
+    // TensorOp base class will call the single column Compute() depending on the ops.
+    // Note: The columns of the result rows are not preallocated, the compute function of each tensor op are
+    // required to resize/push back the result rows
+    result_table.clear();
+    RETURN_IF_NOT_OK(tfuncs_[i]->ComputeRows(to_process, &result_table));
+
+    // Assign result_table to to_process for the next TensorOp processing, except for the last TensorOp in the list.
+    if (i + 1 < tfuncs_.size()) {
+      to_process = std::move(result_table);
     }
+  }
+  if (result_table.size() != static_cast<size_t>(num_rows)) {
+    return Status(StatusCode::kUnexpectedError, __LINE__, __FILE__,
+                  "Result of a tensorOp doesn't match output column names");
+  }
 
+  for (int32_t r = 0; r < num_rows; r++) {
+    TensorRow &cur_row = cur_rows[r];
+    TensorRow &result_row = result_table[r];
     if (out_columns_.size() != result_row.size()) {
       return Status(StatusCode::kUnexpectedError, __LINE__, __FILE__,
                     "Result of a tensorOp doesn't match output column names");
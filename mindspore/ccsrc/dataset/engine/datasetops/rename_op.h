@@ -98,6 +98,12 @@ class RenameOp : public PipelineOp {
   // @param show_all if it should print everything
   void Print(std::ostream &out, bool show_all) const override;
 
+  // Base-class override for fast forward. Every row of the child gives one row, so the position is the child's.
+  // @return Status - The error code return
+  Status FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) override {
+    return child_[0]->FastForward(num_epochs, num_rows, out_epochs);
+  }
+
   // Provide stream operator for displaying it
   friend std::ostream &operator<<(std::ostream &out, const RenameOp &ro) {
     ro.Print(out, false);
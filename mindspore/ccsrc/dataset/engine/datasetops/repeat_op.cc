@@ -15,6 +15,7 @@
  */
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <utility>
 
 #include "dataset/engine/execution_tree.h"
@@ -155,6 +156,34 @@ Status RepeatOp::EoeReceived(int32_t worker_id) {
   return (DatasetOp::ResetSubtree());
 }
 
+Status RepeatOp::FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) {
+  int64_t child_epochs = 0;
+  RETURN_IF_NOT_OK(child_[0]->FastForward(num_epochs, num_rows, &child_epochs));
+  if (max_repeats_ == kInfiniteRepeat) {
+    *out_epochs = 0;
+    return Status::OK();
+  }
+  repeat_count_ = static_cast<int32_t>(child_epochs % max_repeats_);
+  *out_epochs = child_epochs / max_repeats_;
+  // Our parent repeat op, if any, fast forwards after us and flags us again if we are in its last repeat
+  FlagLastRepeat();
+  return Status::OK();
+}
+
+void RepeatOp::FlagLastRepeat() {
+  bool repeated = BitTest(op_ctrl_flags_, kDeOpRepeated);
+  bool last_repeat = BitTest(op_ctrl_flags_, kDeOpLastRepeat);
+  if (max_repeats_ != kInfiniteRepeat && repeat_count_ == (max_repeats_ - 1) && (!repeated || last_repeat)) {
+    for (auto &eoe_op : eoe_ops_) {
+      eoe_op->set_control_flag(kDeOpLastRepeat);
+      auto repeat_op = std::dynamic_pointer_cast<RepeatOp>(eoe_op);
+      if (repeat_op != nullptr) {
+        repeat_op->FlagLastRepeat();
+      }
+    }
+  }
+}
+
 // Class functor operator () override.
 // Most dataset ops operate by launching a thread (see ExecutionTree).
 // However, the RepeatOp is defined as a inlined operator, so it is invalid to launch the
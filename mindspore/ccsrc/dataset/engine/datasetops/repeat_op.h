@@ -110,6 +110,11 @@ class RepeatOp : public PipelineOp {
   // @param worker_id - The worker id
   Status EofReceived(int32_t worker_id) override;
 
+  // Base-class override for fast forward. The repeat count is set from the epochs done by the child, and the eoe
+  // ops are flagged if their current epoch is already the last one.
+  // @return Status - The error code return
+  Status FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) override;
+
   // Base-class override. Return the number of workers in the first parent.
   // @param workerId - The worker id
   int32_t num_consumers() const override;
@@ -129,6 +134,10 @@ class RepeatOp : public PipelineOp {
   virtual int32_t ConnectorCapacity() const { return child_[0]->ConnectorCapacity(); }
 
  private:
+  // Flag the eoe ops if their current epoch is the last one, and carry the flag down through the repeat ops
+  // that are already in their last repeat
+  void FlagLastRepeat();
+
   int32_t max_repeats_;                              // The number of repeats that the user requested
   int32_t repeat_count_;                             // A counter for the current number of executed repeats
   std::vector<std::shared_ptr<DatasetOp>> eoe_ops_;  // List of operators that can generate EOE underneath this repeat.
@@ -298,6 +298,7 @@ Status CelebAOp::AddIOBlock(std::unique_ptr<DataBuffer> *data_buffer) {
       RETURN_IF_NOT_OK(io_block_queues_[(buff_count++) % num_workers_]->Add(
         std::make_unique<IOBlock>(IOBlock(keys, IOBlock::kDeIoBlockNone))));
     }
+    RETURN_IF_NOT_OK(SyncPendingEoe(&wp_));
     if (!BitTest(op_ctrl_flags_, kDeOpRepeated) || BitTest(op_ctrl_flags_, kDeOpLastRepeat)) {
       RETURN_IF_NOT_OK(
         io_block_queues_[(buff_count++) % num_workers_]->Add(std::make_unique<IOBlock>(IOBlock::kDeIoBlockFlagEoe)));
@@ -311,8 +312,7 @@ Status CelebAOp::AddIOBlock(std::unique_ptr<DataBuffer> *data_buffer) {
     } else {  // not the last repeat. Acquire lock, sleeps master thread, wait for the wake-up from reset
       RETURN_IF_NOT_OK(
         io_block_queues_[(buff_count++) % num_workers_]->Add(std::make_unique<IOBlock>(IOBlock::kDeIoBlockFlagEoe)));
-      RETURN_IF_NOT_OK(wp_.Wait());  // Master thread goes to sleep after it has made all the IOBlocks
-      wp_.Clear();
+      RETURN_IF_NOT_OK(StartNextEpoch(&wp_, [this]() { return sampler_->Reset(); }));
       RETURN_IF_NOT_OK(sampler_->GetNextBuffer(data_buffer));
     }
   }
@@ -420,8 +420,13 @@ void CelebAOp::Print(std::ostream &out, bool show_all) const {
 
 // Reset Sampler and wakeup Master thread (functor)
 Status CelebAOp::Reset() {
-  RETURN_IF_NOT_OK(sampler_->Reset());
-  wp_.Set();  // wake up master thread after reset is done
+  // wake up master thread after reset is done
+  return AcknowledgeEoe(&wp_, [this]() { return sampler_->Reset(); });
+}
+
+Status CelebAOp::FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) {
+  RETURN_IF_NOT_OK(sampler_->SetStartPosition(num_epochs, num_rows));
+  *out_epochs = num_epochs;
   return Status::OK();
 }
 }  // namespace dataset
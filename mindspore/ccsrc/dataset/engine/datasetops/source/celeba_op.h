@@ -164,6 +164,13 @@ class CelebAOp : public ParallelOp, RandomAccessOp {
   // @param show_all
   void Print(std::ostream &out, bool show_all) const override;
 
+  // Base-class override, the sampler skips the ids before the position when it is initialized
+  // @param int64_t num_epochs - number of epochs already done
+  // @param int64_t num_rows - number of rows of the current epoch already done
+  // @param int64_t *out_epochs - Returned number of epochs already done
+  // @return Status - The error code return
+  Status FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) override;
+
   // Method in operator(), to fill IOBlockQueue
   // @param std::unique_ptr<DataBuffer> sampler_buffer - to fill IOBlockQueue
   // @return Status - The error code return
@@ -148,6 +148,13 @@ class CifarOp : public ParallelOp, public RandomAccessOp {
   // @param show_all
   void Print(std::ostream &out, bool show_all) const override;
 
+  // Base-class override, the sampler skips the ids before the position when it is initialized
+  // @param int64_t num_epochs - number of epochs already done
+  // @param int64_t num_rows - number of rows of the current epoch already done
+  // @param int64_t *out_epochs - Returned number of epochs already done
+  // @return Status - The error code return
+  Status FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) override;
+
   // Function to count the number of samples in the CIFAR dataset
   // @param dir path to the CIFAR directory
   // @param isCIFAR10 true if CIFAR10 and false if CIFAR100
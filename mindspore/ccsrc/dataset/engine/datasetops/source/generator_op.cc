@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "dataset/engine/datasetops/source/generator_op.h"
+#include <algorithm>
 #include <iomanip>
 #include "dataset/core/global_context.h"
 #include "dataset/engine/db_connector.h"
@@ -24,6 +25,12 @@
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// Rows pulled from the generator per acquisition of the GIL. Python ops downstream compete for the GIL, so a
+// generator that takes it for every row keeps them waiting.
+constexpr int32_t kGeneratorRowsPerGil = 64;
+}  // namespace
+
 GeneratorOp::Builder::Builder() {
   // Some arguments to the StorageOp constructor have a default argument that is taken
   // from the client config.
@@ -56,7 +63,11 @@ GeneratorOp::GeneratorOp(py::function generator_function, std::vector<std::strin
       column_types_(column_types),
       prefetch_size_(prefetch_size),
       buffer_size_(buffer_size),
-      buffer_id_(0) {}
+      buffer_id_(0),
+      gil_counter_(GilMonitor::GetInstance().GetCounter("GeneratorOp")) {
+  // Never hold more buffers than the connector does, so that the prefetch size still bounds the rows read ahead
+  buffers_per_gil_ = std::max(1, std::min(kGeneratorRowsPerGil / std::max(buffer_size_, 1), connector_size));
+}
 
 GeneratorOp::~GeneratorOp() { this->Dealloc(); }
 
@@ -160,7 +171,7 @@ Status GeneratorOp::FillBuffer(TensorQTable *tt) {
 //
 // while !eof:
 //      Try:
-//          Prepare one data buffer                                   GIL, Can throw
+//          Prepare up to buffers_per_gil_ data buffers               GIL, Can throw
 //      Catch:
 //          Fetch Python Exception                                    GIL
 //          Check if Exception is StopIteration (EOE)                 GIL
@@ -168,7 +179,7 @@ Status GeneratorOp::FillBuffer(TensorQTable *tt) {
 //          If not StopIteration:
 //              Return Status PyFuncException
 //
-//      Push data buffer to connector                                 Block
+//      Push data buffers to connector                                Block
 //
 //      if EOE
 //          Push EOE                                                  Block
@@ -191,20 +202,20 @@ Status GeneratorOp::operator()() {
   // Handshake with TaskManager to synchronize thread creation
   TaskManager::FindMe()->Post();
   RETURN_IF_NOT_OK(wp_.Register(tree_->AllTasks()));
-  std::unique_ptr<DataBuffer> fetched_buffer;
   bool eof = false;
   while (!eof) {
-    // Create new buffer each iteration
-    fetched_buffer = std::make_unique<DataBuffer>(buffer_id_++, DataBuffer::kDeBFlagNone);
-    std::unique_ptr<TensorQTable> fetched_table = std::make_unique<TensorQTable>();
+    std::vector<std::unique_ptr<TensorQTable>> fetched_tables;
     bool eoe = false;
     {
-      py::gil_scoped_acquire gil_acquire;
+      TimedGilAcquire gil_acquire(gil_counter_);
       if (Py_IsInitialized() == 0) {
         return Status(StatusCode::kPythonInterpreterFailure, "Python Interpreter is finalized");
       }
       try {
-        RETURN_IF_NOT_OK(FillBuffer(fetched_table.get()));
+        while (static_cast<int32_t>(fetched_tables.size()) < buffers_per_gil_) {
+          fetched_tables.push_back(std::make_unique<TensorQTable>());
+          RETURN_IF_NOT_OK(FillBuffer(fetched_tables.back().get()));
+        }
       } catch (py::error_already_set &e) {
         eoe = e.matches(PyExc_StopIteration);
         // Restore exception to python
@@ -215,15 +226,19 @@ Status GeneratorOp::operator()() {
         }
       }
     }
-    if (fetched_table->size() > 0) {
-      fetched_buffer->set_tensor_table(std::move(fetched_table));
-      RETURN_IF_NOT_OK(out_connector_->Add(0, std::move(fetched_buffer)));
+    for (auto &fetched_table : fetched_tables) {
+      if (fetched_table->size() > 0) {
+        auto fetched_buffer = std::make_unique<DataBuffer>(buffer_id_++, DataBuffer::kDeBFlagNone);
+        fetched_buffer->set_tensor_table(std::move(fetched_table));
+        RETURN_IF_NOT_OK(out_connector_->Add(0, std::move(fetched_buffer)));
+      }
     }
     if (eoe) {
       // Push out EOE upon StopIteration exception from generator
       MS_LOG(DEBUG) << "Generator operator sends out EOE.";
       std::unique_ptr<DataBuffer> eoe_buffer = std::make_unique<DataBuffer>(0, DataBuffer::kDeBFlagEOE);
       RETURN_IF_NOT_OK(out_connector_->Add(0, std::move(eoe_buffer)));
+      RETURN_IF_NOT_OK(SyncPendingEoe(&wp_));
       if (!BitTest(op_ctrl_flags_, kDeOpRepeated) || BitTest(op_ctrl_flags_, kDeOpLastRepeat)) {
         // If last repeat or not repeated, push out EOF and exit master loop
         MS_LOG(DEBUG) << "Generator operator sends out EOF.";
@@ -232,12 +247,10 @@ Status GeneratorOp::operator()() {
         MS_LOG(DEBUG) << "Generator operator main execution loop complete.";
         eof = true;
       } else {
-        // Waiting for repeatOp to start new epoch
+        // Waiting for repeatOp to start new epoch, unless the epochs are pipelined
         // If Reset() is called first by repeat op, this wait() will return right away.
         // If Reset() is not called yet, this wait() will block until reset.
-        RETURN_IF_NOT_OK(wp_.Wait());
-        // Clear the status of the wait post
-        wp_.Clear();
+        RETURN_IF_NOT_OK(StartNextEpoch(&wp_, [this]() { return this->Init(); }));
       }
     }
   }
@@ -245,10 +258,8 @@ Status GeneratorOp::operator()() {
 }
 
 Status GeneratorOp::Reset() {
-  // Reset Op state
-  RETURN_IF_NOT_OK(this->Init());
-  // Wake up master thread
-  wp_.Set();
+  // Reset Op state and wake up master thread
+  RETURN_IF_NOT_OK(AcknowledgeEoe(&wp_, [this]() { return this->Init(); }));
   return Status(StatusCode::kOK, "GeneratorOp Reset Succeed");
 }
 
@@ -23,6 +23,7 @@
 #include <utility>
 #include <vector>
 #include "dataset/core/data_type.h"
+#include "dataset/core/python_gil.h"
 #include "dataset/core/tensor.h"
 #include "dataset/engine/data_schema.h"
 #include "dataset/engine/datasetops/pipeline_op.h"
@@ -136,6 +137,8 @@ class GeneratorOp : public PipelineOp {
 
   py::object generator_;
   int32_t buffer_id_;
+  int32_t buffers_per_gil_;  // Number of buffers pulled from the generator per acquisition of the GIL
+  GilWaitCounter *gil_counter_;
 
   WaitPost wp_;
 
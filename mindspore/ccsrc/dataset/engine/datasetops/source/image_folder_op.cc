@@ -151,6 +151,7 @@ Status ImageFolderOp::operator()() {
       RETURN_IF_NOT_OK(
         io_block_queues_[(buf_cnt_++) % num_workers_]->Add(std::make_unique<IOBlock>(keys, IOBlock::kDeIoBlockNone)));
     }
+    RETURN_IF_NOT_OK(SyncPendingEoe(&wp_));
     if (!BitTest(op_ctrl_flags_, kDeOpRepeated) || BitTest(op_ctrl_flags_, kDeOpLastRepeat)) {
       std::unique_ptr<IOBlock> eoe_block = std::make_unique<IOBlock>(IOBlock::kDeIoBlockFlagEoe);
       std::unique_ptr<IOBlock> eof_block = std::make_unique<IOBlock>(IOBlock::kDeIoBlockFlagEof);
@@ -164,8 +165,10 @@ Status ImageFolderOp::operator()() {
     } else {  // not the last repeat. Sleep master thread, wait for the wake-up from reset
       RETURN_IF_NOT_OK(
         io_block_queues_[(buf_cnt_++) % num_workers_]->Add(std::make_unique<IOBlock>(IOBlock::kDeIoBlockFlagEoe)));
-      RETURN_IF_NOT_OK(wp_.Wait());  // Master thread goes to sleep after it has made all the IOBlocks
-      wp_.Clear();
+      RETURN_IF_NOT_OK(StartNextEpoch(&wp_, [this]() {
+        row_cnt_ = 0;
+        return sampler_->Reset();
+      }));
       RETURN_IF_NOT_OK(sampler_->GetNextBuffer(&sampler_buffer));
     }
   }
@@ -257,9 +260,16 @@ void ImageFolderOp::Print(std::ostream &out, bool show_all) const {
 
 // Reset Sampler and wakeup Master thread (functor)
 Status ImageFolderOp::Reset() {
-  RETURN_IF_NOT_OK(sampler_->Reset());
-  row_cnt_ = 0;
-  wp_.Set();  // wake up master thread after reset is done
+  // wake up master thread after reset is done
+  return AcknowledgeEoe(&wp_, [this]() {
+    row_cnt_ = 0;
+    return sampler_->Reset();
+  });
+}
+
+Status ImageFolderOp::FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) {
+  RETURN_IF_NOT_OK(sampler_->SetStartPosition(num_epochs, num_rows));
+  *out_epochs = num_epochs;
   return Status::OK();
 }
 
@@ -198,6 +198,13 @@ class ImageFolderOp : public ParallelOp, public RandomAccessOp {
   // @param show_all
   void Print(std::ostream &out, bool show_all) const override;
 
+  // Base-class override, the sampler skips the ids before the position when it is initialized
+  // @param int64_t num_epochs - number of epochs already done
+  // @param int64_t num_rows - number of rows of the current epoch already done
+  // @param int64_t *out_epochs - Returned number of epochs already done
+  // @return Status - The error code return
+  Status FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) override;
+
   // This function is a hack! It is to return the num_class and num_rows the old storageOp does. The result
   // returned by this function may not be consistent with what image_folder_op is going to return
   // user this at your own risk!
@@ -165,6 +165,13 @@ class ManifestOp : public ParallelOp, public RandomAccessOp {
   // @param show_all
   void Print(std::ostream &out, bool show_all) const override;
 
+  // Base-class override, the sampler skips the ids before the position when it is initialized
+  // @param int64_t num_epochs - number of epochs already done
+  // @param int64_t num_rows - number of rows of the current epoch already done
+  // @param int64_t *out_epochs - Returned number of epochs already done
+  // @return Status - The error code return
+  Status FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) override;
+
   static Status CountTotalRows(const std::string &file, const py::dict &dict, const std::string &usage, int64_t *count,
                                int64_t *numClasses);
 
@@ -146,6 +146,13 @@ class MnistOp : public ParallelOp, public RandomAccessOp {
   // @param show_all
   void Print(std::ostream &out, bool show_all) const override;
 
+  // Base-class override, the sampler skips the ids before the position when it is initialized
+  // @param int64_t num_epochs - number of epochs already done
+  // @param int64_t num_rows - number of rows of the current epoch already done
+  // @param int64_t *out_epochs - Returned number of epochs already done
+  // @return Status - The error code return
+  Status FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) override;
+
   // Function to count the number of samples in the MNIST dataset
   // @param dir path to the MNIST directory
   // @param count output arg that will hold the minimum of the actual dataset size and numSamples
@@ -67,7 +67,7 @@ Status DistributedSampler::GetNextBuffer(std::unique_ptr<DataBuffer> *out_buffer
 
     (*out_buffer) = std::make_unique<DataBuffer>(cnt_, DataBuffer::kDeBFlagNone);
     std::shared_ptr<Tensor> sample_ids;
-    RETURN_IF_NOT_OK(CreateSamplerTensor(&sample_ids, samples_per_buffer_));
+    RETURN_IF_NOT_OK(CreateSamplerTensor(&sample_ids, samples_per_buffer_ - cnt_));
     int64_t *id_ptr = reinterpret_cast<int64_t *>(sample_ids->GetMutableBuffer());
     while (cnt_ < samples_per_buffer_) {
       int64_t sampled_id = (num_devices_ * cnt_ + device_id_) % num_rows_;
@@ -106,6 +106,14 @@ Status DistributedSampler::Reset() {
   return Status::OK();
 }
 
+Status DistributedSampler::SkipSamples(int64_t num_samples) {
+  CHECK_FAIL_RETURN_UNEXPECTED(!HasChildSampler(), "Cannot skip ids of a sampler with a child sampler");
+  CHECK_FAIL_RETURN_UNEXPECTED(cnt_ + num_samples < samples_per_buffer_,
+                               "Sampler start position is past the end of the epoch");
+  cnt_ += num_samples;
+  return Status::OK();
+}
+
 void DistributedSampler::Print(std::ostream &out, bool show_all) const {
   out << "(sampler): DistributedSampler\n";
   if (show_all) {
@@ -51,6 +51,12 @@ class DistributedSampler : public Sampler {
 
   void Print(std::ostream &out, bool show_all) const override;
 
+ protected:
+  // The ids of the shard are computed from their rank, skipping them only moves the counter
+  // @param int64_t num_samples - number of ids to skip
+  // @return - The error code return
+  Status SkipSamples(int64_t num_samples) override;
+
  private:
   int64_t cnt_;  // number of samples that have already been filled in to buffer
   uint32_t seed_;
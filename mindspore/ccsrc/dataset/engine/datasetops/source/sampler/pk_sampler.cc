@@ -110,7 +110,7 @@ Status PKSampler::HandshakeRandomAccessOp(const RandomAccessOp *op) {
   RETURN_UNEXPECTED_IF_NULL(op);
   RETURN_IF_NOT_OK(op->GetClassIds(&label_to_ids_));
   RETURN_IF_NOT_OK(InitSampler());
-  return Status::OK();
+  return MoveToStartPosition();
 }
 
 }  // namespace dataset
@@ -37,7 +37,9 @@ Sampler::Sampler(int64_t num_samples, int64_t samples_per_buffer)
       num_rows_(0),
       num_samples_(num_samples),
       samples_per_buffer_(samples_per_buffer),
-      col_desc_(nullptr) {}
+      col_desc_(nullptr),
+      start_epochs_(0),
+      start_rows_(0) {}
 
 Status Sampler::HandshakeRandomAccessOp(const RandomAccessOp *op) {
   std::shared_ptr<Sampler> child_sampler;
@@ -65,6 +67,47 @@ Status Sampler::HandshakeRandomAccessOp(const RandomAccessOp *op) {
   // Because some sampler only needs one of the arg (weighted_random_sampler)
   RETURN_IF_NOT_OK(InitSampler());  // init sampler after callback
 
+  return MoveToStartPosition();
+}
+
+Status Sampler::SetStartPosition(int64_t num_epochs, int64_t num_rows) {
+  CHECK_FAIL_RETURN_UNEXPECTED(num_epochs >= 0 && num_rows >= 0, "Invalid sampler start position");
+  start_epochs_ = num_epochs;
+  start_rows_ = num_rows;
+  return Status::OK();
+}
+
+Status Sampler::MoveToStartPosition() {
+  std::unique_ptr<DataBuffer> db;
+  // Skipped epochs only cost the drawing of their ids, which keeps the seeds and rngs where they would be
+  for (int64_t i = 0; i < start_epochs_; i++) {
+    do {
+      RETURN_IF_NOT_OK(GetNextBuffer(&db));
+    } while (!db->eoe());
+    RETURN_IF_NOT_OK(Reset());
+  }
+  if (start_rows_ > 0) {
+    RETURN_IF_NOT_OK(SkipSamples(start_rows_));
+  }
+  start_epochs_ = 0;
+  start_rows_ = 0;
+  return Status::OK();
+}
+
+Status Sampler::SkipSamples(int64_t num_samples) {
+  CHECK_FAIL_RETURN_UNEXPECTED(!HasChildSampler(), "Cannot skip ids of a sampler with a child sampler");
+  // Samplers cut their buffers at samples_per_buffer_ ids, so one buffer of that size holds exactly the skipped ids
+  int64_t samples_per_buffer = samples_per_buffer_;
+  samples_per_buffer_ = num_samples;
+  std::unique_ptr<DataBuffer> db;
+  Status rc = GetNextBuffer(&db);
+  samples_per_buffer_ = samples_per_buffer;
+  RETURN_IF_NOT_OK(rc);
+  CHECK_FAIL_RETURN_UNEXPECTED(!db->eoe(), "Sampler start position is past the end of the epoch");
+  std::shared_ptr<Tensor> sample_ids;
+  RETURN_IF_NOT_OK(db->GetTensor(&sample_ids, 0, 0));
+  CHECK_FAIL_RETURN_UNEXPECTED(static_cast<int64_t>(sample_ids->Size()) == num_samples,
+                               "Sampler cannot skip " + std::to_string(num_samples) + " ids");
   return Status::OK();
 }
 
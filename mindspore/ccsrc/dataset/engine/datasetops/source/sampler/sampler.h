@@ -88,6 +88,13 @@ class Sampler : public DatasetOp {
   // initialize sampler and perform checks on certain vars
   virtual Status InitSampler() { return Status::OK(); }
 
+  // Set a later position to start from, the first ids returned are the ones that would have been returned after
+  // some epochs and rows. The skipped ids are drawn when the sampler is initialized, no data is read for them.
+  // @param int64_t num_epochs - number of epochs to skip
+  // @param int64_t num_rows - number of ids to skip in the epoch after them
+  // @return - The error code return
+  Status SetStartPosition(int64_t num_epochs, int64_t num_rows);
+
   // setter for num samples
   // @param num_samples - the number of samples to assign.
   // @return status error code
@@ -144,6 +151,15 @@ class Sampler : public DatasetOp {
   Status GetAssociatedChildId(int64_t *out_associated_id, int64_t id);
 
  protected:
+  // Skip ids of the current epoch as if they had been returned. The default draws them all in one buffer.
+  // @param int64_t num_samples - number of ids to skip
+  // @return - The error code return
+  virtual Status SkipSamples(int64_t num_samples);
+
+  // Move to the position set by SetStartPosition, called once the sampler is initialized
+  // @return - The error code return
+  Status MoveToStartPosition();
+
   // Number of rows of data from the place this sampler is sampling from. If this sampler
   // has a child sampler, num_rows_ is the number of ids the child sampler will
   // output. Otherwise, num_rows_ is the number of rows in the dataset.
@@ -157,6 +173,8 @@ class Sampler : public DatasetOp {
   int64_t samples_per_buffer_;
   std::unique_ptr<ColDescriptor> col_desc_;
   std::unique_ptr<DataBuffer> child_ids_;
+  int64_t start_epochs_;  // Epochs to skip at initialization
+  int64_t start_rows_;    // Ids to skip at initialization, after start_epochs_
 };
 }  // namespace dataset
 }  // namespace mindspore
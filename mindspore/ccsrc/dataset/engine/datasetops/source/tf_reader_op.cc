@@ -260,6 +260,7 @@ Status TFReaderOp::operator()() {
   TaskManager::FindMe()->Post();
 
   RETURN_IF_NOT_OK(io_block_queue_wait_post_.Register(tree_->AllTasks()));
+  RETURN_IF_NOT_OK(epoch_sync_wait_post_.Register(tree_->AllTasks()));
 
   NotifyToFillIOBlockQueue();
   while (!finished_reading_dataset_) {
@@ -317,12 +318,14 @@ Status TFReaderOp::operator()() {
     std::unique_ptr<DataBuffer> eoe_buffer = std::make_unique<DataBuffer>(0, DataBuffer::kDeBFlagEOE);
     RETURN_IF_NOT_OK(out_connector_->Add(0, std::move(eoe_buffer)));
 
+    RETURN_IF_NOT_OK(SyncPendingEoe(&epoch_sync_wait_post_));
     if (!BitTest(op_ctrl_flags_, kDeOpRepeated) || BitTest(op_ctrl_flags_, kDeOpLastRepeat)) {
       finished_reading_dataset_ = true;
       NotifyToFillIOBlockQueue();
     } else {
       jagged_buffer_connector_->DoReset();
       buffer_id = 0;
+      RETURN_IF_NOT_OK(StartNextEpoch(&epoch_sync_wait_post_, std::bind(&TFReaderOp::ResetEpoch, this)));
     }
   }
 
@@ -711,6 +714,10 @@ Status TFReaderOp::LoadFeature(const std::unique_ptr<TensorQTable> *tensor_table
 // Overrides base class reset method. Cleans up any state info from it's previous execution and
 // reinitializes itself so that it can be executed again, as if it was just created.
 Status TFReaderOp::Reset() {
+  return AcknowledgeEoe(&epoch_sync_wait_post_, std::bind(&TFReaderOp::ResetEpoch, this));
+}
+
+Status TFReaderOp::ResetEpoch() {
   // start workers first, otherwise IOBlokcs will fall through if workers see it before this is set to true
   load_jagged_connector_ = true;
 
@@ -251,6 +251,10 @@ class TFReaderOp : public ParallelOp {
   // Notifies the thread which called WaitToFillIOBlockQueue to resume execution.
   void NotifyToFillIOBlockQueue();
 
+  // Lets the workers and the IOBlockQueue thread start reading the next epoch.
+  // @return Status - the error code returned.
+  Status ResetEpoch();
+
   // Pops an element from a queue in IOBlockQueue.
   // @param index - the index of the queue to pop from.
   // @param out_block - the popped element.
@@ -385,6 +389,7 @@ class TFReaderOp : public ParallelOp {
   std::unique_ptr<JaggedConnector> jagged_buffer_connector_;
   QueueList<std::unique_ptr<FilenameBlock>> io_block_queues_;
   WaitPost io_block_queue_wait_post_;
+  WaitPost epoch_sync_wait_post_;
   std::mutex load_io_block_queue_mutex_;
   std::map<std::string, int64_t> filename_numrows_;
   int64_t num_rows_;
@@ -140,6 +140,7 @@ Status VOCOp::operator()() {
       RETURN_IF_NOT_OK(io_block_queues_[(buf_cnt_++) % num_workers_]->Add(
         std::make_unique<IOBlock>(IOBlock(keys, IOBlock::kDeIoBlockNone))));
     }
+    RETURN_IF_NOT_OK(SyncPendingEoe(&wp_));
     if (!BitTest(op_ctrl_flags_, kDeOpRepeated) || BitTest(op_ctrl_flags_, kDeOpLastRepeat)) {
       std::unique_ptr<IOBlock> eoe_block = std::make_unique<IOBlock>(IOBlock::kDeIoBlockFlagEoe);
       std::unique_ptr<IOBlock> eof_block = std::make_unique<IOBlock>(IOBlock::kDeIoBlockFlagEof);
@@ -153,8 +154,10 @@ Status VOCOp::operator()() {
     } else {
       RETURN_IF_NOT_OK(
         io_block_queues_[(buf_cnt_++) % num_workers_]->Add(std::make_unique<IOBlock>(IOBlock::kDeIoBlockFlagEoe)));
-      RETURN_IF_NOT_OK(wp_.Wait());
-      wp_.Clear();
+      RETURN_IF_NOT_OK(StartNextEpoch(&wp_, [this]() {
+        row_cnt_ = 0;
+        return sampler_->Reset();
+      }));
       RETURN_IF_NOT_OK(sampler_->GetNextBuffer(&sampler_buffer));
     }
   }
@@ -177,9 +180,16 @@ void VOCOp::Print(std::ostream &out, bool show_all) const {
 }
 
 Status VOCOp::Reset() {
-  RETURN_IF_NOT_OK(sampler_->Reset());
-  row_cnt_ = 0;
-  wp_.Set();
+  // wake up master thread after reset is done
+  return AcknowledgeEoe(&wp_, [this]() {
+    row_cnt_ = 0;
+    return sampler_->Reset();
+  });
+}
+
+Status VOCOp::FastForward(int64_t num_epochs, int64_t num_rows, int64_t *out_epochs) {
+  RETURN_IF_NOT_OK(sampler_->SetStartPosition(num_epochs, num_rows));
+  *out_epochs = num_epochs;
   return Status::OK();
 }
 
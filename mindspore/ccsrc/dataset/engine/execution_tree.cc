@@ -154,6 +154,20 @@ ExecutionTree::Iterator::Iterator(const std::shared_ptr<DatasetOp> &root) : ind_
   nodes_.emplace_back(nullptr);
 }
 
+Status ExecutionTree::FastForward(int64_t num_epochs, int64_t num_rows) {
+  if (tree_state_ != kDeTStateReady) {
+    std::string err_msg =
+      "Invalid tree state for fast forward. Current state: " + std::to_string(static_cast<int>(tree_state_)) +
+      " Expected state: " + std::to_string(static_cast<int>(kDeTStateReady));
+    RETURN_STATUS_UNEXPECTED(err_msg);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(num_epochs >= 0 && num_rows >= 0, "Invalid fast forward position");
+  int64_t root_epochs = 0;
+  RETURN_IF_NOT_OK(root_->FastForward(num_epochs, num_rows, &root_epochs));
+  MS_LOG(INFO) << "Tree fast forwarded to epoch " << num_epochs << ", row " << num_rows << ".";
+  return Status::OK();
+}
+
 // Given the number of workers, launches the worker entry function for each. Essentially a
 // wrapper for the TaskGroup handling that is stored inside the execution tree.
 Status ExecutionTree::LaunchWorkers(int32_t num_workers, std::function<Status(uint32_t)> func) {
@@ -113,6 +113,13 @@ class ExecutionTree {
   // @return Status - The error code return
   Status Launch();
 
+  // Move the tree to a position of its leaf ops, so that it starts from there when launched instead of from the
+  // first row. Skipped rows are not read. Must be called between Prepare() and Launch().
+  // @param num_epochs - number of epochs the leaf ops have already done
+  // @param num_rows - number of rows of their current epoch the leaf ops have already done
+  // @return Status - The error code return
+  Status FastForward(int64_t num_epochs, int64_t num_rows);
+
   // A print method typically used for debugging
   // @param out - The output stream to write output to
   void Print(std::ostream &out) const;
@@ -0,0 +1,199 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "dataset/engine/gnn/csr_adjacency.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+
+Status CsrAdjacency::Build(NodeIndexType num_nodes, std::vector<std::pair<NodeIndexType, NodeIndexType>> *edges,
+                          std::vector<EdgeWeightType> *weights) {
+  CHECK_FAIL_RETURN_UNEXPECTED(num_nodes >= 0, "Invalid number of nodes:" + std::to_string(num_nodes));
+  CHECK_FAIL_RETURN_UNEXPECTED(edges != nullptr, "Input edges is null");
+  CHECK_FAIL_RETURN_UNEXPECTED(weights == nullptr || weights->size() == edges->size(),
+                               "The size of weights and edges must be equal");
+  offsets_data_.assign(static_cast<size_t>(num_nodes) + 1, 0);
+  for (const auto &edge : *edges) {
+    if (edge.first < 0 || edge.first >= num_nodes || edge.second < 0 || edge.second >= num_nodes) {
+      std::string err_msg =
+        "Invalid edge node index:(" + std::to_string(edge.first) + "," + std::to_string(edge.second) + ")";
+      RETURN_STATUS_UNEXPECTED(err_msg);
+    }
+    offsets_data_[edge.first + 1]++;
+  }
+  for (size_t i = 1; i < offsets_data_.size(); ++i) {
+    offsets_data_[i] += offsets_data_[i - 1];
+  }
+  weighted_ = false;
+  if (weights != nullptr) {
+    for (EdgeWeightType weight : *weights) {
+      CHECK_FAIL_RETURN_UNEXPECTED(weight >= 0 && std::isfinite(weight),
+                                   "Invalid edge weight:" + std::to_string(weight));
+      weighted_ = weighted_ || weight != weights->front();
+    }
+  }
+
+  // counting sort by source index, then order each row so that membership is a binary search
+  std::vector<std::pair<NodeIndexType, EdgeWeightType>> entries(edges->size());
+  std::vector<int64_t> cursor(offsets_data_.begin(), offsets_data_.end() - 1);
+  for (size_t i = 0; i < edges->size(); ++i) {
+    const auto &edge = (*edges)[i];
+    entries[cursor[edge.first]++] = {edge.second, weighted_ ? (*weights)[i] : kDefaultEdgeWeight};
+  }
+  std::vector<std::pair<NodeIndexType, NodeIndexType>>().swap(*edges);
+  if (weights != nullptr) {
+    std::vector<EdgeWeightType>().swap(*weights);
+  }
+  for (NodeIndexType i = 0; i < num_nodes; ++i) {
+    std::sort(entries.begin() + offsets_data_[i], entries.begin() + offsets_data_[i + 1]);
+  }
+  neighbors_data_.resize(entries.size());
+  std::transform(entries.begin(), entries.end(), neighbors_data_.begin(),
+                 [](const std::pair<NodeIndexType, EdgeWeightType> &entry) { return entry.first; });
+  alias_prob_data_.clear();
+  alias_data_.clear();
+  if (!weighted_) {
+    SetViews();
+    return Status::OK();
+  }
+
+  std::vector<EdgeWeightType> sorted_weights(entries.size());
+  std::transform(entries.begin(), entries.end(), sorted_weights.begin(),
+                 [](const std::pair<NodeIndexType, EdgeWeightType> &entry) { return entry.second; });
+  std::vector<std::pair<NodeIndexType, EdgeWeightType>>().swap(entries);
+  alias_prob_data_.resize(neighbors_data_.size());
+  alias_data_.resize(neighbors_data_.size());
+  for (NodeIndexType i = 0; i < num_nodes; ++i) {
+    RETURN_IF_NOT_OK(BuildAliasTable(offsets_data_[i], offsets_data_[i + 1], sorted_weights));
+  }
+  SetViews();
+  return Status::OK();
+}
+
+bool CsrAdjacency::HasNeighbor(NodeIndexType index, NodeIndexType neighbor) const {
+  return std::binary_search(neighbors_ + offsets_[index], neighbors_ + offsets_[index + 1], neighbor);
+}
+
+Status CsrAdjacency::Attach(NodeIndexType num_nodes, int64_t num_edges, const int64_t *offsets,
+                           const NodeIndexType *neighbors, const float *alias_prob, const NodeIndexType *alias) {
+  CHECK_FAIL_RETURN_UNEXPECTED(num_nodes >= 0 && num_edges >= 0, "Invalid size of adjacency");
+  CHECK_FAIL_RETURN_UNEXPECTED(offsets != nullptr && (neighbors != nullptr || num_edges == 0),
+                               "Adjacency data is null");
+  CHECK_FAIL_RETURN_UNEXPECTED((alias_prob == nullptr) == (alias == nullptr), "Alias table is incomplete");
+  CHECK_FAIL_RETURN_UNEXPECTED(offsets[0] == 0 && offsets[num_nodes] == num_edges, "Adjacency offsets are corrupted");
+  // The rows are read without bound checks afterwards, so a corrupted snapshot is rejected here
+  for (NodeIndexType i = 0; i < num_nodes; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED(offsets[i] <= offsets[i + 1],
+                                 "Adjacency offsets are corrupted at node index:" + std::to_string(i));
+  }
+  for (int64_t k = 0; k < num_edges; ++k) {
+    CHECK_FAIL_RETURN_UNEXPECTED(neighbors[k] >= 0 && neighbors[k] < num_nodes,
+                                 "Invalid neighbor node index:" + std::to_string(neighbors[k]));
+  }
+  if (alias != nullptr) {
+    // The alias slots are offsets within the row of each node
+    for (NodeIndexType i = 0; i < num_nodes; ++i) {
+      int64_t degree = offsets[i + 1] - offsets[i];
+      for (int64_t k = offsets[i]; k < offsets[i + 1]; ++k) {
+        CHECK_FAIL_RETURN_UNEXPECTED(alias_prob[k] >= 0 && alias_prob[k] <= 1,
+                                     "Invalid alias probability:" + std::to_string(alias_prob[k]));
+        CHECK_FAIL_RETURN_UNEXPECTED(alias[k] >= 0 && alias[k] < degree,
+                                     "Invalid alias slot:" + std::to_string(alias[k]) +
+                                       " of node index:" + std::to_string(i));
+      }
+    }
+  }
+  offsets_data_.clear();
+  neighbors_data_.clear();
+  alias_prob_data_.clear();
+  alias_data_.clear();
+  num_nodes_ = num_nodes;
+  num_edges_ = num_edges;
+  offsets_ = offsets;
+  neighbors_ = neighbors;
+  weighted_ = alias_prob != nullptr;
+  alias_prob_ = alias_prob;
+  alias_ = alias;
+  return Status::OK();
+}
+
+void CsrAdjacency::SetViews() {
+  num_nodes_ = offsets_data_.empty() ? 0 : static_cast<NodeIndexType>(offsets_data_.size() - 1);
+  num_edges_ = static_cast<int64_t>(neighbors_data_.size());
+  offsets_ = offsets_data_.data();
+  neighbors_ = neighbors_data_.data();
+  alias_prob_ = weighted_ ? alias_prob_data_.data() : nullptr;
+  alias_ = weighted_ ? alias_data_.data() : nullptr;
+}
+
+Status CsrAdjacency::BuildAliasTable(int64_t begin, int64_t end, const std::vector<EdgeWeightType> &weights) {
+  int64_t degree = end - begin;
+  if (degree == 0) {
+    return Status::OK();
+  }
+  double sum = std::accumulate(weights.begin() + begin, weights.begin() + end, 0.0);
+  CHECK_FAIL_RETURN_UNEXPECTED(sum >= 0 && std::isfinite(sum), "Invalid sum of edge weights:" + std::to_string(sum));
+  if (sum == 0) {
+    // No edge of the row is preferred, so its neighbors are drawn uniformly
+    for (int64_t k = 0; k < degree; ++k) {
+      alias_prob_data_[begin + k] = 1.0;
+      alias_data_[begin + k] = static_cast<NodeIndexType>(k);
+    }
+    return Status::OK();
+  }
+
+  // Scale the weights to mean 1, then pair each slot below 1 with one above it
+  std::vector<double> scaled(degree);
+  std::vector<NodeIndexType> small, large;
+  NodeIndexType positive = 0;
+  for (int64_t k = 0; k < degree; ++k) {
+    scaled[k] = weights[begin + k] * degree / sum;
+    (scaled[k] < 1.0 ? small : large).push_back(static_cast<NodeIndexType>(k));
+    if (weights[begin + k] > 0) {
+      positive = static_cast<NodeIndexType>(k);
+    }
+  }
+  while (!small.empty() && !large.empty()) {
+    NodeIndexType less = small.back(), more = large.back();
+    small.pop_back();
+    alias_prob_data_[begin + less] = static_cast<float>(scaled[less]);
+    alias_data_[begin + less] = more;
+    scaled[more] -= 1.0 - scaled[less];
+    if (scaled[more] < 1.0) {
+      large.pop_back();
+      small.push_back(more);
+    }
+  }
+  // Whatever is left is 1 up to rounding error, except the zero-weight edges, which are never drawn
+  for (NodeIndexType k : small) {
+    bool zero = weights[begin + k] == 0;
+    alias_prob_data_[begin + k] = zero ? 0.0 : 1.0;
+    alias_data_[begin + k] = zero ? positive : k;
+  }
+  for (NodeIndexType k : large) {
+    alias_prob_data_[begin + k] = 1.0;
+    alias_data_[begin + k] = k;
+  }
+  return Status::OK();
+}
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,142 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef DATASET_ENGINE_GNN_CSR_ADJACENCY_H_
+#define DATASET_ENGINE_GNN_CSR_ADJACENCY_H_
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "dataset/engine/gnn/edge.h"
+#include "dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+// Dense position of a node in the graph, node ids are translated to it once when the graph is built
+using NodeIndexType = int32_t;
+
+constexpr NodeIndexType kInvalidNodeIndex = -1;
+
+// Neighbors of one neighbor type for all nodes of the graph in compressed sparse row layout.
+// The neighbors of node i are neighbors_[offsets_[i], offsets_[i + 1]), sorted by node index.
+// If edges carry different weights, an alias table (Vose) is kept per row so that weighted sampling is O(1).
+// The arrays are either owned, after Build, or borrowed from a graph snapshot, after Attach.
+class CsrAdjacency {
+ public:
+  CsrAdjacency() = default;
+
+  CsrAdjacency(const CsrAdjacency &) = delete;
+
+  CsrAdjacency &operator=(const CsrAdjacency &) = delete;
+
+  ~CsrAdjacency() = default;
+
+  // Build the compressed rows from a list of edges, the lists are released afterwards
+  // @param NodeIndexType num_nodes - number of nodes in the graph, all indices must be smaller than it
+  // @param std::vector<std::pair<NodeIndexType, NodeIndexType>> *edges - (source index, neighbor index) pairs
+  // @param std::vector<EdgeWeightType> *weights - non-negative weight of each edge, or nullptr if all edges weigh the
+  //     same. Zero-weight edges are not sampled, unless all edges of their row weigh zero
+  // @return Status - The error code return
+  Status Build(NodeIndexType num_nodes, std::vector<std::pair<NodeIndexType, NodeIndexType>> *edges,
+               std::vector<EdgeWeightType> *weights = nullptr);
+
+  // Use arrays owned by the caller, which must outlive this object
+  // @param NodeIndexType num_nodes - number of rows
+  // @param int64_t num_edges - number of neighbors of all rows
+  // @param const int64_t *offsets - num_nodes + 1 row offsets
+  // @param const NodeIndexType *neighbors - num_edges neighbor indices
+  // @param const float *alias_prob - num_edges alias probabilities, nullptr if unweighted
+  // @param const NodeIndexType *alias - num_edges alias slots, nullptr if unweighted
+  // @return Status - The error code return
+  Status Attach(NodeIndexType num_nodes, int64_t num_edges, const int64_t *offsets, const NodeIndexType *neighbors,
+                const float *alias_prob, const NodeIndexType *alias);
+
+  // @param NodeIndexType index - index of node
+  // @return NodeIndexType - Returned number of neighbors of the node
+  NodeIndexType Degree(NodeIndexType index) const {
+    return static_cast<NodeIndexType>(offsets_[index + 1] - offsets_[index]);
+  }
+
+  // @param NodeIndexType index - index of node
+  // @return const NodeIndexType * - Returned pointer to the first neighbor of the node
+  const NodeIndexType *Neighbors(NodeIndexType index) const { return neighbors_ + offsets_[index]; }
+
+  // Check whether a node is a neighbor of another by binary search in its row
+  // @param NodeIndexType index - index of node
+  // @param NodeIndexType neighbor - index of the candidate neighbor
+  // @return bool - true if neighbor is adjacent to the node
+  bool HasNeighbor(NodeIndexType index, NodeIndexType neighbor) const;
+
+  // Draw one neighbor with probability proportional to the edge weight, the node must have neighbors
+  // @param NodeIndexType index - index of node
+  // @param std::mt19937 *rnd - random generator
+  // @return NodeIndexType - Returned index of the neighbor
+  NodeIndexType SampleNeighbor(NodeIndexType index, std::mt19937 *rnd) const {
+    std::uniform_int_distribution<NodeIndexType> dist(0, Degree(index) - 1);
+    int64_t pos = offsets_[index] + dist(*rnd);
+    if (weighted_) {
+      std::uniform_real_distribution<float> coin(0.0, 1.0);
+      if (coin(*rnd) >= alias_prob_[pos]) {
+        pos = offsets_[index] + alias_[pos];
+      }
+    }
+    return neighbors_[pos];
+  }
+
+  // @return bool - true if neighbors are sampled by weight
+  bool weighted() const { return weighted_; }
+
+  // @return NodeIndexType - Returned number of rows
+  NodeIndexType num_nodes() const { return num_nodes_; }
+
+  // @return int64_t - Returned number of stored edges
+  int64_t num_edges() const { return num_edges_; }
+
+  // Raw arrays, laid out as described by Attach
+  const int64_t *offsets() const { return offsets_; }
+  const NodeIndexType *neighbors() const { return neighbors_; }
+  const float *alias_prob() const { return alias_prob_; }
+  const NodeIndexType *alias() const { return alias_; }
+
+ private:
+  // Build the alias table of one row from its edge weights
+  // @param int64_t begin - position of the first neighbor of the row
+  // @param int64_t end - position after the last neighbor of the row
+  // @param const std::vector<EdgeWeightType> &weights - weights of all edges, ordered as neighbors_
+  // @return Status - The error code return
+  Status BuildAliasTable(int64_t begin, int64_t end, const std::vector<EdgeWeightType> &weights);
+
+  // Point the views at the owned arrays
+  void SetViews();
+
+  NodeIndexType num_nodes_ = 0;
+  int64_t num_edges_ = 0;
+  bool weighted_ = false;
+  const int64_t *offsets_ = nullptr;
+  const NodeIndexType *neighbors_ = nullptr;
+  const float *alias_prob_ = nullptr;      // Probability to keep the drawn slot, aligned with neighbors_
+  const NodeIndexType *alias_ = nullptr;  // Slot taken otherwise, as offset within the row
+
+  std::vector<int64_t> offsets_data_;
+  std::vector<NodeIndexType> neighbors_data_;
+  std::vector<float> alias_prob_data_;
+  std::vector<NodeIndexType> alias_data_;
+};
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // DATASET_ENGINE_GNN_CSR_ADJACENCY_H_
@@ -29,6 +29,10 @@ namespace dataset {
 namespace gnn {
 using EdgeType = int8_t;
 using EdgeIdType = int32_t;
+using EdgeWeightType = float;
+
+constexpr EdgeIdType kDefaultEdgeId = -1;
+constexpr EdgeWeightType kDefaultEdgeWeight = 1.0;
 
 class Edge {
  public:
@@ -37,8 +41,10 @@ class Edge {
   // @param EdgeType type - edge type
   // @param std::shared_ptr<Node> src_node - source node
   // @param std::shared_ptr<Node> dst_node - destination node
-  Edge(EdgeIdType id, EdgeType type, std::shared_ptr<Node> src_node, std::shared_ptr<Node> dst_node)
-      : id_(id), type_(type), src_node_(src_node), dst_node_(dst_node) {}
+  // @param EdgeWeightType weight - weight used by weighted neighbor sampling
+  Edge(EdgeIdType id, EdgeType type, std::shared_ptr<Node> src_node, std::shared_ptr<Node> dst_node,
+       EdgeWeightType weight = kDefaultEdgeWeight)
+      : id_(id), type_(type), weight_(weight), src_node_(src_node), dst_node_(dst_node) {}
 
   virtual ~Edge() = default;
 
@@ -48,6 +54,9 @@ class Edge {
   // @return NodeIdType - Returned edge type
   EdgeType type() const { return type_; }
 
+  // @return EdgeWeightType - Returned edge weight
+  EdgeWeightType weight() const { return weight_; }
+
   // Get the feature of a edge
   // @param FeatureType feature_type - type of feature
   // @param std::shared_ptr<Feature> *out_feature - Returned feature
@@ -77,6 +86,7 @@ class Edge {
  protected:
   EdgeIdType id_;
   EdgeType type_;
+  EdgeWeightType weight_;
   std::shared_ptr<Node> src_node_;
   std::shared_ptr<Node> dst_node_;
 };
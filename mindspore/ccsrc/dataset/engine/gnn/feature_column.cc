@@ -0,0 +1,98 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "dataset/engine/gnn/feature_column.h"
+
+#include <string>
+
+#include "./securec.h"
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+namespace {
+// Rows are looked ahead by this many positions, far enough to hide a cache miss behind the copies in between
+constexpr size_t kPrefetchDistance = 8;
+}  // namespace
+
+Status FeatureColumn::Init(size_t num_rows, const std::shared_ptr<Tensor> &default_value) {
+  CHECK_FAIL_RETURN_UNEXPECTED(default_value != nullptr, "Default feature is null");
+  CHECK_FAIL_RETURN_UNEXPECTED(default_value->type().IsNumeric(), "Feature must be numeric");
+  num_rows_ = num_rows;
+  row_bytes_ = static_cast<size_t>(default_value->SizeInBytes());
+  default_value_ = default_value;
+  data_data_.assign(num_rows_ * row_bytes_, 0);
+  mask_data_.assign(num_rows_, 0);
+  data_ = data_data_.data();
+  mask_ = mask_data_.data();
+  return Status::OK();
+}
+
+Status FeatureColumn::Attach(size_t num_rows, const std::shared_ptr<Tensor> &default_value, const uint8_t *data,
+                             const uint8_t *mask) {
+  CHECK_FAIL_RETURN_UNEXPECTED(default_value != nullptr, "Default feature is null");
+  CHECK_FAIL_RETURN_UNEXPECTED(default_value->type().IsNumeric(), "Feature must be numeric");
+  CHECK_FAIL_RETURN_UNEXPECTED(num_rows == 0 || (data != nullptr && mask != nullptr), "Feature column is null");
+  num_rows_ = num_rows;
+  row_bytes_ = static_cast<size_t>(default_value->SizeInBytes());
+  default_value_ = default_value;
+  data_data_.clear();
+  mask_data_.clear();
+  data_ = data;
+  mask_ = mask;
+  return Status::OK();
+}
+
+Status FeatureColumn::Set(FeatureRowType row, const std::shared_ptr<Tensor> &value) {
+  CHECK_FAIL_RETURN_UNEXPECTED(data_ == data_data_.data(), "Feature column is read only");
+  CHECK_FAIL_RETURN_UNEXPECTED(row >= 0 && static_cast<size_t>(row) < num_rows_,
+                               "Invalid feature row:" + std::to_string(row));
+  if (value->type() != default_value_->type() || value->shape() != default_value_->shape()) {
+    std::string err_msg = "The shape or type of a feature differs from the default, expected:" +
+                          default_value_->shape().ToString() + " " + default_value_->type().ToString() +
+                          " got:" + value->shape().ToString() + " " + value->type().ToString();
+    RETURN_STATUS_UNEXPECTED(err_msg);
+  }
+  if (row_bytes_ > 0) {
+    int ret_code = memcpy_s(data_data_.data() + row * row_bytes_, row_bytes_, value->GetBuffer(), row_bytes_);
+    CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "Failed to copy feature");
+  }
+  mask_data_[row] = 1;
+  return Status::OK();
+}
+
+Status FeatureColumn::Gather(const FeatureRowType *rows, size_t num, uint8_t *out) const {
+  if (row_bytes_ == 0) {
+    return Status::OK();
+  }
+  const uint8_t *default_data = default_value_->GetBuffer();
+  for (size_t i = 0; i < num; ++i) {
+#if defined(__GNUC__)
+    if (i + kPrefetchDistance < num && rows[i + kPrefetchDistance] >= 0) {
+      __builtin_prefetch(data_ + rows[i + kPrefetchDistance] * row_bytes_);
+    }
+#endif
+    FeatureRowType row = rows[i];
+    CHECK_FAIL_RETURN_UNEXPECTED(row < 0 || static_cast<size_t>(row) < num_rows_,
+                                 "Invalid feature row:" + std::to_string(row));
+    const uint8_t *src = (row >= 0 && mask_[row] != 0) ? data_ + row * row_bytes_ : default_data;
+    int ret_code = memcpy_s(out + i * row_bytes_, row_bytes_, src, row_bytes_);
+    CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "Failed to copy feature");
+  }
+  return Status::OK();
+}
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,100 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef DATASET_ENGINE_GNN_FEATURE_COLUMN_H_
+#define DATASET_ENGINE_GNN_FEATURE_COLUMN_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "dataset/core/tensor.h"
+#include "dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+// Row of a feature column, the dense index of a node or an edge. Negative rows read the default value.
+using FeatureRowType = int64_t;
+
+// One feature type of all nodes (or all edges) of the graph, stored as a dense array of fixed size rows.
+// Row i holds the feature of the entity with dense index i, a mask tells whether the entity has the feature.
+// Entities without it read as the default value. The arrays are either owned, after Init, or borrowed from a graph
+// snapshot, after Attach.
+class FeatureColumn {
+ public:
+  FeatureColumn() = default;
+
+  FeatureColumn(const FeatureColumn &) = delete;
+
+  FeatureColumn &operator=(const FeatureColumn &) = delete;
+
+  ~FeatureColumn() = default;
+
+  // Allocate a column in which no row has the feature yet
+  // @param size_t num_rows - number of rows
+  // @param std::shared_ptr<Tensor> default_value - value of the missing rows, gives the shape and type of every row
+  // @return Status - The error code return
+  Status Init(size_t num_rows, const std::shared_ptr<Tensor> &default_value);
+
+  // Use arrays owned by the caller, which must outlive this object
+  // @param size_t num_rows - number of rows
+  // @param std::shared_ptr<Tensor> default_value - value of the missing rows, gives the shape and type of every row
+  // @param const uint8_t *data - num_rows * row_bytes() bytes
+  // @param const uint8_t *mask - num_rows bytes, non zero if the row has the feature
+  // @return Status - The error code return
+  Status Attach(size_t num_rows, const std::shared_ptr<Tensor> &default_value, const uint8_t *data,
+                const uint8_t *mask);
+
+  // Set the feature of one row of an owned column
+  // @param FeatureRowType row - dense index of the entity
+  // @param std::shared_ptr<Tensor> value - feature value, must have the shape and type of the default value
+  // @return Status - The error code return
+  Status Set(FeatureRowType row, const std::shared_ptr<Tensor> &value);
+
+  // Copy rows into a contiguous buffer, missing and negative rows are filled with the default value
+  // @param const FeatureRowType *rows - rows to copy
+  // @param size_t num - number of rows
+  // @param uint8_t *out - Returned values, num * row_bytes() bytes
+  // @return Status - The error code return
+  Status Gather(const FeatureRowType *rows, size_t num, uint8_t *out) const;
+
+  // @return std::shared_ptr<Tensor> - Returned value of the missing rows
+  const std::shared_ptr<Tensor> &default_value() const { return default_value_; }
+
+  // @return size_t - Returned number of rows
+  size_t num_rows() const { return num_rows_; }
+
+  // @return size_t - Returned size of one row in bytes
+  size_t row_bytes() const { return row_bytes_; }
+
+  // Raw arrays, laid out as described by Attach
+  const uint8_t *data() const { return data_; }
+  const uint8_t *mask() const { return mask_; }
+
+ private:
+  size_t num_rows_ = 0;
+  size_t row_bytes_ = 0;
+  std::shared_ptr<Tensor> default_value_;
+  const uint8_t *data_ = nullptr;
+  const uint8_t *mask_ = nullptr;
+
+  std::vector<uint8_t> data_data_;
+  std::vector<uint8_t> mask_data_;
+};
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // DATASET_ENGINE_GNN_FEATURE_COLUMN_H_
@@ -16,17 +16,45 @@
 #include "dataset/engine/gnn/graph.h"
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
+#include <iterator>
+#include <limits>
 #include <numeric>
+#include <set>
 #include <utility>
 
 #include "dataset/core/tensor_shape.h"
+#include "dataset/util/random.h"
+#include "dataset/util/task_manager.h"
 
 namespace mindspore {
 namespace dataset {
 namespace gnn {
+namespace {
+// Batches smaller than this are sampled on the calling thread, a task switch costs more than the work
+constexpr size_t kMinSampleBlockSize = 256;
+// Upper bound of the number of ids sampled for one input node
+constexpr size_t kMaxSampleWidth = 1 << 20;
+constexpr float kWalkParamEpsilon = 1e-6;
 
-Graph::Graph(std::string dataset_file, int32_t num_workers) : dataset_file_(dataset_file), num_workers_(num_workers) {
+Status CreateNodeIdTensor(size_t rows, size_t cols, std::shared_ptr<Tensor> *out) {
+  RETURN_IF_NOT_OK(Tensor::CreateTensor(out, TensorImpl::kFlexible,
+                                        TensorShape({static_cast<dsize_t>(rows), static_cast<dsize_t>(cols)}),
+                                        DataType(DataType::DE_INT32), nullptr));
+  return Status::OK();
+}
+
+// Dense index of an id in ids sorted ascending, -1 if the id does not exist
+template <typename I>
+int64_t FindIndex(const I *ids, size_t num, I id) {
+  const I *itr = std::lower_bound(ids, ids + num, id);
+  return (itr == ids + num || *itr != id) ? -1 : static_cast<int64_t>(itr - ids);
+}
+}  // namespace
+
+Graph::Graph(std::string dataset_file, int32_t num_workers)
+    : dataset_file_(dataset_file), num_workers_(num_workers), rnd_(GetSeed()) {
   MS_LOG(INFO) << "num_workers:" << num_workers;
 }
 
@@ -71,25 +99,57 @@ Status Graph::CreateTensorByVector(const std::vector<std::vector<T>> &data, Data
   return Status::OK();
 }
 
-template <typename T>
-Status Graph::ComplementVector(std::vector<std::vector<T>> *data, size_t max_size, T default_value) {
-  if (!data || data->empty()) {
-    RETURN_STATUS_UNEXPECTED("Input data is empty");
-  }
-  for (std::vector<T> &vec : *data) {
-    size_t size = vec.size();
-    if (size > max_size) {
-      RETURN_STATUS_UNEXPECTED("The max_size parameter is abnormal");
-    } else {
-      for (size_t i = 0; i < (max_size - size); ++i) {
-        vec.push_back(default_value);
-      }
+Status Graph::GetEdges(EdgeType edge_type, EdgeIdType edge_num, std::shared_ptr<Tensor> *out) { return Status::OK(); }
+
+Status Graph::GetNodeIndices(const std::vector<NodeIdType> &node_list, std::vector<NodeIndexType> *out_index) {
+  out_index->resize(node_list.size());
+  for (size_t i = 0; i < node_list.size(); ++i) {
+    int64_t index = FindIndex(node_ids_, num_nodes_, node_list[i]);
+    if (index < 0) {
+      std::string err_msg = "Invalid node id:" + std::to_string(node_list[i]);
+      RETURN_STATUS_UNEXPECTED(err_msg);
     }
+    (*out_index)[i] = static_cast<NodeIndexType>(index);
   }
   return Status::OK();
 }
 
-Status Graph::GetEdges(EdgeType edge_type, EdgeIdType edge_num, std::shared_ptr<Tensor> *out) { return Status::OK(); }
+Status Graph::ParallelFor(size_t num, const std::function<Status(size_t, size_t, std::mt19937 *)> &func) {
+  size_t num_blocks = std::min(static_cast<size_t>(std::max(num_workers_, 1)),
+                               (num + kMinSampleBlockSize - 1) / kMinSampleBlockSize);
+  num_blocks = std::max(num_blocks, static_cast<size_t>(1));
+  std::vector<uint32_t> seeds(num_blocks);
+  {
+    std::lock_guard<std::mutex> lock(rnd_mutex_);
+    for (auto &seed : seeds) seed = rnd_();
+  }
+  if (num_blocks == 1) {
+    std::mt19937 rnd(seeds[0]);
+    return func(0, num, &rnd);
+  }
+
+  size_t block_size = (num + num_blocks - 1) / num_blocks;
+  TaskGroup vg;
+  for (size_t block = 0; block < num_blocks && block * block_size < num; ++block) {
+    size_t begin = block * block_size;
+    size_t end = std::min(num, begin + block_size);
+    uint32_t seed = seeds[block];
+    Status rc = vg.CreateAsyncTask("GraphSampler", [&func, begin, end, seed]() {
+      TaskManager::FindMe()->Post();
+      std::mt19937 rnd(seed);
+      return func(begin, end, &rnd);
+    });
+    if (rc.IsError()) {
+      // the launched blocks still use func, wait for them before it goes away
+      vg.interrupt_all();
+      (void)vg.join_all(Task::WaitFlag::kBlocking);
+      return rc;
+    }
+  }
+  vg.join_all(Task::WaitFlag::kBlocking);
+  RETURN_IF_NOT_OK(vg.GetTaskErrorIfAny());
+  return Status::OK();
+}
 
 Status Graph::GetAllNeighbors(const std::vector<NodeIdType> &node_list, NodeType neighbor_type,
                               std::shared_ptr<Tensor> *out) {
@@ -101,38 +161,217 @@ Status Graph::GetAllNeighbors(const std::vector<NodeIdType> &node_list, NodeType
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
 
-  std::vector<std::vector<NodeIdType>> neighbors;
-  size_t max_neighbor_num = 0;
-  neighbors.resize(node_list.size());
-  for (size_t i = 0; i < node_list.size(); ++i) {
-    auto itr = node_id_map_.find(node_list[i]);
-    if (itr != node_id_map_.end()) {
-      RETURN_IF_NOT_OK(itr->second->GetNeighbors(neighbor_type, -1, &neighbors[i]));
-      max_neighbor_num = max_neighbor_num > neighbors[i].size() ? max_neighbor_num : neighbors[i].size();
-    } else {
-      std::string err_msg = "Invalid node id:" + std::to_string(node_list[i]);
-      RETURN_STATUS_UNEXPECTED(err_msg);
+  std::vector<NodeIndexType> indices;
+  RETURN_IF_NOT_OK(GetNodeIndices(node_list, &indices));
+  auto adj_itr = adjacency_.find(neighbor_type);
+  const CsrAdjacency *adjacency = adj_itr == adjacency_.end() ? nullptr : &adj_itr->second;
+  NodeIndexType max_neighbor_num = 0;
+  if (adjacency != nullptr) {
+    for (NodeIndexType index : indices) {
+      max_neighbor_num = std::max(max_neighbor_num, adjacency->Degree(index));
     }
   }
 
-  RETURN_IF_NOT_OK(ComplementVector<NodeIdType>(&neighbors, max_neighbor_num, kDefaultNodeId));
-  RETURN_IF_NOT_OK(CreateTensorByVector<NodeIdType>(neighbors, DataType(DataType::DE_INT32), out));
-
+  // Each row is the node itself followed by its neighbors, filled as kDefaultNodeId up to the maximum degree
+  size_t width = static_cast<size_t>(max_neighbor_num) + 1;
+  std::shared_ptr<Tensor> tensor;
+  RETURN_IF_NOT_OK(CreateNodeIdTensor(indices.size(), width, &tensor));
+  NodeIdType *data = reinterpret_cast<NodeIdType *>(tensor->GetMutableBuffer());
+  RETURN_IF_NOT_OK(ParallelFor(indices.size(), [&](size_t begin, size_t end, std::mt19937 *) {
+    for (size_t i = begin; i < end; ++i) {
+      NodeIdType *row = data + i * width;
+      NodeIndexType degree = adjacency == nullptr ? 0 : adjacency->Degree(indices[i]);
+      row[0] = node_ids_[indices[i]];
+      for (NodeIndexType k = 0; k < degree; ++k) {
+        row[k + 1] = node_ids_[adjacency->Neighbors(indices[i])[k]];
+      }
+      std::fill(row + degree + 1, row + width, kDefaultNodeId);
+    }
+    return Status::OK();
+  }));
+  tensor->Squeeze();
+  *out = std::move(tensor);
   return Status::OK();
 }
 
 Status Graph::GetSampledNeighbor(const std::vector<NodeIdType> &node_list, const std::vector<NodeIdType> &neighbor_nums,
                                  const std::vector<NodeType> &neighbor_types, std::shared_ptr<Tensor> *out) {
+  CHECK_FAIL_RETURN_UNEXPECTED(!node_list.empty(), "Input node_list is empty.");
+  CHECK_FAIL_RETURN_UNEXPECTED(!neighbor_nums.empty() && neighbor_nums.size() == neighbor_types.size(),
+                               "The size of neighbor_nums and neighbor_types must be equal and not be 0.");
+  std::vector<const CsrAdjacency *> hops;
+  size_t width = 1, layer_size = 1;
+  for (size_t hop = 0; hop < neighbor_nums.size(); ++hop) {
+    if (neighbor_nums[hop] <= 0) {
+      std::string err_msg = "Invalid neighbor num:" + std::to_string(neighbor_nums[hop]);
+      RETURN_STATUS_UNEXPECTED(err_msg);
+    }
+    if (node_type_map_.find(neighbor_types[hop]) == node_type_map_.end()) {
+      std::string err_msg = "Invalid neighbor type:" + std::to_string(neighbor_types[hop]);
+      RETURN_STATUS_UNEXPECTED(err_msg);
+    }
+    layer_size *= static_cast<size_t>(neighbor_nums[hop]);
+    width += layer_size;
+    CHECK_FAIL_RETURN_UNEXPECTED(width <= kMaxSampleWidth, "Too many neighbors to be sampled per node.");
+    auto adj_itr = adjacency_.find(neighbor_types[hop]);
+    hops.push_back(adj_itr == adjacency_.end() ? nullptr : &adj_itr->second);
+  }
+
+  std::vector<NodeIndexType> indices;
+  RETURN_IF_NOT_OK(GetNodeIndices(node_list, &indices));
+  std::shared_ptr<Tensor> tensor;
+  RETURN_IF_NOT_OK(CreateNodeIdTensor(indices.size(), width, &tensor));
+  NodeIdType *data = reinterpret_cast<NodeIdType *>(tensor->GetMutableBuffer());
+  RETURN_IF_NOT_OK(ParallelFor(indices.size(), [&](size_t begin, size_t end, std::mt19937 *rnd) {
+    std::vector<NodeIndexType> layer_in, layer_out;
+    for (size_t i = begin; i < end; ++i) {
+      NodeIdType *row = data + i * width;
+      *row++ = node_ids_[indices[i]];
+      layer_in.assign(1, indices[i]);
+      for (size_t hop = 0; hop < hops.size(); ++hop) {
+        layer_out.clear();
+        for (NodeIndexType index : layer_in) {
+          NodeIndexType degree = (index == kInvalidNodeIndex || hops[hop] == nullptr) ? 0 : hops[hop]->Degree(index);
+          if (degree == 0) {
+            layer_out.insert(layer_out.end(), static_cast<size_t>(neighbor_nums[hop]), kInvalidNodeIndex);
+            continue;
+          }
+          for (NodeIdType k = 0; k < neighbor_nums[hop]; ++k) {
+            layer_out.push_back(hops[hop]->SampleNeighbor(index, rnd));
+          }
+        }
+        for (NodeIndexType index : layer_out) {
+          *row++ = index == kInvalidNodeIndex ? kDefaultNodeId : node_ids_[index];
+        }
+        layer_in.swap(layer_out);
+      }
+    }
+    return Status::OK();
+  }));
+  *out = std::move(tensor);
   return Status::OK();
 }
 
 Status Graph::GetNegSampledNeighbor(const std::vector<NodeIdType> &node_list, NodeIdType samples_num,
                                     NodeType neg_neighbor_type, std::shared_ptr<Tensor> *out) {
+  CHECK_FAIL_RETURN_UNEXPECTED(!node_list.empty(), "Input node_list is empty.");
+  if (samples_num <= 0 || static_cast<size_t>(samples_num) >= kMaxSampleWidth) {
+    std::string err_msg = "Invalid samples num:" + std::to_string(samples_num);
+    RETURN_STATUS_UNEXPECTED(err_msg);
+  }
+  auto type_itr = node_type_index_map_.find(neg_neighbor_type);
+  if (type_itr == node_type_index_map_.end()) {
+    std::string err_msg = "Invalid neighbor type:" + std::to_string(neg_neighbor_type);
+    RETURN_STATUS_UNEXPECTED(err_msg);
+  }
+  const std::vector<NodeIndexType> &candidates = type_itr->second;
+  auto adj_itr = adjacency_.find(neg_neighbor_type);
+  const CsrAdjacency *adjacency = adj_itr == adjacency_.end() ? nullptr : &adj_itr->second;
+
+  std::vector<NodeIndexType> indices;
+  RETURN_IF_NOT_OK(GetNodeIndices(node_list, &indices));
+  size_t width = static_cast<size_t>(samples_num) + 1;
+  std::shared_ptr<Tensor> tensor;
+  RETURN_IF_NOT_OK(CreateNodeIdTensor(indices.size(), width, &tensor));
+  NodeIdType *data = reinterpret_cast<NodeIdType *>(tensor->GetMutableBuffer());
+  RETURN_IF_NOT_OK(ParallelFor(indices.size(), [&](size_t begin, size_t end, std::mt19937 *rnd) {
+    std::vector<NodeIndexType> pool;
+    std::uniform_int_distribution<size_t> candidate_dist(0, candidates.size() - 1);
+    for (size_t i = begin; i < end; ++i) {
+      NodeIdType *row = data + i * width;
+      NodeIndexType index = indices[i];
+      row[0] = node_ids_[index];
+      auto is_negative = [adjacency, index](NodeIndexType candidate) {
+        return candidate != index && (adjacency == nullptr || !adjacency->HasNeighbor(index, candidate));
+      };
+      size_t num_excluded = (adjacency == nullptr ? 0 : static_cast<size_t>(adjacency->Degree(index))) + 1;
+      if (num_excluded * 2 <= candidates.size()) {
+        // At least half of the candidates are negative, so rejection takes less than two draws on average
+        for (size_t k = 1; k < width; ++k) {
+          NodeIndexType candidate;
+          do {
+            candidate = candidates[candidate_dist(*rnd)];
+          } while (!is_negative(candidate));
+          row[k] = node_ids_[candidate];
+        }
+        continue;
+      }
+      pool.clear();
+      std::copy_if(candidates.begin(), candidates.end(), std::back_inserter(pool), is_negative);
+      if (pool.empty()) {
+        std::fill(row + 1, row + width, kDefaultNodeId);
+        continue;
+      }
+      std::uniform_int_distribution<size_t> pool_dist(0, pool.size() - 1);
+      for (size_t k = 1; k < width; ++k) {
+        row[k] = node_ids_[pool[pool_dist(*rnd)]];
+      }
+    }
+    return Status::OK();
+  }));
+  *out = std::move(tensor);
   return Status::OK();
 }
 
 Status Graph::RandomWalk(const std::vector<NodeIdType> &node_list, const std::vector<NodeType> &meta_path, float p,
                          float q, NodeIdType default_node, std::shared_ptr<Tensor> *out) {
+  CHECK_FAIL_RETURN_UNEXPECTED(!node_list.empty(), "Input node_list is empty.");
+  CHECK_FAIL_RETURN_UNEXPECTED(!meta_path.empty() && meta_path.size() < kMaxSampleWidth, "Invalid meta_path size.");
+  CHECK_FAIL_RETURN_UNEXPECTED(p > 0 && q > 0 && std::isfinite(p) && std::isfinite(q), "p and q must be positive.");
+  bool biased = std::fabs(p - 1.0f) >= kWalkParamEpsilon || std::fabs(q - 1.0f) >= kWalkParamEpsilon;
+  // Unnormalized node2vec bias of returning to the previous node, moving to its neighbor and moving away
+  float return_bias = 1.0f / p, stay_bias = 1.0f, away_bias = 1.0f / q;
+  float max_bias = std::max({return_bias, stay_bias, away_bias});
+  std::vector<const CsrAdjacency *> steps;
+  for (NodeType type : meta_path) {
+    if (node_type_map_.find(type) == node_type_map_.end()) {
+      std::string err_msg = "Invalid node type in meta_path:" + std::to_string(type);
+      RETURN_STATUS_UNEXPECTED(err_msg);
+    }
+    auto adj_itr = adjacency_.find(type);
+    steps.push_back(adj_itr == adjacency_.end() ? nullptr : &adj_itr->second);
+  }
+
+  std::vector<NodeIndexType> indices;
+  RETURN_IF_NOT_OK(GetNodeIndices(node_list, &indices));
+  size_t width = steps.size() + 1;
+  std::shared_ptr<Tensor> tensor;
+  RETURN_IF_NOT_OK(CreateNodeIdTensor(indices.size(), width, &tensor));
+  NodeIdType *data = reinterpret_cast<NodeIdType *>(tensor->GetMutableBuffer());
+  RETURN_IF_NOT_OK(ParallelFor(indices.size(), [&](size_t begin, size_t end, std::mt19937 *rnd) {
+    std::uniform_real_distribution<float> coin(0.0, max_bias);
+    for (size_t i = begin; i < end; ++i) {
+      NodeIdType *row = data + i * width;
+      NodeIndexType previous = kInvalidNodeIndex;
+      NodeIndexType current = indices[i];
+      row[0] = node_ids_[current];
+      for (size_t step = 0; step < steps.size(); ++step) {
+        const CsrAdjacency *adjacency = steps[step];
+        NodeIndexType degree = (current == kInvalidNodeIndex || adjacency == nullptr) ? 0 : adjacency->Degree(current);
+        if (degree == 0) {
+          current = kInvalidNodeIndex;
+          row[step + 1] = default_node;
+          continue;
+        }
+        // Rejection sampling: propose by edge weight and accept by bias / max_bias, so the transition probabilities
+        // never have to be normalized over the neighbors of current
+        NodeIndexType next = adjacency->SampleNeighbor(current, rnd);
+        while (biased && previous != kInvalidNodeIndex) {
+          float bias = next == previous ? return_bias
+                                        : (adjacency->HasNeighbor(previous, next) ? stay_bias : away_bias);
+          if (coin(*rnd) < bias) {
+            break;
+          }
+          next = adjacency->SampleNeighbor(current, rnd);
+        }
+        previous = current;
+        current = next;
+        row[step + 1] = node_ids_[current];
+      }
+    }
+    return Status::OK();
+  }));
+  *out = std::move(tensor);
   return Status::OK();
 }
 
@@ -147,65 +386,113 @@ Status Graph::GetNodeDefaultFeature(FeatureType feature_type, std::shared_ptr<Fe
   return Status::OK();
 }
 
-Status Graph::GetNodeFeature(const std::shared_ptr<Tensor> &nodes, const std::vector<FeatureType> &feature_types,
-                             TensorRow *out) {
-  if (!nodes || nodes->Size() == 0) {
-    RETURN_STATUS_UNEXPECTED("Input nodes is empty");
+template <typename I>
+Status Graph::GatherFeatures(const std::shared_ptr<Tensor> &ids, I default_id,
+                             const std::vector<FeatureType> &feature_types,
+                             const std::unordered_map<FeatureType, FeatureColumn> &columns, const I *sorted_ids,
+                             size_t num_ids, TensorRow *out) {
+  std::vector<I> id_list;
+  id_list.reserve(ids->Size());
+  for (auto itr = ids->begin<I>(); itr != ids->end<I>(); ++itr) {
+    id_list.push_back(*itr);
   }
-  CHECK_FAIL_RETURN_UNEXPECTED(!feature_types.empty(), "Inpude feature_types is empty");
-  TensorRow tensors;
+
+  std::vector<const FeatureColumn *> feature_columns;
+  std::vector<std::shared_ptr<Tensor>> default_values;
+  std::vector<std::shared_ptr<Tensor>> tensors;
+  std::vector<unsigned char *> buffers;
   for (auto f_type : feature_types) {
     std::shared_ptr<Feature> default_feature;
     // If no feature can be obtained, fill in the default value
     RETURN_IF_NOT_OK(GetNodeDefaultFeature(f_type, &default_feature));
+    std::shared_ptr<Tensor> default_value = default_feature->Value();
+    auto itr = columns.find(f_type);
+    feature_columns.push_back(itr == columns.end() ? nullptr : &itr->second);
+    default_values.push_back(default_value);
 
-    TensorShape shape(default_feature->Value()->shape());
-    auto shape_vec = nodes->shape().AsVector();
-    dsize_t size = std::accumulate(shape_vec.begin(), shape_vec.end(), 1, std::multiplies<dsize_t>());
-    shape = shape.PrependDim(size);
+    TensorShape shape = default_value->shape().PrependDim(static_cast<dsize_t>(id_list.size()));
     std::shared_ptr<Tensor> fea_tensor;
-    RETURN_IF_NOT_OK(
-      Tensor::CreateTensor(&fea_tensor, TensorImpl::kFlexible, shape, default_feature->Value()->type(), nullptr));
+    RETURN_IF_NOT_OK(Tensor::CreateTensor(&fea_tensor, TensorImpl::kFlexible, shape, default_value->type(), nullptr));
+    tensors.push_back(fea_tensor);
+    buffers.push_back(fea_tensor->GetMutableBuffer());
+  }
 
-    dsize_t index = 0;
-    for (auto node_itr = nodes->begin<NodeIdType>(); node_itr != nodes->end<NodeIdType>(); ++node_itr) {
-      auto itr = node_id_map_.find(*node_itr);
-      std::shared_ptr<Feature> feature;
-      if (itr != node_id_map_.end()) {
-        if (!itr->second->GetFeatures(f_type, &feature).IsOk()) {
-          feature = default_feature;
-        }
-      } else {
-        if (*node_itr == kDefaultNodeId) {
-          feature = default_feature;
-        } else {
-          std::string err_msg = "Invalid node id:" + std::to_string(*node_itr);
-          RETURN_STATUS_UNEXPECTED(err_msg);
-        }
+  // Ids are translated once per block, then every feature is gathered for the block
+  RETURN_IF_NOT_OK(ParallelFor(id_list.size(), [&](size_t begin, size_t end, std::mt19937 *) -> Status {
+    std::vector<FeatureRowType> rows(end - begin);
+    for (size_t i = begin; i < end; ++i) {
+      if (id_list[i] == default_id) {
+        rows[i - begin] = -1;
+        continue;
+      }
+      int64_t index = FindIndex(sorted_ids, num_ids, id_list[i]);
+      if (index < 0) {
+        std::string err_msg = "Invalid id:" + std::to_string(id_list[i]);
+        RETURN_STATUS_UNEXPECTED(err_msg);
       }
-      RETURN_IF_NOT_OK(fea_tensor->InsertTensor({index}, feature->Value()));
-      index++;
+      rows[i - begin] = static_cast<FeatureRowType>(index);
     }
+    for (size_t f = 0; f < feature_columns.size(); ++f) {
+      size_t row_bytes = static_cast<size_t>(default_values[f]->SizeInBytes());
+      unsigned char *dst = buffers[f] + begin * row_bytes;
+      if (feature_columns[f] != nullptr) {
+        RETURN_IF_NOT_OK(feature_columns[f]->Gather(rows.data(), rows.size(), dst));
+        continue;
+      }
+      // None of this kind of entity has the feature
+      for (size_t i = 0; i < rows.size() && row_bytes > 0; ++i) {
+        int ret_code = memcpy_s(dst + i * row_bytes, row_bytes, default_values[f]->GetBuffer(), row_bytes);
+        CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "Failed to copy feature");
+      }
+    }
+    return Status::OK();
+  }));
 
-    TensorShape reshape(nodes->shape());
-    for (auto s : default_feature->Value()->shape().AsVector()) {
+  TensorRow result;
+  for (size_t f = 0; f < tensors.size(); ++f) {
+    TensorShape reshape(ids->shape());
+    for (auto s : default_values[f]->shape().AsVector()) {
       reshape = reshape.AppendDim(s);
     }
-    RETURN_IF_NOT_OK(fea_tensor->Reshape(reshape));
-    fea_tensor->Squeeze();
-    tensors.push_back(fea_tensor);
+    RETURN_IF_NOT_OK(tensors[f]->Reshape(reshape));
+    tensors[f]->Squeeze();
+    result.push_back(tensors[f]);
   }
-  *out = std::move(tensors);
+  *out = std::move(result);
+  return Status::OK();
+}
+
+Status Graph::GetNodeFeature(const std::shared_ptr<Tensor> &nodes, const std::vector<FeatureType> &feature_types,
+                             TensorRow *out) {
+  if (!nodes || nodes->Size() == 0) {
+    RETURN_STATUS_UNEXPECTED("Input nodes is empty");
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(!feature_types.empty(), "Inpude feature_types is empty");
+  RETURN_IF_NOT_OK(
+    GatherFeatures(nodes, kDefaultNodeId, feature_types, node_feature_columns_, node_ids_, num_nodes_, out));
   return Status::OK();
 }
 
 Status Graph::GetEdgeFeature(const std::shared_ptr<Tensor> &edges, const std::vector<FeatureType> &feature_types,
                              TensorRow *out) {
+  if (!edges || edges->Size() == 0) {
+    RETURN_STATUS_UNEXPECTED("Input edges is empty");
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(!feature_types.empty(), "Inpude feature_types is empty");
+  RETURN_IF_NOT_OK(
+    GatherFeatures(edges, kDefaultEdgeId, feature_types, edge_feature_columns_, edge_ids_, num_edges_, out));
   return Status::OK();
 }
 
 Status Graph::Init() {
-  RETURN_IF_NOT_OK(LoadNodeAndEdge());
+  if (GraphSnapshotReader::IsSnapshot(dataset_file_)) {
+    RETURN_IF_NOT_OK(LoadSnapshot(dataset_file_));
+  } else {
+    RETURN_IF_NOT_OK(LoadNodeAndEdge());
+    RETURN_IF_NOT_OK(BuildTables());
+    RETURN_IF_NOT_OK(BuildAdjacency());
+    RETURN_IF_NOT_OK(BuildFeatureColumns());
+  }
   return Status::OK();
 }
 
@@ -250,6 +537,310 @@ Status Graph::LoadNodeAndEdge() {
                                        &node_feature_map_, &edge_feature_map_, &default_feature_map_));
   return Status::OK();
 }
+
+Status Graph::BuildTables() {
+  CHECK_FAIL_RETURN_UNEXPECTED(node_id_map_.size() < static_cast<size_t>(std::numeric_limits<NodeIndexType>::max()),
+                               "Too many nodes:" + std::to_string(node_id_map_.size()));
+  node_ids_data_.clear();
+  node_ids_data_.reserve(node_id_map_.size());
+  for (const auto &node : node_id_map_) {
+    node_ids_data_.push_back(node.first);
+  }
+  std::sort(node_ids_data_.begin(), node_ids_data_.end());
+  node_types_data_.resize(node_ids_data_.size());
+  for (size_t i = 0; i < node_ids_data_.size(); ++i) {
+    node_types_data_[i] = node_id_map_[node_ids_data_[i]]->type();
+  }
+  num_nodes_ = node_ids_data_.size();
+  node_ids_ = node_ids_data_.data();
+  node_types_ = node_types_data_.data();
+  BuildTypeIndex();
+
+  edge_ids_data_.clear();
+  edge_ids_data_.reserve(edge_id_map_.size());
+  for (const auto &edge : edge_id_map_) {
+    edge_ids_data_.push_back(edge.first);
+  }
+  std::sort(edge_ids_data_.begin(), edge_ids_data_.end());
+  size_t num_edges = edge_ids_data_.size();
+  edge_types_data_.resize(num_edges);
+  edge_src_data_.resize(num_edges);
+  edge_dst_data_.resize(num_edges);
+  edge_weights_data_.resize(num_edges);
+  for (size_t i = 0; i < num_edges; ++i) {
+    const std::shared_ptr<Edge> &edge = edge_id_map_[edge_ids_data_[i]];
+    std::pair<std::shared_ptr<Node>, std::shared_ptr<Node>> nodes;
+    RETURN_IF_NOT_OK(edge->GetNode(&nodes));
+    int64_t src = FindIndex(node_ids_, num_nodes_, nodes.first->id());
+    int64_t dst = FindIndex(node_ids_, num_nodes_, nodes.second->id());
+    if (src < 0 || dst < 0) {
+      std::string err_msg = "Invalid node of edge:" + std::to_string(edge_ids_data_[i]);
+      RETURN_STATUS_UNEXPECTED(err_msg);
+    }
+    edge_types_data_[i] = edge->type();
+    edge_src_data_[i] = static_cast<NodeIndexType>(src);
+    edge_dst_data_[i] = static_cast<NodeIndexType>(dst);
+    edge_weights_data_[i] = edge->weight();
+  }
+  num_edges_ = num_edges;
+  edge_ids_ = edge_ids_data_.data();
+  edge_types_ = edge_types_data_.data();
+  edge_src_ = edge_src_data_.data();
+  edge_dst_ = edge_dst_data_.data();
+  edge_weights_ = edge_weights_data_.data();
+  return Status::OK();
+}
+
+void Graph::BuildTypeIndex() {
+  std::unordered_map<NodeType, size_t> counts;
+  for (size_t i = 0; i < num_nodes_; ++i) {
+    ++counts[node_types_[i]];
+  }
+  node_type_index_map_.clear();
+  for (const auto &itr : counts) {
+    node_type_index_map_[itr.first].reserve(itr.second);
+  }
+  for (size_t i = 0; i < num_nodes_; ++i) {
+    node_type_index_map_[node_types_[i]].push_back(static_cast<NodeIndexType>(i));
+  }
+}
+
+Status Graph::BuildAdjacency() {
+  // Edges are grouped by the type of their destination, which is the neighbor type used by the queries
+  std::unordered_map<NodeType, std::vector<std::pair<NodeIndexType, NodeIndexType>>> edges;
+  std::unordered_map<NodeType, std::vector<EdgeWeightType>> weights;
+  for (size_t i = 0; i < num_edges_; ++i) {
+    NodeType neighbor_type = node_types_[edge_dst_[i]];
+    edges[neighbor_type].emplace_back(edge_src_[i], edge_dst_[i]);
+    weights[neighbor_type].push_back(edge_weights_[i]);
+  }
+  adjacency_.clear();
+  for (auto &itr : edges) {
+    RETURN_IF_NOT_OK(adjacency_[itr.first].Build(static_cast<NodeIndexType>(num_nodes_), &itr.second,
+                                                 &weights[itr.first]));
+    MS_LOG(INFO) << "Built adjacency of neighbor type:" << std::to_string(itr.first)
+                 << " edges:" << adjacency_[itr.first].num_edges() << " weighted:" << adjacency_[itr.first].weighted();
+  }
+  return Status::OK();
+}
+
+Status Graph::BuildFeatureColumns() {
+  std::vector<std::shared_ptr<Node>> nodes(num_nodes_);
+  for (size_t i = 0; i < num_nodes_; ++i) {
+    nodes[i] = node_id_map_[node_ids_[i]];
+  }
+  std::vector<std::shared_ptr<Edge>> edges(num_edges_);
+  for (size_t i = 0; i < num_edges_; ++i) {
+    edges[i] = edge_id_map_[edge_ids_[i]];
+  }
+  RETURN_IF_NOT_OK(BuildColumns(nodes, node_feature_map_, &node_feature_columns_));
+  RETURN_IF_NOT_OK(BuildColumns(edges, edge_feature_map_, &edge_feature_columns_));
+  // The columns and the dense tables hold everything the queries read, release the loaded nodes and edges together
+  // with their feature tensors instead of keeping the features twice
+  nodes.clear();
+  edges.clear();
+  std::unordered_map<NodeIdType, std::shared_ptr<Node>>().swap(node_id_map_);
+  std::unordered_map<EdgeIdType, std::shared_ptr<Edge>>().swap(edge_id_map_);
+  return Status::OK();
+}
+
+template <typename T, typename K>
+Status Graph::BuildColumns(const std::vector<T> &entities,
+                           const std::unordered_map<K, std::unordered_set<FeatureType>> &feature_map,
+                           std::unordered_map<FeatureType, FeatureColumn> *columns) {
+  std::set<FeatureType> feature_types;
+  for (const auto &itr : feature_map) {
+    feature_types.insert(itr.second.begin(), itr.second.end());
+  }
+  columns->clear();
+  for (FeatureType f_type : feature_types) {
+    std::shared_ptr<Feature> default_feature;
+    RETURN_IF_NOT_OK(GetNodeDefaultFeature(f_type, &default_feature));
+    FeatureColumn &column = (*columns)[f_type];
+    RETURN_IF_NOT_OK(column.Init(entities.size(), default_feature->Value()));
+    for (size_t i = 0; i < entities.size(); ++i) {
+      // Only ask the entities whose type has the feature, a miss is reported as an error status
+      auto type_itr = feature_map.find(entities[i]->type());
+      if (type_itr == feature_map.end() || type_itr->second.count(f_type) == 0) {
+        continue;
+      }
+      std::shared_ptr<Feature> feature;
+      if (entities[i]->GetFeatures(f_type, &feature).IsOk()) {
+        RETURN_IF_NOT_OK(column.Set(static_cast<FeatureRowType>(i), feature->Value()));
+      }
+    }
+  }
+  return Status::OK();
+}
+
+Status Graph::SaveFeatures(const std::string &prefix, const std::unordered_map<FeatureType, FeatureColumn> &columns,
+                           GraphSnapshotWriter *writer, nlohmann::json *meta) {
+  *meta = nlohmann::json::array();
+  for (const auto &itr : columns) {
+    const FeatureColumn &column = itr.second;
+    std::string section = prefix + "." + std::to_string(itr.first);
+    RETURN_IF_NOT_OK(writer->AddSection(section + ".data", column.data(), column.num_rows() * column.row_bytes()));
+    RETURN_IF_NOT_OK(writer->AddSection(section + ".mask", column.mask(), column.num_rows()));
+    meta->push_back({{"type", itr.first},
+                     {"data_type", column.default_value()->type().ToString()},
+                     {"shape", column.default_value()->shape().AsVector()}});
+  }
+  return Status::OK();
+}
+
+Status Graph::LoadFeatures(const std::string &prefix, size_t num_rows, const nlohmann::json &meta,
+                           std::unordered_map<FeatureType, FeatureColumn> *columns) {
+  for (const auto &item : meta) {
+    FeatureType f_type = item.at("type").get<FeatureType>();
+    DataType type(item.at("data_type").get<std::string>());
+    TensorShape shape(item.at("shape").get<std::vector<dsize_t>>());
+    // Node and edge features of the same type share the default value, as when loading from MindRecord
+    auto default_itr = default_feature_map_.find(f_type);
+    if (default_itr == default_feature_map_.end()) {
+      std::shared_ptr<Tensor> zero_tensor;
+      RETURN_IF_NOT_OK(Tensor::CreateTensor(&zero_tensor, TensorImpl::kFlexible, shape, type));
+      RETURN_IF_NOT_OK(zero_tensor->Zero());
+      default_itr = default_feature_map_.emplace(f_type, std::make_shared<Feature>(f_type, zero_tensor)).first;
+    }
+    std::shared_ptr<Tensor> default_value = default_itr->second->Value();
+    size_t row_bytes = static_cast<size_t>(default_value->SizeInBytes());
+    std::string section = prefix + "." + std::to_string(f_type);
+    const uint8_t *data = nullptr;
+    const uint8_t *mask = nullptr;
+    RETURN_IF_NOT_OK(snapshot_->GetArray(section + ".data", num_rows * row_bytes, &data));
+    RETURN_IF_NOT_OK(snapshot_->GetArray(section + ".mask", num_rows, &mask));
+    RETURN_IF_NOT_OK((*columns)[f_type].Attach(num_rows, default_value, data, mask));
+  }
+  return Status::OK();
+}
+
+Status Graph::SaveSnapshot(const std::string &snapshot_file) {
+  CHECK_FAIL_RETURN_UNEXPECTED(num_nodes_ > 0, "Graph is empty or not initialized.");
+  size_t num_nodes = num_nodes_;
+  size_t num_edges = num_edges_;
+  GraphSnapshotWriter writer;
+  RETURN_IF_NOT_OK(writer.AddSection("node_ids", node_ids_, num_nodes * sizeof(NodeIdType)));
+  RETURN_IF_NOT_OK(writer.AddSection("node_types", node_types_, num_nodes * sizeof(NodeType)));
+  RETURN_IF_NOT_OK(writer.AddSection("edge_ids", edge_ids_, num_edges * sizeof(EdgeIdType)));
+  RETURN_IF_NOT_OK(writer.AddSection("edge_types", edge_types_, num_edges * sizeof(EdgeType)));
+  RETURN_IF_NOT_OK(writer.AddSection("edge_src", edge_src_, num_edges * sizeof(NodeIndexType)));
+  RETURN_IF_NOT_OK(writer.AddSection("edge_dst", edge_dst_, num_edges * sizeof(NodeIndexType)));
+  RETURN_IF_NOT_OK(writer.AddSection("edge_weights", edge_weights_, num_edges * sizeof(EdgeWeightType)));
+
+  nlohmann::json meta;
+  meta["num_nodes"] = num_nodes;
+  meta["num_edges"] = num_edges;
+  meta["adjacency"] = nlohmann::json::array();
+  for (const auto &itr : adjacency_) {
+    const CsrAdjacency &adjacency = itr.second;
+    std::string section = "adjacency." + std::to_string(itr.first);
+    size_t adj_edges = static_cast<size_t>(adjacency.num_edges());
+    RETURN_IF_NOT_OK(writer.AddSection(section + ".offsets", adjacency.offsets(), (num_nodes + 1) * sizeof(int64_t)));
+    RETURN_IF_NOT_OK(
+      writer.AddSection(section + ".neighbors", adjacency.neighbors(), adj_edges * sizeof(NodeIndexType)));
+    if (adjacency.weighted()) {
+      RETURN_IF_NOT_OK(writer.AddSection(section + ".alias_prob", adjacency.alias_prob(), adj_edges * sizeof(float)));
+      RETURN_IF_NOT_OK(writer.AddSection(section + ".alias", adjacency.alias(), adj_edges * sizeof(NodeIndexType)));
+    }
+    meta["adjacency"].push_back({{"type", itr.first}, {"num_edges", adj_edges}, {"weighted", adjacency.weighted()}});
+  }
+  meta["node_feature_map"] = nlohmann::json::array();
+  for (const auto &itr : node_feature_map_) {
+    meta["node_feature_map"].push_back({{"type", itr.first}, {"features", itr.second}});
+  }
+  meta["edge_feature_map"] = nlohmann::json::array();
+  for (const auto &itr : edge_feature_map_) {
+    meta["edge_feature_map"].push_back({{"type", itr.first}, {"features", itr.second}});
+  }
+  RETURN_IF_NOT_OK(SaveFeatures("node_feature", node_feature_columns_, &writer, &meta["node_features"]));
+  RETURN_IF_NOT_OK(SaveFeatures("edge_feature", edge_feature_columns_, &writer, &meta["edge_features"]));
+  RETURN_IF_NOT_OK(writer.AddSection("meta", meta.dump()));
+  RETURN_IF_NOT_OK(writer.Write(snapshot_file));
+  return Status::OK();
+}
+
+Status Graph::LoadSnapshot(const std::string &snapshot_file) {
+  snapshot_ = std::make_shared<GraphSnapshotReader>();
+  RETURN_IF_NOT_OK(snapshot_->Open(snapshot_file));
+  const void *meta_data = nullptr;
+  size_t meta_size = 0;
+  RETURN_IF_NOT_OK(snapshot_->GetSection("meta", &meta_data, &meta_size));
+  try {
+    nlohmann::json meta = nlohmann::json::parse(std::string(reinterpret_cast<const char *>(meta_data), meta_size));
+    size_t num_nodes = meta.at("num_nodes").get<size_t>();
+    size_t num_edges = meta.at("num_edges").get<size_t>();
+    CHECK_FAIL_RETURN_UNEXPECTED(num_nodes < static_cast<size_t>(std::numeric_limits<NodeIndexType>::max()),
+                                 "Too many nodes:" + std::to_string(num_nodes));
+
+    // The tables are used in place, only the per type lists are built
+    RETURN_IF_NOT_OK(snapshot_->GetArray("node_ids", num_nodes, &node_ids_));
+    RETURN_IF_NOT_OK(snapshot_->GetArray("node_types", num_nodes, &node_types_));
+    CHECK_FAIL_RETURN_UNEXPECTED(std::adjacent_find(node_ids_, node_ids_ + num_nodes,
+                                                    std::greater_equal<NodeIdType>()) == node_ids_ + num_nodes,
+                                 "Node ids of snapshot are not sorted.");
+    num_nodes_ = num_nodes;
+    BuildTypeIndex();
+    for (const auto &itr : node_type_index_map_) {
+      std::vector<NodeIdType> &ids = node_type_map_[itr.first];
+      ids.reserve(itr.second.size());
+      for (NodeIndexType index : itr.second) {
+        ids.push_back(node_ids_[index]);
+      }
+    }
+
+    RETURN_IF_NOT_OK(snapshot_->GetArray("edge_ids", num_edges, &edge_ids_));
+    RETURN_IF_NOT_OK(snapshot_->GetArray("edge_types", num_edges, &edge_types_));
+    RETURN_IF_NOT_OK(snapshot_->GetArray("edge_src", num_edges, &edge_src_));
+    RETURN_IF_NOT_OK(snapshot_->GetArray("edge_dst", num_edges, &edge_dst_));
+    RETURN_IF_NOT_OK(snapshot_->GetArray("edge_weights", num_edges, &edge_weights_));
+    CHECK_FAIL_RETURN_UNEXPECTED(std::adjacent_find(edge_ids_, edge_ids_ + num_edges,
+                                                    std::greater_equal<EdgeIdType>()) == edge_ids_ + num_edges,
+                                 "Edge ids of snapshot are not sorted.");
+    num_edges_ = num_edges;
+    for (size_t i = 0; i < num_edges; ++i) {
+      if (edge_src_[i] < 0 || static_cast<size_t>(edge_src_[i]) >= num_nodes || edge_dst_[i] < 0 ||
+          static_cast<size_t>(edge_dst_[i]) >= num_nodes) {
+        RETURN_STATUS_UNEXPECTED("Invalid node of edge:" + std::to_string(edge_ids_[i]));
+      }
+      edge_type_map_[edge_types_[i]].push_back(edge_ids_[i]);
+    }
+
+    for (const auto &item : meta.at("adjacency")) {
+      NodeType type = item.at("type").get<NodeType>();
+      int64_t adj_edges = item.at("num_edges").get<int64_t>();
+      std::string section = "adjacency." + std::to_string(type);
+      const int64_t *offsets = nullptr;
+      const NodeIndexType *neighbors = nullptr, *alias = nullptr;
+      const float *alias_prob = nullptr;
+      RETURN_IF_NOT_OK(snapshot_->GetArray(section + ".offsets", num_nodes + 1, &offsets));
+      RETURN_IF_NOT_OK(snapshot_->GetArray(section + ".neighbors", adj_edges, &neighbors));
+      if (item.at("weighted").get<bool>()) {
+        RETURN_IF_NOT_OK(snapshot_->GetArray(section + ".alias_prob", adj_edges, &alias_prob));
+        RETURN_IF_NOT_OK(snapshot_->GetArray(section + ".alias", adj_edges, &alias));
+      }
+      RETURN_IF_NOT_OK(adjacency_[type].Attach(static_cast<NodeIndexType>(num_nodes), adj_edges, offsets, neighbors,
+                                               alias_prob, alias));
+    }
+
+    for (const auto &item : meta.at("node_feature_map")) {
+      for (FeatureType f_type : item.at("features")) {
+        node_feature_map_[item.at("type").get<NodeType>()].insert(f_type);
+      }
+    }
+    for (const auto &item : meta.at("edge_feature_map")) {
+      for (FeatureType f_type : item.at("features")) {
+        edge_feature_map_[item.at("type").get<EdgeType>()].insert(f_type);
+      }
+    }
+    RETURN_IF_NOT_OK(LoadFeatures("node_feature", num_nodes, meta.at("node_features"), &node_feature_columns_));
+    RETURN_IF_NOT_OK(LoadFeatures("edge_feature", num_edges, meta.at("edge_features"), &edge_feature_columns_));
+    MS_LOG(INFO) << "Graph loaded from snapshot " << snapshot_file << ", nodes:" << num_nodes
+                 << " edges:" << num_edges;
+  } catch (const std::exception &e) {
+    RETURN_STATUS_UNEXPECTED("Invalid graph snapshot " + snapshot_file + ":" + std::string(e.what()));
+  }
+  return Status::OK();
+}
 }  // namespace gnn
 }  // namespace dataset
 }  // namespace mindspore
@@ -16,14 +16,22 @@
 #ifndef DATASET_ENGINE_GNN_GRAPH_H_
 #define DATASET_ENGINE_GNN_GRAPH_H_
 
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <random>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
+#include <nlohmann/json.hpp>
 
 #include "dataset/core/tensor.h"
+#include "dataset/engine/gnn/csr_adjacency.h"
+#include "dataset/engine/gnn/feature_column.h"
 #include "dataset/engine/gnn/graph_loader.h"
+#include "dataset/engine/gnn/graph_snapshot.h"
 #include "dataset/engine/gnn/feature.h"
 #include "dataset/engine/gnn/node.h"
 #include "dataset/engine/gnn/edge.h"
@@ -86,27 +94,54 @@ class Graph {
   Status GetAllNeighbors(const std::vector<NodeIdType> &node_list, NodeType neighbor_type,
                          std::shared_ptr<Tensor> *out);
 
+  // Multi-hop neighbor sampling, neighbors are drawn with replacement and with probability proportional to the edge
+  // weight.
+  // @param std::vector<NodeType> node_list - List of nodes
+  // @param std::vector<NodeIdType> neighbor_nums - Number of neighbors sampled per node in each hop
+  // @param std::vector<NodeType> neighbor_types - Neighbor type sampled in each hop
+  // @param std::shared_ptr<Tensor> *out - Returned neighbor's id. Each row holds the node itself followed by the
+  // neighbors of every hop, i.e. 1 + n1 + n1 * n2 + ... columns. Neighbors of a node without neighbors of the
+  // requested type are filled as -1.
+  // @return Status - The error code return
   Status GetSampledNeighbor(const std::vector<NodeIdType> &node_list, const std::vector<NodeIdType> &neighbor_nums,
                             const std::vector<NodeType> &neighbor_types, std::shared_ptr<Tensor> *out);
+
+  // Sample nodes of a type that are not neighbors of the given nodes.
+  // @param std::vector<NodeType> node_list - List of nodes
+  // @param NodeIdType samples_num - Number of negative neighbors sampled per node
+  // @param NodeType neg_neighbor_type - The type of negative neighbor
+  // @param std::shared_ptr<Tensor> *out - Returned ids, each row holds the node itself followed by samples_num
+  // negative neighbors. If no node of the type is a negative neighbor, fill in tensor as -1.
+  // @return Status - The error code return
   Status GetNegSampledNeighbor(const std::vector<NodeIdType> &node_list, NodeIdType samples_num,
                                NodeType neg_neighbor_type, std::shared_ptr<Tensor> *out);
+
+  // Random walks following a meta path, biased as node2vec if p or q is not 1. Walks of different start nodes run in
+  // parallel on num_workers_ threads.
+  // @param std::vector<NodeType> node_list - List of start nodes
+  // @param std::vector<NodeType> meta_path - Neighbor type of each step
+  // @param float p - Return parameter of node2vec, the weight of going back to the previous node is 1/p
+  // @param float q - In-out parameter of node2vec, the weight of moving away from the previous node is 1/q
+  // @param NodeIdType default_node - Filled in the walk after it reaches a node without neighbors
+  // @param std::shared_ptr<Tensor> *out - Returned walks, each row holds the start node followed by one node per step
+  // @return Status - The error code return
   Status RandomWalk(const std::vector<NodeIdType> &node_list, const std::vector<NodeType> &meta_path, float p, float q,
                     NodeIdType default_node, std::shared_ptr<Tensor> *out);
 
-  // Get the feature of a node
-  // @param std::shared_ptr<Tensor> nodes - List of nodes
+  // Get the feature of a node, gathered from the feature columns on num_workers_ threads
+  // @param std::shared_ptr<Tensor> nodes - List of nodes, kDefaultNodeId gets the default feature
   // @param std::vector<FeatureType> feature_types - Types of features, An error will be reported if the feature type
   // does not exist.
-  // @param TensorRow *out - Returned features
+  // @param TensorRow *out - Returned features, nodes without the feature get the default feature
   // @return Status - The error code return
   Status GetNodeFeature(const std::shared_ptr<Tensor> &nodes, const std::vector<FeatureType> &feature_types,
                         TensorRow *out);
 
-  // Get the feature of a edge
-  // @param std::shared_ptr<Tensor> edget - List of edges
+  // Get the feature of a edge, gathered from the feature columns on num_workers_ threads
+  // @param std::shared_ptr<Tensor> edget - List of edges, kDefaultEdgeId gets the default feature
   // @param std::vector<FeatureType> feature_types - Types of features, An error will be reported if the feature type
   // does not exist.
-  // @param Tensor *out - Returned features
+  // @param Tensor *out - Returned features, edges without the feature get the default feature
   // @return Status - The error code return
   Status GetEdgeFeature(const std::shared_ptr<Tensor> &edget, const std::vector<FeatureType> &feature_types,
                         TensorRow *out);
@@ -117,8 +152,16 @@ class Graph {
   // @return Status - The error code return
   Status GetMetaInfo(std::vector<NodeMetaInfo> *node_info, std::vector<EdgeMetaInfo> *edge_info);
 
+  // Load the graph, either from the MindRecord dataset or from a snapshot if dataset_file is one
+  // @return Status - The error code return
   Status Init();
 
+  // Write the built graph to a snapshot file. A later Graph constructed with the snapshot as dataset_file starts
+  // without reading the MindRecord dataset.
+  // @param std::string snapshot_file - path of snapshot
+  // @return Status - The error code return
+  Status SaveSnapshot(const std::string &snapshot_file);
+
  private:
   // Load graph data from mindrecord file
   // @return Status - The error code return
@@ -132,33 +175,131 @@ class Graph {
   template <typename T>
   Status CreateTensorByVector(const std::vector<std::vector<T>> &data, DataType type, std::shared_ptr<Tensor> *out);
 
-  // Complete vector
-  // @param std::vector<std::vector<T>> *data - To be completed vector
-  // @param size_t max_size - The size of the completed vector
-  // @param T default_value - Filled default
-  // @return Status - The error code return
-  template <typename T>
-  Status ComplementVector(std::vector<std::vector<T>> *data, size_t max_size, T default_value);
-
   // Get the default feature of a node
   // @param FeatureType feature_type -
   // @param std::shared_ptr<Feature> *out_feature - Returned feature
   // @return Status - The error code return
   Status GetNodeDefaultFeature(FeatureType feature_type, std::shared_ptr<Feature> *out_feature);
 
+  // Compact the loaded nodes and edges into the dense tables, sorted by id
+  // @return Status - The error code return
+  Status BuildTables();
+
+  // Group the nodes of the dense tables by type
+  void BuildTypeIndex();
+
+  // Build one CSR adjacency per neighbor type from the edges of the dense tables
+  // @return Status - The error code return
+  Status BuildAdjacency();
+
+  // Restore the dense tables, features and topology from a snapshot, the arrays stay in the mapped file
+  // @param std::string snapshot_file - path of snapshot
+  // @return Status - The error code return
+  Status LoadSnapshot(const std::string &snapshot_file);
+
+  // Copy the features held by the loaded nodes and edges into one column per feature type, then release the nodes
+  // and edges
+  // @return Status - The error code return
+  Status BuildFeatureColumns();
+
+  // Build the columns of one kind of entity
+  // @param const std::vector<T> &entities - Nodes or edges ordered by dense index
+  // @param const std::unordered_map<K, std::unordered_set<FeatureType>> &feature_map - Feature types of each type
+  // @param std::unordered_map<FeatureType, FeatureColumn> *columns - Returned columns
+  // @return Status - The error code return
+  template <typename T, typename K>
+  Status BuildColumns(const std::vector<T> &entities,
+                      const std::unordered_map<K, std::unordered_set<FeatureType>> &feature_map,
+                      std::unordered_map<FeatureType, FeatureColumn> *columns);
+
+  // Gather the features of a list of nodes or edges
+  // @param std::shared_ptr<Tensor> ids - List of node or edge ids
+  // @param I default_id - Id that gets the default features
+  // @param std::vector<FeatureType> feature_types - Types of features
+  // @param const std::unordered_map<FeatureType, FeatureColumn> &columns - Columns of the kind of entity
+  // @param const I *sorted_ids - Ids of the kind of entity ordered by dense index
+  // @param size_t num_ids - Number of sorted_ids
+  // @param TensorRow *out - Returned features
+  // @return Status - The error code return
+  template <typename I>
+  Status GatherFeatures(const std::shared_ptr<Tensor> &ids, I default_id, const std::vector<FeatureType> &feature_types,
+                        const std::unordered_map<FeatureType, FeatureColumn> &columns, const I *sorted_ids,
+                        size_t num_ids, TensorRow *out);
+
+  // Add the feature columns of one kind of entity to a snapshot
+  // @param const std::string &prefix - section prefix, node_feature or edge_feature
+  // @param const std::unordered_map<FeatureType, FeatureColumn> &columns - Columns to add
+  // @param GraphSnapshotWriter *writer - Snapshot to add to
+  // @param nlohmann::json *meta - Returned description of the columns
+  // @return Status - The error code return
+  Status SaveFeatures(const std::string &prefix, const std::unordered_map<FeatureType, FeatureColumn> &columns,
+                      GraphSnapshotWriter *writer, nlohmann::json *meta);
+
+  // Attach the feature columns written by SaveFeatures to the mapped snapshot
+  // @param const std::string &prefix - section prefix, node_feature or edge_feature
+  // @param size_t num_rows - Number of nodes or edges
+  // @param const nlohmann::json &meta - Description of the columns
+  // @param std::unordered_map<FeatureType, FeatureColumn> *columns - Returned columns
+  // @return Status - The error code return
+  Status LoadFeatures(const std::string &prefix, size_t num_rows, const nlohmann::json &meta,
+                      std::unordered_map<FeatureType, FeatureColumn> *columns);
+
+  // Translate node ids to dense indices
+  // @param std::vector<NodeIdType> node_list - List of nodes
+  // @param std::vector<NodeIndexType> *out_index - Returned indices
+  // @return Status - The error code return, an error is reported if a node does not exist
+  Status GetNodeIndices(const std::vector<NodeIdType> &node_list, std::vector<NodeIndexType> *out_index);
+
+  // Split [0, num) into contiguous blocks and run them on num_workers_ threads. Each block gets its own random
+  // generator so that the workers never share state.
+  // @param size_t num - Number of items
+  // @param std::function func - Called as func(begin, end, rnd) for each block
+  // @return Status - The error code return, the first error of any block
+  Status ParallelFor(size_t num, const std::function<Status(size_t, size_t, std::mt19937 *)> &func);
+
   std::string dataset_file_;
   int32_t num_workers_;  // The number of worker threads
 
   std::unordered_map<NodeType, std::vector<NodeIdType>> node_type_map_;
-  std::unordered_map<NodeIdType, std::shared_ptr<Node>> node_id_map_;
+  std::unordered_map<NodeIdType, std::shared_ptr<Node>> node_id_map_;  // Released once the feature columns are built
 
   std::unordered_map<EdgeType, std::vector<EdgeIdType>> edge_type_map_;
-  std::unordered_map<EdgeIdType, std::shared_ptr<Edge>> edge_id_map_;
+  std::unordered_map<EdgeIdType, std::shared_ptr<Edge>> edge_id_map_;  // Released once the feature columns are built
 
   std::unordered_map<NodeType, std::unordered_set<FeatureType>> node_feature_map_;
   std::unordered_map<EdgeType, std::unordered_set<FeatureType>> edge_feature_map_;
 
   std::unordered_map<FeatureType, std::shared_ptr<Feature>> default_feature_map_;
+
+  // Dense tables ordered by node or edge index. Ids are sorted, so an id is translated to its index by binary search.
+  // The tables point to the owned arrays below after BuildTables, or into the mapped file after LoadSnapshot.
+  size_t num_nodes_ = 0;
+  const NodeIdType *node_ids_ = nullptr;
+  const NodeType *node_types_ = nullptr;
+  size_t num_edges_ = 0;
+  const EdgeIdType *edge_ids_ = nullptr;
+  const EdgeType *edge_types_ = nullptr;
+  const NodeIndexType *edge_src_ = nullptr;
+  const NodeIndexType *edge_dst_ = nullptr;
+  const EdgeWeightType *edge_weights_ = nullptr;
+
+  std::vector<NodeIdType> node_ids_data_;
+  std::vector<NodeType> node_types_data_;
+  std::vector<EdgeIdType> edge_ids_data_;
+  std::vector<EdgeType> edge_types_data_;
+  std::vector<NodeIndexType> edge_src_data_;
+  std::vector<NodeIndexType> edge_dst_data_;
+  std::vector<EdgeWeightType> edge_weights_data_;
+
+  std::unordered_map<NodeType, std::vector<NodeIndexType>> node_type_index_map_;
+  std::unordered_map<NodeType, CsrAdjacency> adjacency_;  // Keyed by neighbor type
+  std::unordered_map<FeatureType, FeatureColumn> node_feature_columns_;
+  std::unordered_map<FeatureType, FeatureColumn> edge_feature_columns_;
+
+  std::shared_ptr<GraphSnapshotReader> snapshot_;  // Keeps the mapped snapshot alive
+
+  std::mutex rnd_mutex_;
+  std::mt19937 rnd_;  // Seeds the per-block generators of ParallelFor
 };
 }  // namespace gnn
 }  // namespace dataset
@@ -59,7 +59,6 @@ Status GraphLoader::GetNodesAndEdges(NodeIdMap *n_id_map, EdgeIdMap *e_id_map, N
       CHECK_FAIL_RETURN_UNEXPECTED(src_itr != n_id_map->end(), "invalid src_id:" + std::to_string(src_itr->first));
       CHECK_FAIL_RETURN_UNEXPECTED(dst_itr != n_id_map->end(), "invalid src_id:" + std::to_string(dst_itr->first));
       RETURN_IF_NOT_OK(edge_ptr->SetNode({src_itr->second, dst_itr->second}));
-      RETURN_IF_NOT_OK(src_itr->second->AddNeighbor(dst_itr->second));
       e_id_map->insert({edge_ptr->id(), edge_ptr});  // add edge to edge_id_map_
       (*e_type_map)[edge_ptr->type()].push_back(edge_ptr->id());
       dq.pop_front();
@@ -138,7 +137,13 @@ Status GraphLoader::LoadEdge(const std::vector<uint8_t> &col_blob, const mindrec
   NodeIdType src_id = col_jsn["second_id"], dst_id = col_jsn["third_id"];
   std::shared_ptr<Node> src = std::make_shared<LocalNode>(src_id, -1);
   std::shared_ptr<Node> dst = std::make_shared<LocalNode>(dst_id, -1);
-  (*edge) = std::make_shared<LocalEdge>(edge_id, edge_type, src, dst);
+  // weight is an optional column, edges are sampled uniformly without it
+  EdgeWeightType weight = kDefaultEdgeWeight;
+  auto weight_itr = col_jsn.find("weight");
+  if (weight_itr != col_jsn.end() && weight_itr->is_number()) {
+    weight = weight_itr->get<EdgeWeightType>();
+  }
+  (*edge) = std::make_shared<LocalEdge>(edge_id, edge_type, src, dst, weight);
   std::vector<int32_t> indices;
   RETURN_IF_NOT_OK(LoadFeatureIndex("edge_feature_index", col_blob, col_jsn, &indices));
   for (int32_t ind : indices) {
@@ -0,0 +1,180 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "dataset/engine/gnn/graph_snapshot.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+namespace {
+uint64_t AlignUp(uint64_t value) {
+  return (value + kGraphSnapshotAlignment - 1) / kGraphSnapshotAlignment * kGraphSnapshotAlignment;
+}
+}  // namespace
+
+Status GraphSnapshotWriter::AddSection(const std::string &name, const void *data, size_t size) {
+  CHECK_FAIL_RETURN_UNEXPECTED(!name.empty() && name.size() < kGraphSnapshotNameSize,
+                               "Invalid snapshot section name:" + name);
+  CHECK_FAIL_RETURN_UNEXPECTED(data != nullptr || size == 0, "Snapshot section data is null:" + name);
+  for (const auto &section : sections_) {
+    CHECK_FAIL_RETURN_UNEXPECTED(section.name != name, "Duplicate snapshot section:" + name);
+  }
+  sections_.push_back({name, data, size});
+  return Status::OK();
+}
+
+Status GraphSnapshotWriter::AddSection(const std::string &name, std::string data) {
+  owned_data_.push_back(std::move(data));
+  return AddSection(name, owned_data_.back().data(), owned_data_.back().size());
+}
+
+Status GraphSnapshotWriter::Write(const std::string &path) {
+  std::vector<GraphSnapshotSection> table(sections_.size());
+  uint64_t offset = AlignUp(sizeof(GraphSnapshotHeader) + table.size() * sizeof(GraphSnapshotSection));
+  for (size_t i = 0; i < sections_.size(); ++i) {
+    (void)memset(&table[i], 0, sizeof(GraphSnapshotSection));
+    (void)memcpy(table[i].name, sections_[i].name.data(), sections_[i].name.size());
+    table[i].offset = offset;
+    table[i].size = sections_[i].size;
+    offset = AlignUp(offset + sections_[i].size);
+  }
+  GraphSnapshotHeader header;
+  (void)memset(&header, 0, sizeof(header));
+  (void)memcpy(header.magic, kGraphSnapshotMagic, sizeof(kGraphSnapshotMagic));
+  header.version = kGraphSnapshotVersion;
+  header.byte_order = kGraphSnapshotByteOrder;
+  header.num_sections = table.size();
+  header.file_size = offset;
+
+  std::string tmp_path = path + ".tmp";
+  std::ofstream out(tmp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+  CHECK_FAIL_RETURN_UNEXPECTED(out.is_open(), "Fail to open snapshot file:" + tmp_path);
+  const char padding[kGraphSnapshotAlignment] = {0};
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char *>(table.data()), table.size() * sizeof(GraphSnapshotSection));
+  uint64_t written = sizeof(header) + table.size() * sizeof(GraphSnapshotSection);
+  for (size_t i = 0; i < sections_.size(); ++i) {
+    out.write(padding, table[i].offset - written);
+    out.write(reinterpret_cast<const char *>(sections_[i].data), sections_[i].size);
+    written = table[i].offset + sections_[i].size;
+  }
+  out.write(padding, header.file_size - written);
+  out.close();
+  if (!out.good()) {
+    (void)remove(tmp_path.c_str());
+    RETURN_STATUS_UNEXPECTED("Fail to write snapshot file:" + tmp_path);
+  }
+  if (rename(tmp_path.c_str(), path.c_str()) != 0) {
+    (void)remove(tmp_path.c_str());
+    RETURN_STATUS_UNEXPECTED("Fail to rename snapshot file to:" + path);
+  }
+  MS_LOG(INFO) << "Graph snapshot written to " << path << ", size:" << header.file_size
+               << " sections:" << header.num_sections;
+  return Status::OK();
+}
+
+GraphSnapshotReader::~GraphSnapshotReader() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (mapped_ && base_ != nullptr) {
+    (void)munmap(const_cast<char *>(base_), size_);
+  }
+#endif
+}
+
+bool GraphSnapshotReader::IsSnapshot(const std::string &path) {
+  std::ifstream in(path, std::ios::in | std::ios::binary);
+  char magic[sizeof(kGraphSnapshotMagic)] = {0};
+  if (!in.is_open() || !in.read(magic, sizeof(magic))) {
+    return false;
+  }
+  return memcmp(magic, kGraphSnapshotMagic, sizeof(kGraphSnapshotMagic)) == 0;
+}
+
+Status GraphSnapshotReader::Open(const std::string &path) {
+  CHECK_FAIL_RETURN_UNEXPECTED(base_ == nullptr, "Snapshot is already open");
+#if !defined(_WIN32) && !defined(_WIN64)
+  int fd = open(path.c_str(), O_RDONLY);
+  CHECK_FAIL_RETURN_UNEXPECTED(fd >= 0, "Fail to open snapshot file:" + path);
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size < static_cast<off_t>(sizeof(GraphSnapshotHeader))) {
+    (void)close(fd);
+    RETURN_STATUS_UNEXPECTED("Invalid snapshot file:" + path);
+  }
+  size_ = static_cast<size_t>(file_stat.st_size);
+  void *addr = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+  (void)close(fd);
+  CHECK_FAIL_RETURN_UNEXPECTED(addr != MAP_FAILED, "Fail to map snapshot file:" + path);
+  base_ = reinterpret_cast<const char *>(addr);
+  mapped_ = true;
+#else
+  std::ifstream in(path, std::ios::in | std::ios::binary | std::ios::ate);
+  CHECK_FAIL_RETURN_UNEXPECTED(in.is_open(), "Fail to open snapshot file:" + path);
+  buffer_.resize(static_cast<size_t>(in.tellg()));
+  in.seekg(0);
+  CHECK_FAIL_RETURN_UNEXPECTED(in.read(buffer_.data(), buffer_.size()), "Fail to read snapshot file:" + path);
+  base_ = buffer_.data();
+  size_ = buffer_.size();
+#endif
+
+  CHECK_FAIL_RETURN_UNEXPECTED(size_ >= sizeof(GraphSnapshotHeader), "Invalid snapshot file:" + path);
+  const GraphSnapshotHeader *header = reinterpret_cast<const GraphSnapshotHeader *>(base_);
+  CHECK_FAIL_RETURN_UNEXPECTED(memcmp(header->magic, kGraphSnapshotMagic, sizeof(kGraphSnapshotMagic)) == 0,
+                               "Not a graph snapshot file:" + path);
+  CHECK_FAIL_RETURN_UNEXPECTED(header->byte_order == kGraphSnapshotByteOrder,
+                               "Graph snapshot was written on a host of different byte order:" + path);
+  if (header->version != kGraphSnapshotVersion) {
+    std::string err_msg = "Graph snapshot version " + std::to_string(header->version) + " is not supported, expect " +
+                          std::to_string(kGraphSnapshotVersion) + ". Please rebuild the snapshot:" + path;
+    RETURN_STATUS_UNEXPECTED(err_msg);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(header->file_size == size_, "Graph snapshot is truncated:" + path);
+  uint64_t table_end = sizeof(GraphSnapshotHeader) + header->num_sections * sizeof(GraphSnapshotSection);
+  CHECK_FAIL_RETURN_UNEXPECTED(header->num_sections < size_ && table_end <= size_, "Invalid snapshot file:" + path);
+
+  const GraphSnapshotSection *table = reinterpret_cast<const GraphSnapshotSection *>(base_ + sizeof(*header));
+  for (uint64_t i = 0; i < header->num_sections; ++i) {
+    const GraphSnapshotSection &section = table[i];
+    std::string name(section.name, strnlen(section.name, kGraphSnapshotNameSize));
+    if (section.offset < table_end || section.offset % kGraphSnapshotAlignment != 0 || section.offset > size_ ||
+        section.size > size_ - section.offset) {
+      RETURN_STATUS_UNEXPECTED("Invalid snapshot section:" + name);
+    }
+    sections_[name] = {section.offset, section.size};
+  }
+  return Status::OK();
+}
+
+Status GraphSnapshotReader::GetSection(const std::string &name, const void **data, size_t *size) const {
+  auto itr = sections_.find(name);
+  CHECK_FAIL_RETURN_UNEXPECTED(itr != sections_.end(), "Snapshot section not found:" + name);
+  *data = base_ + itr->second.first;
+  *size = static_cast<size_t>(itr->second.second);
+  return Status::OK();
+}
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
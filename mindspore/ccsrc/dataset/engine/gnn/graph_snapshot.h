@@ -0,0 +1,144 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef DATASET_ENGINE_GNN_GRAPH_SNAPSHOT_H_
+#define DATASET_ENGINE_GNN_GRAPH_SNAPSHOT_H_
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+constexpr char kGraphSnapshotMagic[] = "MSGRAPH";  // 8 bytes including the terminator
+constexpr uint32_t kGraphSnapshotVersion = 1;
+constexpr uint32_t kGraphSnapshotByteOrder = 0x01020304;
+constexpr uint64_t kGraphSnapshotAlignment = 64;
+constexpr size_t kGraphSnapshotNameSize = 48;
+
+// A snapshot file is a header, a table of named sections and the section data. Each section starts at a multiple of
+// kGraphSnapshotAlignment so that arrays can be used in place from a read-only mapping of the file.
+struct GraphSnapshotHeader {
+  char magic[sizeof(kGraphSnapshotMagic)];
+  uint32_t version;
+  uint32_t byte_order;
+  uint64_t num_sections;
+  uint64_t file_size;
+};
+
+struct GraphSnapshotSection {
+  char name[kGraphSnapshotNameSize];
+  uint64_t offset;
+  uint64_t size;
+};
+
+class GraphSnapshotWriter {
+ public:
+  GraphSnapshotWriter() = default;
+
+  ~GraphSnapshotWriter() = default;
+
+  // Add a section, data is not copied and must stay valid until Write returns
+  // @param std::string name - unique name of section
+  // @param const void *data - section data
+  // @param size_t size - size of data in bytes
+  // @return Status - The error code return
+  Status AddSection(const std::string &name, const void *data, size_t size);
+
+  // Add a section whose data is kept by the writer
+  // @param std::string name - unique name of section
+  // @param std::string data - section data
+  // @return Status - The error code return
+  Status AddSection(const std::string &name, std::string data);
+
+  // Write all sections to a temporary file, then move it to path
+  // @param std::string path - snapshot file
+  // @return Status - The error code return
+  Status Write(const std::string &path);
+
+ private:
+  struct PendingSection {
+    std::string name;
+    const void *data;
+    size_t size;
+  };
+
+  std::vector<PendingSection> sections_;
+  std::deque<std::string> owned_data_;
+};
+
+class GraphSnapshotReader {
+ public:
+  GraphSnapshotReader() = default;
+
+  GraphSnapshotReader(const GraphSnapshotReader &) = delete;
+
+  GraphSnapshotReader &operator=(const GraphSnapshotReader &) = delete;
+
+  ~GraphSnapshotReader();
+
+  // Check the magic of a file without opening it as a snapshot
+  // @param std::string path - file to check
+  // @return bool - true if the file starts like a graph snapshot
+  static bool IsSnapshot(const std::string &path);
+
+  // Map the file read-only and validate its header and section table. The mapping is shared, so processes that open
+  // the same snapshot share its pages.
+  // @param std::string path - snapshot file
+  // @return Status - The error code return
+  Status Open(const std::string &path);
+
+  // @param std::string name - name of section
+  // @return bool - true if the section exists
+  bool HasSection(const std::string &name) const { return sections_.find(name) != sections_.end(); }
+
+  // @param std::string name - name of section
+  // @param const void **data - Returned pointer to section data, valid as long as the reader lives
+  // @param size_t *size - Returned size of section in bytes
+  // @return Status - The error code return
+  Status GetSection(const std::string &name, const void **data, size_t *size) const;
+
+  // Get a section holding exactly count elements of T
+  // @param std::string name - name of section
+  // @param size_t count - expected number of elements
+  // @param const T **data - Returned pointer to the elements
+  // @return Status - The error code return
+  template <typename T>
+  Status GetArray(const std::string &name, size_t count, const T **data) const {
+    const void *section = nullptr;
+    size_t size = 0;
+    RETURN_IF_NOT_OK(GetSection(name, &section, &size));
+    CHECK_FAIL_RETURN_UNEXPECTED(size == count * sizeof(T), "Unexpected size of snapshot section:" + name);
+    *data = reinterpret_cast<const T *>(section);
+    return Status::OK();
+  }
+
+ private:
+  const char *base_ = nullptr;
+  size_t size_ = 0;
+  bool mapped_ = false;
+  std::vector<char> buffer_;  // File content on platforms without mmap
+  std::unordered_map<std::string, std::pair<uint64_t, uint64_t>> sections_;
+};
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // DATASET_ENGINE_GNN_GRAPH_SNAPSHOT_H_
@@ -36,7 +36,9 @@ class LocalEdge : public Edge {
   // @param EdgeType type - edge type
   // @param std::shared_ptr<Node> src_node - source node
   // @param std::shared_ptr<Node> dst_node - destination node
-  LocalEdge(EdgeIdType id, EdgeType type, std::shared_ptr<Node> src_node, std::shared_ptr<Node> dst_node);
+  // @param EdgeWeightType weight - weight used by weighted neighbor sampling
+  LocalEdge(EdgeIdType id, EdgeType type, std::shared_ptr<Node> src_node, std::shared_ptr<Node> dst_node,
+            EdgeWeightType weight = kDefaultEdgeWeight);
 
   ~LocalEdge() = default;
 
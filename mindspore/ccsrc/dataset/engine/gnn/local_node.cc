@@ -15,9 +15,7 @@
  */
 #include "dataset/engine/gnn/local_node.h"
 
-#include <algorithm>
 #include <string>
-#include <utility>
 
 #include "dataset/engine/gnn/edge.h"
 
@@ -38,36 +36,6 @@ Status LocalNode::GetFeatures(FeatureType feature_type, std::shared_ptr<Feature>
   }
 }
 
-Status LocalNode::GetNeighbors(NodeType neighbor_type, int32_t samples_num, std::vector<NodeIdType> *out_neighbors) {
-  std::vector<NodeIdType> neighbors;
-  auto itr = neighbor_nodes_.find(neighbor_type);
-  if (itr != neighbor_nodes_.end()) {
-    if (samples_num == -1) {
-      // Return all neighbors
-      neighbors.resize(itr->second.size() + 1);
-      neighbors[0] = id_;
-      std::transform(itr->second.begin(), itr->second.end(), neighbors.begin() + 1,
-                     [](const std::shared_ptr<Node> node) { return node->id(); });
-    } else {
-    }
-  } else {
-    neighbors.push_back(id_);
-    MS_LOG(DEBUG) << "No neighbors. node_id:" << id_ << " neighbor_type:" << neighbor_type;
-  }
-  *out_neighbors = std::move(neighbors);
-  return Status::OK();
-}
-
-Status LocalNode::AddNeighbor(const std::shared_ptr<Node> &node) {
-  auto itr = neighbor_nodes_.find(node->type());
-  if (itr != neighbor_nodes_.end()) {
-    itr->second.push_back(node);
-  } else {
-    neighbor_nodes_[node->type()] = {node};
-  }
-  return Status::OK();
-}
-
 Status LocalNode::UpdateFeature(const std::shared_ptr<Feature> &feature) {
   auto itr = features_.find(feature->type());
   if (itr != features_.end()) {
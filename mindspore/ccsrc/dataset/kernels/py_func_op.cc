@@ -27,58 +27,85 @@ namespace dataset {
 Status PyFuncOp::Compute(const std::vector<std::shared_ptr<Tensor>> &input,
                          std::vector<std::shared_ptr<Tensor>> *output) {
   IO_CHECK_VECTOR(input, output);
-  Status ret = Status(StatusCode::kOK, "PyFunc Call Succeed");
-  {
-    // Acquire Python GIL
-    py::gil_scoped_acquire gil_acquire;
-    if (Py_IsInitialized() == 0) {
-      ret = Status(StatusCode::kPythonInterpreterFailure, "Python Interpreter is finalized");
-      goto ComputeReturn;
+  // Acquire Python GIL
+  TimedGilAcquire gil_acquire(gil_counter_);
+  if (Py_IsInitialized() == 0) {
+    return Status(StatusCode::kPythonInterpreterFailure, "Python Interpreter is finalized");
+  }
+  return PyRowCompute(input, output);
+}
+
+Status PyFuncOp::ComputeRows(const TensorTable &input, TensorTable *output) {
+  if (output == nullptr) {
+    RETURN_STATUS_UNEXPECTED("output is null.");
+  }
+  for (const auto &row : input) {
+    IO_CHECK_VECTOR(row, output);
+  }
+  output->resize(input.size());
+  // Acquire Python GIL once for all rows, the other workers run their C++ ops in the meantime
+  TimedGilAcquire gil_acquire(gil_counter_);
+  if (Py_IsInitialized() == 0) {
+    return Status(StatusCode::kPythonInterpreterFailure, "Python Interpreter is finalized");
+  }
+  for (size_t r = 0; r < input.size(); r++) {
+    RETURN_IF_NOT_OK(PyRowCompute(input[r], &(*output)[r]));
+  }
+  return Status::OK();
+}
+
+Status PyFuncOp::TensorToNumpy(const std::shared_ptr<Tensor> &tensor, py::array *array) {
+  // A tensor that other rows or ops still share is copied, so a function that writes to its input only changes its
+  // own array. A tensor held by this row alone is dropped after the call, so writing to its view is harmless.
+  if (!tensor->type().IsNumeric() || tensor->GetBuffer() == nullptr || tensor.use_count() > 1) {
+    return tensor->GetDataAsNumpy(array);
+  }
+  py::buffer_info info;
+  RETURN_IF_NOT_OK(Tensor::GetBufferInfo(*tensor, &info));
+  // The capsule holds a reference to the tensor, it is released when python frees the array
+  py::capsule base(new std::shared_ptr<Tensor>(tensor),
+                   [](void *ptr) { delete reinterpret_cast<std::shared_ptr<Tensor> *>(ptr); });
+  *array = py::array(py::dtype(info), info.shape, info.strides, info.ptr, base);
+  return Status::OK();
+}
+
+Status PyFuncOp::PyRowCompute(const TensorRow &input, TensorRow *output) {
+  try {
+    // Transform input tensor vector into numpy array vector
+    py::tuple input_args(input.size());
+    for (size_t i = 0; i < input.size(); i++) {
+      py::array new_data;
+      RETURN_IF_NOT_OK(TensorToNumpy(input.at(i), &new_data));
+      input_args[i] = new_data;
     }
-    try {
-      // Transform input tensor vector into numpy array vector
-      py::tuple input_args(input.size());
-      for (size_t i = 0; i < input.size(); i++) {
-        py::array new_data;
-        RETURN_IF_NOT_OK(input.at(i)->GetDataAsNumpy(&new_data));
-        // possible memcpy here
-        input_args[i] = new_data;
-      }
-      // Invoke python function
-      py::object ret_py_obj = this->py_func_ptr_(*input_args);
-      // Process the return value
-      if (py::isinstance<py::array>(ret_py_obj)) {
-        // In case of a n-1 mapping, the return value will be a numpy array
+    // Invoke python function
+    py::object ret_py_obj = this->py_func_ptr_(*input_args);
+    // Process the return value
+    if (py::isinstance<py::array>(ret_py_obj)) {
+      // In case of a n-1 mapping, the return value will be a numpy array
+      std::shared_ptr<Tensor> out;
+      RETURN_IF_NOT_OK(Tensor::CreateTensor(&out, ret_py_obj.cast<py::array>()));
+      output->push_back(out);
+    } else if (py::isinstance<py::tuple>(ret_py_obj)) {
+      // In case of a n-m mapping, the return value will be a tuple of numpy arrays
+      py::tuple ret_py_tuple = ret_py_obj.cast<py::tuple>();
+      // Iterate over two containers simultaneously for memory copy
+      for (size_t i = 0; i < ret_py_tuple.size(); i++) {
+        py::object ret_py_ele = ret_py_tuple[i];
+        if (!py::isinstance<py::array>(ret_py_ele)) {
+          return Status(StatusCode::kShapeMisMatch, "PyFunc should return a numpy array or a numpy array tuple");
+        }
         std::shared_ptr<Tensor> out;
-        RETURN_IF_NOT_OK(Tensor::CreateTensor(&out, ret_py_obj.cast<py::array>()));
+        RETURN_IF_NOT_OK(Tensor::CreateTensor(&out, ret_py_ele.cast<py::array>()));
         output->push_back(out);
-      } else if (py::isinstance<py::tuple>(ret_py_obj)) {
-        // In case of a n-m mapping, the return value will be a tuple of numpy arrays
-        py::tuple ret_py_tuple = ret_py_obj.cast<py::tuple>();
-        // Iterate over two containers simultaneously for memory copy
-        for (size_t i = 0; i < ret_py_tuple.size(); i++) {
-          py::object ret_py_ele = ret_py_tuple[i];
-          if (!py::isinstance<py::array>(ret_py_ele)) {
-            goto ShapeMisMatch;
-          }
-          std::shared_ptr<Tensor> out;
-          RETURN_IF_NOT_OK(Tensor::CreateTensor(&out, ret_py_ele.cast<py::array>()));
-          output->push_back(out);
-        }
-      } else {
-        goto ShapeMisMatch;
       }
-    } catch (const py::error_already_set &e) {
-      ret = Status(StatusCode::kPyFuncException, e.what());
+    } else {
+      return Status(StatusCode::kShapeMisMatch, "PyFunc should return a numpy array or a numpy array tuple");
     }
+  } catch (const py::error_already_set &e) {
+    return Status(StatusCode::kPyFuncException, e.what());
   }
-
-ComputeReturn:
-  return ret;
-
-ShapeMisMatch:
-  ret = Status(StatusCode::kShapeMisMatch, "PyFunc should return a numpy array or a numpy array tuple");
-  goto ComputeReturn;
+  return Status(StatusCode::kOK, "PyFunc Call Succeed");
 }
 }  // namespace dataset
 }  // namespace mindspore
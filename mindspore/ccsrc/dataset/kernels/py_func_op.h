@@ -21,6 +21,7 @@
 #include <vector>
 #include <utility>
 
+#include "dataset/core/python_gil.h"
 #include "dataset/core/tensor.h"
 #include "dataset/kernels/tensor_op.h"
 
@@ -28,7 +29,8 @@ namespace mindspore {
 namespace dataset {
 class __attribute__((visibility("hidden"))) PyFuncOp : public TensorOp {
  public:
-  explicit PyFuncOp(py::function func) : py_func_ptr_(std::move(func)) {}
+  explicit PyFuncOp(py::function func)
+      : py_func_ptr_(std::move(func)), gil_counter_(GilMonitor::GetInstance().GetCounter("PyFuncOp")) {}
 
   ~PyFuncOp() override = default;
 
@@ -39,8 +41,25 @@ class __attribute__((visibility("hidden"))) PyFuncOp : public TensorOp {
   Status Compute(const std::vector<std::shared_ptr<Tensor>> &input,
                  std::vector<std::shared_ptr<Tensor>> *output) override;
 
+  // Compute function for a table of rows, the GIL is taken once for the whole table.
+  Status ComputeRows(const TensorTable &input, TensorTable *output) override;
+
  private:
+  // Call the python function on one row, the caller holds the GIL
+  // @param input - the input columns of the row
+  // @param output - the returned columns
+  // @return Status - The error code return
+  Status PyRowCompute(const TensorRow &input, TensorRow *output);
+
+  // Wrap a tensor as a numpy array without copying it, the array keeps the tensor alive. Tensors of strings and
+  // tensors shared with other holders are copied. The caller holds the GIL.
+  // @param tensor - the tensor to wrap
+  // @param array - the returned numpy array
+  // @return Status - The error code return
+  static Status TensorToNumpy(const std::shared_ptr<Tensor> &tensor, py::array *array);
+
   py::function py_func_ptr_;
+  GilWaitCounter *gil_counter_;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -49,6 +49,19 @@ Status TensorOp::Compute(const std::vector<std::shared_ptr<Tensor>> &input,
                 "Is this TensorOp oneToOne? If no, please implement this Compute() in the derived class.");
 }
 
+// Name: ComputeRows()
+// Description: This ComputeRows() runs the m-to-n Compute() on every row of a table.
+Status TensorOp::ComputeRows(const TensorTable &input, TensorTable *output) {
+  if (output == nullptr) {
+    RETURN_STATUS_UNEXPECTED("output is null.");
+  }
+  output->resize(input.size());
+  for (size_t r = 0; r < input.size(); r++) {
+    RETURN_IF_NOT_OK(Compute(input[r], &(*output)[r]));
+  }
+  return Status::OK();
+}
+
 void TensorOp::Print(std::ostream &out) const { out << "TensorOp" << std::endl; }
 
 Status TensorOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
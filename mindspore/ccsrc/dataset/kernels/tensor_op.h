@@ -78,6 +78,13 @@ class TensorOp {
   virtual Status Compute(const std::vector<std::shared_ptr<Tensor>> &input,
                          std::vector<std::shared_ptr<Tensor>> *output);
 
+  // Perform the operation on every row of a table, the default calls the m-to-n Compute() once per row.
+  // Ops with a fixed cost per call, like taking the Python GIL, override it to pay that cost once per table.
+  // @param input is a table of rows, each row holds the input columns.
+  // @param output is the address to an empty table, filled with one row per input row.
+  // @return Status
+  virtual Status ComputeRows(const TensorTable &input, TensorTable *output);
+
   // Returns true oif the TensorOp takes one input and returns one output.
   // @return true/false
   bool OneToOne() { return NumInput() == 1 && NumOutput() == 1; }
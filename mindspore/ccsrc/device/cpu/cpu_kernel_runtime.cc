@@ -41,6 +41,12 @@ void CPUKernelRuntime::AssignKernelAddress(session::KernelGraph *kernel_graph) {
   resource_manager_.MemMalloc(kernel_graph);
 }
 
+void CPUKernelRuntime::RunOpAssignKernelAddress(session::KernelGraph *kernel_graph) {
+  AssignValueNodeAddress(kernel_graph);
+  AssignInputNodeAddress(kernel_graph);
+  AssignKernelOutputAddress(kernel_graph);
+}
+
 void CPUKernelRuntime::AssignValueNodeAddress(session::KernelGraph *kernel_graph) {
   MS_EXCEPTION_IF_NULL(kernel_graph);
   size_t type_size = sizeof(float);
@@ -221,6 +227,37 @@ void CPUKernelRuntime::BindInputOutput(const session::KernelGraph *kernel_graph,
   }
 }
 
+void CPUKernelRuntime::UnbindInput(const session::KernelGraph *kernel_graph,
+                                   const std::vector<tensor::TensorPtr> &inputs) {
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  auto &input_nodes = kernel_graph->inputs();
+  if (input_nodes.size() != inputs.size()) {
+    MS_LOG(EXCEPTION) << "Input size not equal to input node size!";
+  }
+  for (size_t input_idx = 0; input_idx < input_nodes.size(); ++input_idx) {
+    auto &item = input_nodes[input_idx];
+    MS_EXCEPTION_IF_NULL(item);
+    if (!item->isa<Parameter>()) {
+      continue;
+    }
+    auto address = AnfAlgo::GetMutableOutputAddr(item, 0);
+    auto tensor = inputs[input_idx];
+    MS_EXCEPTION_IF_NULL(address);
+    MS_EXCEPTION_IF_NULL(tensor);
+    if (tensor->data_type() != kNumberTypeFloat32 && tensor->data_type() != kNumberTypeInt32 &&
+        address->ptr_ != nullptr) {
+      // the data was converted into memory of the runtime, copy it back in case the kernel updated it
+      if (!address->SyncDeviceToHost(tensor->shape(), LongToSize(tensor->data().nbytes()), tensor->data_type(),
+                                     tensor->data_c(true))) {
+        MS_LOG(EXCEPTION) << "Parameter node sync device to host failed!";
+      }
+      resource_manager_.MemFree(address->ptr_);
+    }
+    address->ptr_ = nullptr;
+    tensor->set_device_address(nullptr);
+  }
+}
+
 void CPUKernelRuntime::AddRuntimeAddress(DeviceAddress *address, std::vector<kernel::AddressPtr> *input_list) {
   MS_EXCEPTION_IF_NULL(address);
   kernel::AddressPtr input = std::make_shared<kernel::Address>();
@@ -234,6 +271,11 @@ void CPUKernelRuntime::AddRuntimeAddress(DeviceAddress *address, std::vector<ker
   input_list->push_back(input);
 }
 
+void CPUKernelRuntime::ClearGraphRuntimeResource(uint32_t graph_id) {
+  KernelRuntime::ClearGraphRuntimeResource(graph_id);
+  resource_manager_.ReleaseGraph(graph_id);
+}
+
 bool CPUKernelRuntime::Run(session::KernelGraph *kernel_graph) {
   MS_EXCEPTION_IF_NULL(kernel_graph);
   resource_manager_.ResetAddressRefCount(kernel_graph);
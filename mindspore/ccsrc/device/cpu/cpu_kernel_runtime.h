@@ -34,9 +34,15 @@ class CPUKernelRuntime : public KernelRuntime {
 
   bool Init() override { return true; }
   bool Run(session::KernelGraph *graph) override;
+  void ClearGraphRuntimeResource(uint32_t graph_id) override;
   void AssignKernelAddress(session::KernelGraph *kernel_graph);
+  // assign the addresses of a single op graph, whose memory is allocated when it runs instead of being planned, as
+  // the graph is kept and run again with the other single op graphs
+  void RunOpAssignKernelAddress(session::KernelGraph *kernel_graph);
   void BindInputOutput(const session::KernelGraph *kernel_graph, const std::vector<tensor::TensorPtr> &inputs,
                        VectorRef *outputs);
+  // detach the input tensors from the addresses of a graph that is run again with other inputs
+  void UnbindInput(const session::KernelGraph *kernel_graph, const std::vector<tensor::TensorPtr> &inputs);
 
  protected:
   bool SyncStream() override { return true; };
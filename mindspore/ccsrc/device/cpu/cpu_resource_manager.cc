@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 #include "device/cpu/cpu_resource_manager.h"
+#include <algorithm>
+#include <utility>
 #include "session/anf_runtime_algorithm.h"
 
 namespace mindspore {
@@ -27,6 +29,11 @@ void CPUResourceManager::MemFree() {
     mem_ptr_ = nullptr;
     mem_size_ = 0;
   }
+  for (auto ptr : retired_mem_) {
+    free(ptr);
+  }
+  retired_mem_.clear();
+  graph_mem_.clear();
 
   for (auto &&iter : dynamic_mem_) {
     free(iter.first);
@@ -38,7 +45,16 @@ void CPUResourceManager::MemPlan(const session::KernelGraph *graph) {
   mem_plan_.MemPlan(graph);
   size_t graph_mem_size = mem_plan_.GetGraphMemSize(graph);
   if (graph_mem_size > mem_size_) {
-    MemFree();
+    // the graphs planned before keep running in the current buffer
+    if (mem_ptr_ != nullptr) {
+      if (IsBufferUsed(mem_ptr_)) {
+        retired_mem_.push_back(mem_ptr_);
+      } else {
+        free(mem_ptr_);
+      }
+      mem_ptr_ = nullptr;
+      mem_size_ = 0;
+    }
     mem_ptr_ = reinterpret_cast<uint8_t *>(malloc(graph_mem_size));
     if (mem_ptr_ != nullptr) {
       mem_size_ = graph_mem_size;
@@ -54,7 +70,28 @@ void CPUResourceManager::MemMalloc(const session::KernelGraph *graph) {
   if (dynamic_malloc_) {
     return;
   }
+  MS_EXCEPTION_IF_NULL(graph);
   mem_plan_.MemAssign(graph, mem_ptr_);
+  graph_mem_[graph->graph_id()] = mem_ptr_;
+}
+
+bool CPUResourceManager::IsBufferUsed(const uint8_t *buffer) const {
+  return std::any_of(graph_mem_.begin(), graph_mem_.end(),
+                     [buffer](const std::pair<const uint32_t, uint8_t *> &item) { return item.second == buffer; });
+}
+
+void CPUResourceManager::ReleaseGraph(uint32_t graph_id) {
+  auto iter = graph_mem_.find(graph_id);
+  if (iter == graph_mem_.end()) {
+    return;
+  }
+  auto buffer = iter->second;
+  (void)graph_mem_.erase(iter);
+  auto retired = std::find(retired_mem_.begin(), retired_mem_.end(), buffer);
+  if (retired != retired_mem_.end() && !IsBufferUsed(buffer)) {
+    free(buffer);
+    (void)retired_mem_.erase(retired);
+  }
 }
 
 void *CPUResourceManager::MemMalloc(size_t mem_size) {
@@ -35,13 +35,20 @@ class CPUResourceManager {
   void DecreaseAddressRefCount(const AnfNodePtr &kernel);
   void *MemMalloc(size_t mem_size);
   void MemFree(void *ptr);
+  // forget a graph, the retired buffer it was planned in is freed once no graph uses it
+  void ReleaseGraph(uint32_t graph_id);
 
  private:
   void MemFree();
+  bool IsBufferUsed(const uint8_t *buffer) const;
   CPUSimpleMemPlan mem_plan_;
 
   size_t mem_size_{0};
   uint8_t *mem_ptr_{nullptr};
+  // buffers replaced by a larger one, still used by the graphs planned in them
+  std::vector<uint8_t *> retired_mem_;
+  // buffer each graph was planned in
+  std::unordered_map<uint32_t, uint8_t *> graph_mem_;
   bool dynamic_malloc_{false};
   std::unordered_map<void *, size_t> dynamic_mem_;
 };
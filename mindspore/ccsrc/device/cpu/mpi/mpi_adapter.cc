@@ -16,6 +16,8 @@
 
 #include "device/cpu/mpi/mpi_adapter.h"
 #include <algorithm>
+#include <climits>
+#include "Eigen/Core"
 #include "utils/log_adapter.h"
 
 namespace mindspore {
@@ -35,14 +37,122 @@ MPI_Op GetMpiOp(const std::string &op_type) {
   MS_LOG(EXCEPTION) << "unsupport op_type:" << op_type;
   return MPI_SUM;
 }
+
+template <typename T>
+void ReduceData(const T *input, T *inout, size_t data_num, const std::string &op_type) {
+  if (op_type == "sum") {
+    for (size_t i = 0; i < data_num; ++i) {
+      inout[i] = inout[i] + input[i];
+    }
+  } else if (op_type == "max") {
+    for (size_t i = 0; i < data_num; ++i) {
+      inout[i] = inout[i] < input[i] ? input[i] : inout[i];
+    }
+  } else if (op_type == "min") {
+    for (size_t i = 0; i < data_num; ++i) {
+      inout[i] = input[i] < inout[i] ? input[i] : inout[i];
+    }
+  } else if (op_type == "prod") {
+    for (size_t i = 0; i < data_num; ++i) {
+      inout[i] = inout[i] * input[i];
+    }
+  } else {
+    MS_LOG(EXCEPTION) << "unsupport op_type:" << op_type;
+  }
+}
+
+void HalfSum(void *input, void *inout, int *len, MPI_Datatype * /*datatype*/) {
+  ReduceData(static_cast<Eigen::half *>(input), static_cast<Eigen::half *>(inout), static_cast<size_t>(*len), "sum");
+}
+
+void HalfMax(void *input, void *inout, int *len, MPI_Datatype * /*datatype*/) {
+  ReduceData(static_cast<Eigen::half *>(input), static_cast<Eigen::half *>(inout), static_cast<size_t>(*len), "max");
+}
+
+void HalfMin(void *input, void *inout, int *len, MPI_Datatype * /*datatype*/) {
+  ReduceData(static_cast<Eigen::half *>(input), static_cast<Eigen::half *>(inout), static_cast<size_t>(*len), "min");
+}
+
+void HalfProd(void *input, void *inout, int *len, MPI_Datatype * /*datatype*/) {
+  ReduceData(static_cast<Eigen::half *>(input), static_cast<Eigen::half *>(inout), static_cast<size_t>(*len), "prod");
+}
+
+// After the n - 1 steps of the reduce-scatter, the rank r holds the reduced chunk (r + 1) % n, which the n - 1 steps
+// of the all-gather pass around the ring.
+template <typename T>
+bool RingAllReduceImpl(const T *input, T *output, size_t data_num, const std::string &op_type, MPI_Comm comm) {
+  int rank = 0;
+  int size = 0;
+  if (MPI_Comm_rank(comm, &rank) != MPI_SUCCESS || MPI_Comm_size(comm, &size) != MPI_SUCCESS) {
+    MS_LOG(ERROR) << "get the rank of the mpi comm fail!";
+    return false;
+  }
+  if (input != output) {
+    (void)std::copy(input, input + data_num, output);
+  }
+  if (size == 1) {
+    return true;
+  }
+  std::vector<size_t> counts(size, data_num / size);
+  std::vector<size_t> offsets(size, 0);
+  for (int i = 0; i < size; ++i) {
+    if (static_cast<size_t>(i) < data_num % size) {
+      counts[i]++;
+    }
+    offsets[i] = (i == 0) ? 0 : offsets[i - 1] + counts[i - 1];
+  }
+  if (counts[0] * sizeof(T) > INT_MAX) {
+    MS_LOG(ERROR) << "the chunk of " << counts[0] << " elements is too large for mpi!";
+    return false;
+  }
+  std::vector<T> recv_buffer(counts[0]);
+  int right = (rank + 1) % size;
+  int left = (rank + size - 1) % size;
+  for (int step = 0; step < size - 1; ++step) {
+    int send_chunk = (rank - step + size) % size;
+    int recv_chunk = (rank - step - 1 + size) % size;
+    auto ret = MPI_Sendrecv(output + offsets[send_chunk], static_cast<int>(counts[send_chunk] * sizeof(T)), MPI_BYTE,
+                            right, 0, recv_buffer.data(), static_cast<int>(counts[recv_chunk] * sizeof(T)), MPI_BYTE,
+                            left, 0, comm, MPI_STATUS_IGNORE);
+    if (ret != MPI_SUCCESS) {
+      MS_LOG(ERROR) << "mpi ring reduce-scatter fail!ret = " << ret << ", step:" << step;
+      return false;
+    }
+    ReduceData(recv_buffer.data(), output + offsets[recv_chunk], counts[recv_chunk], op_type);
+  }
+  for (int step = 0; step < size - 1; ++step) {
+    int send_chunk = (rank - step + 1 + size) % size;
+    int recv_chunk = (rank - step + size) % size;
+    auto ret = MPI_Sendrecv(output + offsets[send_chunk], static_cast<int>(counts[send_chunk] * sizeof(T)), MPI_BYTE,
+                            right, 1, output + offsets[recv_chunk], static_cast<int>(counts[recv_chunk] * sizeof(T)),
+                            MPI_BYTE, left, 1, comm, MPI_STATUS_IGNORE);
+    if (ret != MPI_SUCCESS) {
+      MS_LOG(ERROR) << "mpi ring all-gather fail!ret = " << ret << ", step:" << step;
+      return false;
+    }
+  }
+  return true;
+}
 }  // namespace
 
-MPIAdapter::MPIAdapter() : rank_id_(0), rank_size_(0), comm_group_world_(MPI_GROUP_NULL) { Init(); }
+MPIAdapter::MPIAdapter()
+    : rank_id_(0), rank_size_(0), comm_group_world_(MPI_GROUP_NULL), half_type_(MPI_DATATYPE_NULL) {
+  Init();
+}
 
 MPIAdapter::~MPIAdapter() {
+  for (auto iter = ranks_comm_.begin(); iter != ranks_comm_.end(); ++iter) {
+    MPI_Comm_free(&iter->second);
+  }
   for (auto iter = ranks_group_.begin(); iter != ranks_group_.end(); ++iter) {
     MPI_Group_free(&iter->second);
   }
+  for (auto iter = half_ops_.begin(); iter != half_ops_.end(); ++iter) {
+    MPI_Op_free(&iter->second);
+  }
+  if (half_type_ != MPI_DATATYPE_NULL) {
+    MPI_Type_free(&half_type_);
+  }
   if (comm_group_world_ != MPI_GROUP_NULL) {
     MPI_Group_free(&comm_group_world_);
   }
@@ -89,6 +199,20 @@ void MPIAdapter::Init() {
   if (ret != MPI_SUCCESS) {
     MS_LOG(EXCEPTION) << "Failed to init mpi rank size!rankid:" << rank_id_;
   }
+
+  if (MPI_Type_contiguous(sizeof(Eigen::half), MPI_BYTE, &half_type_) != MPI_SUCCESS ||
+      MPI_Type_commit(&half_type_) != MPI_SUCCESS) {
+    MS_LOG(EXCEPTION) << "Failed to init mpi float16 type!rankid:" << rank_id_;
+  }
+  std::map<std::string, MPI_User_function *> half_functions = {
+    {"sum", HalfSum}, {"max", HalfMax}, {"min", HalfMin}, {"prod", HalfProd}};
+  for (auto &function : half_functions) {
+    MPI_Op op = MPI_OP_NULL;
+    if (MPI_Op_create(function.second, 1, &op) != MPI_SUCCESS) {
+      MS_LOG(EXCEPTION) << "Failed to init mpi float16 op " << function.first << "!rankid:" << rank_id_;
+    }
+    half_ops_[function.first] = op;
+  }
   init = true;
 }
 
@@ -123,6 +247,25 @@ MPI_Group MPIAdapter::AddGroup(const std::vector<int> &ranks) {
   return group;
 }
 
+MPI_Comm MPIAdapter::GetComm(const std::vector<int> &ranks) {
+  auto group = AddGroup(ranks);
+  if (group == MPI_GROUP_NULL) {
+    MS_LOG(EXCEPTION) << "Get mpi group fail!rankid:" << rank_id_;
+  }
+  std::lock_guard<std::mutex> lock(group_mutex_);
+  auto iter = ranks_comm_.find(ranks);
+  if (iter != ranks_comm_.end()) {
+    return iter->second;
+  }
+  MPI_Comm comm = MPI_COMM_NULL;
+  MPI_Comm_create_group(MPI_COMM_WORLD, group, 0, &comm);
+  if (comm == MPI_COMM_NULL) {
+    MS_LOG(EXCEPTION) << "create mpi comm fail!rankid:" << rank_id_;
+  }
+  ranks_comm_[ranks] = comm;
+  return comm;
+}
+
 bool MPIAdapter::ReduceScatter(float *input, float *output, const std::vector<int> &ranks_group, size_t data_num,
                                const std::string &op_type) {
   if (ranks_group.empty()) {
@@ -186,6 +329,69 @@ bool MPIAdapter::AllGather(float *input, float *output, const std::vector<int> &
   }
   return result;
 }
+
+bool MPIAdapter::AllReduce(const void *input, void *output, const std::vector<int> &ranks_group, size_t data_num,
+                           TypeId type_id, const std::string &op_type) {
+  if (ranks_group.empty()) {
+    MS_LOG(ERROR) << "input rank group is empty!";
+    return false;
+  }
+  if (data_num > INT_MAX) {
+    MS_LOG(ERROR) << "the data of " << data_num << " elements is too large for mpi!";
+    return false;
+  }
+  MPI_Datatype data_type = MPI_FLOAT;
+  MPI_Op op = MPI_SUM;
+  if (type_id == kNumberTypeFloat32) {
+    op = GetMpiOp(op_type);
+  } else if (type_id == kNumberTypeInt32) {
+    data_type = MPI_INT;
+    op = GetMpiOp(op_type);
+  } else if (type_id == kNumberTypeFloat16) {
+    auto iter = half_ops_.find(op_type);
+    if (iter == half_ops_.end()) {
+      MS_LOG(EXCEPTION) << "unsupport op_type:" << op_type;
+    }
+    data_type = half_type_;
+    op = iter->second;
+  } else {
+    MS_LOG(EXCEPTION) << "unsupport data type:" << TypeIdLabel(type_id);
+  }
+  auto comm = GetComm(ranks_group);
+  auto send_buffer = (input == output) ? MPI_IN_PLACE : input;
+  auto ret = MPI_Allreduce(send_buffer, output, static_cast<int>(data_num), data_type, op, comm);
+  if (ret != MPI_SUCCESS) {
+    MS_LOG(ERROR) << "mpi allreduce fail!ret = " << ret << ", rankid:" << rank_id_;
+    return false;
+  }
+  return true;
+}
+
+bool MPIAdapter::RingAllReduce(const void *input, void *output, const std::vector<int> &ranks_group, size_t data_num,
+                               TypeId type_id, const std::string &op_type) {
+  if (ranks_group.empty()) {
+    MS_LOG(ERROR) << "input rank group is empty!";
+    return false;
+  }
+  auto comm = GetComm(ranks_group);
+  bool result = false;
+  if (type_id == kNumberTypeFloat32) {
+    result =
+      RingAllReduceImpl(static_cast<const float *>(input), static_cast<float *>(output), data_num, op_type, comm);
+  } else if (type_id == kNumberTypeInt32) {
+    result =
+      RingAllReduceImpl(static_cast<const int32_t *>(input), static_cast<int32_t *>(output), data_num, op_type, comm);
+  } else if (type_id == kNumberTypeFloat16) {
+    result = RingAllReduceImpl(static_cast<const Eigen::half *>(input), static_cast<Eigen::half *>(output), data_num,
+                               op_type, comm);
+  } else {
+    MS_LOG(EXCEPTION) << "unsupport data type:" << TypeIdLabel(type_id);
+  }
+  if (!result) {
+    MS_LOG(ERROR) << "mpi ring allreduce fail!rankid:" << rank_id_;
+  }
+  return result;
+}
 }  // namespace cpu
 }  // namespace device
 }  // namespace mindspore
@@ -22,11 +22,14 @@
 #include <map>
 #include <string>
 #include <mutex>
+#include "ir/dtype/type.h"
 
 namespace mindspore {
 namespace device {
 namespace cpu {
 constexpr auto kOpTypeSum = "sum";
+constexpr auto kAllReduceAlgorithmMpi = "mpi";
+constexpr auto kAllReduceAlgorithmRing = "ring";
 class MPIAdapter {
  public:
   ~MPIAdapter();
@@ -35,18 +38,31 @@ class MPIAdapter {
   bool ReduceScatter(float *input, float *output, const std::vector<int> &ranks_group, size_t data_num,
                      const std::string &op_type = kOpTypeSum);
   bool AllGather(float *input, float *output, const std::vector<int> &ranks_group, size_t data_num);
+  // data_num elements of type_id, which is float32, float16 or int32, by the allreduce of mpi
+  bool AllReduce(const void *input, void *output, const std::vector<int> &ranks_group, size_t data_num, TypeId type_id,
+                 const std::string &op_type = kOpTypeSum);
+  // the same as AllReduce, by a reduce-scatter and an all-gather around the ring of the ranks, each rank sending
+  // 2 * (n - 1) / n of the data whatever the number n of ranks
+  bool RingAllReduce(const void *input, void *output, const std::vector<int> &ranks_group, size_t data_num,
+                     TypeId type_id, const std::string &op_type = kOpTypeSum);
 
  private:
   MPIAdapter();
   void Init();
   MPI_Group AddGroup(const std::vector<int> &ranks);
+  MPI_Comm GetComm(const std::vector<int> &ranks);
 
   int rank_id_;
   int rank_size_;
   MPI_Group comm_group_world_;
   // key:ranks group, value: mpi group
   std::map<std::vector<int>, MPI_Group> ranks_group_;
+  // key:ranks group, value: mpi comm, kept for the allreduce of every step
+  std::map<std::vector<int>, MPI_Comm> ranks_comm_;
   std::mutex group_mutex_;
+  // mpi has no float16, which is reduced by the ops of mindspore
+  MPI_Datatype half_type_;
+  std::map<std::string, MPI_Op> half_ops_;
 };
 }  // namespace cpu
 }  // namespace device
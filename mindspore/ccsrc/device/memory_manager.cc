@@ -15,9 +15,12 @@
  */
 
 #include "device/memory_manager.h"
+#include <string>
+#include "pre_activate/mem_reuse/mem_reuse_interval_planner.h"
 #include "session/anf_runtime_algorithm.h"
 #include "utils/context/ms_context.h"
 using mindspore::memreuse::BestFitMemReuse;
+using mindspore::memreuse::GreedyBySizeMemReuse;
 using mindspore::memreuse::MemReuseUtilPtr;
 namespace mindspore {
 namespace device {
@@ -35,11 +38,41 @@ void MemoryManager::MallocReusedDynamicMem(session::KernelGraph *graph) {
   MS_EXCEPTION_IF_NULL(mem_reuse_util_ptr);
   // set all infos
   mem_reuse_util_ptr->SetAllInfo(graph);
-  auto bestfit_mem_reuse = std::make_shared<BestFitMemReuse>();
-  MS_EXCEPTION_IF_NULL(bestfit_mem_reuse);
-  bestfit_mem_reuse->Reuse(mem_reuse_util_ptr.get());
-  size_t total_allocated_size = bestfit_mem_reuse->GetAllocatedSize();
+  auto context_ptr = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context_ptr);
+  std::string planner = context_ptr->mem_reuse_planner();
+  if (planner == kGreedyBySizePlanner && !GreedyBySizeMemReuse::IsSupported(mem_reuse_util_ptr.get())) {
+    MS_LOG(WARNING) << "The greedy by size memory planner supports a single stream only, use best fit instead";
+    planner = kBestFitPlanner;
+  }
+  // the intervals are read before the planners consume the reference counts
+  std::vector<memreuse::MemInterval> intervals;
+  if (context_ptr->save_graphs_flag()) {
+    intervals = memreuse::GetMemIntervals(mem_reuse_util_ptr.get());
+  }
+  size_t total_allocated_size = 0;
+  if (planner == kGreedyBySizePlanner) {
+    auto greedy_mem_reuse = std::make_shared<GreedyBySizeMemReuse>();
+    greedy_mem_reuse->Reuse(mem_reuse_util_ptr.get());
+    total_allocated_size = greedy_mem_reuse->GetAllocatedSize();
+  } else {
+    auto bestfit_mem_reuse = std::make_shared<BestFitMemReuse>();
+    MS_EXCEPTION_IF_NULL(bestfit_mem_reuse);
+    bestfit_mem_reuse->Reuse(mem_reuse_util_ptr.get());
+    total_allocated_size = bestfit_mem_reuse->GetAllocatedSize();
+  }
   MS_LOG(INFO) << "TotalReuseDynamicSize [" << total_allocated_size << "]";
+  if (context_ptr->save_graphs_flag()) {
+    for (auto &interval : intervals) {
+      interval.offset = interval.ref->offset_;
+    }
+    auto save_graphs_path = context_ptr->save_graphs_path();
+    if (save_graphs_path.empty()) {
+      save_graphs_path = ".";
+    }
+    std::string file_path = save_graphs_path + "/mem_reuse_intervals_" + std::to_string(graph->graph_id()) + ".txt";
+    memreuse::DumpMemIntervals(file_path, planner, total_allocated_size, intervals);
+  }
   mem_reuse_util_ptr_ = mem_reuse_util_ptr;
   auto base_ptr = MallocDynamicMem(total_allocated_size, false);
   mem_reuse_util_ptr_->set_mem_base(base_ptr);
@@ -79,6 +79,7 @@ void FuncGraphManager::Reset() {
   func_graphs_ = FuncGraphSet();
   all_nodes_ = AnfNodeSet();
   node_users_ = NodeUsersMap();
+  dirty_func_graphs_ = FuncGraphSet();
 
   signals_ = std::make_shared<Signals>();
 
@@ -106,6 +107,7 @@ void FuncGraphManager::Init() {
 FuncGraphSet &FuncGraphManager::func_graph_parents_total(const FuncGraphPtr &fg) const {
   MS_EXCEPTION_IF_NULL(fg);
   MS_LOG(DEBUG) << "Start func_graph_parents_total func graph " << fg->ToString();
+  InvalidateDirtyFuncGraphs();
   func_graph_parents_total_->Recompute(fg);
   MS_LOG(DEBUG) << "End func_graph_parents func graph " << fg->ToString();
   return func_graph_parents_total_->func_graph_parents_total_analysis()[fg];
@@ -115,6 +117,7 @@ FuncGraphPtr FuncGraphManager::parent(const FuncGraphPtr &fg) const {
   MS_EXCEPTION_IF_NULL(fg);
   MS_EXCEPTION_IF_NULL(func_graph_parent_);
   MS_LOG(DEBUG) << "Start parents func graph " << fg->ToString();
+  InvalidateDirtyFuncGraphs();
   func_graph_parent_->Recompute(fg);
   if (func_graph_parent_->parent_analysis().count(fg) == 0) {
     MS_LOG(WARNING) << "This func graph is not in manager:" << fg->ToString();
@@ -128,6 +131,7 @@ FuncGraphSet &FuncGraphManager::children(const FuncGraphPtr &fg) const {
   MS_EXCEPTION_IF_NULL(fg);
   MS_EXCEPTION_IF_NULL(children_);
   MS_LOG(DEBUG) << "Start child func graph " << fg->ToString();
+  InvalidateDirtyFuncGraphs();
   children_->Recompute(fg);
   return children_->children_analysis()[fg];
 }
@@ -136,6 +140,7 @@ FuncGraphSet &FuncGraphManager::scopes(const FuncGraphPtr &fg) const {
   MS_EXCEPTION_IF_NULL(fg);
   MS_EXCEPTION_IF_NULL(scopes_);
   MS_LOG(DEBUG) << "Start scopes func graph:" << fg->ToString();
+  InvalidateDirtyFuncGraphs();
   scopes_->Recompute(fg);
   MS_LOG(DEBUG) << "End scopes func graph:" << fg->ToString();
   return scopes_->scope_analysis()[fg];
@@ -143,18 +148,21 @@ FuncGraphSet &FuncGraphManager::scopes(const FuncGraphPtr &fg) const {
 
 FVTotalMap &FuncGraphManager::free_variables_total() const {
   MS_EXCEPTION_IF_NULL(free_variables_total_);
+  InvalidateDirtyFuncGraphs();
   free_variables_total_->Recompute();
   return free_variables_total_->fv_total_analysis();
 }
 
 FuncGraphSet &FuncGraphManager::func_graphs_used_total(const FuncGraphPtr &fg) const {
   MS_EXCEPTION_IF_NULL(func_graphs_used_total_);
+  InvalidateDirtyFuncGraphs();
   func_graphs_used_total_->Recompute(fg);
   return func_graphs_used_total_->func_graph_used_total_analysis()[fg];
 }
 
 bool FuncGraphManager::recursive(const FuncGraphPtr &fg) const {
   MS_EXCEPTION_IF_NULL(fg);
+  InvalidateDirtyFuncGraphs();
   recursive_->Recompute(fg);
   if (recursive_->recursive_analysis().count(fg) == 0) {
     MS_LOG(WARNING) << "This func graph is not in manager: " << fg->ToString();
@@ -183,6 +191,7 @@ std::shared_ptr<std::list<FuncGraphPtr>> FuncGraphManager::recursive_graphs(cons
 bool FuncGraphManager::func_graph_j_total(const FuncGraphPtr &fg) const {
   MS_EXCEPTION_IF_NULL(j_total_);
   MS_EXCEPTION_IF_NULL(fg);
+  InvalidateDirtyFuncGraphs();
   j_total_->Recompute(fg);
   if (j_total_->j_total_analysis().count(fg) == 0) {
     MS_LOG(WARNING) << "This func graph is not in manager: " << fg->ToString();
@@ -213,6 +222,7 @@ void FuncGraphManager::Clear() {
   all_nodes_.clear();
   node_users_.clear();
   roots_.clear();
+  dirty_func_graphs_.clear();
 
   signals_->InvalidateComputer();
 }
@@ -312,6 +322,8 @@ void FuncGraphManager::MaybeDropFuncGraphs(const FuncGraphSet &func_graphs, bool
     if (fg->manager().get() == this) {
       fg->set_manager(nullptr);
     }
+    // drop its analyses
+    dirty_func_graphs_.add(fg);
     MS_LOG(DEBUG) << "Func graph dropped " << fg->ToString();
   }
 }
@@ -472,15 +484,16 @@ void FuncGraphManager::AddEdge(AnfNodePtr node, int index, AnfNodePtr input) {
       auto used = GetValueNode<FuncGraphPtr>(input);
       used->AddFuncGraphCNodeIndex(std::make_shared<CNodeIndexPair>(std::make_pair(node, index)));
       if (fg->AddFuncGraphUsed(used)) {
-        signals_->InvalidateComputer();
+        dirty_func_graphs_.add(fg);
       }
       if (IsPrimitiveCNode(node, prim::kPrimJ)) {
         fg->AddJFuncGraph(used);
+        dirty_func_graphs_.add(fg);
       }
     }
   } else if (fg != nullptr && fg != input->func_graph()) {
     if (fg->AddFreeVariable(input)) {
-      signals_->InvalidateComputer();
+      dirty_func_graphs_.add(fg);
     }
   }
 }
@@ -493,19 +506,43 @@ void FuncGraphManager::DropEdge(AnfNodePtr node, int index, AnfNodePtr input) {
       auto used = GetValueNode<FuncGraphPtr>(input);
       used->DropFuncGraphCNodeIndex(std::make_shared<CNodeIndexPair>(std::make_pair(node, index)));
       if (fg->DropFuncGraphUsed(used)) {
-        signals_->InvalidateComputer();
+        dirty_func_graphs_.add(fg);
       }
       if (IsPrimitiveCNode(node, prim::kPrimJ)) {
         fg->DropJFuncGraph(used);
+        dirty_func_graphs_.add(fg);
       }
     }
   } else if (fg != nullptr && fg != input->func_graph()) {
     if (fg->DropFreeVariable(input)) {
-      signals_->InvalidateComputer();
+      dirty_func_graphs_.add(fg);
     }
   }
 }
 
+void FuncGraphManager::InvalidateDirtyFuncGraphs() const {
+  if (dirty_func_graphs_.empty()) {
+    return;
+  }
+  FuncGraphSet dirty = dirty_func_graphs_;
+  dirty_func_graphs_.clear();
+  std::vector<FuncGraphPtr> todo(dirty.begin(), dirty.end());
+  while (!todo.empty()) {
+    auto fg = todo.back();
+    todo.pop_back();
+    for (auto &item : fg->func_graph_cnodes_index()) {
+      MS_EXCEPTION_IF_NULL(item.first);
+      auto user = item.first->first->func_graph();
+      if (user != nullptr && !dirty.contains(user)) {
+        dirty.add(user);
+        todo.push_back(user);
+      }
+    }
+  }
+  MS_LOG(DEBUG) << "Invalidate the analyses of " << dirty.size() << " func graphs";
+  signals_->InvalidateFuncGraphs(dirty);
+}
+
 void FuncGraphManager::MoveAllNodes(FuncGraphPtr source, FuncGraphPtr target) {
   target->CopyNodes(source);
   target->CopyValueNodes(source);
@@ -607,7 +644,8 @@ bool FuncGraphTransaction::Replace(const AnfNodePtr &old_node, const AnfNodePtr
     MS_LOG(WARNING) << "Cannot replace the return node of a func graph " << old_func_graph->ToString();
     return false;
   }
-  auto users = manager_->node_users()[old_node];
+  // the users are only updated by the commit
+  const auto &users = manager_->node_users()[old_node];
   for (auto &node : users) {
     SetEdge(node.first, node.second, new_node);
   }
@@ -732,12 +770,24 @@ bool CounterFuncGraphCollector::Mod(const FuncGraphPtr &func_graph, const FuncGr
 DepComputer::DepComputer(const FuncGraphManager *const manager) : FuncGraphAnalysis(manager) {
   MS_EXCEPTION_IF_NULL(manager_);
   manager_->signals()->InvalidateComputer.connect(this, &DepComputer::OnInvalidateComputer);
+  manager_->signals()->InvalidateFuncGraphs.connect(this, &DepComputer::OnInvalidateFuncGraphs);
   validate_ = false;
 }
 
+void DepComputer::OnInvalidateFuncGraphs(const FuncGraphSet &func_graphs) {
+  for (auto &fg : func_graphs) {
+    if (!ExtraInvalidate(fg)) {
+      Reset();
+      return;
+    }
+    (void)func_graphs_validate_.erase(fg);
+  }
+}
+
 void DepComputer::Recompute() {
   if (!validate_) {
     RealRecompute();
+    recompute_count_++;
     validate_ = true;
   }
 }
@@ -745,6 +795,7 @@ void DepComputer::Recompute() {
 void DepComputer::Recompute(const FuncGraphPtr &fg) {
   if (func_graphs_validate_.count(fg) == 0 || !func_graphs_validate_[fg]) {
     RealRecompute(fg);
+    recompute_count_++;
     func_graphs_validate_[fg] = true;
   }
 }
@@ -97,6 +97,7 @@ struct Signals {
   Signal<void(FuncGraphPtr, FuncGraphPtr)> MoveAllCNode;
   Signal<void()> InvalidateCollector;
   Signal<void()> InvalidateComputer;
+  Signal<void(const FuncGraphSet &)> InvalidateFuncGraphs;
 };
 
 enum EdgeProcessDirection { kDecEdge = -1, kIncEdge = 1 };
@@ -242,6 +243,9 @@ class DepComputer : public FuncGraphAnalysis {
 
   void OnInvalidateComputer() { Reset(); }
 
+  // drop the analyses of the given graphs, or all of them if the subclass can't drop them one by one
+  void OnInvalidateFuncGraphs(const FuncGraphSet &func_graphs);
+
   void Recompute();
 
   void Recompute(const FuncGraphPtr &fg);
@@ -250,6 +254,9 @@ class DepComputer : public FuncGraphAnalysis {
 
   bool IsValidate(const FuncGraphPtr &fg) { return func_graphs_validate_[fg]; }
 
+  // number of real recomputes since the computer was created
+  size_t recompute_count() const { return recompute_count_; }
+
   void OnAddFuncGraph(FuncGraphPtr) final { Reset(); }
 
   void OnDropFuncGraph(FuncGraphPtr) final { Reset(); }
@@ -258,12 +265,15 @@ class DepComputer : public FuncGraphAnalysis {
   // subclass do the real compute
   virtual void RealRecompute() {}
   virtual void RealRecompute(FuncGraphPtr) {}
+  // subclass drop the analysis of a graph, return false if the analyses of other graphs may depend on it
+  virtual bool ExtraInvalidate(const FuncGraphPtr &) { return false; }
 
   bool validate_;
   OrderedMap<FuncGraphPtr, bool> func_graphs_validate_;
 
  private:
   friend FuncGraphManager;
+  size_t recompute_count_{0};
 };
 
 // graph g's all direct or proxy parents
@@ -281,6 +291,11 @@ class FuncGraphParentsTotalComputer final : public DepComputer {
  protected:
   void ExtraReset() override { func_graph_parents_total_analysis_.clear(); }
 
+  bool ExtraInvalidate(const FuncGraphPtr &fg) override {
+    (void)func_graph_parents_total_analysis_.erase(fg);
+    return true;
+  }
+
   void RealRecompute(FuncGraphPtr fg) override;
 
  private:
@@ -379,6 +394,11 @@ class FuncGraphsUsedTotalComputer final : public DepComputer {
  protected:
   void ExtraReset() override { func_graph_used_total_analysis_.clear(); }
 
+  bool ExtraInvalidate(const FuncGraphPtr &fg) override {
+    (void)func_graph_used_total_analysis_.erase(fg);
+    return true;
+  }
+
   void RealRecompute(FuncGraphPtr fg) override;
 };
 
@@ -406,6 +426,12 @@ class RecursiveComputer final : public DepComputer {
     recursive_map_.clear();
   }
 
+  bool ExtraInvalidate(const FuncGraphPtr &fg) override {
+    (void)recursive_analysis_.erase(fg);
+    (void)recursive_map_.erase(fg);
+    return true;
+  }
+
   void RealRecompute(FuncGraphPtr fg) override;
 };
 
@@ -423,6 +449,11 @@ class FuncGraphJTotalComputer final : public DepComputer {
  protected:
   void ExtraReset() override { j_total_analysis_.clear(); }
 
+  bool ExtraInvalidate(const FuncGraphPtr &fg) override {
+    (void)j_total_analysis_.erase(fg);
+    return true;
+  }
+
   void RealRecompute(FuncGraphPtr fg) override;
   bool SeekJ(const FuncGraphPtr &fg, size_t seen_num);
 };
@@ -472,6 +503,9 @@ class FuncGraphManager : public std::enable_shared_from_this<FuncGraphManager> {
   FuncGraphSet &children(const FuncGraphPtr &fg) const;
 
   FuncGraphSet &func_graphs_used_total(const FuncGraphPtr &fg) const;
+  const std::shared_ptr<FuncGraphsUsedTotalComputer> &func_graphs_used_total_computer() const {
+    return func_graphs_used_total_;
+  }
 
   bool recursive(const FuncGraphPtr &fg) const;
   std::shared_ptr<std::list<FuncGraphPtr>> recursive_graphs(const FuncGraphPtr &fg) const;
@@ -500,6 +534,8 @@ class FuncGraphManager : public std::enable_shared_from_this<FuncGraphManager> {
   void AddEdge(AnfNodePtr node, int index, AnfNodePtr input);
   void DropEdge(AnfNodePtr node, int index, AnfNodePtr input);
   void MoveAllNodes(FuncGraphPtr source, FuncGraphPtr target);
+  // the analyses of a graph depend on the graphs it uses, so the users of a dirty graph are invalidated too
+  void InvalidateDirtyFuncGraphs() const;
 
   FuncGraphSet roots_;        // managed roots
   FuncGraphSet func_graphs_;  // managed func graphs
@@ -514,6 +550,8 @@ class FuncGraphManager : public std::enable_shared_from_this<FuncGraphManager> {
   std::shared_ptr<FuncGraphsUsedTotalComputer> func_graphs_used_total_;
   std::shared_ptr<RecursiveComputer> recursive_;
   std::shared_ptr<FuncGraphJTotalComputer> j_total_;
+  // graphs whose free variables, used graphs or J graphs changed since the analyses were last read
+  mutable FuncGraphSet dirty_func_graphs_;
 
   bool is_manage_;
   std::function<IncludeType(AnfNodePtr)> limit_;
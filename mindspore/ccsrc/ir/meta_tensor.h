@@ -116,6 +116,7 @@ class MetaTensor : public Value {
   //
   // return A const vector<int> which represents the shape of the tensor.
   std::vector<int> shape() const { return shape_; }
+  const std::vector<int> &shape_ref() const { return shape_; }
 
   // brief Sets the shape of a tensor.
   //
@@ -46,7 +46,8 @@ class Primitive : public Named {
         is_base_(is_base),
         has_signature_(false),
         prim_type_(prim_type),
-        record_evaluate_add_attr_(false) {}
+        record_evaluate_add_attr_(false),
+        attrs_version_(0) {}
 
   Primitive(const Primitive &prim)
       : Named(prim),
@@ -55,7 +56,8 @@ class Primitive : public Named {
         is_base_(prim.is_base_),
         has_signature_(prim.has_signature_),
         prim_type_(prim.prim_type_),
-        record_evaluate_add_attr_(false) {}
+        record_evaluate_add_attr_(false),
+        attrs_version_(0) {}
 
   MS_DECLARE_PARENT(Primitive, Named);
 
@@ -67,7 +69,7 @@ class Primitive : public Named {
   }
   void EndRecordAddAttr() { record_evaluate_add_attr_ = false; }
   Primitive &AddAttr(const std::string &name, const ValuePtr &attr) {
-    attrs_[name] = attr;
+    StoreAttr(name, attr);
     if (record_evaluate_add_attr_) {
       evaluate_added_attrs_[name] = attr;
     }
@@ -76,13 +78,17 @@ class Primitive : public Named {
 
   Primitive &SetAttrs(const std::unordered_map<std::string, ValuePtr> &attrs) {
     for (auto &attr : attrs) {
-      attrs_[attr.first] = attr.second;
+      StoreAttr(attr.first, attr.second);
     }
     return *this;
   }
 
-  void set_attr(const std::string &attrName, const ValuePtr &attr) { attrs_[attrName] = attr; }
-  void EraseAttr(const std::string &attrName) { (void)attrs_.erase(attrName); }
+  void set_attr(const std::string &attrName, const ValuePtr &attr) { StoreAttr(attrName, attr); }
+  void EraseAttr(const std::string &attrName) {
+    if (attrs_.erase(attrName) != 0) {
+      attrs_version_++;
+    }
+  }
 
   ValuePtr GetAttr(const std::string &attrName) const {
     auto iter = attrs_.find(attrName);
@@ -93,6 +99,9 @@ class Primitive : public Named {
   py::function hook() const { return hook_; }
 
   const std::unordered_map<std::string, ValuePtr> &attrs() const { return attrs_; }
+  // changes each time an attribute is added, erased or set to a different value, so that results derived from the
+  // attributes can be cached
+  uint64_t attrs_version() const { return attrs_version_; }
   std::unordered_map<std::string, ValuePtr> &evaluate_added_attrs() { return evaluate_added_attrs_; }
 
   // if Primitive has any attribute, for Primitives like scalar_add, return, etc, don't have any attribute.
@@ -123,12 +132,26 @@ class Primitive : public Named {
   std::unordered_map<std::string, ValuePtr> evaluate_added_attrs_;
 
  private:
+  void StoreAttr(const std::string &name, const ValuePtr &attr) {
+    auto iter = attrs_.find(name);
+    if (iter == attrs_.end()) {
+      (void)attrs_.emplace(name, attr);
+      attrs_version_++;
+      return;
+    }
+    if (iter->second != attr && (iter->second == nullptr || attr == nullptr || !(*iter->second == *attr))) {
+      attrs_version_++;
+    }
+    iter->second = attr;
+  }
+
   std::string instance_name_;
   py::function hook_;
   bool is_base_;
   bool has_signature_;
   PrimType prim_type_;
   bool record_evaluate_add_attr_;
+  uint64_t attrs_version_;
 };
 
 inline std::ostream &operator<<(std::ostream &os, const PrimitivePtr &p) {
@@ -77,7 +77,13 @@ Tensor::Tensor(const py::int_ &input, const TypePtr &data_type) { init(py::array
 
 Tensor::Tensor(const Tensor &tensor, const TypePtr &data_type)
     : MetaTensor(tensor), device_address_(tensor.device_address_) {
-  init(tensor.data_, data_type);
+  if (tensor.is_pending() && (data_type == nullptr || data_type->type_id() == tensor.data_type())) {
+    // the copy shares the data that is still to be computed, and the pending state with it
+    init(tensor.data_, data_type);
+    pending_sync_ = tensor.pending_sync_;
+  } else {
+    init(tensor.data(), data_type);
+  }
   dirty_ = tensor.is_dirty();
   id_ = tensor.id();
 }
@@ -88,6 +94,7 @@ Tensor &Tensor::operator=(const Tensor &tensor) {
     dirty_ = tensor.is_dirty();
     device_address_ = tensor.device_address();
     data_ = tensor.data_;
+    pending_sync_ = tensor.pending_sync_;
     id_ = tensor.id();
   }
   return *this;
@@ -100,11 +107,11 @@ bool Tensor::operator==(const Tensor &tensor) const {
 bool Tensor::ValueEqual(const Tensor &other) const {
   auto equal = [&other, this]() -> bool {
     auto np = py::module::import("numpy");
-    auto equal = np.attr("equal")(data_, other.data_);
+    auto equal = np.attr("equal")(data(), other.data());
     auto all_equal = np.attr("all")(equal);
     return all_equal.cast<bool>();
   };
-  return (MetaTensor::operator==(other) && (data_.is(other.data_) || equal()));
+  return (MetaTensor::operator==(other) && (data().is(other.data()) || equal()));
 }
 
 py::tuple Tensor::GetPyTupleShape() const {
@@ -120,13 +127,26 @@ int Tensor::DataDim() const { return static_cast<int>(data_.ndim()); }
 
 int Tensor::DataSize() const { return static_cast<int>(data_.size()); }
 
-py::array Tensor::data() const { return data_; }
+py::array Tensor::data() const {
+  WaitPending();
+  return data_;
+}
 
 int Tensor::data_type_c() const { return static_cast<int>(data_type_); }
 
 std::vector<int> Tensor::shape_c(void) const { return shape(); }
 
+void Tensor::WaitPending() const {
+  if (!is_pending()) {
+    return;
+  }
+  auto pending_sync = *pending_sync_;
+  *pending_sync_ = nullptr;
+  pending_sync();
+}
+
 void *Tensor::data_c(bool writable) {
+  WaitPending();
   // operand of bit operation should be unsigned int.
   unsigned int flags = ((unsigned int)data_.flags()) & pybind11::detail::npy_api::NPY_ARRAY_C_CONTIGUOUS_;
   bool is_c_contiguous = (flags != 0) ? true : false;
@@ -265,6 +285,8 @@ TypePtr Tensor::SetDtype(const TypePtr type_ptr) {
 }
 
 TypeId Tensor::set_data_type(const TypeId data_type) {
+  // the pending value has to be in data_ before it is converted
+  WaitPending();
   if (data_.size() > 0 && data_type_ != data_type) {
     bool success = convert_data(data_, data_type_, &data_, data_type);
     if (success) {
@@ -364,6 +386,7 @@ std::string Tensor::ToStringRepr() const {
 }
 
 py::array Tensor::data_sync() {
+  WaitPending();
   if (device_address_ != nullptr) {
     if (!device_address_->SyncDeviceToHost(this->shape(), static_cast<size_t>(this->data().nbytes()), this->data_type(),
                                            this->data_c(true))) {
@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_IR_TENSOR_H_
 #define MINDSPORE_CCSRC_IR_TENSOR_H_
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -97,6 +98,9 @@ namespace mindspore {
 //
 // A sub namespace in ME to support tensor related definition.
 namespace tensor {
+// computes the value of tensors that are still to be computed, shared by the copies of such a tensor
+using PendingSyncPtr = std::shared_ptr<std::function<void()>>;
+
 // Tensor entity class
 class Tensor : public MetaTensor {
  public:
@@ -260,9 +264,16 @@ class Tensor : public MetaTensor {
   void set_device_address(const DeviceAddressPtr &device_address) { device_address_ = device_address; }
   py::array data_sync();
   std::string id() const { return id_; }
+  // set while the value of the tensor is still to be computed, the function computes it and is called before the data
+  // is read
+  void set_pending_sync(const PendingSyncPtr &pending_sync) { pending_sync_ = pending_sync; }
+  const PendingSyncPtr &pending_sync() const { return pending_sync_; }
+  bool is_pending() const { return pending_sync_ != nullptr && *pending_sync_ != nullptr; }
+  void WaitPending() const;
 
  private:
   bool dirty_{true};
+  PendingSyncPtr pending_sync_{nullptr};
   std::string id_{""};
   DeviceAddressPtr device_address_{nullptr};
 };
@@ -0,0 +1,135 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "kernel/cpu/allreduce_cpu_kernel.h"
+#include "device/convert_tensor_utils.h"
+#include "device/cpu/cpu_device_address.h"
+#include "device/cpu/mpi/mpi_adapter.h"
+#include "ir/primitive.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+constexpr auto kRanksGroup = "group";
+constexpr auto kAlgorithm = "algorithm";
+// the cpu runtime keeps every element in 4 bytes
+constexpr size_t kDeviceTypeSize = sizeof(float);
+constexpr size_t kHalfTypeSize = 2;
+}  // namespace
+
+AllReduceCPUKernel::AllReduceCPUKernel()
+    : total_data_number_(0),
+      data_type_(kNumberTypeFloat32),
+      op_type_(device::cpu::kOpTypeSum),
+      algorithm_(device::cpu::kAllReduceAlgorithmMpi) {}
+
+void AllReduceCPUKernel::InitKernel(const CNodePtr &kernel_node) {
+  size_t input_num = AnfAlgo::GetInputTensorNum(kernel_node);
+  if (input_num == 0 || input_num != AnfAlgo::GetOutputTensorNum(kernel_node)) {
+    MS_LOG(EXCEPTION) << "allreduce input num:" << input_num
+                      << ", output num:" << AnfAlgo::GetOutputTensorNum(kernel_node);
+  }
+  for (size_t i = 0; i < input_num; ++i) {
+    auto shape = AnfAlgo::GetPrevNodeOutputInferShape(kernel_node, i);
+    size_t count = 1;
+    for (size_t j = 0; j < shape.size(); j++) {
+      count *= shape[j];
+    }
+    input_data_numbers_.push_back(count);
+    total_data_number_ += count;
+  }
+  data_type_ = AnfAlgo::GetInputDeviceDataType(kernel_node, 0);
+
+  auto prim = AnfAlgo::GetCNodePrimitive(kernel_node);
+  MS_EXCEPTION_IF_NULL(prim);
+  auto op = prim->GetAttr("op");
+  if (op != nullptr) {
+    op_type_ = GetValue<std::string>(op);
+  }
+  auto algorithm = prim->GetAttr(kAlgorithm);
+  if (algorithm != nullptr) {
+    algorithm_ = GetValue<std::string>(algorithm);
+  }
+  if (algorithm_ != device::cpu::kAllReduceAlgorithmMpi && algorithm_ != device::cpu::kAllReduceAlgorithmRing) {
+    MS_LOG(EXCEPTION) << "unsupport allreduce algorithm:" << algorithm_;
+  }
+  auto ranks_group = prim->GetAttr(kRanksGroup);
+  if (ranks_group != nullptr) {
+    ranks_group_ = GetValue<std::vector<int>>(ranks_group);
+  } else {
+    MS_LOG(EXCEPTION) << "Miss attribute " << kRanksGroup;
+  }
+
+  // the fused inputs are gathered into a bucket, and the float16 ones are converted into it
+  if (data_type_ == kNumberTypeFloat16) {
+    workspace_size_list_.emplace_back(total_data_number_ * kHalfTypeSize);
+  } else if (input_num > 1) {
+    workspace_size_list_.emplace_back(total_data_number_ * kDeviceTypeSize);
+  }
+}
+
+bool AllReduceCPUKernel::AllReduce(const void *input, void *output, size_t data_num) const {
+  if (algorithm_ == device::cpu::kAllReduceAlgorithmRing) {
+    return device::cpu::MPIAdapter::Instance().RingAllReduce(input, output, ranks_group_, data_num, data_type_,
+                                                             op_type_);
+  }
+  return device::cpu::MPIAdapter::Instance().AllReduce(input, output, ranks_group_, data_num, data_type_, op_type_);
+}
+
+bool AllReduceCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
+                                const std::vector<kernel::AddressPtr> &workspace,
+                                const std::vector<kernel::AddressPtr> &outputs) {
+  if (inputs.size() != input_data_numbers_.size() || outputs.size() != input_data_numbers_.size()) {
+    MS_LOG(EXCEPTION) << "allreduce input size:" << inputs.size() << ", output size:" << outputs.size();
+  }
+  if (workspace.empty()) {
+    return AllReduce(inputs[0]->addr, outputs[0]->addr, total_data_number_);
+  }
+  auto bucket = reinterpret_cast<uint8_t *>(workspace[0]->addr);
+  size_t type_size = (data_type_ == kNumberTypeFloat16) ? kHalfTypeSize : kDeviceTypeSize;
+  size_t offset = 0;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    size_t size = input_data_numbers_[i] * type_size;
+    if (data_type_ == kNumberTypeFloat16) {
+      device::FloatToHalf(bucket + offset, inputs[i]->addr, input_data_numbers_[i]);
+    } else if (size > 0) {
+      auto ret = memcpy_s(bucket + offset, workspace[0]->size - offset, inputs[i]->addr, size);
+      if (ret != 0) {
+        MS_LOG(EXCEPTION) << "memcpy_s error, errorno" << ret;
+      }
+    }
+    offset += size;
+  }
+  if (!AllReduce(bucket, bucket, total_data_number_)) {
+    return false;
+  }
+  offset = 0;
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    size_t size = input_data_numbers_[i] * type_size;
+    if (data_type_ == kNumberTypeFloat16) {
+      device::HalfToFloat(outputs[i]->addr, bucket + offset, input_data_numbers_[i]);
+    } else if (size > 0) {
+      auto ret = memcpy_s(outputs[i]->addr, outputs[i]->size, bucket + offset, size);
+      if (ret != 0) {
+        MS_LOG(EXCEPTION) << "memcpy_s error, errorno" << ret;
+      }
+    }
+    offset += size;
+  }
+  return true;
+}
+}  // namespace kernel
+}  // namespace mindspore
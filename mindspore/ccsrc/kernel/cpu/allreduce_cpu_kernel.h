@@ -0,0 +1,60 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_KERNEL_CPU_ALLREDUCE_CPU_KERNEL_H_
+#define MINDSPORE_CCSRC_KERNEL_CPU_ALLREDUCE_CPU_KERNEL_H_
+#include <vector>
+#include <string>
+#include "kernel/cpu/cpu_kernel.h"
+#include "kernel/cpu/cpu_kernel_factory.h"
+
+namespace mindspore {
+namespace kernel {
+// The allreduce of the inputs, which are the gradients fused into a bucket by the all reduce fusion pass. The
+// float16 tensors are kept in float32 by the cpu runtime, so they are sent in float16 to halve the traffic.
+class AllReduceCPUKernel : public CPUKernel {
+ public:
+  AllReduceCPUKernel();
+  ~AllReduceCPUKernel() override = default;
+
+  void InitKernel(const CNodePtr &kernel_node) override;
+
+  bool Launch(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &workspace,
+              const std::vector<AddressPtr> &outputs) override;
+
+ private:
+  bool AllReduce(const void *input, void *output, size_t data_num) const;
+
+  std::vector<size_t> input_data_numbers_;
+  size_t total_data_number_;
+  TypeId data_type_;
+  std::string op_type_;
+  std::string algorithm_;
+  std::vector<int> ranks_group_;
+};
+
+MS_REG_CPU_KERNEL(HostAllReduce,
+                  KernelAttr().SetAllSameAttr(true).AddInputAttr(kNumberTypeFloat32).AddOutputAttr(kNumberTypeFloat32),
+                  AllReduceCPUKernel);
+MS_REG_CPU_KERNEL(HostAllReduce,
+                  KernelAttr().SetAllSameAttr(true).AddInputAttr(kNumberTypeFloat16).AddOutputAttr(kNumberTypeFloat16),
+                  AllReduceCPUKernel);
+MS_REG_CPU_KERNEL(HostAllReduce,
+                  KernelAttr().SetAllSameAttr(true).AddInputAttr(kNumberTypeInt32).AddOutputAttr(kNumberTypeInt32),
+                  AllReduceCPUKernel);
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_KERNEL_CPU_ALLREDUCE_CPU_KERNEL_H_
@@ -49,6 +49,10 @@ std::shared_ptr<CPUKernel> CPUKernelFactory::Create(const std::string &kernel_na
   return nullptr;
 }
 
+bool CPUKernelFactory::IsRegistered(const std::string &kernel_name) const {
+  return name_to_attr_creator_.find(kernel_name) != name_to_attr_creator_.end();
+}
+
 std::pair<bool, size_t> CPUKernelFactory::CPUKernelAttrCheck(const std::string &kernel_name,
                                                              const KernelBuildInfo &kernel_info) {
   auto iter = name_to_attr_creator_.find(kernel_name);
@@ -67,6 +71,11 @@ std::pair<bool, size_t> CPUKernelFactory::CPUKernelAttrCheck(const std::string &
 }
 
 bool CPUKernelFactory::CPUKernelSingleAttrCheck(const KernelAttr &kernel_attr, const KernelBuildInfo &kernel_info) {
+  if (!kernel_attr.GetAllSame() && (kernel_attr.GetInputSize() < kernel_info.GetInputNum() ||
+                                    kernel_attr.GetOutputSize() < kernel_info.GetOutputNum())) {
+    MS_LOG(DEBUG) << "input num:" << kernel_info.GetInputNum() << ", register input num:" << kernel_attr.GetInputSize();
+    return false;
+  }
   for (size_t i = 0; i < kernel_info.GetInputNum(); ++i) {
     auto dtype = kernel_attr.GetAllSame() ? kernel_attr.GetInputAttr(0).first : kernel_attr.GetInputAttr(i).first;
     if (kernel_info.GetInputDeviceType(i) != dtype) {
@@ -26,6 +26,7 @@
 #include <utility>
 #include <vector>
 #include "mindrecord/include/shard_header.h"
+#include "mindrecord/include/shard_zone_map.h"
 #include "./sqlite3.h"
 
 namespace mindspore {
@@ -94,6 +95,9 @@ class ShardIndexGenerator {
   MSRStatus ExecuteTransaction(const int &shard_no, const std::pair<MSRStatus, sqlite3 *> &db,
                                const std::vector<int> &raw_page_ids, const std::map<int, int> &blob_id_to_page_id);
 
+  /// \brief write min/max/distinct-count of every index field per row group, next to table INDEXES
+  MSRStatus GenerateZoneMap(sqlite3 *db);
+
   MSRStatus CreateShardNameTable(sqlite3 *db, const std::string &shard_name);
 
   MSRStatus AddBlobPageInfo(std::vector<std::tuple<std::string, std::string, std::string>> &row_data,
@@ -50,12 +50,11 @@
 #include "mindrecord/include/shard_reader.h"
 #include "mindrecord/include/shard_sample.h"
 #include "mindrecord/include/shard_shuffle.h"
+#include "mindrecord/include/shard_zone_map.h"
 #include "utils/log_adapter.h"
 
 namespace mindspore {
 namespace mindrecord {
-using ROW_GROUPS =
-  std::tuple<MSRStatus, std::vector<std::vector<std::vector<uint64_t>>>, std::vector<std::vector<json>>>;
 using ROW_GROUP_BRIEF =
   std::tuple<MSRStatus, std::string, int, uint64_t, std::vector<std::vector<uint64_t>>, std::vector<json>>;
 using TASK_RETURN_CONTENT =
@@ -174,6 +173,13 @@ class ShardReader {
   ROW_GROUP_BRIEF ReadRowGroupCriteria(int group_id, int shard_id, const std::pair<std::string, std::string> &criteria,
                                        const std::vector<std::string> &columns = std::vector<std::string>());
 
+  /// \brief check row group statistics whether some row of row group may fulfill the criteria
+  /// \param[in] groupID row group ID
+  /// \param[in] shard_id sharding ID
+  /// \param[in] column-value pair of criteria to fulfill
+  /// \return false if no row of row group can fulfill the criteria
+  bool RowGroupMayMatch(int group_id, int shard_id, const std::pair<std::string, std::string> &criteria);
+
   /// \brief join all created threads
   /// \return MSRStatus the status of MSRStatus
   MSRStatus Finish();
@@ -218,18 +224,20 @@ class ShardReader {
   static int SelectCallback(void *p_data, int num_fields, char **p_fields, char **p_col_names);
 
  private:
-  /// \brief wrap up labels to json format
-  MSRStatus ConvertLabelToJson(const std::vector<std::vector<std::string>> &labels, std::shared_ptr<std::fstream> fs,
-                               std::vector<std::vector<std::vector<uint64_t>>> &offsets, int shard_id,
-                               const std::vector<std::string> &columns, std::vector<std::vector<json>> &column_values);
+  /// \brief wrap up labels of one row to json format
+  MSRStatus ConvertLabelToJson(const std::vector<std::string> &label, std::shared_ptr<std::fstream> fs, int shard_id,
+                               const std::vector<std::string> &columns, std::vector<uint64_t> *offset,
+                               json *column_value);
+
+  /// \brief generate sql which selects offsets and labels of one row by row id
+  std::pair<MSRStatus, std::string> GenerateRowSQL(const std::vector<std::string> &columns);
 
-  /// \brief read all rows for specified columns
-  ROW_GROUPS ReadAllRowGroup(std::vector<std::string> &columns);
+  /// \brief read offsets and labels of one row in lazy row-reader mode
+  std::pair<MSRStatus, std::pair<std::vector<uint64_t>, json>> ReadRowByID(int shard_id, uint64_t row_id,
+                                                                           uint32_t consumer_id);
 
-  /// \brief read all rows in one shard
-  MSRStatus ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &columns,
-                               std::vector<std::vector<std::vector<uint64_t>>> &offsets,
-                               std::vector<std::vector<json>> &column_values);
+  /// \brief finalize the prepared statements of row_sql_
+  void FinalizeRowStatements();
 
   /// \brief initialize reader
   MSRStatus Init(const std::vector<std::string> &file_paths, bool load_dataset);
@@ -315,6 +323,7 @@ class ShardReader {
   int shard_count_;                            // number of shards
   std::shared_ptr<ShardHeader> shard_header_;  // shard header
   std::shared_ptr<ShardColumn> shard_column_;  // shard column
+  ShardZoneMap zone_map_;                      // row group statistics of index fields
 
   std::vector<sqlite3 *> database_paths_;                                        // sqlite handle list
   std::vector<string> file_paths_;                                               // file paths
@@ -327,6 +336,8 @@ class ShardReader {
   std::map<string, uint64_t> column_schema_id_;            // column-schema map
   std::vector<std::shared_ptr<ShardOperator>> operators_;  // data operators, including shuffle, sample and category
   ShardTask tasks_;                                        // shard task
+  std::string row_sql_;                                    // sql selecting one row in lazy row-reader mode
+  std::vector<std::vector<sqlite3_stmt *>> row_stmts_;     // row_sql_ prepared per consumer and shard
   std::mutex shard_locker_;                                // locker of shard
 
   // flags
@@ -17,7 +17,9 @@
 #ifndef MINDRECORD_INCLUDE_SHARD_TASK_H_
 #define MINDRECORD_INCLUDE_SHARD_TASK_H_
 
+#include <algorithm>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -25,15 +27,37 @@
 
 namespace mindspore {
 namespace mindrecord {
+enum TaskIndexType { kIndexShuffle, kIndexSlice, kIndexPick };
+
+/// \brief one step of the index mapping between the visible task list and the underlying tasks, so that shuffle
+///        and sample operators never copy the task list itself
+struct TaskIndex {
+  TaskIndexType type;
+  uint64_t input_size;                          // number of tasks this step reads from
+  uint64_t output_size;                         // number of tasks this step exposes
+  uint64_t start = 0;                           // first task of a slice, wrapped around input_size
+  uint32_t seed = 0;                            // seed of the feistel permutation
+  uint32_t categories = 1;                      // shuffle unit like: (a1, b1, c1),(a2, b2, c2),..., (an, bn, cn)
+  std::shared_ptr<std::vector<int64_t>> picks;  // explicit task ids of a pick
+};
+
 class ShardTask {
  public:
-  void MakePerm();
-
   void InsertTask(TaskType task_type, int shard_id, int group_id, const std::vector<uint64_t> &offset,
                   const json &label);
 
   void InsertTask(std::tuple<TaskType, std::tuple<int, int>, std::vector<uint64_t>, json> task);
 
+  /// \brief append a row group whose rows become tasks without materializing them
+  /// \param[in] shard_id sharding ID
+  /// \param[in] group_id row group ID
+  /// \param[in] start_row_id ID of the first row of row group in shard
+  /// \param[in] n_rows # of rows in row group
+  void InsertRowGroup(int shard_id, int group_id, uint64_t start_row_id, uint64_t n_rows);
+
+  /// \brief append padded tasks behind the row groups
+  void InsertPaddedTask(uint32_t n_padded);
+
   void PopBack();
 
   uint32_t Size() const;
@@ -44,12 +68,45 @@ class ShardTask {
 
   std::tuple<TaskType, std::tuple<int, int>, std::vector<uint64_t>, json> &GetRandomTask();
 
+  /// \brief whether tasks are described by row groups instead of a materialized task list
+  bool IsLazy() const { return task_list_.empty() && (!row_groups_.empty() || padded_tasks_ > 0); }
+
+  /// \brief map the position in the shuffled and sampled task list to the id of the underlying task
+  uint64_t GetPermutedID(uint64_t pos) const;
+
+  /// \brief locate an underlying task in lazy mode
+  /// \return the tuple of 3 elements
+  ///         1. Task type
+  ///         2. Sharding ID and row group ID
+  ///         3. Row ID in shard
+  std::tuple<TaskType, std::tuple<int, int>, uint64_t> GetRowByID(uint64_t id) const;
+
+  /// \brief permute tasks in place of the existing permutation
+  void Shuffle(uint32_t seed, uint32_t categories);
+
+  /// \brief keep count tasks starting from start, wrapped around the current size
+  void Slice(uint64_t start, uint64_t count);
+
+  /// \brief keep the given task ids, wrapped around the current size
+  void Pick(const std::vector<int64_t> &indices);
+
+  /// \brief the underlying task id permuted by a feistel network, bijective on [0, n)
+  static uint64_t FeistelPermute(uint64_t id, uint64_t n, uint32_t seed);
+
   static ShardTask Combine(std::vector<ShardTask> &category_tasks, bool replacement, int64_t num_elements);
 
   uint32_t categories = 1;
 
   std::vector<std::tuple<TaskType, std::tuple<int, int>, std::vector<uint64_t>, json>> task_list_;
-  std::vector<int> permutation_;
+
+ private:
+  uint64_t BaseSize() const;
+
+  std::vector<std::tuple<int, int, uint64_t, uint64_t>> row_groups_;  // shard id, group id, start row id, # of rows
+  std::vector<uint64_t> row_group_offsets_;                           // # of rows before each row group
+  uint64_t total_rows_ = 0;                                           // # of rows in all row groups
+  uint32_t padded_tasks_ = 0;                                         // # of padded tasks behind row groups
+  std::vector<TaskIndex> indexes_;                                    // applied from back to front
 };
 }  // namespace mindrecord
 }  // namespace mindspore
@@ -0,0 +1,94 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDRECORD_INCLUDE_SHARD_ZONE_MAP_H_
+#define MINDRECORD_INCLUDE_SHARD_ZONE_MAP_H_
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "mindrecord/include/common/shard_utils.h"
+#include "mindrecord/include/shard_error.h"
+#include "./sqlite3.h"
+
+namespace mindspore {
+namespace mindrecord {
+const char kZoneMapTable[] = "ROW_GROUP_STATS";
+
+/// \brief min, max and distinct count of every indexed field in every row group, used to skip row groups which can
+///        not match a criteria before any sql or io is issued
+class ShardZoneMap {
+ public:
+  ShardZoneMap() = default;
+
+  ~ShardZoneMap() = default;
+
+  /// \brief save statistics of one indexed field in one row group
+  /// \param[in] shard_id sharding ID
+  /// \param[in] group_id row group ID
+  /// \param[in] field field name in index table
+  /// \param[in] min_value smallest value of field in row group
+  /// \param[in] max_value largest value of field in row group
+  /// \param[in] distinct_count # of distinct values of field in row group
+  /// \param[in] is_number whether values compare as numbers or as strings
+  void AddStatistics(int shard_id, int group_id, const std::string &field, const std::string &min_value,
+                     const std::string &max_value, uint64_t distinct_count, bool is_number);
+
+  /// \brief load statistics of one shard from its index database
+  /// \param[in] db sqlite handle of shard
+  /// \param[in] shard_id sharding ID
+  /// \return MSRStatus the status of MSRStatus, SUCCESS with nothing loaded if database has no statistics
+  MSRStatus Load(sqlite3 *db, int shard_id);
+
+  /// \brief drop statistics of one shard, its row groups may match any criteria afterwards
+  /// \param[in] shard_id sharding ID
+  void Erase(int shard_id);
+
+  /// \brief whether some row of row group may have field equal to value
+  /// \param[in] shard_id sharding ID
+  /// \param[in] group_id row group ID
+  /// \param[in] field field name in index table
+  /// \param[in] value value of criteria
+  /// \return false only if no row of row group can match, true if not sure
+  bool MayContain(int shard_id, int group_id, const std::string &field, const std::string &value) const;
+
+  /// \brief get # of distinct values of field in row group, -1 if unknown
+  int64_t GetDistinctCount(int shard_id, int group_id, const std::string &field) const;
+
+  /// \brief get # of row groups and fields with statistics
+  size_t Size() const { return statistics_.size(); }
+
+ private:
+  struct FieldStatistics {
+    bool is_number;
+    bool is_integer;  // integers compare as int64, which double can not hold exactly above 2^53
+    int64_t min_integer;
+    int64_t max_integer;
+    double min_number;
+    double max_number;
+    std::string min_value;
+    std::string max_value;
+    uint64_t distinct_count;
+  };
+
+  std::map<std::tuple<int, int, std::string>, FieldStatistics> statistics_;
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDRECORD_INCLUDE_SHARD_ZONE_MAP_H_
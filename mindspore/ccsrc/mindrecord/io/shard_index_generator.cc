@@ -548,6 +548,10 @@ MSRStatus ShardIndexGenerator::ExecuteTransaction(const int &shard_no, const std
     }
     MS_LOG(INFO) << "Insert " << data.second.size() << " rows to index db.";
   }
+  if (GenerateZoneMap(db.second) != SUCCESS) {
+    MS_LOG(ERROR) << "Generate row group statistics failed";
+    return FAILED;
+  }
   (void)sqlite3_exec(db.second, "END TRANSACTION;", nullptr, nullptr, nullptr);
   in.close();
 
@@ -559,6 +563,32 @@ MSRStatus ShardIndexGenerator::ExecuteTransaction(const int &shard_no, const std
   return SUCCESS;
 }
 
+MSRStatus ShardIndexGenerator::GenerateZoneMap(sqlite3 *db) {
+  std::string sql = "DROP TABLE IF EXISTS " + std::string(kZoneMapTable) + ";";
+  if (ExecuteSQL(sql, db, "drop table successfully.") != SUCCESS) {
+    return FAILED;
+  }
+  sql = "CREATE TABLE " + std::string(kZoneMapTable) +
+        "(ROW_GROUP_ID INT NOT NULL, FIELD TEXT NOT NULL, MIN_VALUE, MAX_VALUE, DISTINCT_COUNT INT NOT NULL"
+        ", PRIMARY KEY(ROW_GROUP_ID, FIELD));";
+  if (ExecuteSQL(sql, db, "create table successfully.") != SUCCESS) {
+    return FAILED;
+  }
+  for (const auto &field : fields_) {
+    auto ret = GenerateFieldName(field);
+    if (ret.first != SUCCESS) {
+      return FAILED;
+    }
+    sql = "INSERT INTO " + std::string(kZoneMapTable) + " SELECT ROW_GROUP_ID, '" + ret.second + "', MIN(" +
+          ret.second + "), MAX(" + ret.second + "), COUNT(DISTINCT " + ret.second + ") FROM INDEXES GROUP BY " +
+          "ROW_GROUP_ID;";
+    if (ExecuteSQL(sql, db, "insert row group statistics successfully.") != SUCCESS) {
+      return FAILED;
+    }
+  }
+  return SUCCESS;
+}
+
 MSRStatus ShardIndexGenerator::WriteToDatabase() {
   fields_ = shard_header_.GetFields();
   page_size_ = shard_header_.GetPageSize();
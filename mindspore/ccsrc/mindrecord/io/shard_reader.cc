@@ -125,6 +125,10 @@ MSRStatus ShardReader::Init(const std::vector<std::string> &file_paths, bool loa
         return FAILED;
       }
     }
+    if (zone_map_.Load(db, static_cast<int>(database_paths_.size())) != SUCCESS) {
+      MS_LOG(WARNING) << "Load row group statistics of " << file << " failed, all its row groups will be read.";
+      zone_map_.Erase(static_cast<int>(database_paths_.size()));
+    }
     database_paths_.push_back(db);
   }
   ShardHeader sh = ShardHeader();
@@ -200,6 +204,8 @@ MSRStatus ShardReader::Open(int n_consumer) {
     }
     MS_LOG(INFO) << "Open shard file successfully.";
   }
+  FinalizeRowStatements();
+  row_stmts_ = std::vector<std::vector<sqlite3_stmt *>>(n_consumer, std::vector<sqlite3_stmt *>(file_paths_.size()));
 
   return SUCCESS;
 }
@@ -217,6 +223,7 @@ void ShardReader::FileStreamsOperator() {
       }
     }
   }
+  FinalizeRowStatements();
   for (int i = static_cast<int>(database_paths_.size()) - 1; i >= 0; --i) {
     if (database_paths_[i] != nullptr) {
       (void)sqlite3_close(database_paths_[i]);
@@ -268,100 +275,134 @@ std::vector<std::tuple<int, int, int, uint64_t>> ShardReader::ReadRowGroupSummar
   return row_group_summary;
 }
 
-MSRStatus ShardReader::ConvertLabelToJson(const std::vector<std::vector<std::string>> &labels,
-                                          std::shared_ptr<std::fstream> fs,
-                                          std::vector<std::vector<std::vector<uint64_t>>> &offsets, int shard_id,
-                                          const std::vector<std::string> &columns,
-                                          std::vector<std::vector<json>> &column_values) {
-  for (int i = 0; i < static_cast<int>(labels.size()); ++i) {
-    uint64_t group_id = std::stoull(labels[i][0]);
-    uint64_t offset_start = std::stoull(labels[i][1]) + kInt64Len;
-    uint64_t offset_end = std::stoull(labels[i][2]);
-    offsets[shard_id].emplace_back(
-      std::vector<uint64_t>{static_cast<uint64_t>(shard_id), group_id, offset_start, offset_end});
-    if (!all_in_index_) {
-      int raw_page_id = std::stoi(labels[i][3]);
-      uint64_t label_start = std::stoull(labels[i][4]) + kInt64Len;
-      uint64_t label_end = std::stoull(labels[i][5]);
-      auto len = label_end - label_start;
-      auto label_raw = std::vector<uint8_t>(len);
-      auto &io_seekg = fs->seekg(page_size_ * raw_page_id + header_size_ + label_start, std::ios::beg);
-      if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
-        MS_LOG(ERROR) << "File seekg failed";
-        fs->close();
-        return FAILED;
-      }
+MSRStatus ShardReader::ConvertLabelToJson(const std::vector<std::string> &label, std::shared_ptr<std::fstream> fs,
+                                          int shard_id, const std::vector<std::string> &columns,
+                                          std::vector<uint64_t> *offset, json *column_value) {
+  uint64_t group_id = std::stoull(label[0]);
+  uint64_t offset_start = std::stoull(label[1]) + kInt64Len;
+  uint64_t offset_end = std::stoull(label[2]);
+  *offset = std::vector<uint64_t>{static_cast<uint64_t>(shard_id), group_id, offset_start, offset_end};
+  if (!all_in_index_) {
+    int raw_page_id = std::stoi(label[3]);
+    uint64_t label_start = std::stoull(label[4]) + kInt64Len;
+    uint64_t label_end = std::stoull(label[5]);
+    auto len = label_end - label_start;
+    auto label_raw = std::vector<uint8_t>(len);
+    auto &io_seekg = fs->seekg(page_size_ * raw_page_id + header_size_ + label_start, std::ios::beg);
+    if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
+      MS_LOG(ERROR) << "File seekg failed";
+      fs->close();
+      return FAILED;
+    }
 
-      auto &io_read = fs->read(reinterpret_cast<char *>(&label_raw[0]), len);
-      if (!io_read.good() || io_read.fail() || io_read.bad()) {
-        MS_LOG(ERROR) << "File read failed";
-        fs->close();
-        return FAILED;
-      }
-      json label_json = json::from_msgpack(label_raw);
-      json tmp;
-      if (!columns.empty()) {
-        for (auto &col : columns) {
-          if (label_json.find(col) != label_json.end()) {
-            tmp[col] = label_json[col];
-          }
+    auto &io_read = fs->read(reinterpret_cast<char *>(&label_raw[0]), len);
+    if (!io_read.good() || io_read.fail() || io_read.bad()) {
+      MS_LOG(ERROR) << "File read failed";
+      fs->close();
+      return FAILED;
+    }
+    json label_json = json::from_msgpack(label_raw);
+    json tmp;
+    if (!columns.empty()) {
+      for (auto &col : columns) {
+        if (label_json.find(col) != label_json.end()) {
+          tmp[col] = label_json[col];
         }
-      } else {
-        tmp = label_json;
       }
-      column_values[shard_id].emplace_back(tmp);
     } else {
-      json construct_json;
-      for (unsigned int j = 0; j < columns.size(); ++j) {
-        // construct json "f1": value
-        auto schema = shard_header_->GetSchemas()[0]->GetSchema()["schema"];
-
-        // convert the string to base type by schema
-        if (schema[columns[j]]["type"] == "int32") {
-          construct_json[columns[j]] = StringToNum<int32_t>(labels[i][j + 3]);
-        } else if (schema[columns[j]]["type"] == "int64") {
-          construct_json[columns[j]] = StringToNum<int64_t>(labels[i][j + 3]);
-        } else if (schema[columns[j]]["type"] == "float32") {
-          construct_json[columns[j]] = StringToNum<float>(labels[i][j + 3]);
-        } else if (schema[columns[j]]["type"] == "float64") {
-          construct_json[columns[j]] = StringToNum<double>(labels[i][j + 3]);
-        } else {
-          construct_json[columns[j]] = std::string(labels[i][j + 3]);
-        }
+      tmp = label_json;
+    }
+    *column_value = std::move(tmp);
+  } else {
+    json construct_json;
+    auto schema = shard_header_->GetSchemas()[0]->GetSchema()["schema"];
+    for (unsigned int j = 0; j < columns.size(); ++j) {
+      // construct json "f1": value
+      // convert the string to base type by schema
+      if (schema[columns[j]]["type"] == "int32") {
+        construct_json[columns[j]] = StringToNum<int32_t>(label[j + 3]);
+      } else if (schema[columns[j]]["type"] == "int64") {
+        construct_json[columns[j]] = StringToNum<int64_t>(label[j + 3]);
+      } else if (schema[columns[j]]["type"] == "float32") {
+        construct_json[columns[j]] = StringToNum<float>(label[j + 3]);
+      } else if (schema[columns[j]]["type"] == "float64") {
+        construct_json[columns[j]] = StringToNum<double>(label[j + 3]);
+      } else {
+        construct_json[columns[j]] = std::string(label[j + 3]);
       }
-      column_values[shard_id].emplace_back(construct_json);
     }
+    *column_value = std::move(construct_json);
   }
 
   return SUCCESS;
 }
 
-MSRStatus ShardReader::ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &columns,
-                                          std::vector<std::vector<std::vector<uint64_t>>> &offsets,
-                                          std::vector<std::vector<json>> &column_values) {
-  auto db = database_paths_[shard_id];
-  std::vector<std::vector<std::string>> labels;
-  char *errmsg = nullptr;
-  int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &labels, &errmsg);
-  if (rc != SQLITE_OK) {
-    MS_LOG(ERROR) << "Error in select statement, sql: " << sql << ", error: " << errmsg;
-    sqlite3_free(errmsg);
-    sqlite3_close(db);
-    return FAILED;
+std::pair<MSRStatus, std::string> ShardReader::GenerateRowSQL(const std::vector<std::string> &columns) {
+  std::string fields = "ROW_GROUP_ID, PAGE_OFFSET_BLOB, PAGE_OFFSET_BLOB_END";
+  if (all_in_index_) {
+    for (unsigned int i = 0; i < columns.size(); ++i) {
+      fields += ',';
+      auto ret = ShardIndexGenerator::GenerateFieldName(std::make_pair(column_schema_id_[columns[i]], columns[i]));
+      if (ret.first != SUCCESS) {
+        return {FAILED, ""};
+      }
+      fields += ret.second;
+    }
+  } else {  // fetch raw data from Raw page while some field is not index.
+    fields += ", PAGE_ID_RAW, PAGE_OFFSET_RAW, PAGE_OFFSET_RAW_END ";
   }
-  MS_LOG(INFO) << "Get " << static_cast<int>(labels.size()) << " records from shard " << shard_id << " index.";
+  return {SUCCESS, "SELECT " + fields + " FROM INDEXES WHERE ROW_ID = :row_id;"};
+}
 
-  std::string file_name = file_paths_[shard_id];
-  std::shared_ptr<std::fstream> fs = std::make_shared<std::fstream>();
-  if (!all_in_index_) {
-    fs->open(common::SafeCStr(file_name), std::ios::in | std::ios::binary);
-    if (!fs->good()) {
-      MS_LOG(ERROR) << "File could not opened";
-      return FAILED;
+std::pair<MSRStatus, std::pair<std::vector<uint64_t>, json>> ShardReader::ReadRowByID(int shard_id, uint64_t row_id,
+                                                                                        uint32_t consumer_id) {
+  // each consumer prepares the row sql once per shard, and only rebinds the row id for the next rows
+  auto &stmt = row_stmts_[consumer_id][shard_id];
+  if (stmt == nullptr &&
+      sqlite3_prepare_v2(database_paths_[shard_id], common::SafeCStr(row_sql_), -1, &stmt, 0) != SQLITE_OK) {
+    MS_LOG(ERROR) << "SQL error: could not prepare statement, sql: " << row_sql_;
+    (void)sqlite3_finalize(stmt);
+    stmt = nullptr;
+    return {FAILED, {}};
+  }
+  (void)sqlite3_reset(stmt);
+  int index = sqlite3_bind_parameter_index(stmt, ":row_id");
+  if (sqlite3_bind_int64(stmt, index, static_cast<sqlite3_int64>(row_id)) != SQLITE_OK) {
+    MS_LOG(ERROR) << "SQL error: could not bind parameter, index: " << index << ", row id: " << row_id;
+    return {FAILED, {}};
+  }
+  std::vector<std::string> label;
+  if (sqlite3_step(stmt) == SQLITE_ROW) {
+    int ncols = sqlite3_column_count(stmt);
+    for (int i = 0; i < ncols; i++) {
+      auto text = reinterpret_cast<const char *>(sqlite3_column_text(stmt, i));
+      label.emplace_back(text == nullptr ? "" : text);
+    }
+  }
+  (void)sqlite3_reset(stmt);
+  if (label.empty()) {
+    MS_LOG(ERROR) << "Row " << row_id << " does not exist in shard " << shard_id << " index.";
+    return {FAILED, {}};
+  }
+
+  std::vector<uint64_t> offset;
+  json column_value;
+  if (ConvertLabelToJson(label, file_streams_random_[consumer_id][shard_id], shard_id, selected_columns_, &offset,
+                         &column_value) != SUCCESS) {
+    return {FAILED, {}};
+  }
+  return {SUCCESS, std::make_pair(std::vector<uint64_t>{offset[2], offset[3]}, std::move(column_value))};
+}
+
+void ShardReader::FinalizeRowStatements() {
+  for (auto &stmts : row_stmts_) {
+    for (auto &stmt : stmts) {
+      if (stmt != nullptr) {
+        (void)sqlite3_finalize(stmt);
+        stmt = nullptr;
+      }
     }
   }
-  sqlite3_free(errmsg);
-  return ConvertLabelToJson(labels, fs, offsets, shard_id, columns, column_values);
 }
 
 MSRStatus ShardReader::GetAllClasses(const std::string &category_field, std::set<std::string> &categories) {
@@ -410,37 +451,6 @@ void ShardReader::GetClassesInShard(sqlite3 *db, int shard_id, const std::string
   }
 }
 
-ROW_GROUPS ShardReader::ReadAllRowGroup(std::vector<std::string> &columns) {
-  std::string fields = "ROW_GROUP_ID, PAGE_OFFSET_BLOB, PAGE_OFFSET_BLOB_END";
-  std::vector<std::vector<std::vector<uint64_t>>> offsets(shard_count_, std::vector<std::vector<uint64_t>>{});
-  std::vector<std::vector<json>> column_values(shard_count_, std::vector<json>{});
-  if (all_in_index_) {
-    for (unsigned int i = 0; i < columns.size(); ++i) {
-      fields += ',';
-      auto ret = ShardIndexGenerator::GenerateFieldName(std::make_pair(column_schema_id_[columns[i]], columns[i]));
-      if (ret.first != SUCCESS) {
-        return std::make_tuple(FAILED, std::move(offsets), std::move(column_values));
-      }
-      fields += ret.second;
-    }
-  } else {  // fetch raw data from Raw page while some field is not index.
-    fields += ", PAGE_ID_RAW, PAGE_OFFSET_RAW, PAGE_OFFSET_RAW_END ";
-  }
-
-  std::string sql = "SELECT " + fields + " FROM INDEXES ORDER BY ROW_ID ;";
-
-  std::vector<std::thread> thread_read_db = std::vector<std::thread>(shard_count_);
-  for (int x = 0; x < shard_count_; x++) {
-    thread_read_db[x] =
-      std::thread(&ShardReader::ReadAllRowsInShard, this, x, sql, columns, std::ref(offsets), std::ref(column_values));
-  }
-
-  for (int x = 0; x < shard_count_; x++) {
-    thread_read_db[x].join();
-  }
-  return std::make_tuple(SUCCESS, std::move(offsets), std::move(column_values));
-}
-
 ROW_GROUP_BRIEF ShardReader::ReadRowGroupBrief(int group_id, int shard_id, const std::vector<std::string> &columns) {
   const auto &ret = shard_header_->GetPageByGroupId(group_id, shard_id);
   if (SUCCESS != ret.first) {
@@ -467,6 +477,12 @@ ROW_GROUP_BRIEF ShardReader::ReadRowGroupCriteria(int group_id, int shard_id,
   if (SUCCESS != ret.first) {
     return std::make_tuple(FAILED, "", 0, 0, std::vector<std::vector<uint64_t>>(), std::vector<json>());
   }
+  // Skip row group which can not match criteria, neither index nor file is touched
+  if (!RowGroupMayMatch(group_id, shard_id, criteria)) {
+    MS_LOG(DEBUG) << "Skip row group " << group_id << " of shard " << shard_id << " by statistics.";
+    return std::make_tuple(SUCCESS, file_paths_[shard_id], 0, 0, std::vector<std::vector<uint64_t>>(),
+                           std::vector<json>());
+  }
   vector<string> criteria_list{criteria.first};
   if (CheckColumnList(criteria_list) == FAILED) {
     return std::make_tuple(FAILED, "", 0, 0, std::vector<std::vector<uint64_t>>(), std::vector<json>());
@@ -486,6 +502,14 @@ ROW_GROUP_BRIEF ShardReader::ReadRowGroupCriteria(int group_id, int shard_id,
                          std::move(status_labels.second));
 }
 
+bool ShardReader::RowGroupMayMatch(int group_id, int shard_id, const std::pair<std::string, std::string> &criteria) {
+  auto it = column_schema_id_.find(criteria.first);
+  if (it == column_schema_id_.end()) {
+    return true;
+  }
+  return zone_map_.MayContain(shard_id, group_id, criteria.first + "_" + std::to_string(it->second), criteria.second);
+}
+
 int ShardReader::SelectCallback(void *p_data, int num_fields, char **p_fields, char **p_col_names) {
   auto *records = static_cast<std::vector<std::vector<std::string>> *>(p_data);
   if (num_fields > 0 && num_fields <= kMaxFieldCount) {
@@ -1009,23 +1033,28 @@ MSRStatus ShardReader::CreateTasksByRow(const std::vector<std::tuple<int, int, i
                                         const std::vector<std::shared_ptr<ShardOperator>> &operators) {
   CheckIfColumnInIndex(selected_columns_);
 
-  auto ret = ReadAllRowGroup(selected_columns_);
-  if (std::get<0>(ret) != SUCCESS) {
+  auto ret = GenerateRowSQL(selected_columns_);
+  if (ret.first != SUCCESS) {
     return FAILED;
   }
-  auto offsets = std::get<1>(ret);
-  auto local_columns = std::get<2>(ret);
-  if (shard_count_ <= kMaxShardCount) {
-    for (int shard_id = 0; shard_id < shard_count_; shard_id++) {
-      for (uint32_t i = 0; i < offsets[shard_id].size(); i += 1) {
-        tasks_.InsertTask(TaskType::kCommonTask, offsets[shard_id][i][0], offsets[shard_id][i][1],
-                          std::vector<uint64_t>{offsets[shard_id][i][2], offsets[shard_id][i][3]},
-                          local_columns[shard_id][i]);
-      }
-    }
-  } else {
+  if (row_sql_ != ret.second) {
+    FinalizeRowStatements();
+    row_sql_ = ret.second;
+  }
+  if (shard_count_ > kMaxShardCount) {
     return FAILED;
   }
+
+  // Rows are visited in (shard_id, row_id) order, offsets and labels are fetched when the row is consumed
+  auto row_groups = row_group_summary;
+  std::sort(row_groups.begin(), row_groups.end(),
+            [](const std::tuple<int, int, int, uint64_t> &a, const std::tuple<int, int, int, uint64_t> &b) {
+              return std::get<0>(a) < std::get<0>(b) ||
+                     (std::get<0>(a) == std::get<0>(b) && std::get<2>(a) < std::get<2>(b));
+            });
+  for (const auto &rg : row_groups) {
+    tasks_.InsertRowGroup(std::get<0>(rg), std::get<1>(rg), static_cast<uint64_t>(std::get<2>(rg)), std::get<3>(rg));
+  }
   return SUCCESS;
 }
 
@@ -1049,9 +1078,7 @@ MSRStatus ShardReader::CreateTasks(const std::vector<std::tuple<int, int, int, u
         return FAILED;
       }
       if (num_padded_ > 0) {
-        for (int i = 0; i < num_padded_; ++i) {
-          tasks_.InsertTask(TaskType::kPaddedTask, 0, 0, {}, json());
-        }
+        tasks_.InsertPaddedTask(static_cast<uint32_t>(num_padded_));
       }
     } else {
       if (SUCCESS != CreateTasksByCategory(row_group_summary, operators[category_operator])) {
@@ -1069,7 +1096,6 @@ MSRStatus ShardReader::CreateTasks(const std::vector<std::tuple<int, int, int, u
     }
   }
 
-  if (tasks_.permutation_.empty()) tasks_.MakePerm();
   num_rows_ = block_reader_ ? tasks_.SizeOfRows() : tasks_.Size();
   num_blocks_ = block_reader_ ? tasks_.Size() : 0;
   MS_LOG(INFO) << "Total rows is " << num_rows_;
@@ -1084,7 +1110,23 @@ TASK_RETURN_CONTENT ShardReader::ConsumerOneTask(int task_id, uint32_t consumer_
   }
 
   // Pick up task from task list
-  auto task = tasks_.GetTaskByID(tasks_.permutation_[task_id]);
+  std::tuple<TaskType, std::tuple<int, int>, std::vector<uint64_t>, json> task;
+  if (tasks_.IsLazy()) {
+    auto row = tasks_.GetRowByID(tasks_.GetPermutedID(task_id));
+    if (std::get<0>(row) == TaskType::kCommonTask) {
+      auto row_ret = ReadRowByID(std::get<0>(std::get<1>(row)), std::get<2>(row), consumer_id);
+      if (SUCCESS != row_ret.first) {
+        return std::make_pair(
+          FAILED, std::make_pair(TaskType::kCommonTask, std::vector<std::tuple<std::vector<uint8_t>, json>>()));
+      }
+      task = std::make_tuple(TaskType::kCommonTask, std::get<1>(row), std::move(row_ret.second.first),
+                             std::move(row_ret.second.second));
+    } else {
+      std::get<0>(task) = TaskType::kPaddedTask;
+    }
+  } else {
+    task = tasks_.GetTaskByID(tasks_.GetPermutedID(task_id));
+  }
 
   // check task type
   auto task_type = std::get<0>(task);
@@ -1211,7 +1253,7 @@ MSRStatus ShardReader::ConsumerByBlock(int consumer_id) {
     }
 
     // Pick up task from task list
-    auto task = tasks_.GetTaskByID(tasks_.permutation_[task_id]);
+    auto task = tasks_.GetTaskByID(tasks_.GetPermutedID(task_id));
 
     auto shard_id = std::get<0>(std::get<1>(task));
     auto group_id = std::get<1>(std::get<1>(task));
@@ -1222,7 +1264,7 @@ MSRStatus ShardReader::ConsumerByBlock(int consumer_id) {
     auto page_length = std::get<2>(row_group_brief);
     auto page_offset = std::get<3>(row_group_brief);
 
-    MS_LOG(DEBUG) << "Block task " << task_id << tasks_.permutation_[task_id] << ", shard " << shard_id << ", group "
+    MS_LOG(DEBUG) << "Block task " << task_id << tasks_.GetPermutedID(task_id) << ", shard " << shard_id << ", group "
                   << group_id << ", page length " << page_length << ", page offset " << page_offset;
 
     // Deliver block data to output map
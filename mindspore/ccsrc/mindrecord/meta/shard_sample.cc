@@ -101,30 +101,10 @@ MSRStatus ShardSample::Execute(ShardTask &tasks) {
     }
   }
 
-  if (tasks.permutation_.empty()) {
-    ShardTask new_tasks;
-    total_no = static_cast<int>(tasks.Size());
-    if (sampler_type_ == kSubsetRandomSampler) {
-      for (int i = 0; i < indices_.size(); ++i) {
-        int index = ((indices_[i] % total_no) + total_no) % total_no;
-        new_tasks.InsertTask(tasks.GetTaskByID(index));  // different mod result between c and python
-      }
-    } else {
-      for (int i = partition_id_ * taking; i < (partition_id_ + 1) * taking; i++) {
-        new_tasks.InsertTask(tasks.GetTaskByID(i % total_no));  // rounding up. if overflow, go back to start
-      }
-    }
-    std::swap(tasks, new_tasks);
+  if (sampler_type_ == kSubsetRandomSampler) {
+    tasks.Pick(indices_);
   } else {
-    ShardTask new_tasks;
-    if (taking > static_cast<int>(tasks.permutation_.size())) {
-      return FAILED;
-    }
-    total_no = static_cast<int>(tasks.permutation_.size());
-    for (size_t i = partition_id_ * taking; i < (partition_id_ + 1) * taking; i++) {
-      new_tasks.InsertTask(tasks.GetTaskByID(tasks.permutation_[i % total_no]));
-    }
-    std::swap(tasks, new_tasks);
+    tasks.Slice(static_cast<uint64_t>(partition_id_) * taking, taking);  // rounding up. if overflow, go back to start
   }
   return SUCCESS;
 }
@@ -16,8 +16,6 @@
 
 #include "mindrecord/include/shard_shuffle.h"
 
-#include <algorithm>
-
 namespace mindspore {
 namespace mindrecord {
 ShardShuffle::ShardShuffle(uint32_t seed, ShuffleType shuffle_type)
@@ -28,23 +26,9 @@ MSRStatus ShardShuffle::Execute(ShardTask &tasks) {
     return FAILED;
   }
   if (shuffle_type_ == kShuffleSample) {
-    if (tasks.permutation_.empty() == true) {
-      tasks.MakePerm();
-    }
-    std::shuffle(tasks.permutation_.begin(), tasks.permutation_.end(), std::default_random_engine(shuffle_seed_));
+    tasks.Shuffle(shuffle_seed_, 1);
   } else {  // shuffle unit like: (a1, b1, c1),(a2, b2, c2),..., (an, bn, cn)
-    uint32_t individual_size = tasks.Size() / tasks.categories;
-    std::vector<std::vector<int>> new_permutations(tasks.categories, std::vector<int>(individual_size));
-    for (uint32_t i = 0; i < tasks.categories; i++) {
-      for (uint32_t j = 0; j < individual_size; j++) new_permutations[i][j] = static_cast<int>(j);
-      std::shuffle(new_permutations[i].begin(), new_permutations[i].end(), std::default_random_engine(shuffle_seed_));
-    }
-    tasks.permutation_.clear();
-    for (uint32_t j = 0; j < individual_size; j++) {
-      for (uint32_t i = 0; i < tasks.categories; i++) {
-        tasks.permutation_.push_back(new_permutations[i][j] * static_cast<int>(tasks.categories) + static_cast<int>(i));
-      }
-    }
+    tasks.Shuffle(shuffle_seed_, tasks.categories);
   }
   shuffle_seed_++;
   return SUCCESS;
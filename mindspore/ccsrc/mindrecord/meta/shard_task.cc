@@ -24,12 +24,17 @@ using mindspore::MsLogLevel::DEBUG;
 
 namespace mindspore {
 namespace mindrecord {
-void ShardTask::MakePerm() {
-  permutation_ = std::vector<int>(task_list_.size());
-  for (uint32_t i = 0; i < task_list_.size(); i++) {
-    permutation_[i] = static_cast<int>(i);
-  }
+namespace {
+const int kFeistelRounds = 4;
+
+// finalizer of splitmix64, used as round function of the feistel network
+uint64_t MixBits(uint64_t x) {
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
 }
+}  // namespace
 
 void ShardTask::InsertTask(TaskType task_type, int shard_id, int group_id, const std::vector<uint64_t> &offset,
                            const json &label) {
@@ -46,18 +51,36 @@ void ShardTask::InsertTask(std::tuple<TaskType, std::tuple<int, int>, std::vecto
   task_list_.push_back(std::move(task));
 }
 
+void ShardTask::InsertRowGroup(int shard_id, int group_id, uint64_t start_row_id, uint64_t n_rows) {
+  if (n_rows == 0) return;
+  row_groups_.emplace_back(shard_id, group_id, start_row_id, n_rows);
+  row_group_offsets_.push_back(total_rows_);
+  total_rows_ += n_rows;
+}
+
+void ShardTask::InsertPaddedTask(uint32_t n_padded) { padded_tasks_ += n_padded; }
+
 void ShardTask::PopBack() { task_list_.pop_back(); }
 
-uint32_t ShardTask::Size() const { return static_cast<uint32_t>(task_list_.size()); }
+uint64_t ShardTask::BaseSize() const {
+  if (!task_list_.empty()) return task_list_.size();
+  return total_rows_ + padded_tasks_;
+}
+
+uint32_t ShardTask::Size() const {
+  if (indexes_.empty()) return static_cast<uint32_t>(BaseSize());
+  return static_cast<uint32_t>(indexes_.back().output_size);
+}
 
 uint32_t ShardTask::SizeOfRows() const {
+  if (IsLazy()) return Size();
   if (task_list_.size() == 0) return static_cast<uint32_t>(0);
 
   // 1 task is 1 page
-  auto sum_num_rows = [](int x, std::tuple<TaskType, std::tuple<int, int>, std::vector<uint64_t>, json> y) {
-    return x + std::get<2>(y)[0];
-  };
-  uint32_t nRows = std::accumulate(task_list_.begin(), task_list_.end(), 0, sum_num_rows);
+  uint32_t nRows = 0;
+  for (uint64_t pos = 0; pos < Size(); ++pos) {
+    nRows += std::get<2>(task_list_[GetPermutedID(pos)])[0];
+  }
   return nRows;
 }
 
@@ -72,6 +95,91 @@ std::tuple<TaskType, std::tuple<int, int>, std::vector<uint64_t>, json> &ShardTa
   std::uniform_int_distribution<> dis(0, task_list_.size() - 1);
   return task_list_[dis(gen)];
 }
+
+uint64_t ShardTask::GetPermutedID(uint64_t pos) const {
+  uint64_t id = pos;
+  for (auto it = indexes_.rbegin(); it != indexes_.rend(); ++it) {
+    const auto &index = *it;
+    if (index.type == kIndexShuffle) {
+      uint64_t categories = index.categories;
+      id = FeistelPermute(id / categories, index.output_size / categories, index.seed) * categories + id % categories;
+    } else if (index.type == kIndexSlice) {
+      id = (index.start + id) % index.input_size;
+    } else {
+      auto n = static_cast<int64_t>(index.input_size);
+      id = static_cast<uint64_t>((((*index.picks)[id] % n) + n) % n);  // different mod result between c and python
+    }
+  }
+  return id;
+}
+
+std::tuple<TaskType, std::tuple<int, int>, uint64_t> ShardTask::GetRowByID(uint64_t id) const {
+  if (id >= total_rows_) {
+    return std::make_tuple(TaskType::kPaddedTask, std::make_tuple(0, 0), 0);
+  }
+  auto it = std::upper_bound(row_group_offsets_.begin(), row_group_offsets_.end(), id);
+  auto group_no = static_cast<size_t>(std::distance(row_group_offsets_.begin(), it)) - 1;
+  const auto &row_group = row_groups_[group_no];
+  return std::make_tuple(TaskType::kCommonTask, std::make_tuple(std::get<0>(row_group), std::get<1>(row_group)),
+                         std::get<2>(row_group) + id - row_group_offsets_[group_no]);
+}
+
+void ShardTask::Shuffle(uint32_t seed, uint32_t categories) {
+  // a new permutation replaces the previous one rather than being stacked on it
+  if (!indexes_.empty() && indexes_.back().type == kIndexShuffle) {
+    indexes_.pop_back();
+  }
+  TaskIndex index;
+  index.type = kIndexShuffle;
+  index.input_size = Size();
+  index.output_size = index.input_size / categories * categories;
+  index.seed = seed;
+  index.categories = categories;
+  indexes_.push_back(std::move(index));
+}
+
+void ShardTask::Slice(uint64_t start, uint64_t count) {
+  TaskIndex index;
+  index.type = kIndexSlice;
+  index.input_size = Size();
+  index.output_size = index.input_size == 0 ? 0 : count;
+  index.start = start;
+  indexes_.push_back(std::move(index));
+}
+
+void ShardTask::Pick(const std::vector<int64_t> &indices) {
+  TaskIndex index;
+  index.type = kIndexPick;
+  index.input_size = Size();
+  index.output_size = index.input_size == 0 ? 0 : indices.size();
+  index.picks = std::make_shared<std::vector<int64_t>>(indices);
+  indexes_.push_back(std::move(index));
+}
+
+uint64_t ShardTask::FeistelPermute(uint64_t id, uint64_t n, uint32_t seed) {
+  if (n <= 1) return id;
+  // balanced network over the smallest even number of bits covering n, cycle-walking back into [0, n)
+  uint32_t half_bits = 1;
+  while (half_bits < 32 && (uint64_t{1} << (2 * half_bits)) < n) half_bits++;
+  const uint64_t mask = (uint64_t{1} << half_bits) - 1;
+  uint64_t keys[kFeistelRounds];
+  for (int round = 0; round < kFeistelRounds; ++round) {
+    keys[round] = MixBits((static_cast<uint64_t>(seed) << 8) | static_cast<uint64_t>(round));
+  }
+  uint64_t x = id;
+  do {
+    uint64_t left = x >> half_bits;
+    uint64_t right = x & mask;
+    for (int round = 0; round < kFeistelRounds; ++round) {
+      uint64_t next = left ^ (MixBits(right ^ keys[round]) & mask);
+      left = right;
+      right = next;
+    }
+    x = (left << half_bits) | right;
+  } while (x >= n);
+  return x;
+}
+
 ShardTask ShardTask::Combine(std::vector<ShardTask> &category_tasks, bool replacement, int64_t num_elements) {
   ShardTask res;
   if (category_tasks.empty()) return res;
@@ -0,0 +1,147 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mindrecord/include/shard_zone_map.h"
+
+#include <climits>
+
+#include "common/utils.h"
+
+using mindspore::LogStream;
+using mindspore::ExceptionType::NoExceptionType;
+using mindspore::MsLogLevel::DEBUG;
+using mindspore::MsLogLevel::ERROR;
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+// parse the whole string as an int64, fail on fractions, exponents and overflow
+bool ParseInteger(const std::string &value, int64_t *result) {
+  try {
+    size_t pos = 0;
+    *result = static_cast<int64_t>(std::stoll(value, &pos));
+    return pos == value.size();
+  } catch (std::exception &e) {
+    return false;
+  }
+}
+}  // namespace
+
+void ShardZoneMap::AddStatistics(int shard_id, int group_id, const std::string &field, const std::string &min_value,
+                                 const std::string &max_value, uint64_t distinct_count, bool is_number) {
+  FieldStatistics stats{is_number, false, 0, 0, 0.0, 0.0, min_value, max_value, distinct_count};
+  if (is_number) {
+    stats.is_integer = ParseInteger(min_value, &stats.min_integer) && ParseInteger(max_value, &stats.max_integer);
+    try {
+      stats.min_number = std::stod(min_value);
+      stats.max_number = std::stod(max_value);
+    } catch (std::exception &e) {
+      MS_LOG(DEBUG) << "Statistics of field " << field << " are not numbers, compare them as strings.";
+      stats.is_number = false;
+      stats.is_integer = false;
+    }
+  }
+  statistics_[std::make_tuple(shard_id, group_id, field)] = std::move(stats);
+}
+
+void ShardZoneMap::Erase(int shard_id) {
+  auto first = statistics_.lower_bound(std::make_tuple(shard_id, INT_MIN, std::string()));
+  auto last = statistics_.lower_bound(std::make_tuple(shard_id + 1, INT_MIN, std::string()));
+  (void)statistics_.erase(first, last);
+}
+
+MSRStatus ShardZoneMap::Load(sqlite3 *db, int shard_id) {
+  if (db == nullptr) {
+    return FAILED;
+  }
+  // mindrecord files written before zone maps existed have no statistics table, every row group may match
+  std::string sql = "SELECT name FROM sqlite_master WHERE type = 'table' AND name = '" + std::string(kZoneMapTable) +
+                    "';";
+  sqlite3_stmt *stmt = nullptr;
+  if (sqlite3_prepare_v2(db, common::SafeCStr(sql), -1, &stmt, 0) != SQLITE_OK) {
+    MS_LOG(ERROR) << "SQL error: could not prepare statement, sql: " << sql;
+    return FAILED;
+  }
+  bool exist = sqlite3_step(stmt) == SQLITE_ROW;
+  (void)sqlite3_finalize(stmt);
+  if (!exist) {
+    MS_LOG(DEBUG) << "No row group statistics in shard " << shard_id << " index.";
+    return SUCCESS;
+  }
+
+  sql = "SELECT ROW_GROUP_ID, FIELD, MIN_VALUE, MAX_VALUE, DISTINCT_COUNT FROM " + std::string(kZoneMapTable) + ";";
+  if (sqlite3_prepare_v2(db, common::SafeCStr(sql), -1, &stmt, 0) != SQLITE_OK) {
+    MS_LOG(ERROR) << "SQL error: could not prepare statement, sql: " << sql;
+    return FAILED;
+  }
+  int rc = sqlite3_step(stmt);
+  while (rc == SQLITE_ROW) {
+    auto column_text = [stmt](int i) {
+      auto text = reinterpret_cast<const char *>(sqlite3_column_text(stmt, i));
+      return std::string(text == nullptr ? "" : text);
+    };
+    // sqlite keeps the storage class of the indexed column, numbers are stored as INTEGER or REAL
+    int value_type = sqlite3_column_type(stmt, 2);
+    bool is_number = value_type == SQLITE_INTEGER || value_type == SQLITE_FLOAT;
+    if (value_type != SQLITE_NULL) {
+      AddStatistics(shard_id, sqlite3_column_int(stmt, 0), column_text(1), column_text(2), column_text(3),
+                    static_cast<uint64_t>(sqlite3_column_int64(stmt, 4)), is_number);
+    }
+    rc = sqlite3_step(stmt);
+  }
+  (void)sqlite3_finalize(stmt);
+  if (rc != SQLITE_DONE) {
+    MS_LOG(ERROR) << "Error in select statement, sql: " << sql << ", error: " << sqlite3_errmsg(db);
+    return FAILED;
+  }
+  MS_LOG(DEBUG) << "Get row group statistics from shard " << shard_id << " index.";
+  return SUCCESS;
+}
+
+bool ShardZoneMap::MayContain(int shard_id, int group_id, const std::string &field, const std::string &value) const {
+  auto it = statistics_.find(std::make_tuple(shard_id, group_id, field));
+  if (it == statistics_.end()) {
+    return true;
+  }
+  const auto &stats = it->second;
+  if (stats.distinct_count == 0) {
+    return false;
+  }
+  int64_t integer = 0;
+  if (stats.is_integer && ParseInteger(value, &integer)) {
+    return integer >= stats.min_integer && integer <= stats.max_integer;
+  }
+  if (stats.is_number) {
+    double number = 0.0;
+    try {
+      number = std::stod(value);
+    } catch (std::exception &e) {
+      return true;
+    }
+    return number >= stats.min_number && number <= stats.max_number;
+  }
+  return value >= stats.min_value && value <= stats.max_value;
+}
+
+int64_t ShardZoneMap::GetDistinctCount(int shard_id, int group_id, const std::string &field) const {
+  auto it = statistics_.find(std::make_tuple(shard_id, group_id, field));
+  if (it == statistics_.end()) {
+    return -1;
+  }
+  return static_cast<int64_t>(it->second.distinct_count);
+}
+}  // namespace mindrecord
+}  // namespace mindspore
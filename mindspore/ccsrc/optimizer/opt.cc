@@ -20,12 +20,14 @@
 #include <unordered_set>
 #include <deque>
 #include <algorithm>
+#include <iterator>
 
 #include "ir/anf.h"
 #include "ir/manager.h"
 #include "utils/ordered_set.h"
 
 #include "utils/log_adapter.h"
+#include "utils/profile.h"
 #include "optimizer/optimizer.h"
 
 namespace mindspore {
@@ -34,7 +36,9 @@ namespace opt {
 SubstitutionPtr MakeSubstitution(const TransformFuncType &transform, const std::string &name, const PrimitivePtr &prim,
                                  const RenormAction &renorm_action) {
   auto fn = [prim](const AnfNodePtr &node) -> bool { return IsPrimitiveCNode(node, prim); };
-  return std::make_shared<Substitution>(transform, name, fn, renorm_action);
+  auto substitution = std::make_shared<Substitution>(transform, name, fn, renorm_action);
+  substitution->root_prims_ = {prim};
+  return substitution;
 }
 
 SubstitutionPtr MakeSubstitution(const TransformFuncType &transform, const std::string &name,
@@ -52,7 +56,9 @@ SubstitutionPtr MakeSubstitution(const TransformFuncType &transform, const std::
     return false;
   };
 
-  return std::make_shared<Substitution>(transform, name, fn, renorm_action);
+  auto substitution = std::make_shared<Substitution>(transform, name, fn, renorm_action);
+  substitution->root_prims_ = prims;
+  return substitution;
 }
 
 SubstitutionPtr MakeSubstitution(const TransformFuncType &transform, const std::string &name,
@@ -61,13 +67,16 @@ SubstitutionPtr MakeSubstitution(const TransformFuncType &transform, const std::
 }
 
 AnfNodePtr Substitution::operator()(const OptimizerPtr &optimizer, const AnfNodePtr &node) const {
-#ifdef ENABLE_PROFILE
   double t = GetTime();
-#endif
   AnfNodePtr result = transform_(optimizer, node);
+  auto time = GetTime();
+  stat_->tries++;
+  stat_->time += time - t;
+  if (result != nullptr && result != node) {
+    stat_->hits++;
+  }
 #ifdef ENABLE_PROFILE
   if (optimizer != nullptr) {
-    auto time = GetTime();
     MsProfile::StatTime("substitution." + name_, time - t);
     if (result != nullptr) {
       MsProfile::StatTime("match." + name_, time - t);
@@ -101,15 +110,49 @@ static bool isTraversable(const AnfNodePtr &node) {
   return false;
 }
 
-bool SubstitutionList::ApplyTransform(const OptimizerPtr &optimizer, const AnfNodePtr &root_node,
-                                      const SubstitutionPtr &transform) const {
+SubstitutionList::SubstitutionList(const std::vector<SubstitutionPtr> &patterns, bool is_once)
+    : list_(patterns), is_once_(is_once) {
+  for (size_t i = 0; i < list_.size(); ++i) {
+    MS_EXCEPTION_IF_NULL(list_[i]);
+    if (list_[i]->root_prims_.empty()) {
+      any_node_transforms_.push_back(i);
+    }
+    for (auto &prim : list_[i]->root_prims_) {
+      MS_EXCEPTION_IF_NULL(prim);
+      auto &transforms = prim_transforms_[prim->name()];
+      if (transforms.empty() || transforms.back() != i) {
+        transforms.push_back(i);
+      }
+    }
+  }
+  // The Substitutions matching any node are tried on the primitive nodes too, keeping the order of the list
+  for (auto &iter : prim_transforms_) {
+    auto &transforms = iter.second;
+    std::vector<size_t> merged;
+    (void)std::set_union(transforms.begin(), transforms.end(), any_node_transforms_.begin(),
+                         any_node_transforms_.end(), std::back_inserter(merged));
+    transforms = std::move(merged);
+  }
+}
+
+const std::vector<size_t> &SubstitutionList::Candidates(const AnfNodePtr &node) const {
+  PrimitivePtr prim = GetCNodePrimitive(node);
+  if (prim != nullptr) {
+    auto iter = prim_transforms_.find(prim->name());
+    if (iter != prim_transforms_.end()) {
+      return iter->second;
+    }
+  }
+  return any_node_transforms_;
+}
+
+bool SubstitutionList::ApplyTransforms(const OptimizerPtr &optimizer, const AnfNodePtr &root_node) const {
 #ifdef ENABLE_PROFILE
   double start = GetTime();
 #endif
   FuncGraphManagerPtr manager = optimizer->manager();
   auto seen = NewSeenGeneration();
-  // 1024 is for the initial capacity of deque
-  std::deque<AnfNodePtr> todo(1024);
+  std::deque<AnfNodePtr> todo;
   todo.push_back(root_node);
   bool changes = false;
 
@@ -124,12 +167,13 @@ bool SubstitutionList::ApplyTransform(const OptimizerPtr &optimizer, const AnfNo
     }
     node->seen_ = seen;
 
-    // select nodes that this transform can be applied.
-    bool is_match = transform->predicate_(node);
-
-    // apply transform on this node
+    // apply the first transform that changes this node, the new node is visited again for the others
     bool change = false;
-    if (is_match) {
+    for (size_t index : Candidates(node)) {
+      auto &transform = list_[index];
+      if (!transform->predicate_(node)) {
+        continue;
+      }
       auto ret = (*transform)(optimizer, node);
       if (ret != nullptr && ret != node) {
         change = true;
@@ -142,22 +186,21 @@ bool SubstitutionList::ApplyTransform(const OptimizerPtr &optimizer, const AnfNo
         MsProfile::StatTime("replace." + transform->name_, GetTime() - t);
 #endif
         node = ret;
+        break;
       }
     }
 
-    // find success, and add them to todo list
-    if (IsValueNode<FuncGraph>(node)) {
-      todo.push_back(GetValueNode<FuncGraphPtr>(node)->output());
-    }
-
-    if (node->isa<CNode>()) {
-      auto &inputs = node->cast<CNodePtr>()->inputs();
-      (void)std::copy(inputs.begin(), inputs.end(), std::back_inserter(todo));
-    }
-
-    auto &node_users = manager->node_users();
-    if (change && node_users.find(node) != node_users.end()) {
-      for (auto &use : node_users[node]) {
+    if (change) {
+      if (node->seen_ == seen) {
+        node->seen_--;
+      }
+      todo.push_front(node);
+      auto &node_users = manager->node_users();
+      auto users = node_users.find(node);
+      if (users == node_users.end()) {
+        continue;
+      }
+      for (auto &use : users->second) {
         auto use_node = use.first;
         if (use_node == nullptr) {
           continue;
@@ -167,6 +210,17 @@ bool SubstitutionList::ApplyTransform(const OptimizerPtr &optimizer, const AnfNo
           use_node->seen_--;
         }
       }
+      continue;
+    }
+
+    // find success, and add them to todo list
+    if (IsValueNode<FuncGraph>(node)) {
+      todo.push_back(GetValueNode<FuncGraphPtr>(node)->output());
+    }
+
+    if (node->isa<CNode>()) {
+      auto &inputs = node->cast<CNodePtr>()->inputs();
+      (void)std::copy(inputs.begin(), inputs.end(), std::back_inserter(todo));
     }
   }
 
@@ -176,28 +230,44 @@ bool SubstitutionList::ApplyTransform(const OptimizerPtr &optimizer, const AnfNo
   return changes;
 }
 
+void SubstitutionList::DumpStatistics() const {
+  for (auto &transform : list_) {
+    auto &stat = transform->stat_;
+    if (stat->tries == 0) {
+      continue;
+    }
+    MS_LOG(DEBUG) << "Substitution " << transform->name_ << ": hits " << stat->hits << ", tries " << stat->tries
+                  << ", time " << stat->time << "s.";
+  }
+}
+
 bool SubstitutionList::operator()(const FuncGraphPtr &func_graph, const OptimizerPtr &optimizer) const {
   MS_EXCEPTION_IF_NULL(optimizer);
   MS_EXCEPTION_IF_NULL(func_graph);
   FuncGraphManagerPtr manager = optimizer->manager();
   manager->AddFuncGraph(func_graph);
+  auto &compile_profiler = CompileProfiler::GetInstance();
+  if (compile_profiler.active()) {
+    for (auto &transform : list_) {
+      compile_profiler.WatchSubstitution(transform->name_, transform->stat_);
+    }
+  }
 
   bool loop = false;
   bool changes = false;
 
   do {
-    loop = false;
-    for (auto const &transform : list_) {
-      auto change = ApplyTransform(optimizer, func_graph->output(), transform);
-      changes = changes || change;
-      loop = loop || change;
-    }
+    loop = ApplyTransforms(optimizer, func_graph->output());
+    changes = changes || loop;
 
     if (is_once_) {
       break;
     }
   } while (loop);
 
+  if (IS_OUTPUT_ON(mindspore::DEBUG)) {
+    DumpStatistics();
+  }
   return changes;
 }
 }  // namespace opt
@@ -20,10 +20,12 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <unordered_map>
 
 #include "ir/anf.h"
 #include "ir/func_graph.h"
 #include "operator/ops.h"
+#include "utils/profile.h"
 
 namespace mindspore {
 /* namespace to support opt */
@@ -48,9 +50,17 @@ class Substitution {
   PredicateFuncType predicate_{nullptr};
   // an enum to mark this Substitution relation to renormalize pass
   RenormAction renorm_action_;
+  // the primitives of the nodes this Substitution can match, empty if it can match any node
+  std::vector<PrimitivePtr> root_prims_;
+  // statistics of the runs of this Substitution, summed over all the lists that use it
+  SubstitutionStatPtr stat_;
   Substitution(const TransformFuncType &transform, const std::string &name, const PredicateFuncType &predicate,
                const RenormAction &renorm_action)
-      : transform_(transform), name_(name), predicate_(predicate), renorm_action_(renorm_action) {}
+      : transform_(transform),
+        name_(name),
+        predicate_(predicate),
+        renorm_action_(renorm_action),
+        stat_(std::make_shared<SubstitutionStat>()) {}
   ~Substitution() = default;
   AnfNodePtr operator()(const OptimizerPtr &optimizer, const AnfNodePtr &node) const;
 };
@@ -65,19 +75,29 @@ SubstitutionPtr MakeSubstitution(const TransformFuncType &transform, const std::
 SubstitutionPtr MakeSubstitution(const TransformFuncType &transform, const std::string &name,
                                  const PredicateFuncType &predicate, const RenormAction &action_renorm = CHECK_RENORM);
 
+// Apply a list of Substitution until none of them changes the graph. Each round visits every node once and tries
+// only the Substitutions that can match its primitive, in the order of the list; the users of a changed node are
+// visited again in the same round.
 class SubstitutionList {
  public:
-  explicit SubstitutionList(const std::vector<SubstitutionPtr> &patterns, bool is_once = false)
-      : list_(patterns), is_once_(is_once) {}
+  explicit SubstitutionList(const std::vector<SubstitutionPtr> &patterns, bool is_once = false);
   ~SubstitutionList() = default;
 
   bool operator()(const FuncGraphPtr &func_graph, const OptimizerPtr &optimizer) const;
 
  private:
-  bool ApplyTransform(const OptimizerPtr &optimizer, const AnfNodePtr &node, const SubstitutionPtr &transform) const;
+  bool ApplyTransforms(const OptimizerPtr &optimizer, const AnfNodePtr &root_node) const;
+  // indexes in list_ of the Substitutions to try on a node
+  const std::vector<size_t> &Candidates(const AnfNodePtr &node) const;
+  void DumpStatistics() const;
+
   std::vector<SubstitutionPtr> list_;
   // a flag to mark this list of Substitution can only be executed only once
   bool is_once_;
+  // Substitutions that can match any node
+  std::vector<size_t> any_node_transforms_;
+  // primitive name to the Substitutions that can match its nodes, including those of any_node_transforms_
+  std::unordered_map<std::string, std::vector<size_t>> prim_transforms_;
 };
 }  // namespace opt
 }  // namespace mindspore
@@ -34,6 +34,7 @@
 #include "pipeline/resource.h"
 #include "pipeline/action.h"
 #include "utils/context/ms_context.h"
+#include "utils/profile.h"
 
 namespace mindspore {
 namespace opt {
@@ -140,7 +141,13 @@ class Optimizer : public std::enable_shared_from_this<Optimizer> {
       auto run_runc = [&counter, &func_graph, &changes, use_profile, this]() {
         for (size_t i = 0; i < passes_.size(); ++i) {
           const OptPass &opt = passes_[i];
-          auto opt_func = [&func_graph, &changes, &opt, this]() {
+          auto opt_func = [&func_graph, &changes, &opt, &counter, i, this]() {
+            CompileStepRecorder recorder(name_, pass_names_[i], counter, [this]() -> size_t {
+              if (resource_ == nullptr || resource_->manager() == nullptr) {
+                return 0;
+              }
+              return resource_->manager()->all_nodes().size();
+            });
             if (opt.is_renormalize()) {
               auto resource_ptr = std::dynamic_pointer_cast<pipeline::Resource>(resource_);
               if (resource_ptr != nullptr) {
@@ -0,0 +1,164 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "parallel/auto_parallel/costlist_memo.h"
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <unordered_map>
+#include "parallel/auto_parallel/graph_costmodel.h"
+
+namespace mindspore {
+namespace parallel {
+void RunCostListTasks(size_t task_num, const std::function<void(size_t)> &task) {
+  size_t thread_num = DP_ALGO_SEARCH_THREADS > 0 ? static_cast<size_t>(DP_ALGO_SEARCH_THREADS)
+                                                 : static_cast<size_t>(std::thread::hardware_concurrency());
+  thread_num = std::min(thread_num, task_num);
+  if (thread_num <= 1) {
+    for (size_t i = 0; i < task_num; ++i) {
+      task(i);
+    }
+    return;
+  }
+  std::atomic<size_t> next_task{0};
+  std::mutex exception_mutex;
+  std::exception_ptr exception = nullptr;
+  auto worker = [&]() {
+    for (size_t i = next_task++; i < task_num; i = next_task++) {
+      try {
+        task(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (exception == nullptr) {
+          exception = std::current_exception();
+        }
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < thread_num; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (exception != nullptr) {
+    std::rethrow_exception(exception);
+  }
+}
+
+CostListMemo &CostListMemo::GetInstance() {
+  static CostListMemo instance;
+  return instance;
+}
+
+void CostListMemo::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  memo_.clear();
+  hits_ = 0;
+  misses_ = 0;
+}
+
+CostPtrList CostListMemo::CreateCostList(CostListKind kind, const std::vector<Factors> &products,
+                                         const CostCreator &creator) {
+  // the positions of the first cost of each product in the concatenation
+  std::vector<size_t> begins;
+  size_t total = 0;
+  for (auto &factors : products) {
+    begins.push_back(total);
+    size_t size = factors.empty() ? 0 : 1;
+    for (auto &factor : factors) {
+      size *= factor.size();
+    }
+    total += size;
+  }
+  auto create = [&products, &begins, &creator](size_t position) {
+    auto product = static_cast<size_t>(std::upper_bound(begins.begin(), begins.end(), position) - begins.begin()) - 1;
+    auto &factors = products[product];
+    // the indexes of the factors in row-major order, as nested loops over the factors would visit them
+    size_t remain = position - begins[product];
+    std::vector<size_t> indexes(factors.size());
+    for (size_t i = factors.size(); i > 0; --i) {
+      indexes[i - 1] = remain % factors[i - 1].size();
+      remain /= factors[i - 1].size();
+    }
+    return creator(product, indexes);
+  };
+
+  MemoKey key;
+  key.first = static_cast<int>(kind);
+  if (COST_MODEL_SIMPLIFY_CALCULATION) {
+    // Simplify compares the sums of these values, and the partial communications depend on COST_MODEL_GAMMA
+    auto &values = key.second;
+    values.push_back(COST_MODEL_GAMMA);
+    values.push_back(static_cast<double>(RUN_PHASE));
+    for (auto &factors : products) {
+      values.push_back(static_cast<double>(factors.size()));
+      for (auto &factor : factors) {
+        values.push_back(static_cast<double>(factor.size()));
+        for (auto &cost : factor) {
+          MS_EXCEPTION_IF_NULL(cost);
+          values.push_back(cost->computation_cost_);
+          values.push_back(cost->communication_cost_);
+          values.push_back(cost->communication_without_parameter_);
+          values.push_back(cost->communication_forward_);
+        }
+      }
+    }
+    std::vector<size_t> positions;
+    bool hit = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto iter = memo_.find(key);
+      if (iter != memo_.end()) {
+        positions = iter->second;
+        hit = true;
+      }
+    }
+    if (hit) {
+      hits_++;
+      CostPtrList result;
+      for (auto position : positions) {
+        result.emplace_back(create(position));
+      }
+      return result;
+    }
+  }
+
+  misses_++;
+  CostPtrList result;
+  std::unordered_map<Cost *, size_t> cost_positions;
+  for (size_t position = 0; position < total; ++position) {
+    auto cost = create(position);
+    MS_EXCEPTION_IF_NULL(cost);
+    cost_positions[cost.get()] = position;
+    result.emplace_back(std::move(cost));
+  }
+  Simplify(&result);
+  if (COST_MODEL_SIMPLIFY_CALCULATION) {
+    std::vector<size_t> positions;
+    for (auto &cost : result) {
+      positions.push_back(cost_positions[cost.get()]);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    memo_[key] = positions;
+  }
+  return result;
+}
+}  // namespace parallel
+}  // namespace mindspore
@@ -0,0 +1,71 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PARALLEL_AUTO_PARALLEL_COSTLIST_MEMO_H_
+#define MINDSPORE_CCSRC_PARALLEL_AUTO_PARALLEL_COSTLIST_MEMO_H_
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "parallel/auto_parallel/costmodel.h"
+
+namespace mindspore {
+namespace parallel {
+// Run task(0), ..., task(task_num - 1) on DP_ALGO_SEARCH_THREADS threads, or on all the cores if it is 0. The tasks
+// must write disjoint data. The first exception thrown by a task is rethrown after all the tasks ended.
+void RunCostListTasks(size_t task_num, const std::function<void(size_t)> &task);
+
+enum CostListKind {
+  OP_ELIMINATION_COSTLIST,
+  EDGE_ELIMINATION_COSTLIST,
+  MERGE_ELIMINATION_COSTLIST,
+  CONTRACT_ELIMINATION_COSTLIST,
+  TRIANGLE_ELIMINATION_COSTLIST
+};
+
+// The new cost list of an elimination is the simplified concatenation of the cartesian products of some cost lists,
+// the factors. The repeated layers of a network are eliminated into products of the same costs, so the positions of
+// the costs kept by Simplify are memoized by the values of the factors, and only these costs are created on a hit.
+class CostListMemo {
+ public:
+  // the factors of a cartesian product
+  using Factors = std::vector<CostPtrList>;
+  // create the cost combining the costs at 'indexes' of the factors of the product 'product'
+  using CostCreator = std::function<CostPtr(size_t product, const std::vector<size_t> &indexes)>;
+
+  static CostListMemo &GetInstance();
+  CostPtrList CreateCostList(CostListKind kind, const std::vector<Factors> &products, const CostCreator &creator);
+  void Clear();
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+
+ private:
+  CostListMemo() = default;
+  ~CostListMemo() = default;
+  using MemoKey = std::pair<int, std::vector<double>>;
+
+  std::mutex mutex_;
+  std::map<MemoKey, std::vector<size_t>> memo_;
+  std::atomic<size_t> hits_{0};
+  std::atomic<size_t> misses_{0};
+};
+}  // namespace parallel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PARALLEL_AUTO_PARALLEL_COSTLIST_MEMO_H_
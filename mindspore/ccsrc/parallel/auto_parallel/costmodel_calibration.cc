@@ -0,0 +1,161 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "parallel/auto_parallel/costmodel_calibration.h"
+
+#include <sys/stat.h>
+#include <fstream>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include "parallel/auto_parallel/operator_costmodel.h"
+#include "parallel/tensor_layout/tensor_info.h"
+#include "utils/log_adapter.h"
+
+using json = nlohmann::json;
+
+namespace mindspore {
+namespace parallel {
+namespace {
+// modification time of 'file' in nanoseconds, -1 if it can't be read
+int64_t GetFileMtime(const std::string &file) {
+  struct stat file_stat;
+  if (stat(file.c_str(), &file_stat) != 0) {
+    return -1;
+  }
+  return static_cast<int64_t>(file_stat.st_mtim.tv_sec) * 1000000000 + static_cast<int64_t>(file_stat.st_mtim.tv_nsec);
+}
+
+// the cost of the operator info of each calibrated primitive
+OperatorCostPtr NewCalibratedOperatorCost(const std::string &op_type) {
+  if (op_type == "MatMul") {
+    return std::make_shared<MatMulCost>(true);
+  }
+  if (op_type == "ReLU") {
+    return std::make_shared<ActivationCost>(false);
+  }
+  if (op_type == "Softmax") {
+    return std::make_shared<SoftmaxCost>(false);
+  }
+  if (op_type == "Mul") {
+    return std::make_shared<ArithmeticCost>(true);
+  }
+  if (op_type == "BiasAdd") {
+    return std::make_shared<BiasAddCost>(false);
+  }
+  if (op_type == "Transpose") {
+    return std::make_shared<TransposeCost>(false);
+  }
+  MS_LOG(EXCEPTION) << "The computation cost of " << op_type << " can't be calibrated.";
+}
+
+TensorInfo MakeSlicedTensorInfo(const Shape &shape, const Dimensions &strategy) {
+  if (shape.size() != strategy.size()) {
+    MS_LOG(EXCEPTION) << "The strategy of " << strategy.size() << " dimensions doesn't match the shape of "
+                      << shape.size() << " dimensions.";
+  }
+  Shape slice_shape;
+  for (size_t i = 0; i < shape.size(); ++i) {
+    if (strategy[i] <= 0 || shape[i] % strategy[i] != 0) {
+      MS_LOG(EXCEPTION) << "The dimension " << i << " of size " << shape[i] << " can't be split by " << strategy[i]
+                        << ".";
+    }
+    slice_shape.push_back(shape[i] / strategy[i]);
+  }
+  return TensorInfo(TensorLayout(), shape, slice_shape);
+}
+}  // namespace
+
+CostModelCalibration &CostModelCalibration::GetInstance() {
+  static CostModelCalibration instance;
+  return instance;
+}
+
+void CostModelCalibration::Clear() {
+  file_.clear();
+  file_mtime_ = -1;
+  computation_coefficients_.clear();
+}
+
+void CostModelCalibration::Load(const std::string &file) {
+  auto mtime = file.empty() ? -1 : GetFileMtime(file);
+  if (file == file_ && mtime == file_mtime_) {
+    return;
+  }
+  Clear();
+  if (file.empty()) {
+    return;
+  }
+  std::ifstream fin(file);
+  if (!fin.is_open()) {
+    MS_LOG(EXCEPTION) << "Open the cost model calibration file " << file << " failed.";
+  }
+  json profile;
+  try {
+    fin >> profile;
+  } catch (const std::exception &e) {
+    MS_LOG(EXCEPTION) << "Parse the cost model calibration file " << file << " failed: " << e.what();
+  }
+  auto coefficients = profile.find("computation_coefficients");
+  if (coefficients == profile.end() || !coefficients->is_object()) {
+    MS_LOG(EXCEPTION) << "The cost model calibration file " << file << " has no 'computation_coefficients'.";
+  }
+  for (auto iter = coefficients->begin(); iter != coefficients->end(); ++iter) {
+    if (!iter.value().is_number() || iter.value().get<double>() <= 0) {
+      MS_LOG(EXCEPTION) << "The computation coefficient of " << iter.key() << " in " << file << " must be positive.";
+    }
+    computation_coefficients_[iter.key()] = iter.value().get<double>();
+    MS_LOG(INFO) << "The computation coefficient of " << iter.key() << ": " << iter.value().get<double>() << ".";
+  }
+  file_ = file;
+  file_mtime_ = mtime;
+}
+
+double CostModelCalibration::computation_coefficient(const std::string &op_type) const {
+  auto iter = computation_coefficients_.find(op_type);
+  if (iter == computation_coefficients_.end()) {
+    return DEFAULT_COMPUTATION_COEFFICIENT;
+  }
+  return iter->second;
+}
+
+double CostModelCalibration::ComputationCost(const std::string &op_type, const std::vector<Shape> &shapes,
+                                             const std::vector<Dimensions> &strategy) {
+  auto operator_cost = NewCalibratedOperatorCost(op_type);
+  if (shapes.empty() || shapes.size() != strategy.size()) {
+    MS_LOG(EXCEPTION) << "The " << strategy.size() << " strategies of " << op_type << " don't match its "
+                      << shapes.size() << " inputs.";
+  }
+  std::vector<TensorInfo> inputs;
+  for (size_t i = 0; i < shapes.size(); ++i) {
+    inputs.push_back(MakeSlicedTensorInfo(shapes[i], strategy[i]));
+  }
+  // only the output of MatMul is read, the others are of the shape of their first input
+  auto output = inputs[0];
+  if (op_type == "MatMul") {
+    if (shapes.size() != 2 || shapes[0].size() != 2 || shapes[1].size() != 2) {
+      MS_LOG(EXCEPTION) << "The calibrated MatMul has two inputs of two dimensions.";
+    }
+    output = MakeSlicedTensorInfo({shapes[0][0], shapes[1][1]}, {strategy[0][0], strategy[1][1]});
+  }
+  return operator_cost->GetForwardComputationCost(inputs, {output}, 0);
+}
+
+double CostModelCalibration::CalibratedComputationCost(const std::string &op_type, const std::vector<Shape> &shapes,
+                                                       const std::vector<Dimensions> &strategy) const {
+  return computation_coefficient(op_type) * ComputationCost(op_type, shapes, strategy);
+}
+}  // namespace parallel
+}  // namespace mindspore
@@ -0,0 +1,67 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PARALLEL_AUTO_PARALLEL_COSTMODEL_CALIBRATION_H_
+#define MINDSPORE_CCSRC_PARALLEL_AUTO_PARALLEL_COSTMODEL_CALIBRATION_H_
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "parallel/device_matrix.h"
+#include "parallel/strategy.h"
+
+namespace mindspore {
+namespace parallel {
+#define DEFAULT_COMPUTATION_COEFFICIENT 1.0
+
+// The computation costs of the operators are bytes of the sliced tensors, which weight all the operators alike. The
+// calibration profile, written by mindspore.parallel._cost_model_calibration from the measured kernel times, holds a
+// coefficient for each operator type, e.g.
+//   {"device_target": "CPU", "computation_coefficients": {"MatMul": 2.5, "ReLU": 0.6}}
+// and the computation cost of an operator is multiplied by the coefficient of its primitive.
+class CostModelCalibration {
+ public:
+  static CostModelCalibration &GetInstance();
+  // load the profile 'file', or drop the coefficients if it is empty. A file already loaded is only read again if
+  // it was modified since.
+  void Load(const std::string &file);
+  void Clear();
+  // the coefficient of the primitive 'op_type', DEFAULT_COMPUTATION_COEFFICIENT if it is not calibrated
+  double computation_coefficient(const std::string &op_type) const;
+  const std::map<std::string, double> &computation_coefficients() const { return computation_coefficients_; }
+
+  // the forward computation cost of the calibrated operator 'op_type' on the inputs of 'shapes' sliced by
+  // 'strategy', as the cost graph computes it before calibration. The calibration fits the kernel times against it.
+  static double ComputationCost(const std::string &op_type, const std::vector<Shape> &shapes,
+                                const std::vector<Dimensions> &strategy);
+  // the above cost multiplied by the coefficient of 'op_type'
+  double CalibratedComputationCost(const std::string &op_type, const std::vector<Shape> &shapes,
+                                   const std::vector<Dimensions> &strategy) const;
+
+ private:
+  CostModelCalibration() = default;
+  ~CostModelCalibration() = default;
+
+  std::string file_;
+  // modification time of the loaded file in nanoseconds
+  int64_t file_mtime_{-1};
+  std::map<std::string, double> computation_coefficients_;
+};
+}  // namespace parallel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PARALLEL_AUTO_PARALLEL_COSTMODEL_CALIBRATION_H_
@@ -16,15 +16,19 @@
 
 #include "parallel/auto_parallel/dp_algo_costmodel.h"
 
+#include <chrono>
 #include <memory>
 #include <utility>
 #include <vector>
+#include "parallel/auto_parallel/costlist_memo.h"
 
 namespace mindspore {
 namespace parallel {
 Status GetStrategy(const CostGraphPtr &graph) {
   MS_LOG(INFO) << "Searching strategies begins.";
   MS_EXCEPTION_IF_NULL(graph);
+  auto start_time = std::chrono::steady_clock::now();
+  CostListMemo::GetInstance().Clear();
   std::vector<EliminationPtr> eliminations;
   bool flag = true;
 
@@ -105,6 +109,12 @@ Status GetStrategy(const CostGraphPtr &graph) {
     }
   }
 
+  auto &memo = CostListMemo::GetInstance();
+  auto cost = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time);
+  MS_LOG(INFO) << "Shrinking the CostGraph by " << eliminations.size() << " eliminations costs " << cost.count()
+               << " ms, " << memo.hits() << " cost lists are reused from " << memo.hits() + memo.misses() << ".";
+  memo.Clear();
+
   // Phase 2: Search the cost_list in the final graph, and determine the optimal one
   if (graph->SearchStrategy() != SUCCESS) {
     MS_LOG(ERROR) << "Searching strategy for the final failed.";
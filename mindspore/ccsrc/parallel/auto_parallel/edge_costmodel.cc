@@ -20,6 +20,7 @@
 #include <functional>
 #include <iterator>
 #include <utility>
+#include "parallel/auto_parallel/costlist_memo.h"
 #include "parallel/auto_parallel/costmodel.h"
 #include "parallel/auto_parallel/graph_costmodel.h"
 #include "parallel/tensor_layout/tensor_redistribution.h"
@@ -160,94 +161,93 @@ CostPtrList Edge::CreateEdgeEliminationCostList(const StrategyPtr &output_st_ptr
     MS_EXCEPTION_IF_NULL(edge);
     return edge->GetCostList(output_st_ptr, input_st_ptr);
   };
-  CostPtrList result;
   std::vector<CostPtrList> all_cost_list;
   all_cost_list.resize(edges.size());
   (void)std::transform(edges.begin(), edges.end(), all_cost_list.begin(), LocalGetCostList);
 
-  CostPtrList selected_cost_list(all_cost_list.size(), nullptr);
-  std::function<void(size_t, double, double, double, double, double)> recursive =
-    [&](size_t k, double computation, double memory, double communication, double communication_without_para,
-        double communication_forward) {
-      if (k == edges.size()) {
-        auto decision = std::make_shared<EdgeEliminationDecision>(selected_cost_list);
-        CostPtr new_cost = std::make_shared<Cost>(computation, communication);
-        MS_EXCEPTION_IF_NULL(new_cost);
-        new_cost->communication_without_parameter_ = communication_without_para;
-        new_cost->communication_with_partial_para_ =
-          communication_without_para + COST_MODEL_GAMMA * (communication - communication_without_para);
-        new_cost->memory_with_reuse_ = memory;
-        new_cost->communication_forward_ = communication_forward;
-        new_cost->decision_ptr_ = decision;
-        result.push_back(new_cost);
-        return;
-      }
-      for (auto &c : all_cost_list[k]) {
-        MS_EXCEPTION_IF_NULL(c);
-        selected_cost_list[k] = c;
-        recursive(k + 1, computation + c->computation_cost_, memory + c->memory_with_reuse_,
-                  communication + c->communication_cost_,
-                  communication_without_para + c->communication_without_parameter_,
-                  communication_forward + c->communication_forward_);
-      }
-    };
-  recursive(0, 0.0, 0.0, 0.0, 0.0, 0.0);
-  Simplify(&result);
-  return result;
+  // a cost for each combination of the costs of the edges
+  auto create_cost = [&all_cost_list](size_t, const std::vector<size_t> &indexes) {
+    double computation = 0.0, memory = 0.0, communication = 0.0, communication_without_para = 0.0,
+           communication_forward = 0.0;
+    CostPtrList selected_cost_list(all_cost_list.size(), nullptr);
+    for (size_t k = 0; k < all_cost_list.size(); ++k) {
+      auto &c = all_cost_list[k][indexes[k]];
+      MS_EXCEPTION_IF_NULL(c);
+      selected_cost_list[k] = c;
+      computation = computation + c->computation_cost_;
+      memory = memory + c->memory_with_reuse_;
+      communication = communication + c->communication_cost_;
+      communication_without_para = communication_without_para + c->communication_without_parameter_;
+      communication_forward = communication_forward + c->communication_forward_;
+    }
+    auto decision = std::make_shared<EdgeEliminationDecision>(selected_cost_list);
+    CostPtr new_cost = std::make_shared<Cost>(computation, communication);
+    MS_EXCEPTION_IF_NULL(new_cost);
+    new_cost->communication_without_parameter_ = communication_without_para;
+    new_cost->communication_with_partial_para_ =
+      communication_without_para + COST_MODEL_GAMMA * (communication - communication_without_para);
+    new_cost->memory_with_reuse_ = memory;
+    new_cost->communication_forward_ = communication_forward;
+    new_cost->decision_ptr_ = decision;
+    return new_cost;
+  };
+  return CostListMemo::GetInstance().CreateCostList(EDGE_ELIMINATION_COSTLIST, {all_cost_list}, create_cost);
 }
 
-void Edge::EdgeEliminationSetNewCost(OperatorInfoPtr, const std::vector<EdgePtr> &edges, OperatorInfoPtr) {
-  bool valid = false;
+// Set the cost lists of the pairs of strategies in parallel, then fill 'cost_map_'
+void Edge::SetNewCost(const std::function<CostPtrList(const StrategyPtr &, const StrategyPtr &)> &create_cost_list) {
+  std::vector<CostPtrKey> keys;
   for (const auto &output_pair : pre_op_output_) {
-    StrategyPtr output_st_ptr = output_pair.first;
     for (const auto &input_pair : next_op_input_) {
-      StrategyPtr input_st_ptr = input_pair.first;
-      CostPtrList clist = CreateEdgeEliminationCostList(output_st_ptr, edges, input_st_ptr);
-      CostPtrKey key = {output_st_ptr, input_st_ptr};
-      cost_map_[key] = clist;
-      if ((!valid) && (!clist.empty())) {
-        valid = true;
-      }
+      keys.push_back({output_pair.first, input_pair.first});
     }
   }
+  std::vector<CostPtrList> clists(keys.size());
+  RunCostListTasks(keys.size(), [&keys, &clists, &create_cost_list](size_t i) {
+    clists[i] = create_cost_list(keys[i].first, keys[i].second);
+  });
+  bool valid = false;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if ((!valid) && (!clists[i].empty())) {
+      valid = true;
+    }
+    cost_map_[keys[i]] = std::move(clists[i]);
+  }
   if (!valid) {
     MS_LOG(EXCEPTION) << "Creating edge: " << edge_name_ << " failed.";
   }
 }
 
-void Edge::CreateOpEliminationSubCostList(StrategyPtr op_strategy, const CostPtrList &left_cost_list,
-                                          const CostPtrList &middle_cost_list, const CostPtrList &right_cost_list,
-                                          CostPtrList *ret_cost_list) {
-  for (auto &left_cost : left_cost_list) {
-    MS_EXCEPTION_IF_NULL(left_cost);
-    for (auto &middle_cost : middle_cost_list) {
-      MS_EXCEPTION_IF_NULL(middle_cost);
-      for (auto &right_cost : right_cost_list) {
-        MS_EXCEPTION_IF_NULL(right_cost);
-        double computation =
-          left_cost->computation_cost_ + middle_cost->computation_cost_ + right_cost->computation_cost_;
-        double communication =
-          left_cost->communication_cost_ + middle_cost->communication_cost_ + right_cost->communication_cost_;
-        double communication_forward =
-          left_cost->communication_forward_ + middle_cost->communication_forward_ + right_cost->communication_forward_;
-        double communication_without_para = left_cost->communication_without_parameter_ +
-                                            middle_cost->communication_without_parameter_ +
-                                            right_cost->communication_without_parameter_;
-        double memory_cost =
-          left_cost->memory_with_reuse_ + middle_cost->memory_with_reuse_ + right_cost->memory_with_reuse_;
+void Edge::EdgeEliminationSetNewCost(OperatorInfoPtr, const std::vector<EdgePtr> &edges, OperatorInfoPtr) {
+  SetNewCost([this, &edges](const StrategyPtr &output_st_ptr, const StrategyPtr &input_st_ptr) {
+    return CreateEdgeEliminationCostList(output_st_ptr, edges, input_st_ptr);
+  });
+}
 
-        auto decision = std::make_shared<OpEliminationDecision>(op_strategy, left_cost, middle_cost, right_cost);
-        auto cost = std::make_shared<Cost>(computation, communication, decision);
-        MS_EXCEPTION_IF_NULL(cost);
-        cost->communication_without_parameter_ = communication_without_para;
-        cost->communication_with_partial_para_ =
-          communication_without_para + COST_MODEL_GAMMA * (communication - communication_without_para);
-        cost->memory_with_reuse_ = memory_cost;
-        cost->communication_forward_ = communication_forward;
-        ret_cost_list->emplace_back(std::move(cost));
-      }
-    }
-  }
+CostPtr Edge::CreateOpEliminationCost(const StrategyPtr &op_strategy, const CostPtr &left_cost,
+                                      const CostPtr &middle_cost, const CostPtr &right_cost) {
+  MS_EXCEPTION_IF_NULL(left_cost);
+  MS_EXCEPTION_IF_NULL(middle_cost);
+  MS_EXCEPTION_IF_NULL(right_cost);
+  double computation = left_cost->computation_cost_ + middle_cost->computation_cost_ + right_cost->computation_cost_;
+  double communication =
+    left_cost->communication_cost_ + middle_cost->communication_cost_ + right_cost->communication_cost_;
+  double communication_forward =
+    left_cost->communication_forward_ + middle_cost->communication_forward_ + right_cost->communication_forward_;
+  double communication_without_para = left_cost->communication_without_parameter_ +
+                                      middle_cost->communication_without_parameter_ +
+                                      right_cost->communication_without_parameter_;
+  double memory_cost = left_cost->memory_with_reuse_ + middle_cost->memory_with_reuse_ + right_cost->memory_with_reuse_;
+
+  auto decision = std::make_shared<OpEliminationDecision>(op_strategy, left_cost, middle_cost, right_cost);
+  auto cost = std::make_shared<Cost>(computation, communication, decision);
+  MS_EXCEPTION_IF_NULL(cost);
+  cost->communication_without_parameter_ = communication_without_para;
+  cost->communication_with_partial_para_ =
+    communication_without_para + COST_MODEL_GAMMA * (communication - communication_without_para);
+  cost->memory_with_reuse_ = memory_cost;
+  cost->communication_forward_ = communication_forward;
+  return cost;
 }
 
 CostPtrList Edge::CreateOpEliminationCostList(const EdgePtr &e1, const StrategyPtr &output_st_ptr,
@@ -256,35 +256,28 @@ CostPtrList Edge::CreateOpEliminationCostList(const EdgePtr &e1, const StrategyP
   MS_EXCEPTION_IF_NULL(op);
   MS_EXCEPTION_IF_NULL(e1);
   MS_EXCEPTION_IF_NULL(e2);
-  CostPtrList result;
+  // a product of the left, middle and right costs for each strategy of 'op'
+  std::vector<StrategyPtr> middle_strategies;
+  std::vector<CostListMemo::Factors> products;
   for (const auto &op_strategy : op->GetStrategyCost()) {
     MS_EXCEPTION_IF_NULL(op_strategy);
     auto middle_strategy = op_strategy->strategy_ptr;
-    CreateOpEliminationSubCostList(middle_strategy, e1->GetCostList(output_st_ptr, middle_strategy),
-                                   op_strategy->cost_list, e2->GetCostList(middle_strategy, input_st_ptr), &result);
+    middle_strategies.push_back(middle_strategy);
+    products.push_back({e1->GetCostList(output_st_ptr, middle_strategy), op_strategy->cost_list,
+                        e2->GetCostList(middle_strategy, input_st_ptr)});
   }
-  Simplify(&result);
-  return result;
+  auto create_cost = [&middle_strategies, &products](size_t product, const std::vector<size_t> &indexes) {
+    auto &factors = products[product];
+    return CreateOpEliminationCost(middle_strategies[product], factors[0][indexes[0]], factors[1][indexes[1]],
+                                   factors[2][indexes[2]]);
+  };
+  return CostListMemo::GetInstance().CreateCostList(OP_ELIMINATION_COSTLIST, products, create_cost);
 }
 
 void Edge::OpEliminationSetNewCost(const EdgePtr &e1, const OperatorInfoPtr &op, const EdgePtr &e2) {
-  bool valid = false;
-  for (const auto &output_pair : pre_op_output_) {
-    StrategyPtr output_st_ptr = output_pair.first;
-    for (const auto &input_pair : next_op_input_) {
-      StrategyPtr input_st_ptr = input_pair.first;
-
-      CostPtrList clist = CreateOpEliminationCostList(e1, output_st_ptr, op, e2, input_st_ptr);
-      CostPtrKey key = {output_st_ptr, input_st_ptr};
-      cost_map_[key] = clist;
-      if ((!valid) && (!clist.empty())) {
-        valid = true;
-      }
-    }
-  }
-  if (!valid) {
-    MS_LOG(EXCEPTION) << "Creating edge: " << edge_name_ << " failed.";
-  }
+  SetNewCost([this, &e1, &op, &e2](const StrategyPtr &output_st_ptr, const StrategyPtr &input_st_ptr) {
+    return CreateOpEliminationCostList(e1, output_st_ptr, op, e2, input_st_ptr);
+  });
 }
 
 Status Edge::CalculateMemoryCost() {
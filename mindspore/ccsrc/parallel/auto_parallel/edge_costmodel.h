@@ -17,6 +17,7 @@
 #ifndef PARALLEL_AUTO_PARALLEL_EDGE_COSTMODEL_H_
 #define PARALLEL_AUTO_PARALLEL_EDGE_COSTMODEL_H_
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -116,9 +117,9 @@ class Edge {
   // set cost for this new edge
   void EdgeEliminationSetNewCost(std::shared_ptr<OperatorInfo> u, const std::vector<std::shared_ptr<Edge>> &edges,
                                  std::shared_ptr<OperatorInfo> v);
-  void CreateOpEliminationSubCostList(StrategyPtr op_strategy, const CostPtrList &left_cost_list,
-                                      const CostPtrList &middle_cost_list, const CostPtrList &right_cost_list,
-                                      CostPtrList *ret_cost_list);
+  // The cost of 'op' under 'op_strategy' with the cost of the edges on both sides
+  static CostPtr CreateOpEliminationCost(const StrategyPtr &op_strategy, const CostPtr &left_cost,
+                                         const CostPtr &middle_cost, const CostPtr &right_cost);
 
   CostPtrList CreateOpEliminationCostList(const std::shared_ptr<Edge> &e1, const StrategyPtr &output_st_ptr,
                                           const std::shared_ptr<OperatorInfo> &op, const std::shared_ptr<Edge> &e2,
@@ -140,6 +141,8 @@ class Edge {
   void mark_output_critical() { is_output_critical_ = 1; }
 
  private:
+  void SetNewCost(const std::function<CostPtrList(const StrategyPtr &, const StrategyPtr &)> &create_cost_list);
+
   std::string edge_name_;
   std::shared_ptr<OperatorInfo> prev_op_, next_op_;
   std::map<CostPtrKey, CostPtrList> cost_map_;
@@ -22,6 +22,8 @@
 #include <vector>
 
 #include "parallel/auto_parallel/graph_costmodel.h"
+#include "parallel/auto_parallel/costlist_memo.h"
+#include "parallel/auto_parallel/costmodel_calibration.h"
 #include "parallel/ops_info/reshape_info.h"
 #include "parallel/step_auto_parallel.h"
 
@@ -41,8 +43,19 @@ bool FULLY_USE_DEVICES = DEFAULT_FULLY_USE_DEVICES;
 bool ELEMENTWISE_OP_STRA_FOLLOW = DEFAULT_ELEMENTWISE_OP_STRA_FOLLOW;
 bool MULTI_SUBGRAPHS = DEFAULT_IS_MULTI_SUBGRAPHS;
 int32_t RUN_PHASE = DEFAULT_RUN_PHASE;
+int32_t DP_ALGO_SEARCH_THREADS = DEFAULT_DP_ALGO_SEARCH_THREADS;
 constexpr char RESHAPEINFO[] = "ReshapeInfo";
 
+namespace {
+// whether the operator has a cost under some strategy after an elimination
+bool HasCostList(const std::vector<std::shared_ptr<StrategyWithCost>> &stra_costs) {
+  return std::any_of(stra_costs.begin(), stra_costs.end(), [](const std::shared_ptr<StrategyWithCost> &stra_cost) {
+    MS_EXCEPTION_IF_NULL(stra_cost);
+    return !stra_cost->cost_list.empty();
+  });
+}
+}  // namespace
+
 void CostGraph::SetDeviceMemoryAndCostParameter() {
   MS_EXCEPTION_IF_NULL(CostModelContext::GetInstance());
 
@@ -163,6 +176,19 @@ void CostGraph::SetDeviceMemoryAndCostParameter() {
   }
   RUN_PHASE = phase;
   MS_LOG(INFO) << "run_phase: " << RUN_PHASE << ".";
+
+  // DP_ALGO_SEARCH_THREADS
+  auto search_threads = CostModelContext::GetInstance()->dp_algo_search_threads();
+  if (search_threads < 0) {
+    MS_LOG(EXCEPTION) << "'dp_algo_search_threads' must be nonnegative.";
+  }
+  DP_ALGO_SEARCH_THREADS = search_threads;
+  MS_LOG(INFO) << "dp_algo_search_threads: " << DP_ALGO_SEARCH_THREADS << ".";
+
+  // COST_MODEL_CALIBRATION_FILE
+  auto calibration_file = CostModelContext::GetInstance()->costmodel_calibration_file();
+  CostModelCalibration::GetInstance().Load(calibration_file);
+  MS_LOG(INFO) << "costmodel_calibration_file: " << calibration_file << ".";
 }
 
 void CostGraph::RemoveOperator(const OperatorInfoPtr &op) {
@@ -923,45 +949,33 @@ std::shared_ptr<Edge> CostGraph::EliminationEdges(const std::vector<std::shared_
   return new_edge;
 }
 
-// Given 'op_cost_list', 'edge_cost_list', and 'tar_cost_list', this method is to create 'tar_cost_list_new'
-// for this contract under the strategy 'op_strategy'
-void CostGraph::CreateMergeEliminationSubCostList(StrategyPtr op_strategy, const CostPtrList &op_cost_list,
-                                                  const CostPtrList &edge_cost_list, StrategyPtr tar_op_strategy,
-                                                  const CostPtrList &tar_cost_list,
-                                                  CostPtrList *const tar_cost_list_new) {
-  for (size_t i = 0; i < op_cost_list.size(); ++i) {
-    auto &op_cost = op_cost_list[i];
-    MS_EXCEPTION_IF_NULL(op_cost);
-    for (size_t j = 0; j < edge_cost_list.size(); ++j) {
-      auto &edge_cost = edge_cost_list[j];
-      MS_EXCEPTION_IF_NULL(edge_cost);
-      for (size_t k = 0; k < tar_cost_list.size(); ++k) {
-        auto &tar_cost = tar_cost_list[k];
-        MS_EXCEPTION_IF_NULL(tar_cost);
-        double computation = op_cost->computation_cost_ + edge_cost->computation_cost_ + tar_cost->computation_cost_;
-        double memory = op_cost->memory_with_reuse_ + edge_cost->memory_with_reuse_ + tar_cost->memory_with_reuse_;
-        double communication =
-          op_cost->communication_cost_ + edge_cost->communication_cost_ + tar_cost->communication_cost_;
-        double communication_forward =
-          op_cost->communication_forward_ + edge_cost->communication_forward_ + tar_cost->communication_forward_;
-        double communication_without_para = op_cost->communication_without_parameter_ +
-                                            edge_cost->communication_without_parameter_ +
-                                            tar_cost->communication_without_parameter_;
-
-        auto decision =
-          std::make_shared<MergeEliminationDecision>(op_strategy, op_cost, edge_cost, tar_op_strategy, tar_cost);
-        auto new_cost = std::make_shared<Cost>(computation, communication, decision);
-        MS_EXCEPTION_IF_NULL(new_cost);
-        new_cost->communication_without_parameter_ = communication_without_para;
-        new_cost->communication_with_partial_para_ =
-          communication_without_para + COST_MODEL_GAMMA * (communication - communication_without_para);
-        new_cost->memory_with_reuse_ = memory;
-        new_cost->communication_forward_ = communication_forward;
-        MS_EXCEPTION_IF_NULL(tar_cost_list_new);
-        tar_cost_list_new->emplace_back(std::move(new_cost));
-      }
-    }
-  }
+// Given the costs of 'op', the edge and the target operator, this method is to create the cost of the target
+// operator for this merge under the strategies 'op_strategy' and 'tar_op_strategy'
+CostPtr CostGraph::CreateMergeEliminationCost(const StrategyPtr &op_strategy, const CostPtr &op_cost,
+                                              const CostPtr &edge_cost, const StrategyPtr &tar_op_strategy,
+                                              const CostPtr &tar_cost) {
+  MS_EXCEPTION_IF_NULL(op_cost);
+  MS_EXCEPTION_IF_NULL(edge_cost);
+  MS_EXCEPTION_IF_NULL(tar_cost);
+  double computation = op_cost->computation_cost_ + edge_cost->computation_cost_ + tar_cost->computation_cost_;
+  double memory = op_cost->memory_with_reuse_ + edge_cost->memory_with_reuse_ + tar_cost->memory_with_reuse_;
+  double communication = op_cost->communication_cost_ + edge_cost->communication_cost_ + tar_cost->communication_cost_;
+  double communication_forward =
+    op_cost->communication_forward_ + edge_cost->communication_forward_ + tar_cost->communication_forward_;
+  double communication_without_para = op_cost->communication_without_parameter_ +
+                                      edge_cost->communication_without_parameter_ +
+                                      tar_cost->communication_without_parameter_;
+
+  auto decision =
+    std::make_shared<MergeEliminationDecision>(op_strategy, op_cost, edge_cost, tar_op_strategy, tar_cost);
+  auto new_cost = std::make_shared<Cost>(computation, communication, decision);
+  MS_EXCEPTION_IF_NULL(new_cost);
+  new_cost->communication_without_parameter_ = communication_without_para;
+  new_cost->communication_with_partial_para_ =
+    communication_without_para + COST_MODEL_GAMMA * (communication - communication_without_para);
+  new_cost->memory_with_reuse_ = memory;
+  new_cost->communication_forward_ = communication_forward;
+  return new_cost;
 }
 
 // This method is for the 'Merge' operation in DP algorithm. It creates new costlist for each strategy in the
@@ -973,31 +987,34 @@ OperatorInfoPtr CostGraph::EliminationMerge(const OperatorInfoPtr &op) {
   MS_EXCEPTION_IF_NULL(target_op);
   MS_EXCEPTION_IF_NULL(edge_ptr);
   MS_LOG(INFO) << "Now merging " << op->name() << " into " << target_op->name() << ".";
-  bool valid = false;
+  auto tar_stra_costs = target_op->GetStrategyCost();
+  auto op_stra_costs = op->GetStrategyCost();
 
-  for (auto &tar_stra_cost : target_op->GetStrategyCost()) {
+  // the cost lists of the strategies of target_op are independent, so they are created in parallel
+  RunCostListTasks(tar_stra_costs.size(), [&tar_stra_costs, &op_stra_costs, &edge_ptr](size_t index) {
+    auto &tar_stra_cost = tar_stra_costs[index];
     MS_EXCEPTION_IF_NULL(tar_stra_cost);
     auto tar_stra = tar_stra_cost->strategy_ptr;
-    auto tar_clist_origin = tar_stra_cost->cost_list;
-    CostPtrList tar_clist_new;
-
-    for (auto &op_stra_cost : op->GetStrategyCost()) {
+    std::vector<StrategyPtr> op_stras;
+    std::vector<CostListMemo::Factors> products;
+    for (auto &op_stra_cost : op_stra_costs) {
       MS_EXCEPTION_IF_NULL(op_stra_cost);
       auto op_stra = op_stra_cost->strategy_ptr;
-      auto op_clist = op_stra_cost->cost_list;
-      auto edge_clist = edge_ptr->GetCostList(op_stra, tar_stra);
-
-      CreateMergeEliminationSubCostList(op_stra, op_clist, edge_clist, tar_stra, tar_clist_origin, &tar_clist_new);
-    }
-    Simplify(&tar_clist_new);
+      op_stras.push_back(op_stra);
+      products.push_back(
+        {op_stra_cost->cost_list, edge_ptr->GetCostList(op_stra, tar_stra), tar_stra_cost->cost_list});
+    }
+    auto create_cost = [&op_stras, &products, &tar_stra](size_t product, const std::vector<size_t> &indexes) {
+      auto &factors = products[product];
+      return CreateMergeEliminationCost(op_stras[product], factors[0][indexes[0]], factors[1][indexes[1]], tar_stra,
+                                        factors[2][indexes[2]]);
+    };
     // Set the new costlist w.r.t the strategy
-    tar_stra_cost->cost_list = tar_clist_new;
-    if ((!valid) && (!tar_clist_new.empty())) {
-      valid = true;
-    }
-  }
+    tar_stra_cost->cost_list =
+      CostListMemo::GetInstance().CreateCostList(MERGE_ELIMINATION_COSTLIST, products, create_cost);
+  });
 
-  if (!valid) {
+  if (!HasCostList(tar_stra_costs)) {
     MS_LOG(EXCEPTION) << "Merging " << op->name() << " into " << target_op->name() << " failed.";
   }
   op->SetNotAlive();
@@ -1005,45 +1022,35 @@ OperatorInfoPtr CostGraph::EliminationMerge(const OperatorInfoPtr &op) {
   return target_op;
 }
 
-// Given 'contract_op_cost_list', 'edge_cost_list', and 'tar_cost_list', this method is to create 'tar_cost_list_new'
-// for this contract under the strategy 'contract_op_stra'
-void CostGraph::CreateContractEliminationSubCostList(StrategyPtr contract_op_stra,
-                                                     const CostPtrList &contract_op_cost_list,
-                                                     const CostPtrList &edge_cost_list, StrategyPtr target_op_stra,
-                                                     const CostPtrList &tar_cost_list, CostPtrList *tar_cost_list_new) {
-  for (size_t i = 0; i < contract_op_cost_list.size(); ++i) {
-    auto &contract_op_cost = contract_op_cost_list[i];
-    MS_EXCEPTION_IF_NULL(contract_op_cost);
-    for (size_t j = 0; j < edge_cost_list.size(); ++j) {
-      auto &edge_cost = edge_cost_list[j];
-      MS_EXCEPTION_IF_NULL(edge_cost);
-      for (size_t k = 0; k < tar_cost_list.size(); ++k) {
-        auto &tar_cost = tar_cost_list[k];
-        MS_EXCEPTION_IF_NULL(tar_cost);
-        double computation =
-          contract_op_cost->computation_cost_ + edge_cost->computation_cost_ + tar_cost->computation_cost_;
-        double memory =
-          contract_op_cost->memory_with_reuse_ + edge_cost->memory_with_reuse_ + tar_cost->memory_with_reuse_;
-        double communication =
-          contract_op_cost->communication_cost_ + edge_cost->communication_cost_ + tar_cost->communication_cost_;
-        double communication_forward = contract_op_cost->communication_forward_ + edge_cost->communication_forward_ +
-                                       tar_cost->communication_forward_;
-        double communication_without_para = contract_op_cost->communication_without_parameter_ +
-                                            edge_cost->communication_without_parameter_ +
-                                            tar_cost->communication_without_parameter_;
-
-        auto decision = std::make_shared<ContractEliminationDecision>(contract_op_stra, contract_op_cost, edge_cost,
-                                                                      target_op_stra, tar_cost);
-        auto new_cost = std::make_shared<Cost>(computation, communication, decision);
-        new_cost->communication_without_parameter_ = communication_without_para;
-        new_cost->communication_with_partial_para_ =
-          communication_without_para + COST_MODEL_GAMMA * (communication - communication_without_para);
-        new_cost->memory_with_reuse_ = memory;
-        new_cost->communication_forward_ = communication_forward;
-        tar_cost_list_new->emplace_back(std::move(new_cost));
-      }
-    }
-  }
+// Given the costs of 'contract_op', the edge and the target operator, this method is to create the cost of the target
+// operator for this contract under the strategies 'contract_op_stra' and 'target_op_stra'
+CostPtr CostGraph::CreateContractEliminationCost(const StrategyPtr &contract_op_stra, const CostPtr &contract_op_cost,
+                                                 const CostPtr &edge_cost, const StrategyPtr &target_op_stra,
+                                                 const CostPtr &tar_cost) {
+  MS_EXCEPTION_IF_NULL(contract_op_cost);
+  MS_EXCEPTION_IF_NULL(edge_cost);
+  MS_EXCEPTION_IF_NULL(tar_cost);
+  double computation =
+    contract_op_cost->computation_cost_ + edge_cost->computation_cost_ + tar_cost->computation_cost_;
+  double memory = contract_op_cost->memory_with_reuse_ + edge_cost->memory_with_reuse_ + tar_cost->memory_with_reuse_;
+  double communication =
+    contract_op_cost->communication_cost_ + edge_cost->communication_cost_ + tar_cost->communication_cost_;
+  double communication_forward =
+    contract_op_cost->communication_forward_ + edge_cost->communication_forward_ + tar_cost->communication_forward_;
+  double communication_without_para = contract_op_cost->communication_without_parameter_ +
+                                      edge_cost->communication_without_parameter_ +
+                                      tar_cost->communication_without_parameter_;
+
+  auto decision = std::make_shared<ContractEliminationDecision>(contract_op_stra, contract_op_cost, edge_cost,
+                                                                target_op_stra, tar_cost);
+  auto new_cost = std::make_shared<Cost>(computation, communication, decision);
+  MS_EXCEPTION_IF_NULL(new_cost);
+  new_cost->communication_without_parameter_ = communication_without_para;
+  new_cost->communication_with_partial_para_ =
+    communication_without_para + COST_MODEL_GAMMA * (communication - communication_without_para);
+  new_cost->memory_with_reuse_ = memory;
+  new_cost->communication_forward_ = communication_forward;
+  return new_cost;
 }
 
 // This method is for the 'Contract' operation in DP algorithm. It creates new costlist for each strategy in the
@@ -1052,31 +1059,36 @@ OperatorInfoPtr CostGraph::EliminationContract(const OperatorInfoPtr &op) {
   MS_EXCEPTION_IF_NULL(op);
   auto target_op = op->GetAlivePrevEdges()[0]->prev_operator();
   auto edge_ptr = op->GetAlivePrevEdges()[0];
+  MS_EXCEPTION_IF_NULL(target_op);
+  MS_EXCEPTION_IF_NULL(edge_ptr);
   MS_LOG(INFO) << "Now contracting " << op->name() << " into " << target_op->name() << ".";
-  bool valid = false;
+  auto tar_stra_costs = target_op->GetStrategyCost();
+  auto op_stra_costs = op->GetStrategyCost();
 
-  for (auto &tar_stra_cost : target_op->GetStrategyCost()) {
+  RunCostListTasks(tar_stra_costs.size(), [&tar_stra_costs, &op_stra_costs, &edge_ptr](size_t index) {
+    auto &tar_stra_cost = tar_stra_costs[index];
     MS_EXCEPTION_IF_NULL(tar_stra_cost);
     auto tar_stra = tar_stra_cost->strategy_ptr;
-    auto tar_clist_origin = tar_stra_cost->cost_list;
-    CostPtrList tar_clist_new;
-
-    for (auto &op_stra_cost : op->GetStrategyCost()) {
+    std::vector<StrategyPtr> op_stras;
+    std::vector<CostListMemo::Factors> products;
+    for (auto &op_stra_cost : op_stra_costs) {
       MS_EXCEPTION_IF_NULL(op_stra_cost);
       auto op_stra = op_stra_cost->strategy_ptr;
-      auto op_clist = op_stra_cost->cost_list;
-      auto edge_clist = edge_ptr->GetCostList(tar_stra, op_stra);
-
-      CreateContractEliminationSubCostList(op_stra, op_clist, edge_clist, tar_stra, tar_clist_origin, &tar_clist_new);
-    }
-    Simplify(&tar_clist_new);
+      op_stras.push_back(op_stra);
+      products.push_back(
+        {op_stra_cost->cost_list, edge_ptr->GetCostList(tar_stra, op_stra), tar_stra_cost->cost_list});
+    }
+    auto create_cost = [&op_stras, &products, &tar_stra](size_t product, const std::vector<size_t> &indexes) {
+      auto &factors = products[product];
+      return CreateContractEliminationCost(op_stras[product], factors[0][indexes[0]], factors[1][indexes[1]],
+                                           tar_stra, factors[2][indexes[2]]);
+    };
     // Set the new costlist w.r.t the strategy
-    tar_stra_cost->cost_list = tar_clist_new;
-    if ((!valid) && (!tar_clist_new.empty())) {
-      valid = true;
-    }
-  }
-  if (!valid) {
+    tar_stra_cost->cost_list =
+      CostListMemo::GetInstance().CreateCostList(CONTRACT_ELIMINATION_COSTLIST, products, create_cost);
+  });
+
+  if (!HasCostList(tar_stra_costs)) {
     MS_LOG(EXCEPTION) << "Contracting " << op->name() << " into " << target_op->name() << " failed.";
   }
   op->SetNotAlive();
@@ -1084,63 +1096,38 @@ OperatorInfoPtr CostGraph::EliminationContract(const OperatorInfoPtr &op) {
   return target_op;
 }
 
-void CostGraph::CreateTriangleEliminationSubCostList(StrategyPtr elimi_op_stra, StrategyPtr left_op_stra,
-                                                     StrategyPtr right_op_stra, const CostPtr &right_op_cost,
-                                                     const CostPtrList &elimi_op_clist,
-                                                     const CostPtrList &left_edge_clist, const CostPtr &right_edge_cost,
-                                                     const CostPtrList &left_node_clist_origin,
-                                                     CostPtrList *left_node_clist_new) {
-  MS_EXCEPTION_IF_NULL(right_edge_cost);
+CostPtr CostGraph::CreateTriangleEliminationCost(const StrategyPtr &elimi_op_stra, const StrategyPtr &left_op_stra,
+                                                 const StrategyPtr &right_op_stra, const CostPtr &right_op_cost,
+                                                 const CostPtr &elimi_op_cost, const CostPtr &left_edge_cost,
+                                                 const CostPtr &right_edge_cost, const CostPtr &left_node_cost) {
   MS_EXCEPTION_IF_NULL(right_op_cost);
-  MS_EXCEPTION_IF_NULL(left_node_clist_new);
-  for (auto &elimi_op_cost : elimi_op_clist) {
-    MS_EXCEPTION_IF_NULL(elimi_op_cost);
-    for (auto &left_edge_cost : left_edge_clist) {
-      MS_EXCEPTION_IF_NULL(left_edge_cost);
-      for (auto &left_node_cost : left_node_clist_origin) {
-        MS_EXCEPTION_IF_NULL(left_node_cost);
-        double new_computation = elimi_op_cost->computation_cost_ + left_edge_cost->computation_cost_ +
-                                 left_node_cost->computation_cost_ + right_edge_cost->computation_cost_;
-        double new_memory = elimi_op_cost->memory_with_reuse_ + left_edge_cost->memory_with_reuse_ +
-                            left_node_cost->memory_with_reuse_ + right_edge_cost->memory_with_reuse_;
-        double new_commu_cost = elimi_op_cost->communication_cost_ + left_edge_cost->communication_cost_ +
-                                left_node_cost->communication_cost_ + right_edge_cost->communication_cost_;
-        double new_commu_forward = elimi_op_cost->communication_forward_ + left_edge_cost->communication_forward_ +
-                                   left_node_cost->communication_forward_ + right_edge_cost->communication_forward_;
-        double new_commu_without =
-          elimi_op_cost->communication_without_parameter_ + left_edge_cost->communication_without_parameter_ +
-          left_node_cost->communication_without_parameter_ + right_edge_cost->communication_without_parameter_;
-
-        auto decision = std::make_shared<TriangleEliminationDecision>(
-          elimi_op_stra, elimi_op_cost, left_edge_cost, right_edge_cost, left_op_stra, left_node_cost, right_op_stra);
-        auto new_cost = std::make_shared<Cost>(new_computation, new_commu_cost, decision);
-        new_cost->communication_without_parameter_ = new_commu_without;
-        new_cost->communication_with_partial_para_ =
-          new_commu_without + COST_MODEL_GAMMA * (new_commu_cost - new_commu_without);
-        new_cost->memory_with_reuse_ = new_memory;
-        new_cost->communication_forward_ = new_commu_forward;
-        left_node_clist_new->emplace_back(std::move(new_cost));
-      }
-    }
-  }
-}
-
-void CostGraph::CreateTriangleEliminationCostList(const OperatorInfoPtr &elimi_op, const CostPtrList &right_node_clist,
-                                                  const CostPtrList &right_edge_clist, const StrategyPtr &elimi_op_stra,
-                                                  const StrategyPtr &left_node_stra, const StrategyPtr &right_node_stra,
-                                                  const CostPtrList &elimi_op_clist, const CostPtrList &left_edge_clist,
-                                                  const CostPtrList &left_node_clist_origin,
-                                                  CostPtrList *left_node_clist_new) {
-  MS_EXCEPTION_IF_NULL(elimi_op);
-  for (auto &right_node_cost : right_node_clist) {
-    MS_EXCEPTION_IF_NULL(right_node_cost);
-    for (auto &right_edge_cost : right_edge_clist) {
-      MS_EXCEPTION_IF_NULL(right_edge_cost);
-      CreateTriangleEliminationSubCostList(elimi_op_stra, left_node_stra, right_node_stra, right_node_cost,
-                                           elimi_op_clist, left_edge_clist, right_edge_cost, left_node_clist_origin,
-                                           left_node_clist_new);
-    }
-  }
+  MS_EXCEPTION_IF_NULL(elimi_op_cost);
+  MS_EXCEPTION_IF_NULL(left_edge_cost);
+  MS_EXCEPTION_IF_NULL(right_edge_cost);
+  MS_EXCEPTION_IF_NULL(left_node_cost);
+  double new_computation = elimi_op_cost->computation_cost_ + left_edge_cost->computation_cost_ +
+                           left_node_cost->computation_cost_ + right_edge_cost->computation_cost_;
+  double new_memory = elimi_op_cost->memory_with_reuse_ + left_edge_cost->memory_with_reuse_ +
+                      left_node_cost->memory_with_reuse_ + right_edge_cost->memory_with_reuse_;
+  double new_commu_cost = elimi_op_cost->communication_cost_ + left_edge_cost->communication_cost_ +
+                          left_node_cost->communication_cost_ + right_edge_cost->communication_cost_;
+  double new_commu_forward = elimi_op_cost->communication_forward_ + left_edge_cost->communication_forward_ +
+                             left_node_cost->communication_forward_ + right_edge_cost->communication_forward_;
+  double new_commu_without =
+    elimi_op_cost->communication_without_parameter_ + left_edge_cost->communication_without_parameter_ +
+    left_node_cost->communication_without_parameter_ + right_edge_cost->communication_without_parameter_;
+
+  auto decision = std::make_shared<TriangleEliminationDecision>(elimi_op_stra, elimi_op_cost, left_edge_cost,
+                                                                right_edge_cost, left_op_stra, left_node_cost,
+                                                                right_op_stra);
+  auto new_cost = std::make_shared<Cost>(new_computation, new_commu_cost, decision);
+  MS_EXCEPTION_IF_NULL(new_cost);
+  new_cost->communication_without_parameter_ = new_commu_without;
+  new_cost->communication_with_partial_para_ =
+    new_commu_without + COST_MODEL_GAMMA * (new_commu_cost - new_commu_without);
+  new_cost->memory_with_reuse_ = new_memory;
+  new_cost->communication_forward_ = new_commu_forward;
+  return new_cost;
 }
 
 OperatorInfoPtr CostGraph::EliminationTriangle(const OperatorInfoPtr &elimi_op,
@@ -1164,40 +1151,42 @@ OperatorInfoPtr CostGraph::EliminationTriangle(const OperatorInfoPtr &elimi_op,
     left_edge = right_edge;
     right_edge = tmp;
   }
-  bool valid = false;
+  auto left_node_stra_costs = left_node->GetStrategyCost();
+  auto elimi_op_stra_costs = elimi_op->GetStrategyCost();
+  auto right_node_stra_costs = right_node->GetStrategyCost();
 
-  for (auto &left_node_stra_cost : left_node->GetStrategyCost()) {
+  RunCostListTasks(left_node_stra_costs.size(), [&](size_t index) {
+    auto &left_node_stra_cost = left_node_stra_costs[index];
     MS_EXCEPTION_IF_NULL(left_node_stra_cost);
     auto left_node_stra = left_node_stra_cost->strategy_ptr;
-    auto left_node_clist_origin = left_node_stra_cost->cost_list;
-    CostPtrList left_node_clist_new;
-
-    for (auto &elimi_op_stra_cost : elimi_op->GetStrategyCost()) {
+    // a product for each pair of strategies of elimi_op and right_node
+    std::vector<std::pair<StrategyPtr, StrategyPtr>> stras;
+    std::vector<CostListMemo::Factors> products;
+    for (auto &elimi_op_stra_cost : elimi_op_stra_costs) {
       MS_EXCEPTION_IF_NULL(elimi_op_stra_cost);
       auto elimi_op_stra = elimi_op_stra_cost->strategy_ptr;
-      auto elimi_op_clist = elimi_op_stra_cost->cost_list;
       auto left_edge_clist = left_edge->GetCostList(elimi_op_stra, left_node_stra);
 
-      for (auto &right_node_stra_cost : right_node->GetStrategyCost()) {
+      for (auto &right_node_stra_cost : right_node_stra_costs) {
         MS_EXCEPTION_IF_NULL(right_node_stra_cost);
         auto right_node_stra = right_node_stra_cost->strategy_ptr;
-        auto right_node_clist = right_node_stra_cost->cost_list;
-        auto right_edge_clist = right_edge->GetCostList(elimi_op_stra, right_node_stra);
-
-        CreateTriangleEliminationCostList(elimi_op, right_node_clist, right_edge_clist, elimi_op_stra, left_node_stra,
-                                          right_node_stra, elimi_op_clist, left_edge_clist, left_node_clist_origin,
-                                          &left_node_clist_new);
+        stras.emplace_back(elimi_op_stra, right_node_stra);
+        products.push_back({right_node_stra_cost->cost_list, right_edge->GetCostList(elimi_op_stra, right_node_stra),
+                            elimi_op_stra_cost->cost_list, left_edge_clist, left_node_stra_cost->cost_list});
       }
     }
-    Simplify(&left_node_clist_new);
+    auto create_cost = [&stras, &products, &left_node_stra](size_t product, const std::vector<size_t> &indexes) {
+      auto &factors = products[product];
+      return CreateTriangleEliminationCost(stras[product].first, left_node_stra, stras[product].second,
+                                           factors[0][indexes[0]], factors[2][indexes[2]], factors[3][indexes[3]],
+                                           factors[1][indexes[1]], factors[4][indexes[4]]);
+    };
     // Set the new costlist w.r.t the strategy
-    left_node_stra_cost->cost_list = left_node_clist_new;
-    if ((!valid) && (!left_node_clist_new.empty())) {
-      valid = true;
-    }
-  }
+    left_node_stra_cost->cost_list =
+      CostListMemo::GetInstance().CreateCostList(TRIANGLE_ELIMINATION_COSTLIST, products, create_cost);
+  });
 
-  if (!valid) {
+  if (!HasCostList(left_node_stra_costs)) {
     MS_LOG(EXCEPTION) << "Eliminating triangle: " << elimi_op->name() << " failed.";
   }
   elimi_op->SetNotAlive();
@@ -1315,17 +1304,19 @@ std::vector<std::shared_ptr<Edge>> CostGraph::EliminationStar(const OperatorInfo
   MS_EXCEPTION_IF_NULL(succ_edges[0]);
   auto first_succ_node = succ_edges[0]->next_operator();
   auto first_succ_edge = succ_edges[0];
-  bool valid = false;
 
   // 'merged_op' is merged into first_node
   MS_EXCEPTION_IF_NULL(first_succ_node);
-  for (auto &first_succ_node_stra_cost : first_succ_node->GetStrategyCost()) {
+  auto first_succ_node_stra_costs = first_succ_node->GetStrategyCost();
+  auto merged_op_stra_costs = merged_op->GetStrategyCost();
+  RunCostListTasks(first_succ_node_stra_costs.size(), [&](size_t index) {
+    auto &first_succ_node_stra_cost = first_succ_node_stra_costs[index];
     MS_EXCEPTION_IF_NULL(first_succ_node_stra_cost);
     auto first_succ_node_stra = first_succ_node_stra_cost->strategy_ptr;
     auto first_succ_node_clist = first_succ_node_stra_cost->cost_list;
     CostPtrList first_succ_node_clist_new;
 
-    for (auto &merged_op_stra_cost : merged_op->GetStrategyCost()) {
+    for (auto &merged_op_stra_cost : merged_op_stra_costs) {
       MS_EXCEPTION_IF_NULL(merged_op_stra_cost);
       auto merged_op_stra = merged_op_stra_cost->strategy_ptr;
       auto merged_op_clist = merged_op_stra_cost->cost_list;
@@ -1337,12 +1328,9 @@ std::vector<std::shared_ptr<Edge>> CostGraph::EliminationStar(const OperatorInfo
     Simplify(&first_succ_node_clist_new);
     // Set the new costlist w.r.t the strategy
     first_succ_node_stra_cost->cost_list = first_succ_node_clist_new;
-    if ((!valid) && (!first_succ_node_clist_new.empty())) {
-      valid = true;
-    }
-  }
+  });
 
-  if (!valid) {
+  if (!HasCostList(first_succ_node_stra_costs)) {
     MS_LOG(EXCEPTION) << "Eliminating star centered at: " << merged_op->name() << " failed.";
   }
 
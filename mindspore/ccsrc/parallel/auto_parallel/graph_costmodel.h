@@ -45,6 +45,7 @@ namespace parallel {
 #define DEFAULT_FULLY_USE_DEVICES true
 #define DEFAULT_ELEMENTWISE_OP_STRA_FOLLOW false
 #define DEFAULT_IS_MULTI_SUBGRAPHS false
+#define DEFAULT_DP_ALGO_SEARCH_THREADS 0
 #define DEFAULT_RUN_PHASE 0
 #define TRAINING_PHASE 0
 #define INFERENCE_PHASE 1
@@ -65,6 +66,7 @@ extern bool FULLY_USE_DEVICES;
 extern bool ELEMENTWISE_OP_STRA_FOLLOW;
 extern bool MULTI_SUBGRAPHS;
 extern int32_t RUN_PHASE;
+extern int32_t DP_ALGO_SEARCH_THREADS;
 
 class CostGraph {
   // 'CostGraph' consists of Operators and edges between them. An edge is created between two Operators if they have
@@ -154,22 +156,20 @@ class CostGraph {
   EdgePtr EliminationEdges(const std::vector<EdgePtr> &edges);
   // Applying Merge Elimination in DP algorithm
   OperatorInfoPtr EliminationMerge(const OperatorInfoPtr &op);
-  void CreateMergeEliminationSubCostList(StrategyPtr op_strategy, const CostPtrList &op_cost_list,
-                                         const CostPtrList &edge_cost_list, StrategyPtr tar_op_strategy,
-                                         const CostPtrList &tar_cost_list, CostPtrList *tar_cost_list_new);
+  static CostPtr CreateMergeEliminationCost(const StrategyPtr &op_strategy, const CostPtr &op_cost,
+                                            const CostPtr &edge_cost, const StrategyPtr &tar_op_strategy,
+                                            const CostPtr &tar_cost);
   // Applying Contract Elimination in DP algorithm
   OperatorInfoPtr EliminationContract(const OperatorInfoPtr &op);
-  void CreateContractEliminationSubCostList(StrategyPtr, const CostPtrList &, const CostPtrList &, StrategyPtr,
-                                            const CostPtrList &, CostPtrList *);
+  static CostPtr CreateContractEliminationCost(const StrategyPtr &, const CostPtr &, const CostPtr &,
+                                               const StrategyPtr &, const CostPtr &);
 
   // Applying Triangle Elimination in DP algorithm. return the left_node
   OperatorInfoPtr EliminationTriangle(const OperatorInfoPtr &elimi_op, const EdgePtr &edge_left_right);
-  void CreateTriangleEliminationCostList(const OperatorInfoPtr &, const CostPtrList &, const CostPtrList &,
-                                         const StrategyPtr &, const StrategyPtr &, const StrategyPtr &,
-                                         const CostPtrList &, const CostPtrList &, const CostPtrList &, CostPtrList *);
-  // Given the relevant costlist, create the TriangleElimination cost
-  void CreateTriangleEliminationSubCostList(StrategyPtr, StrategyPtr, StrategyPtr, const CostPtr &, const CostPtrList &,
-                                            const CostPtrList &, const CostPtr &, const CostPtrList &, CostPtrList *);
+  // Given the relevant costs, create the TriangleElimination cost
+  static CostPtr CreateTriangleEliminationCost(const StrategyPtr &, const StrategyPtr &, const StrategyPtr &,
+                                               const CostPtr &, const CostPtr &, const CostPtr &, const CostPtr &,
+                                               const CostPtr &);
 
   // Applying the Star Elimination in DP algorithm. Return the successive edges of this merged_op
   // NOTE: this elimination MUST be performed only when the above 5 operation cannot be applied.
@@ -74,6 +74,9 @@ class OperatorCost {
   void SetInputAndOutputTypeLength(const std::vector<size_t> &input_lengths, const std::vector<size_t> &output_lengths);
   std::vector<size_t> inputs_type_lengths() const { return inputs_type_lengths_; }
   std::vector<size_t> outputs_type_lengths() const { return outputs_type_lengths_; }
+  // the calibrated coefficient of the computation cost, see CostModelCalibration
+  void set_computation_coefficient(double coefficient) { computation_coefficient_ = coefficient; }
+  double computation_coefficient() const { return computation_coefficient_; }
 
   // per device communication cost
   virtual double GetCommCost(const std::vector<TensorInfo> &inputs, const std::vector<TensorInfo> &outputs,
@@ -112,6 +115,7 @@ class OperatorCost {
   // Whether the output is critical, which means that this output is included in calculating peak memory cost
   // in the inference phase.
   int is_outputs_critical_ = -1;
+  double computation_coefficient_ = 1.0;
 };
 
 using OperatorCostPtr = std::shared_ptr<OperatorCost>;
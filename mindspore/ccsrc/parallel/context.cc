@@ -61,6 +61,7 @@ void ParallelContext::Reset() {
   enable_all_reduce_fusion_ = false;
   strategy_ckpt_load_file_ = "";
   strategy_ckpt_save_file_ = "";
+  strategy_cache_dir_ = "";
 }
 
 void ParallelContext::set_device_num(int32_t device_num) {
@@ -116,6 +117,10 @@ void ParallelContext::set_strategy_ckpt_save_file(const std::string &strategy_ck
   strategy_ckpt_save_file_ = strategy_ckpt_save_file;
 }
 
+void ParallelContext::set_strategy_cache_dir(const std::string &strategy_cache_dir) {
+  strategy_cache_dir_ = strategy_cache_dir;
+}
+
 void ParallelContext::SetAllReduceFusionSplitIndices(const std::vector<uint32_t> indices, const std::string &group) {
   all_reduce_fusion_split_indices_[group] = indices;
 }
@@ -96,6 +96,8 @@ class ParallelContext {
   std::string strategy_ckpt_load_file() const { return strategy_ckpt_load_file_; }
   void set_strategy_ckpt_save_file(const std::string &strategy_ckpt_save_file);
   std::string strategy_ckpt_save_file() const { return strategy_ckpt_save_file_; }
+  void set_strategy_cache_dir(const std::string &strategy_cache_dir);
+  std::string strategy_cache_dir() const { return strategy_cache_dir_; }
 
   void Reset();
 
@@ -119,6 +121,7 @@ class ParallelContext {
   std::map<std::string, std::vector<uint32_t>> all_reduce_fusion_split_sizes_;
   std::string strategy_ckpt_load_file_;
   std::string strategy_ckpt_save_file_;
+  std::string strategy_cache_dir_;
 };
 
 void ParallelParameterContextInit(const FuncGraphPtr &func_graph);
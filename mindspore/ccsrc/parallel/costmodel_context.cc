@@ -56,6 +56,7 @@ void CostModelContext::ResetCostModel() {
   costmodel_allreduce_fusion_allreduce_bandwidth_ = DEFAULT_COST_MODEL_ALLREDUCE_FUSION_ALLREDUCE_BANDWIDTH;
   costmodel_allreduce_fusion_computation_time_parameter_ =
     DEFAULT_COST_MODEL_ALLREDUCE_FUSION_COMPUTATION_TIME_PARAMETER;
+  costmodel_calibration_file_ = "";
 }
 
 void CostModelContext::ResetAlgoParameters() {
@@ -64,6 +65,7 @@ void CostModelContext::ResetAlgoParameters() {
   tensor_slice_alignment_size_ = DEFAULT_TENSOR_SLICE_ALIGNMENT_SIZE;
   fully_use_device_ = DEFAULT_FULLY_USE_DEVICES;
   elementwise_stra_follow_ = DEFAULT_ELEMENTWISE_OP_STRA_FOLLOW;
+  dp_algo_search_threads_ = DEFAULT_DP_ALGO_SEARCH_THREADS;
 }
 
 void CostModelContext::set_device_memory_capacity(double dm_capacity) { device_memory_capacity_ = dm_capacity; }
@@ -128,5 +130,9 @@ void CostModelContext::set_elementwise_stra_follow(bool elementwise_follow) {
 }
 
 void CostModelContext::set_run_phase(int32_t phase) { run_phase_ = phase; }
+
+void CostModelContext::set_costmodel_calibration_file(const std::string &file) { costmodel_calibration_file_ = file; }
+
+void CostModelContext::set_dp_algo_search_threads(int32_t threads) { dp_algo_search_threads_ = threads; }
 }  // namespace parallel
 }  // namespace mindspore
@@ -116,6 +116,14 @@ class CostModelContext {
   void set_run_phase(int32_t);
   int32_t run_phase() const { return run_phase_; }
 
+  // DP_ALGO_SEARCH_THREADS
+  void set_dp_algo_search_threads(int32_t);
+  int32_t dp_algo_search_threads() const { return dp_algo_search_threads_; }
+
+  // COST_MODEL_CALIBRATION_FILE
+  void set_costmodel_calibration_file(const std::string &);
+  std::string costmodel_calibration_file() const { return costmodel_calibration_file_; }
+
  private:
   CostModelContext();
   static std::shared_ptr<CostModelContext> cm_context_inst_;
@@ -163,6 +171,9 @@ class CostModelContext {
 
   double costmodel_allreduce_fusion_computation_time_parameter_;
 
+  // COST_MODEL_CALIBRATION_FILE
+  std::string costmodel_calibration_file_;
+
   // TENSOR_SLICE_ALIGNMENT_ENABLE
   bool tensor_slice_alignment_enable_;
 
@@ -174,6 +185,9 @@ class CostModelContext {
 
   // ELEMENTWISE_OP_STRA_FOLLOW
   bool elementwise_stra_follow_;
+
+  // DP_ALGO_SEARCH_THREADS
+  int32_t dp_algo_search_threads_;
 };
 }  // namespace parallel
 }  // namespace mindspore
@@ -397,8 +397,9 @@ void ReshapeInfo::SetCostForReshapeWithParameter() {
 void ReshapeInfo::SetCostForReshape(const mindspore::parallel::StrategyPtr &strategy) {
   MS_EXCEPTION_IF_NULL(strategy);
   int32_t stage_id = strategy->GetInputStage();
-  double computation_cost =
-    operator_cost()->GetForwardComputationCost(inputs_tensor_info_, outputs_tensor_info_, stage_id);
+  double computation_cost = operator_cost()->computation_coefficient() *
+                            operator_cost()->GetForwardComputationCost(inputs_tensor_info_, outputs_tensor_info_,
+                                                                       stage_id);
   double communication_cost = operator_cost()->GetCommCost(inputs_tensor_info_, outputs_tensor_info_, stage_id);
   std::shared_ptr<Cost> result = std::make_shared<Cost>(computation_cost, communication_cost);
   result->communication_without_parameter_ =
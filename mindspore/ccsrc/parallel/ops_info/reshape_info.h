@@ -52,6 +52,10 @@ class ReshapeInfo : public OperatorInfo {
     output_layout_ = output_layout;
     output_layout_set_flag_ = true;
   }
+  bool input_layout_set() const { return input_layout_set_flag_; }
+  bool output_layout_set() const { return output_layout_set_flag_; }
+  TensorLayout input_layout() const { return input_layout_; }
+  TensorLayout output_layout() const { return output_layout_; }
   void SetCostForReshape(const mindspore::parallel::StrategyPtr &strategy);
   void SetCostForReshapeWithParameter();
   void set_pre_operator_name(const std::string &pre_name) { pre_operator_name_ = pre_name; }
@@ -19,9 +19,11 @@
 #include <inttypes.h>
 #include <sys/time.h>
 #include <algorithm>
+#include <iomanip>
 #include <map>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -32,6 +34,7 @@
 #include "ir/tensor.h"
 #include "optimizer/opt.h"
 #include "optimizer/optimizer.h"
+#include "parallel/auto_parallel/costmodel_calibration.h"
 #include "parallel/auto_parallel/dp_algo_costmodel.h"
 #include "parallel/auto_parallel/edge_costmodel.h"
 #include "parallel/auto_parallel/graph_costmodel.h"
@@ -89,17 +92,45 @@ bool StepAutoParallel(const FuncGraphPtr &root, const opt::OptimizerPtr &) {
     MS_LOG(EXCEPTION) << "The graph contain communication op";
   }
 
+  // reuse the strategies searched for the same graph, devices and cost model parameters, unless the strategies are
+  // loaded from the checkpoint
+  bool use_strategy_cache = !StrategyCheckpoint::GetInstance().LoadCheckPointOn();
+  bool strategy_cache_hit = false;
+  std::string strategy_cache_signature;
+  std::string strategy_cache_key;
+  if (use_strategy_cache) {
+    strategy_cache_signature = GraphSignature(all_nodes, strategy_search_mode);
+    strategy_cache_key = StrategyCache::SignatureKey(strategy_cache_signature);
+    CachedStrategies cached_strategies;
+    if (StrategyCache::GetInstance().Find(strategy_cache_signature, &cached_strategies)) {
+      strategy_cache_hit = (ApplyCachedStrategies(all_nodes, cached_strategies) == SUCCESS);
+      if (strategy_cache_hit) {
+        MS_LOG(INFO) << "Apply the cached strategies of the graph " << strategy_cache_key << ".";
+      } else {
+        MS_LOG(WARNING) << "Applying the cached strategies of the graph " << strategy_cache_key
+                        << " failed, search the strategies.";
+        TOTAL_OPS = 0;
+      }
+    }
+    StrategyCache::GetInstance().CountLookup(strategy_cache_hit);
+  }
+
   // search parallelization strategy
-  if (strategy_search_mode == DYNAMIC_PROGRAMMING) {
-    if (ParallelStrategySearch(all_nodes, root) != SUCCESS) {
-      MS_LOG(EXCEPTION) << "Auto-parallel strategy search failed when using DP searching mode";
+  if (!strategy_cache_hit) {
+    if (strategy_search_mode == DYNAMIC_PROGRAMMING) {
+      if (ParallelStrategySearch(all_nodes, root) != SUCCESS) {
+        MS_LOG(EXCEPTION) << "Auto-parallel strategy search failed when using DP searching mode";
+      }
+    } else if (strategy_search_mode == RECURSIVE_PROGRAMMING) {
+      if (ParallelStrategyRecSearch(all_nodes, root) != SUCCESS) {
+        MS_LOG(EXCEPTION) << "Auto-parallel strategy search failed when using RP searching mode";
+      }
+    } else {
+      MS_LOG(EXCEPTION) << "Auto-parallel strategy searching mode unexpected";
     }
-  } else if (strategy_search_mode == RECURSIVE_PROGRAMMING) {
-    if (ParallelStrategyRecSearch(all_nodes, root) != SUCCESS) {
-      MS_LOG(EXCEPTION) << "Auto-parallel strategy search failed when using RP searching mode";
+    if (use_strategy_cache) {
+      StrategyCache::GetInstance().Insert(strategy_cache_signature, SearchedStrategies(all_nodes));
     }
-  } else {
-    MS_LOG(EXCEPTION) << "Auto-parallel strategy searching mode unexpected";
   }
 
   (void)gettimeofday(&end_time, nullptr);
@@ -288,7 +319,8 @@ bool IsAutoParallelCareNode(const CNodePtr &cnode) {
   return IsParallelCareNode(cnode) && IsSplittableOperator(prim->name());
 }
 
-OperatorInfoPtr CreateTheOperatorInfo(const PrimitivePtr &prim, const CNodePtr &cnode, StrategyMap *stra_map) {
+// Create the OperatorInfo of the cnode, without any strategy
+OperatorInfoPtr NewOperatorInfoOfCNode(const PrimitivePtr &prim, const CNodePtr &cnode) {
   MS_EXCEPTION_IF_NULL(prim);
   MS_EXCEPTION_IF_NULL(cnode);
   auto attrs = prim->attrs();
@@ -316,6 +348,9 @@ OperatorInfoPtr CreateTheOperatorInfo(const PrimitivePtr &prim, const CNodePtr &
     MS_LOG(ERROR) << "Setting the lengths of inputs and outputs failed for operator: " << operator_info->name();
     return nullptr;
   }
+  // Scale the computation cost by the calibrated coefficient of this primitive
+  operator_info->operator_cost()->set_computation_coefficient(
+    CostModelCalibration::GetInstance().computation_coefficient(prim->name()));
   if (operator_info->set_outputs_type(outputs_type) != SUCCESS) {
     MS_LOG(ERROR) << "Setting the types of outputs failed for operator: " << operator_info->name();
     return nullptr;
@@ -334,6 +369,15 @@ OperatorInfoPtr CreateTheOperatorInfo(const PrimitivePtr &prim, const CNodePtr &
   operator_info->set_input_value(input_value);
   operator_info->set_outputs_dtype(cnode->Type());
   operator_info->set_cnode(cnode);
+  return operator_info;
+}
+
+OperatorInfoPtr CreateTheOperatorInfo(const PrimitivePtr &prim, const CNodePtr &cnode, StrategyMap *stra_map) {
+  auto operator_info = NewOperatorInfoOfCNode(prim, cnode);
+  if (operator_info == nullptr) {
+    return nullptr;
+  }
+  auto attrs = prim->attrs();
   // key of strategy map
   std::string strategy_key_name = NodeParameterName(cnode);
   bool load_strategy_from_ckpt =
@@ -1148,5 +1192,184 @@ Status ParallelStrategyRecSearch(const std::vector<AnfNodePtr> &all_nodes, const
 
   return SUCCESS;
 }
+
+namespace {
+std::string ValueSignature(const ValuePtr &value) {
+  MS_EXCEPTION_IF_NULL(value);
+  // the data of the tensors and the names of the graphs do not change the strategies
+  if (value->isa<tensor::Tensor>()) {
+    auto tensor = value->cast<tensor::TensorPtr>();
+    return "Tensor" + ShapeToString(tensor->shape()) + tensor->Dtype()->ToString();
+  }
+  if (value->isa<FuncGraph>()) {
+    return "FuncGraph";
+  }
+  if (value->isa<Primitive>()) {
+    auto prim = value->cast<PrimitivePtr>();
+    std::map<std::string, ValuePtr> attrs(prim->attrs().begin(), prim->attrs().end());
+    std::ostringstream signature;
+    signature << prim->name() << "{";
+    for (auto &attr : attrs) {
+      signature << attr.first << "=" << (attr.second == nullptr ? "null" : attr.second->ToString()) << ",";
+    }
+    signature << "}";
+    return signature.str();
+  }
+  return value->ToString();
+}
+
+bool IsCachedCNode(const AnfNodePtr &node) {
+  auto cnode = node->cast<CNodePtr>();
+  return (cnode != nullptr) && IsValueNode<Primitive>(cnode->input(0)) && IsAutoParallelCareNode(cnode);
+}
+}  // namespace
+
+std::string GraphSignature(const std::vector<AnfNodePtr> &all_nodes, const std::string &strategy_search_mode) {
+  std::ostringstream signature;
+  signature << std::setprecision(17);
+  // the devices
+  MS_EXCEPTION_IF_NULL(g_device_manager);
+  signature << "devices " << g_device_manager->DeviceNum() << " " << g_device_manager->GetDeviceListByStageId(0).size()
+            << " " << strategy_search_mode << "\n";
+  // the cost model parameters
+  auto context = CostModelContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context);
+  signature << "cost_model " << context->device_memory_capacity() << " " << context->costmodel_alpha() << " "
+            << context->costmodel_beta() << " " << context->costmodel_gamma() << " "
+            << context->costmodel_simplify_cal() << " " << context->costmodel_communi_threshold() << " "
+            << context->costmodel_communi_const() << " " << context->costmodel_communi_bias() << " "
+            << context->is_multi_subgraphs() << " " << context->run_phase() << " "
+            << context->tensor_slice_alignment_enable() << " " << context->tensor_slice_alignment_size() << " "
+            << context->fully_use_device() << " " << context->elementwise_stra_follow();
+  CostModelCalibration::GetInstance().Load(context->costmodel_calibration_file());
+  for (auto &coefficient : CostModelCalibration::GetInstance().computation_coefficients()) {
+    signature << " " << coefficient.first << "=" << coefficient.second;
+  }
+  signature << "\n";
+  // the nodes, whose inputs refer to the other nodes by their indexes
+  std::unordered_map<AnfNodePtr, size_t> indexes;
+  for (auto &node : all_nodes) {
+    if (node->isa<CNode>() || node->isa<Parameter>()) {
+      size_t index = indexes.size();
+      indexes[node] = index;
+    }
+  }
+  for (auto &node : all_nodes) {
+    auto iter = indexes.find(node);
+    if (iter == indexes.end()) {
+      continue;
+    }
+    auto type = node->Type();
+    auto shape = node->Shape();
+    signature << "%" << iter->second << " " << (type == nullptr ? "null" : type->ToString()) << " "
+              << (shape == nullptr ? "null" : shape->ToString()) << " =";
+    if (node->isa<Parameter>()) {
+      signature << (node->cast<ParameterPtr>()->has_default() ? " Weight\n" : " Parameter\n");
+      continue;
+    }
+    for (auto &input : node->cast<CNodePtr>()->inputs()) {
+      auto input_iter = indexes.find(input);
+      if (input_iter != indexes.end()) {
+        signature << " %" << input_iter->second;
+      } else if (input->isa<ValueNode>()) {
+        signature << " " << ValueSignature(GetValueNode(input));
+      } else {
+        signature << " ?";
+      }
+    }
+    signature << "\n";
+  }
+  return signature.str();
+}
+
+CachedStrategies SearchedStrategies(const std::vector<AnfNodePtr> &all_nodes) {
+  CachedStrategies strategies;
+  for (auto &node : all_nodes) {
+    if (!IsCachedCNode(node)) {
+      continue;
+    }
+    auto cnode = node->cast<CNodePtr>();
+    auto operator_info = cnode->operator_info();
+    CachedStrategy cached;
+    if (operator_info == nullptr) {
+      strategies.push_back(cached);
+      continue;
+    }
+    // the search sets the strategy and the layouts of Reshape from the operators it chose around it
+    if (GetValueNode<PrimitivePtr>(cnode->input(0))->name() == RESHAPE) {
+      auto reshape_info = std::dynamic_pointer_cast<ReshapeInfo>(operator_info);
+      MS_EXCEPTION_IF_NULL(reshape_info);
+      cached.strategy = reshape_info->strategy();
+      if (reshape_info->input_layout_set()) {
+        cached.input_layout = std::make_shared<TensorLayout>(reshape_info->input_layout());
+      }
+      if (reshape_info->output_layout_set()) {
+        cached.output_layout = std::make_shared<TensorLayout>(reshape_info->output_layout());
+      }
+    } else {
+      cached.strategy = operator_info->selected_strategy();
+    }
+    strategies.push_back(cached);
+  }
+  return strategies;
+}
+
+Status ApplyCachedStrategies(const std::vector<AnfNodePtr> &all_nodes, const CachedStrategies &strategies) {
+  // The OperatorInfos are shared by the copies of the cnodes as in ConstructCostGraphNodesByUniqueIdTC, if there
+  // are multiple subgraphs
+  bool through_copy = CostModelContext::GetInstance()->is_multi_subgraphs();
+  std::map<std::string, OperatorInfoPtr> from_cnode_to_info;
+  size_t index = 0;
+  for (auto &node : all_nodes) {
+    if (!IsCachedCNode(node)) {
+      continue;
+    }
+    if (index >= strategies.size()) {
+      MS_LOG(WARNING) << "The cached strategies are fewer than the operators.";
+      return FAILED;
+    }
+    auto &cached = strategies[index++];
+    auto cnode = node->cast<CNodePtr>();
+    auto prim = GetValueNode<PrimitivePtr>(cnode->input(0));
+    auto unique_id = through_copy ? cnode->UniqueIdThroughCopy() : cnode->UniqueId();
+    auto iter = from_cnode_to_info.find(unique_id);
+    if (iter != from_cnode_to_info.end()) {
+      (void)cnode->set_operator_info(iter->second);
+      continue;
+    }
+    auto operator_info = NewOperatorInfoOfCNode(prim, cnode);
+    if (operator_info == nullptr) {
+      return FAILED;
+    }
+    operator_info->set_type(prim->name());
+    Status status = FAILED;
+    if (prim->name() == RESHAPE) {
+      // restore the layouts as CostGraph::InitSelectedStrategy set them
+      auto reshape_info = std::dynamic_pointer_cast<ReshapeInfo>(operator_info);
+      MS_EXCEPTION_IF_NULL(reshape_info);
+      if (cached.input_layout != nullptr) {
+        reshape_info->SetInputLayout(*cached.input_layout);
+      }
+      if (cached.output_layout != nullptr) {
+        reshape_info->SetOutputLayout(*cached.output_layout);
+      }
+      reshape_info->set_strategy(cached.strategy);
+      status = reshape_info->Init(nullptr);
+    } else if (cached.strategy != nullptr) {
+      status = operator_info->Init(cached.strategy);
+    }
+    if (status != SUCCESS) {
+      MS_LOG(WARNING) << "Initializing " << operator_info->name() << " with the cached strategy failed.";
+      return FAILED;
+    }
+    (void)cnode->set_operator_info(operator_info);
+    from_cnode_to_info[unique_id] = operator_info;
+  }
+  if (index != strategies.size()) {
+    MS_LOG(WARNING) << "The cached strategies are more than the operators.";
+    return FAILED;
+  }
+  return SUCCESS;
+}
 }  // namespace parallel
 }  // namespace mindspore
@@ -23,7 +23,9 @@
 #include <vector>
 #include "ir/anf.h"
 #include "optimizer/opt.h"
+#include "parallel/ops_info/operator_info.h"
 #include "parallel/status.h"
+#include "parallel/strategy_cache/strategy_cache.h"
 #include "pipeline/pipeline.h"
 
 namespace mindspore {
@@ -55,6 +57,18 @@ Status ParallelStrategySearch(const std::vector<AnfNodePtr> &all_nodes, const Fu
 
 Status ParallelStrategyRecSearch(const std::vector<AnfNodePtr> &all_nodes, const FuncGraphPtr &root);
 
+// Create the OperatorInfo of the cnode, without any strategy
+OperatorInfoPtr NewOperatorInfoOfCNode(const PrimitivePtr &prim, const CNodePtr &cnode);
+
+// The signature of the annotated graph, the devices and the cost model parameters, which keys the strategy cache
+std::string GraphSignature(const std::vector<AnfNodePtr> &all_nodes, const std::string &strategy_search_mode);
+
+// The selected strategies of the operators of the graph after the search
+CachedStrategies SearchedStrategies(const std::vector<AnfNodePtr> &all_nodes);
+
+// Create the OperatorInfos of the graph with the cached strategies instead of searching them
+Status ApplyCachedStrategies(const std::vector<AnfNodePtr> &all_nodes, const CachedStrategies &strategies);
+
 std::vector<std::vector<std::string>> RecInputTensorNames(const std::map<std::string, std::string>::iterator &it,
                                                           std::vector<std::vector<std::string>> input_tensor_names);
 }  // namespace parallel
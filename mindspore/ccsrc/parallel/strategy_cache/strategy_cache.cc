@@ -0,0 +1,264 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "parallel/strategy_cache/strategy_cache.h"
+
+#include <unistd.h>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include "parallel/context.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace parallel {
+namespace {
+constexpr char kCacheFileHeader[] = "strategy_cache";
+constexpr int32_t kCacheFileVersion = 3;
+// a larger size is taken for a broken file
+constexpr size_t kMaxSignatureSize = 1UL << 30;
+
+bool ReadArray(std::istream *in, std::vector<int32_t> *array) {
+  size_t size = 0;
+  if (!(*in >> size)) {
+    return false;
+  }
+  array->resize(size);
+  for (auto &value : *array) {
+    if (!(*in >> value)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void WriteArray(std::ostream *out, const std::vector<int32_t> &array) {
+  *out << " " << array.size();
+  for (auto value : array) {
+    *out << " " << value;
+  }
+}
+
+bool ReadStrategy(std::istream *in, StrategyPtr *strategy) {
+  int32_t stage = 0;
+  if (!(*in >> stage)) {
+    return false;
+  }
+  if (stage < 0) {
+    *strategy = nullptr;
+    return true;
+  }
+  size_t input_num = 0;
+  if (!(*in >> input_num)) {
+    return false;
+  }
+  std::vector<Dimensions> inputs(input_num);
+  for (auto &dims : inputs) {
+    if (!ReadArray(in, &dims)) {
+      return false;
+    }
+  }
+  *strategy = NewStrategy(stage, inputs);
+  return true;
+}
+
+void WriteStrategy(std::ostream *out, const StrategyPtr &strategy) {
+  if (strategy == nullptr) {
+    *out << "-1";
+    return;
+  }
+  auto inputs = strategy->GetInputDim();
+  *out << strategy->GetInputStage() << " " << inputs.size();
+  for (auto &dims : inputs) {
+    WriteArray(out, dims);
+  }
+}
+
+bool ReadLayout(std::istream *in, std::shared_ptr<TensorLayout> *layout) {
+  int32_t is_set = 0;
+  if (!(*in >> is_set)) {
+    return false;
+  }
+  if (is_set < 0) {
+    *layout = nullptr;
+    return true;
+  }
+  std::vector<int32_t> device_arrangement;
+  std::vector<int32_t> tensor_map;
+  std::vector<int32_t> tensor_shape;
+  if (!ReadArray(in, &device_arrangement) || !ReadArray(in, &tensor_map) || !ReadArray(in, &tensor_shape)) {
+    return false;
+  }
+  *layout = std::make_shared<TensorLayout>();
+  return (*layout)->InitFromVector(device_arrangement, tensor_map, tensor_shape) == SUCCESS;
+}
+
+void WriteLayout(std::ostream *out, const std::shared_ptr<TensorLayout> &layout) {
+  if (layout == nullptr) {
+    *out << " -1";
+    return;
+  }
+  *out << " 1";
+  WriteArray(out, layout->device_arrangement_origin().array());
+  WriteArray(out, layout->origin_tensor_map().array());
+  WriteArray(out, layout->tensor_shape_origin().array());
+}
+}  // namespace
+
+StrategyCache &StrategyCache::GetInstance() {
+  static StrategyCache instance;
+  return instance;
+}
+
+std::string StrategyCache::SignatureKey(const std::string &signature) {
+  // 64 bits FNV-1a, which is stable across the processes unlike std::hash, and the length of the signature
+  uint64_t hash = 14695981039346656037ULL;
+  for (auto c : signature) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 1099511628211ULL;
+  }
+  std::ostringstream key;
+  key << std::hex << std::setw(16) << std::setfill('0') << hash << "_" << signature.size();
+  return key.str();
+}
+
+std::string StrategyCache::CacheFile(const std::string &key) const {
+  MS_EXCEPTION_IF_NULL(ParallelContext::GetInstance());
+  auto dir = ParallelContext::GetInstance()->strategy_cache_dir();
+  if (dir.empty()) {
+    return "";
+  }
+  return dir + "/strategy_cache_" + key + ".txt";
+}
+
+bool StrategyCache::Find(const std::string &signature, CachedStrategies *strategies) {
+  MS_EXCEPTION_IF_NULL(strategies);
+  auto iter = strategies_.find(signature);
+  if (iter != strategies_.end()) {
+    *strategies = iter->second;
+    return true;
+  }
+  auto file = CacheFile(SignatureKey(signature));
+  if (file.empty() || Load(file, signature, strategies) != SUCCESS) {
+    return false;
+  }
+  strategies_[signature] = *strategies;
+  MS_LOG(INFO) << "Load the strategies from the cache file " << file << ".";
+  return true;
+}
+
+void StrategyCache::Clear() {
+  strategies_.clear();
+  hits_ = 0;
+  misses_ = 0;
+}
+
+void StrategyCache::CountLookup(bool hit) {
+  if (hit) {
+    hits_++;
+  } else {
+    misses_++;
+  }
+}
+
+void StrategyCache::Insert(const std::string &signature, const CachedStrategies &strategies) {
+  strategies_[signature] = strategies;
+  auto file = CacheFile(SignatureKey(signature));
+  if (!file.empty() && Save(file, signature, strategies) != SUCCESS) {
+    MS_LOG(WARNING) << "Save the strategies to the cache file " << file << " failed.";
+  }
+}
+
+// The header line, the size of the signature on a line, the signature and a newline, the number of operators, then a
+// line per operator: its strategy, which is the stage, the number of inputs and the dimensions
+// of each input, or -1 if it has none, followed by the input layout and the output layout, each -1 if it is not set,
+// or 1 and the original device arrangement, tensor map and tensor shape. The arrays are written as their sizes
+// followed by their values.
+Status StrategyCache::Load(const std::string &file, const std::string &signature, CachedStrategies *strategies) const {
+  std::ifstream fin(file, std::ios::binary);
+  if (!fin.is_open()) {
+    return FAILED;
+  }
+  std::string header;
+  int32_t version = 0;
+  if (!(fin >> header >> version) || header != kCacheFileHeader || version != kCacheFileVersion) {
+    MS_LOG(WARNING) << "The strategy cache file " << file << " is of another version.";
+    return FAILED;
+  }
+  // the signature has several lines, it is read by its size
+  size_t signature_size = 0;
+  if (!(fin >> signature_size) || fin.get() != '\n' || signature_size > kMaxSignatureSize) {
+    MS_LOG(WARNING) << "The strategy cache file " << file << " is broken.";
+    return FAILED;
+  }
+  std::string file_signature(signature_size, '\0');
+  if (!fin.read(&file_signature[0], static_cast<std::streamsize>(signature_size))) {
+    MS_LOG(WARNING) << "The strategy cache file " << file << " is broken.";
+    return FAILED;
+  }
+  if (file_signature != signature) {
+    MS_LOG(WARNING) << "The strategy cache file " << file << " belongs to another graph of the same key.";
+    return FAILED;
+  }
+  size_t op_num = 0;
+  if (!(fin >> op_num)) {
+    MS_LOG(WARNING) << "The strategy cache file " << file << " is broken.";
+    return FAILED;
+  }
+  CachedStrategies result(op_num);
+  for (auto &cached : result) {
+    if (!ReadStrategy(&fin, &cached.strategy) || !ReadLayout(&fin, &cached.input_layout) ||
+        !ReadLayout(&fin, &cached.output_layout)) {
+      MS_LOG(WARNING) << "The strategy cache file " << file << " is broken.";
+      return FAILED;
+    }
+  }
+  *strategies = result;
+  return SUCCESS;
+}
+
+Status StrategyCache::Save(const std::string &file, const std::string &signature,
+                           const CachedStrategies &strategies) const {
+  // the ranks of a launch write the same file, so each one writes its own and renames it
+  auto tmp_file = file + "." + std::to_string(getpid());
+  {
+    std::ofstream fout(tmp_file, std::ios::binary);
+    if (!fout.is_open()) {
+      return FAILED;
+    }
+    fout << kCacheFileHeader << " " << kCacheFileVersion << "\n" << signature.size() << "\n" << signature << "\n"
+         << strategies.size() << "\n";
+    for (auto &cached : strategies) {
+      WriteStrategy(&fout, cached.strategy);
+      WriteLayout(&fout, cached.input_layout);
+      WriteLayout(&fout, cached.output_layout);
+      fout << "\n";
+    }
+    if (!fout.good()) {
+      (void)remove(tmp_file.c_str());
+      return FAILED;
+    }
+  }
+  if (rename(tmp_file.c_str(), file.c_str()) != 0) {
+    (void)remove(tmp_file.c_str());
+    return FAILED;
+  }
+  return SUCCESS;
+}
+}  // namespace parallel
+}  // namespace mindspore
@@ -0,0 +1,74 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PARALLEL_STRATEGY_CACHE_STRATEGY_CACHE_H_
+#define MINDSPORE_CCSRC_PARALLEL_STRATEGY_CACHE_STRATEGY_CACHE_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "parallel/status.h"
+#include "parallel/strategy.h"
+#include "parallel/tensor_layout/tensor_layout.h"
+
+namespace mindspore {
+namespace parallel {
+// the strategy searched for an operator, nullptr if it has none, and for a Reshape the layouts which the search took
+// from its neighbours, nullptr for the ones it did not set
+struct CachedStrategy {
+  StrategyPtr strategy;
+  std::shared_ptr<TensorLayout> input_layout;
+  std::shared_ptr<TensorLayout> output_layout;
+};
+
+// the strategies searched for the operators of a graph in their order
+using CachedStrategies = std::vector<CachedStrategy>;
+
+// Unlike StrategyCheckpoint, which keeps the strategies of the operators with parameters by name for the user, the
+// strategy cache keeps all the searched strategies of a graph under its signature, which describes the annotated
+// graph, the devices and the cost model parameters. The strategies are kept in memory, and also in the files
+// strategy_cache_<key>.txt of the directory 'strategy_cache_dir' of the parallel context if it is set, so that the
+// next launches of the same graph on the same devices skip the strategy search. The key is a hash of the signature,
+// the file holds the whole signature, which is compared on loading.
+class StrategyCache {
+ public:
+  static StrategyCache &GetInstance();
+  static std::string SignatureKey(const std::string &signature);
+
+  bool Find(const std::string &signature, CachedStrategies *strategies);
+  void Insert(const std::string &signature, const CachedStrategies &strategies);
+  void Clear();
+  // count the compilings which applied the cached strategies, and those which searched the strategies
+  void CountLookup(bool hit);
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+
+ private:
+  StrategyCache() = default;
+  ~StrategyCache() = default;
+  std::string CacheFile(const std::string &key) const;
+  Status Load(const std::string &file, const std::string &signature, CachedStrategies *strategies) const;
+  Status Save(const std::string &file, const std::string &signature, const CachedStrategies &strategies) const;
+
+  std::map<std::string, CachedStrategies> strategies_;
+  size_t hits_{0};
+  size_t misses_{0};
+};
+}  // namespace parallel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PARALLEL_STRATEGY_CACHE_STRATEGY_CACHE_H_
@@ -29,6 +29,8 @@
 #include "parallel/context.h"
 #include "parallel/device_manager.h"
 #include "parallel/costmodel_context.h"
+#include "parallel/auto_parallel/costmodel_calibration.h"
+#include "parallel/strategy_cache/strategy_cache.h"
 #ifdef ENABLE_GPU_COLLECTIVE
 #include "device/gpu/distribution/collective_init.h"
 #else
@@ -100,6 +102,19 @@ PYBIND11_MODULE(_c_expression, m) {
   (void)m.def("init_backend", &mindspore::pipeline::InitBackend, "Init Backend.");
 
   (void)m.def("export_graph", &mindspore::pipeline::ExportGraph, "Export Graph.");
+  (void)m.def("get_computation_cost", &mindspore::parallel::CostModelCalibration::ComputationCost,
+              "Get the uncalibrated computation cost of an operator under a strategy.");
+  (void)m.def(
+    "get_calibrated_computation_cost",
+    [](const std::string &op_type, const std::vector<mindspore::parallel::Shape> &shapes,
+       const std::vector<mindspore::parallel::Dimensions> &strategy) {
+      return mindspore::parallel::CostModelCalibration::GetInstance().CalibratedComputationCost(op_type, shapes,
+                                                                                                strategy);
+    },
+    "Get the computation cost of an operator under a strategy with the loaded calibration.");
+  (void)m.def(
+    "get_strategy_cache_hits", []() { return mindspore::parallel::StrategyCache::GetInstance().hits(); },
+    "Get the number of compilings which applied the cached strategies instead of searching them.");
 
   (void)py::class_<mindspore::MsContext, std::shared_ptr<mindspore::MsContext>>(m, "MSContext")
     .def_static("get_instance", &mindspore::MsContext::GetInstance, "Get ms context instance.")
@@ -143,7 +158,25 @@ PYBIND11_MODULE(_c_expression, m) {
     .def("get_profiling_options", &mindspore::MsContext::profiling_options, "Get options to profiling.")
     .def("set_profiling_options", &mindspore::MsContext::set_profiling_options, "Set options to profiling.")
     .def("get_check_bprop_flag", &mindspore::MsContext::check_bprop_flag, "Get whether to check bprop.")
-    .def("set_check_bprop_flag", &mindspore::MsContext::set_check_bprop_flag, "Set whether to check bprop.");
+    .def("set_check_bprop_flag", &mindspore::MsContext::set_check_bprop_flag, "Set whether to check bprop.")
+    .def("get_enable_pynative_lazy", &mindspore::MsContext::enable_pynative_lazy,
+         "Get whether to trace and fuse PyNative ops.")
+    .def("set_enable_pynative_lazy", &mindspore::MsContext::set_enable_pynative_lazy,
+         "Set whether to trace and fuse PyNative ops.")
+    .def("get_enable_compile_profile", &mindspore::MsContext::enable_compile_profile,
+         "Get whether to save the profile of each compile.")
+    .def("set_enable_compile_profile", &mindspore::MsContext::set_enable_compile_profile,
+         "Set whether to save the profile of each compile.")
+    .def("get_enable_mem_aware_order", &mindspore::MsContext::enable_mem_aware_order,
+         "Get whether to order kernels for a lower peak memory.")
+    .def("set_enable_mem_aware_order", &mindspore::MsContext::set_enable_mem_aware_order,
+         "Set whether to order kernels for a lower peak memory.")
+    .def("get_remat_memory_budget", &mindspore::MsContext::remat_memory_budget,
+         "Get the memory budget in GB of the activations of the backward pass.")
+    .def("set_remat_memory_budget", &mindspore::MsContext::set_remat_memory_budget,
+         "Set the memory budget in GB of the activations of the backward pass.")
+    .def("get_mem_reuse_planner", &mindspore::MsContext::mem_reuse_planner, "Get the memory reuse planner.")
+    .def("set_mem_reuse_planner", &mindspore::MsContext::set_mem_reuse_planner, "Set the memory reuse planner.");
 
   (void)py::class_<ParallelContext, std::shared_ptr<ParallelContext>>(m, "AutoParallelContext")
     .def_static("get_instance", &ParallelContext::GetInstance, "Get auto parallel context instance.")
@@ -187,6 +220,8 @@ PYBIND11_MODULE(_c_expression, m) {
          "Set strategy checkpoint save file.")
     .def("get_strategy_ckpt_load_file", &ParallelContext::strategy_ckpt_load_file, "Get strategy checkpoint load file.")
     .def("get_strategy_ckpt_save_file", &ParallelContext::strategy_ckpt_save_file, "Get strategy checkpoint save file.")
+    .def("set_strategy_cache_dir", &ParallelContext::set_strategy_cache_dir, "Set strategy cache directory.")
+    .def("get_strategy_cache_dir", &ParallelContext::strategy_cache_dir, "Get strategy cache directory.")
     .def("reset", &ParallelContext::Reset, "Reset auto parallel context.");
 
   (void)py::class_<CostModelContext, std::shared_ptr<CostModelContext>>(m, "CostModelContext")
@@ -256,6 +291,10 @@ PYBIND11_MODULE(_c_expression, m) {
     .def("get_costmodel_allreduce_fusion_computation_time_parameter",
          &CostModelContext::costmodel_allreduce_fusion_computation_time_parameter,
          "Get the parameter gradient AllReduce fusion computation time parameter.")
+    .def("set_costmodel_calibration_file", &CostModelContext::set_costmodel_calibration_file,
+         "Set the calibration profile of the computation costs.")
+    .def("get_costmodel_calibration_file", &CostModelContext::costmodel_calibration_file,
+         "Get the calibration profile of the computation costs.")
     .def("set_tensor_slice_align_enable", &CostModelContext::set_tensor_slice_alignment_enable,
          "Set the parameter tensor_slice_align_enable in strategy generation.")
     .def("get_tensor_slice_align_enable", &CostModelContext::tensor_slice_alignment_enable,
@@ -272,6 +311,10 @@ PYBIND11_MODULE(_c_expression, m) {
          "Set the parameter elementwise_op_strategy_follow in the DP algorithm.")
     .def("get_elementwise_op_strategy_follow", &CostModelContext::elementwise_stra_follow,
          "Get the parameter elementwise_op_strategy_follow in the DP algorithm.")
+    .def("set_dp_algo_search_threads", &CostModelContext::set_dp_algo_search_threads,
+         "Set the parameter dp_algo_search_threads in the DP algorithm.")
+    .def("get_dp_algo_search_threads", &CostModelContext::dp_algo_search_threads,
+         "Get the parameter dp_algo_search_threads in the DP algorithm.")
     .def("reset_cost_model", &CostModelContext::ResetCostModel, "Reset the CostModelContext.")
     .def("reset_algo_parameters", &CostModelContext::ResetAlgoParameters, "Reset the AlgoParameters.");
 
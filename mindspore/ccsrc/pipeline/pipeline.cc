@@ -33,6 +33,7 @@
 #include "utils/config_manager.h"
 #include "utils/convert_utils.h"
 #include "utils/utils.h"
+#include "utils/profile.h"
 #include "vm/segment_runner.h"
 #include "parallel/context.h"
 #include "parallel/graph_util/get_parallel_info.h"
@@ -392,7 +393,11 @@ bool ExecutorPy::CompileInner(const py::object &obj, const py::tuple &args, cons
   executor_info->arg_list_size = size;
   executor_info->resource = resource;
   info_[phase_s] = executor_info;
-  pip->Run();
+  {
+    CompileProfileGuard profile_guard(MsContext::GetInstance()->enable_compile_profile(), phase_s,
+                                      GetFilePathName("compile_profile_" + phase_s + ".json"));
+    pip->Run();
+  }
 
   // save compile graph to file in protobuf format
   SaveCompiledGraphToPb(phase_s);
@@ -546,6 +551,9 @@ void Pipeline::Run() {
       bool result = true;
       WITH(MsProfile::GetProfile()->Step(action.first))[&result, &action, this]() {
         MS_LOG(DEBUG) << "Action " << action.first << " start ...";
+        CompileStepRecorder recorder("action", action.first, 0, [this]() -> size_t {
+          return resource_->manager() == nullptr ? 0 : resource_->manager()->all_nodes().size();
+        });
 #ifdef ENABLE_LOAD_ANF_IR
         RunPipelineAction(action, resource_, &result);
 #else
@@ -22,6 +22,7 @@
 #include "ir/func_graph_cloner.h"
 #include "pipeline/static_analysis/utils.h"
 #include "debug/trace.h"
+#include "utils/profile.h"
 
 namespace mindspore {
 namespace abstract {
@@ -92,6 +93,9 @@ static std::vector<AnfNodePtr> FastShadowSort(const AnfNodePtr &ret_node) {
 }
 
 EvalResultPtr BaseFuncGraphEvaluator::Eval(AnalysisEnginePtr engine, const AbstractBasePtrList &args_spec_list) {
+#ifdef ENABLE_PROFILE
+  double start = GetTime();
+#endif
   FuncGraphPtr fg = GetFuncGraph(engine, args_spec_list);
   MS_EXCEPTION_IF_NULL(fg);
   std::size_t nargs = fg->parameters().size();
@@ -127,6 +131,10 @@ EvalResultPtr BaseFuncGraphEvaluator::Eval(AnalysisEnginePtr engine, const Abstr
 
   MS_EXCEPTION_IF_NULL(ret_base);
   MS_LOG(DEBUG) << "BaseFuncGraph " << fg->ToString() << " eval end, evaluated abstract: " << ret_base->ToString();
+#ifdef ENABLE_PROFILE
+  // the time of a graph includes the time of the graphs it calls
+  MsProfile::StatTime("infer." + fg->ToString(), GetTime() - start);
+#endif
   return std::make_shared<EvalResult>(ret_base, nullptr);
 }
 
@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
 #include <mutex>
 #include <set>
 #include <string>
@@ -39,6 +40,8 @@
 #include "pipeline/parse/data_converter.h"
 #include "pipeline/static_analysis/param_validator.h"
 #include "common/utils.h"
+#include "pybind_api/export_flags.h"
+#include "utils/context/ms_context.h"
 
 namespace mindspore {
 namespace abstract {
@@ -466,8 +469,269 @@ AbstractBasePtr PyInferRes2Abstract(const PrimitivePyPtr &prim_py, const py::dic
   }
   return res_spec;
 }
+
+// The cache is emptied when it grows past this number of entries
+constexpr size_t kMaxPyInferCacheEntries = 8192;
+
+// Convert an argument to what the infer function sees of it, return false if that is more than shapes, types and
+// scalar values, the key must not keep nodes, graphs or tensor data alive
+bool ToPyInferArg(const AbstractBasePtr &arg, AbstractBasePtr *out) {
+  MS_EXCEPTION_IF_NULL(arg);
+  if (arg->isa<AbstractRef>()) {
+    return ToPyInferArg(arg->cast<AbstractRefPtr>()->ref(), out);
+  }
+  if (arg->isa<AbstractSequeue>()) {
+    auto &elements = arg->cast<AbstractSequeuePtr>()->elements();
+    AbstractBasePtrList new_elements(elements.size());
+    for (size_t i = 0; i < elements.size(); ++i) {
+      if (!ToPyInferArg(elements[i], &new_elements[i])) {
+        return false;
+      }
+    }
+    if (arg->isa<AbstractTuple>()) {
+      *out = std::make_shared<AbstractTuple>(new_elements);
+      return true;
+    }
+    if (arg->isa<AbstractList>()) {
+      *out = std::make_shared<AbstractList>(new_elements);
+      return true;
+    }
+    return false;
+  }
+  auto value = arg->GetValueTrack();
+  // a constant tensor is compared by pointer, it would be held by the cache
+  bool known_value = value == nullptr || value->isa<AnyValue>();
+  if (arg->isa<AbstractScalar>()) {
+    known_value = known_value || value->isa<Scalar>() || value->isa<StringImm>();
+  } else if (!arg->isa<AbstractTensor>() && !arg->isa<AbstractType>() && !arg->isa<AbstractNone>()) {
+    return false;
+  }
+  *out = arg;
+  return known_value || arg->isa<AbstractType>() || arg->isa<AbstractNone>();
+}
+
+// Convert a python attribute of a primitive instance to a value compared by content, return false if it is more
+// than scalars, strings, types and sequences of them
+bool ToPyInferState(const py::handle &obj, ValuePtr *out) {
+  if (py::isinstance<py::bool_>(obj)) {
+    *out = MakeValue(py::cast<bool>(obj));
+    return true;
+  }
+  if (py::isinstance<py::int_>(obj)) {
+    *out = std::make_shared<Int64Imm>(py::cast<int64_t>(obj));
+    return true;
+  }
+  if (py::isinstance<py::float_>(obj)) {
+    *out = std::make_shared<FP64Imm>(py::cast<double>(obj));
+    return true;
+  }
+  if (py::isinstance<py::none>(obj) || py::isinstance<py::str>(obj) || py::hasattr(obj, PYTHON_DTYPE_FLAG)) {
+    return parse::ConvertData(py::reinterpret_borrow<py::object>(obj), out);
+  }
+  if (py::isinstance<py::tuple>(obj) || py::isinstance<py::list>(obj)) {
+    std::vector<ValuePtr> elements;
+    for (const auto &item : obj) {
+      ValuePtr element = nullptr;
+      if (!ToPyInferState(item, &element)) {
+        return false;
+      }
+      elements.push_back(element);
+    }
+    if (py::isinstance<py::list>(obj)) {
+      *out = std::make_shared<ValueList>(elements);
+    } else {
+      *out = std::make_shared<ValueTuple>(elements);
+    }
+    return true;
+  }
+  return false;
+}
+
+// The python object of a value made by ToPyInferState
+py::object FromPyInferState(const ValuePtr &value) {
+  MS_EXCEPTION_IF_NULL(value);
+  if (value->isa<Int64Imm>()) {
+    return py::int_(GetValue<int64_t>(value));
+  }
+  if (value->isa<ValueSequeue>()) {
+    auto &elements = value->cast<ValueSequeuePtr>()->value();
+    py::list items(elements.size());
+    for (size_t i = 0; i < elements.size(); ++i) {
+      items[i] = FromPyInferState(elements[i]);
+    }
+    if (value->isa<ValueList>()) {
+      return items;
+    }
+    return py::tuple(items);
+  }
+  return ValuePtrToPyData(value);
+}
+
+// The python attributes of a primitive instance, other than its name and primitive attributes which the key holds
+bool GetPyInferInstanceState(const PrimitivePyPtr &prim, ValuePtr *out) {
+  static const std::set<std::string> skipped = {"name", "attrs", "init_attrs", "instance_name"};
+  auto obj_dict = py::getattr(prim->GetPyObj(), "__dict__", py::none());
+  if (!py::isinstance<py::dict>(obj_dict)) {
+    *out = std::make_shared<ValueTuple>(std::vector<ValuePtr>{});
+    return true;
+  }
+  // sorted by name, so that equal states are equal values
+  std::map<std::string, ValuePtr> state;
+  for (const auto &item : py::cast<py::dict>(obj_dict)) {
+    if (!py::isinstance<py::str>(item.first)) {
+      return false;
+    }
+    auto name = py::cast<std::string>(item.first);
+    if (skipped.count(name) != 0 || prim->HasAttr(name)) {
+      continue;
+    }
+    ValuePtr value = nullptr;
+    if (!ToPyInferState(item.second, &value)) {
+      MS_LOG(DEBUG) << "Python infer of " << prim->name() << " is not cached, its attribute " << name
+                    << " is not a plain value";
+      return false;
+    }
+    state[name] = value;
+  }
+  std::vector<ValuePtr> elements;
+  for (const auto &item : state) {
+    elements.push_back(std::make_shared<ValueTuple>(std::vector<ValuePtr>{MakeValue(item.first), item.second}));
+  }
+  *out = std::make_shared<ValueTuple>(elements);
+  return true;
+}
+
+// The python attributes an infer function set on the instance, as (name, value) pairs of the state after the call
+// which are new or changed, return false if it deleted one which is not a primitive attribute now
+bool GetPyInferStateChanges(const PrimitivePyPtr &prim, const ValuePtr &before, const ValuePtr &after,
+                            ValuePtr *out) {
+  auto to_map = [](const ValuePtr &state) {
+    std::map<std::string, ValuePtr> items;
+    for (const auto &item : state->cast<ValueTuplePtr>()->value()) {
+      auto &pair = item->cast<ValueTuplePtr>()->value();
+      items[GetValue<std::string>(pair[0])] = pair[1];
+    }
+    return items;
+  };
+  auto before_items = to_map(before);
+  auto after_items = to_map(after);
+  for (const auto &item : before_items) {
+    if (after_items.count(item.first) == 0 && !prim->HasAttr(item.first)) {
+      MS_LOG(DEBUG) << "Python infer of " << prim->name() << " is not cached, it deletes the attribute "
+                    << item.first;
+      return false;
+    }
+  }
+  std::vector<ValuePtr> changes;
+  for (const auto &item : after_items) {
+    auto iter = before_items.find(item.first);
+    if (iter == before_items.end() || !(*iter->second == *item.second)) {
+      changes.push_back(std::make_shared<ValueTuple>(std::vector<ValuePtr>{MakeValue(item.first), item.second}));
+    }
+  }
+  *out = std::make_shared<ValueTuple>(changes);
+  return true;
+}
 }  // end anonymous namespace
 
+PyInferCache &PyInferCache::GetInstance() {
+  static PyInferCache instance;
+  return instance;
+}
+
+bool PyInferCache::MakeKey(const PrimitivePyPtr &prim, const AbstractBasePtrList &args, PyInferKey *key) const {
+  MS_EXCEPTION_IF_NULL(prim);
+  MS_EXCEPTION_IF_NULL(key);
+  key->args.resize(args.size());
+  for (size_t i = 0; i < args.size(); ++i) {
+    if (!ToPyInferArg(args[i], &key->args[i])) {
+      return false;
+    }
+  }
+  auto py_type = prim->GetPyObj().get_type();
+  key->class_name = py::str(py_type.attr("__module__")).cast<std::string>() + "." +
+                    py::str(py_type.attr("__qualname__")).cast<std::string>();
+  key->prim = std::make_shared<Primitive>(*prim);
+  if (!GetPyInferInstanceState(prim, &key->instance_state)) {
+    return false;
+  }
+  auto context = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context);
+  key->context = context->device_target() + "." + context->backend_policy() + "." +
+                 std::to_string(context->execution_mode());
+  // the attributes are unordered, their hashes are summed
+  std::size_t attrs_hash = 0;
+  for (const auto &attr : prim->attrs()) {
+    MS_EXCEPTION_IF_NULL(attr.second);
+    attrs_hash += hash_combine(std::hash<std::string>{}(attr.first), attr.second->hash());
+  }
+  key->hash = hash_combine({std::hash<std::string>{}(key->class_name), attrs_hash, key->instance_state->hash(),
+                            std::hash<std::string>{}(key->context), static_cast<std::size_t>(prim->is_tuple_input_),
+                            AbstractBasePtrListHasher{}(key->args)});
+  return true;
+}
+
+EvalResultPtr PyInferCache::Find(const PyInferKey &key, ValuePtr *instance_changes) {
+  MS_EXCEPTION_IF_NULL(instance_changes);
+  std::lock_guard<std::mutex> lock(lock_);
+  auto range = entries_.equal_range(key.hash);
+  for (auto iter = range.first; iter != range.second; ++iter) {
+    auto &entry_key = iter->second.key;
+    if (entry_key.class_name == key.class_name && entry_key.context == key.context && *entry_key.prim == *key.prim &&
+        *entry_key.instance_state == *key.instance_state && AbstractBasePtrListEqual{}(entry_key.args, key.args)) {
+      hits_++;
+      // the abstract is cloned, so that the graphs of different compiles don't share it
+      auto &result = iter->second.result;
+      *instance_changes = iter->second.instance_changes;
+      return std::make_shared<EvalResult>(result->abstract()->Clone(), result->attribute());
+    }
+  }
+  misses_++;
+  return nullptr;
+}
+
+void PyInferCache::Insert(const PyInferKey &key, const EvalResultPtr &result, const ValuePtr &instance_changes) {
+  MS_EXCEPTION_IF_NULL(result);
+  MS_EXCEPTION_IF_NULL(result->abstract());
+  MS_EXCEPTION_IF_NULL(instance_changes);
+  auto attrs = result->attribute() == nullptr ? std::make_shared<AttrValueMap>()
+                                              : std::make_shared<AttrValueMap>(*result->attribute());
+  auto entry_result = std::make_shared<EvalResult>(result->abstract()->Clone(), attrs);
+  std::lock_guard<std::mutex> lock(lock_);
+  if (entries_.size() >= kMaxPyInferCacheEntries) {
+    ClearLocked();
+  }
+  (void)entries_.emplace(key.hash, PyInferEntry{key, entry_result, instance_changes});
+}
+
+void PyInferCache::Clear() {
+  std::lock_guard<std::mutex> lock(lock_);
+  ClearLocked();
+}
+
+size_t PyInferCache::hits() const {
+  std::lock_guard<std::mutex> lock(lock_);
+  return hits_;
+}
+
+size_t PyInferCache::misses() const {
+  std::lock_guard<std::mutex> lock(lock_);
+  return misses_;
+}
+
+size_t PyInferCache::size() const {
+  std::lock_guard<std::mutex> lock(lock_);
+  return entries_.size();
+}
+
+void PyInferCache::ClearLocked() {
+  MS_LOG(INFO) << "Clear python infer cache of " << entries_.size() << " entries, hits: " << hits_
+               << ", misses: " << misses_;
+  entries_.clear();
+  hits_ = 0;
+  misses_ = 0;
+}
+
 EvalResultPtr PythonPrimEvaluator::EvalPrim(const AnalysisEnginePtr &, const AbstractBasePtrList &args) {
   MS_LOG(DEBUG) << "Eval for:" << prim_py_->ToString();
 
@@ -475,12 +739,33 @@ EvalResultPtr PythonPrimEvaluator::EvalPrim(const AnalysisEnginePtr &, const Abs
   if (iter != cache_->end()) {
     return iter->second;
   }
-  auto py_args = PreparePyInputs(prim_py_, args);
-
+  auto &infer_cache = PyInferCache::GetInstance();
+  PyInferKey key;
+  bool cacheable = infer_cache.MakeKey(prim_py_, args, &key);
   auto pyobj = prim_py_->GetPyObj();
   if (pyobj == nullptr) {
     MS_LOG(EXCEPTION) << "[" << prim_py_->ToString() << "]: pyobj is empty";
   }
+  if (cacheable) {
+    ValuePtr instance_changes = nullptr;
+    auto infer_result = infer_cache.Find(key, &instance_changes);
+    if (infer_result != nullptr) {
+      MS_LOG(DEBUG) << "Python infer cache hit for " << prim_py_->ToString() << ": "
+                    << infer_result->abstract()->ToString();
+      // do to the instance what the infer did, the backend reads the added attributes and python attributes
+      for (const auto &attr : *infer_result->attribute()) {
+        (void)pyobj.attr("add_prim_attr")(attr.first, ValuePtrToPyData(attr.second));
+      }
+      for (const auto &item : instance_changes->cast<ValueTuplePtr>()->value()) {
+        auto &pair = item->cast<ValueTuplePtr>()->value();
+        py::setattr(pyobj, py::str(GetValue<std::string>(pair[0])), FromPyInferState(pair[1]));
+      }
+      (*cache_)[args] = infer_result;
+      return infer_result;
+    }
+  }
+  auto py_args = PreparePyInputs(prim_py_, args);
+
   auto infer_fuc = pyobj.attr("__infer__");
   prim_py_->BeginRecordAddAttr();
   py::dict output = infer_fuc(*py_args);
@@ -492,6 +777,12 @@ EvalResultPtr PythonPrimEvaluator::EvalPrim(const AnalysisEnginePtr &, const Abs
   MS_LOG(DEBUG) << "Python InferTensor result spec: " << res_spec->ToString() << ".";
   auto infer_result = std::make_shared<EvalResult>(res_spec, std::make_shared<AttrValueMap>(added_attrs));
   (*cache_)[args] = infer_result;
+  ValuePtr instance_state = nullptr;
+  ValuePtr instance_changes = nullptr;
+  if (cacheable && GetPyInferInstanceState(prim_py_, &instance_state) &&
+      GetPyInferStateChanges(prim_py_, key.instance_state, instance_state, &instance_changes)) {
+    infer_cache.Insert(key, infer_result, instance_changes);
+  }
   return infer_result;
 }
 
@@ -1142,6 +1433,7 @@ void InitPrimEvaluatorConstructors() {
 
 void ClearPrimEvaluatorMap() {
   PrimEvaluatorConstructors.clear();
+  PyInferCache::GetInstance().Clear();
   GetPrimitiveToEvalImplMap().clear();
   GetUniformPrimitiveToImplMap().clear();
 }
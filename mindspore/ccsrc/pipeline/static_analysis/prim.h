@@ -21,8 +21,10 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "pipeline/static_analysis/evaluator.h"
@@ -72,6 +74,58 @@ class PythonPrimEvaluator : public TrivialPrimEvaluator {
   PrimitivePyPtr prim_py_;
 };
 
+// Key of a call of a python infer function: the class and attributes of the primitive, and the arguments as the
+// infer function sees them
+struct PyInferKey {
+  std::string class_name;
+  // copy of the primitive taken before infer, holding its name and attributes
+  PrimitivePtr prim;
+  // the python attributes of the primitive instance which are not primitive attributes, as the infer may read them
+  ValuePtr instance_state;
+  // the device target, backend policy and execution mode, which the infer may read from the context
+  std::string context;
+  AbstractBasePtrList args;
+  std::size_t hash{0};
+};
+
+// A cached result of a python infer function
+struct PyInferEntry {
+  PyInferKey key;
+  EvalResultPtr result;
+  // the python attributes the infer set on the instance, as a tuple of (name, value) pairs
+  ValuePtr instance_changes;
+};
+
+// Process wide cache of the results of python infer functions. A result only depends on the key, so it is shared by
+// the instances of a primitive with the same attributes, as those of the identical layers of a network, and by the
+// following compiles. On a hit the added attributes and python attributes of the entry are set on the instance of
+// the call, as the infer would have done.
+class PyInferCache {
+ public:
+  static PyInferCache &GetInstance();
+
+  // return false if the call can't be cached, as its arguments refer to more than shapes, types and values
+  bool MakeKey(const PrimitivePyPtr &prim, const AbstractBasePtrList &args, PyInferKey *key) const;
+  // return the cached result and the python attributes the infer set, nullptr on a miss
+  EvalResultPtr Find(const PyInferKey &key, ValuePtr *instance_changes);
+  void Insert(const PyInferKey &key, const EvalResultPtr &result, const ValuePtr &instance_changes);
+  void Clear();
+
+  size_t hits() const;
+  size_t misses() const;
+  size_t size() const;
+
+ private:
+  PyInferCache() = default;
+  ~PyInferCache() = default;
+  void ClearLocked();
+
+  mutable std::mutex lock_;
+  std::unordered_multimap<std::size_t, PyInferEntry> entries_;
+  size_t hits_{0};
+  size_t misses_{0};
+};
+
 class DoSignatureEvaluator : public Evaluator {
  public:
   explicit DoSignatureEvaluator(const PrimitivePtr primitive) : Evaluator("DoSignatureEvaluator"), prim_(primitive) {}
@@ -0,0 +1,322 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pre_activate/mem_reuse/mem_aware_order.h"
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include "pre_activate/mem_reuse/mem_reuse.h"
+#include "session/anf_runtime_algorithm.h"
+#include "utils/graph_utils.h"
+#include "utils/utils.h"
+
+namespace mindspore {
+namespace memreuse {
+namespace {
+const std::set<std::string> kParamWriterOpSet = {"Assign", "AssignSub", kAssignAddOpName};
+
+bool IsKept(const KernelRefCount *ref) { return ref->ref_count_ >= kMaxRefCount; }
+
+using KernelIndexMap = std::unordered_map<const AnfNode *, size_t>;
+
+// the kernels and parameters a node reads, looking through the nodes which are not kernels of the graph
+void CollectReads(const AnfNodePtr &node, const KernelIndexMap &index, std::set<size_t> *kernels,
+                  std::vector<AnfNodePtr> *params) {
+  std::vector<AnfNodePtr> todo{node};
+  std::unordered_set<AnfNodePtr> seen;
+  while (!todo.empty()) {
+    auto cur = todo.back();
+    todo.pop_back();
+    if (cur == nullptr || !seen.insert(cur).second) {
+      continue;
+    }
+    auto iter = index.find(cur.get());
+    if (iter != index.end()) {
+      (void)kernels->insert(iter->second);
+    } else if (cur->isa<Parameter>()) {
+      params->push_back(cur);
+    } else if (cur->isa<CNode>()) {
+      auto &inputs = cur->cast<CNodePtr>()->inputs();
+      todo.insert(todo.end(), inputs.begin(), inputs.end());
+    }
+  }
+}
+
+void AddEdge(size_t from, size_t to, std::vector<OrderKernel> *kernels) {
+  // the edges follow the default order, so that it stays valid
+  if (from == to) {
+    return;
+  }
+  (*kernels)[std::max(from, to)].preds.push_back(std::min(from, to));
+}
+
+void AddChain(const std::set<size_t> &chain, std::vector<OrderKernel> *kernels) {
+  if (chain.empty()) {
+    return;
+  }
+  for (auto iter = std::next(chain.begin()); iter != chain.end(); ++iter) {
+    AddEdge(*std::prev(iter), *iter, kernels);
+  }
+}
+
+bool IsParamWriter(const session::KernelGraph &graph, const CNodePtr &kernel) {
+  auto name = AnfAlgo::GetCNodeName(kernel);
+  if (kOptOperatorSet.find(name) != kOptOperatorSet.end() || kParamWriterOpSet.find(name) != kParamWriterOpSet.end()) {
+    return true;
+  }
+  for (size_t i = 0; i < AnfAlgo::GetOutputTensorNum(kernel); ++i) {
+    if (graph.IsInRefOutputMap(std::make_pair(kernel, i))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void CollectDependencies(const session::KernelGraph &graph, std::vector<OrderKernel> *kernels) {
+  auto &order = graph.execution_order();
+  KernelIndexMap index;
+  for (size_t i = 0; i < order.size(); ++i) {
+    index[order[i].get()] = i;
+  }
+  // data dependencies, and the users of each parameter
+  std::map<AnfNodePtr, std::set<size_t>> param_users;
+  std::set<size_t> writers;
+  std::set<size_t> fixed;
+  for (size_t i = 0; i < order.size(); ++i) {
+    auto &kernel = order[i];
+    std::set<size_t> reads;
+    std::vector<AnfNodePtr> params;
+    for (size_t j = 1; j < kernel->inputs().size(); ++j) {
+      CollectReads(kernel->input(j), index, &reads, &params);
+    }
+    for (auto read : reads) {
+      AddEdge(read, i, kernels);
+    }
+    for (auto &param : params) {
+      (void)param_users[param].insert(i);
+    }
+    if (IsParamWriter(graph, kernel)) {
+      (void)writers.insert(i);
+    }
+    if (AnfAlgo::IsCommunicationOp(kernel) || AnfAlgo::GetOutputTensorNum(kernel) == 0) {
+      (void)fixed.insert(i);
+    }
+  }
+  // the reads and writes of a parameter keep their order
+  for (auto &users : param_users) {
+    if (std::any_of(users.second.begin(), users.second.end(), [&writers](size_t i) { return writers.count(i) > 0; })) {
+      AddChain(users.second, kernels);
+    }
+  }
+  AddChain(fixed, kernels);
+  // control dependencies, a parameter stands for its users
+  auto kernels_of = [&index, &param_users](const AnfNodePtr &node) {
+    std::set<size_t> result;
+    std::vector<AnfNodePtr> params;
+    CollectReads(node, index, &result, &params);
+    for (auto &param : params) {
+      auto &users = param_users[param];
+      result.insert(users.begin(), users.end());
+    }
+    return result;
+  };
+  for (auto &node : TopoSort(graph.get_return())) {
+    if (!AnfAlgo::CheckPrimitiveType(node, prim::kPrimControlDepend)) {
+      continue;
+    }
+    auto cnode = node->cast<CNodePtr>();
+    MS_EXCEPTION_IF_NULL(cnode);
+    if (cnode->inputs().size() <= kControlDependBehindIndex) {
+      continue;
+    }
+    auto prior = kernels_of(cnode->input(kControlDependPriorIndex));
+    auto behind = kernels_of(cnode->input(kControlDependBehindIndex));
+    for (auto from : prior) {
+      for (auto to : behind) {
+        AddEdge(from, to, kernels);
+      }
+    }
+  }
+}
+}  // namespace
+
+MemAwareOrder::MemAwareOrder(const std::vector<OrderKernel> &kernels) : kernels_(kernels) {
+  for (auto &kernel : kernels_) {
+    std::vector<const KernelRefCount *> reads;
+    for (auto &input : kernel.inputs) {
+      MS_EXCEPTION_IF_NULL(input);
+      if (std::find(reads.begin(), reads.end(), input.get()) == reads.end()) {
+        reads.push_back(input.get());
+        readers_[input.get()]++;
+      }
+    }
+    reads_.push_back(reads);
+  }
+}
+
+size_t MemAwareOrder::OutputSize(size_t index) const {
+  size_t size = 0;
+  for (auto &output : kernels_[index].outputs) {
+    MS_EXCEPTION_IF_NULL(output);
+    size += output->size_;
+  }
+  return size;
+}
+
+size_t MemAwareOrder::FreedSize(size_t index, const std::unordered_map<const KernelRefCount *, size_t> &remain) const {
+  size_t size = 0;
+  for (auto ref : reads_[index]) {
+    auto iter = remain.find(ref);
+    if (iter != remain.end() && iter->second == 1 && !IsKept(ref)) {
+      size += ref->size_;
+    }
+  }
+  // an output nobody reads is dropped right away
+  for (auto &output : kernels_[index].outputs) {
+    if (readers_.find(output.get()) == readers_.end() && !IsKept(output.get())) {
+      size += output->size_;
+    }
+  }
+  return size;
+}
+
+void MemAwareOrder::Run(size_t index, std::unordered_map<const KernelRefCount *, size_t> *remain) const {
+  for (auto ref : reads_[index]) {
+    auto iter = remain->find(ref);
+    if (iter != remain->end() && iter->second > 0) {
+      iter->second--;
+    }
+  }
+}
+
+size_t MemAwareOrder::Peak(const std::vector<size_t> &order) const {
+  auto remain = readers_;
+  size_t live = 0;
+  size_t peak = 0;
+  for (auto index : order) {
+    auto output_size = OutputSize(index);
+    peak = std::max(peak, live + output_size + kernels_[index].workspace);
+    auto freed = FreedSize(index, remain);
+    Run(index, &remain);
+    live = live + output_size - freed;
+  }
+  return peak;
+}
+
+std::vector<size_t> MemAwareOrder::Schedule() const {
+  size_t kernel_num = kernels_.size();
+  std::vector<size_t> pred_num(kernel_num, 0);
+  std::vector<std::vector<size_t>> succs(kernel_num);
+  for (size_t i = 0; i < kernel_num; ++i) {
+    for (auto pred : kernels_[i].preds) {
+      if (pred >= kernel_num) {
+        MS_LOG(EXCEPTION) << "The pred " << pred << " of kernel " << i << " is out of range " << kernel_num;
+      }
+      succs[pred].push_back(i);
+      pred_num[i]++;
+    }
+  }
+  std::vector<size_t> ready;
+  for (size_t i = 0; i < kernel_num; ++i) {
+    if (pred_num[i] == 0) {
+      ready.push_back(i);
+    }
+  }
+
+  auto remain = readers_;
+  size_t live = 0;
+  std::vector<size_t> order;
+  while (!ready.empty()) {
+    auto best = ready.begin();
+    std::tuple<int64_t, size_t, size_t> best_key;
+    for (auto iter = ready.begin(); iter != ready.end(); ++iter) {
+      auto output_size = OutputSize(*iter);
+      auto growth = static_cast<int64_t>(output_size) - static_cast<int64_t>(FreedSize(*iter, remain));
+      auto key = std::make_tuple(growth, live + output_size + kernels_[*iter].workspace, *iter);
+      if (iter == ready.begin() || key < best_key) {
+        best = iter;
+        best_key = key;
+      }
+    }
+    auto index = *best;
+    (void)ready.erase(best);
+    live = live + OutputSize(index) - FreedSize(index, remain);
+    Run(index, &remain);
+    order.push_back(index);
+    for (auto succ : succs[index]) {
+      if (--pred_num[succ] == 0) {
+        ready.push_back(succ);
+      }
+    }
+  }
+  if (order.size() != kernel_num) {
+    MS_LOG(EXCEPTION) << "The dependencies of the kernels have a cycle, " << order.size() << " of " << kernel_num
+                      << " kernels are ordered";
+  }
+  return order;
+}
+
+bool ReorderForMemory(session::KernelGraph *graph) {
+  MS_EXCEPTION_IF_NULL(graph);
+  auto order = graph->execution_order();
+  if (order.size() < 2) {
+    return false;
+  }
+  MemReuseUtil util;
+  util.SetAllInfo(graph);
+  util.SetGraphOutputRefCount();
+  auto kernel_defs = util.kernel_def_ptr_list();
+  if (kernel_defs.size() != order.size()) {
+    MS_LOG(EXCEPTION) << "The graph has " << order.size() << " kernels, but " << kernel_defs.size() << " kernel defs";
+  }
+  std::vector<OrderKernel> kernels(order.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    MS_EXCEPTION_IF_NULL(kernel_defs[i]);
+    kernels[i].inputs = kernel_defs[i]->input_refs();
+    kernels[i].outputs = kernel_defs[i]->output_refs();
+    for (auto &wk : kernel_defs[i]->wk_space_) {
+      for (auto &ref : wk.second) {
+        kernels[i].workspace += ref->size_;
+      }
+    }
+  }
+  CollectDependencies(*graph, &kernels);
+
+  MemAwareOrder scheduler(kernels);
+  std::vector<size_t> default_order(order.size());
+  for (size_t i = 0; i < default_order.size(); ++i) {
+    default_order[i] = i;
+  }
+  auto new_order = scheduler.Schedule();
+  auto default_peak = scheduler.Peak(default_order);
+  auto new_peak = scheduler.Peak(new_order);
+  MS_LOG(INFO) << "Peak memory of graph " << graph->graph_id() << ": default order " << default_peak
+               << " bytes, memory aware order " << new_peak << " bytes";
+  if (new_peak >= default_peak) {
+    return false;
+  }
+  std::vector<CNodePtr> execution_order;
+  (void)std::transform(new_order.begin(), new_order.end(), std::back_inserter(execution_order),
+                       [&order](size_t index) { return order[index]; });
+  graph->set_execution_order(execution_order);
+  return true;
+}
+}  // namespace memreuse
+}  // namespace mindspore
@@ -0,0 +1,68 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PRE_ACTIVATE_MEM_REUSE_MEM_AWARE_ORDER_H_
+#define MINDSPORE_CCSRC_PRE_ACTIVATE_MEM_REUSE_MEM_AWARE_ORDER_H_
+#include <unordered_map>
+#include <vector>
+#include "pre_activate/mem_reuse/kernel_refcount.h"
+#include "session/kernel_graph.h"
+
+namespace mindspore {
+namespace memreuse {
+// A kernel as seen by the scheduler, the preds are indexes of the kernels that must run before it
+struct OrderKernel {
+  std::vector<size_t> preds;
+  KernelRefCountPtrList inputs;
+  KernelRefCountPtrList outputs;
+  size_t workspace = 0;
+};
+
+// Orders kernels to lower the peak of the live memory.
+// An output is live from its kernel to its last consumer, a workspace only while its kernel runs. The graph
+// outputs, whose ref_count_ is kMaxRefCount, stay live to the end.
+class MemAwareOrder {
+ public:
+  explicit MemAwareOrder(const std::vector<OrderKernel> &kernels);
+  ~MemAwareOrder() = default;
+
+  // peak of the live bytes when the kernels run in the order, which must respect the preds
+  size_t Peak(const std::vector<size_t> &order) const;
+  // Greedy list scheduling: among the ready kernels, run the one which adds the least live bytes, then the one
+  // with the lowest peak while it runs, then the first one of the given order.
+  std::vector<size_t> Schedule() const;
+
+ private:
+  size_t OutputSize(size_t index) const;
+  // bytes freed after the kernel runs, given the number of kernels still to read each ref
+  size_t FreedSize(size_t index, const std::unordered_map<const KernelRefCount *, size_t> &remain) const;
+  void Run(size_t index, std::unordered_map<const KernelRefCount *, size_t> *remain) const;
+
+  std::vector<OrderKernel> kernels_;
+  // the refs read by each kernel without duplicates
+  std::vector<std::vector<const KernelRefCount *>> reads_;
+  // number of kernels reading each ref
+  std::unordered_map<const KernelRefCount *, size_t> readers_;
+};
+
+// Set the execution order of the graph to the order of MemAwareOrder if its peak is lower.
+// The kernels keep their data and control dependencies, the kernels writing parameters keep their order with the
+// other users of the parameters, and the communication kernels and the kernels without outputs keep their order.
+// return true if the order of the graph is changed
+bool ReorderForMemory(session::KernelGraph *graph);
+}  // namespace memreuse
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PRE_ACTIVATE_MEM_REUSE_MEM_AWARE_ORDER_H_
@@ -0,0 +1,191 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pre_activate/mem_reuse/mem_reuse_interval_planner.h"
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include "operator/ops.h"
+#include "utils/convert_utils_base.h"
+
+namespace mindspore {
+namespace memreuse {
+namespace {
+// same alignment as BestFitMemReuse::AlignMemorySize
+size_t AlignMemorySize(size_t size) {
+  return (size + kDefaultMemAlignSize + kAttAlignSize) / kDefaultMemAlignSize * kDefaultMemAlignSize;
+}
+
+// the kernels whose outputs are not released when nobody reads them, see BestFitMemReuse::IsRelease
+bool IsRelease(const std::string &kernel_name) {
+  static const std::unordered_set<std::string> unable_used_node = {
+    prim::kPrimBatchNorm->name(), prim::kPrimBatchNormGrad->name(), prim::kPrimFusedBatchNorm->name(),
+    prim::kPrimFusedBatchNormGrad->name()};
+  return unable_used_node.find(kernel_name) == unable_used_node.end();
+}
+
+bool IsOverlap(const MemInterval &a, const MemInterval &b) { return a.start <= b.end && b.start <= a.end; }
+}  // namespace
+
+std::vector<MemInterval> GetMemIntervals(const MemReuseUtil *mem_reuse_util_ptr) {
+  MS_EXCEPTION_IF_NULL(mem_reuse_util_ptr);
+  auto kernels = mem_reuse_util_ptr->kernel_def_ptr_list();
+  size_t last = kernels.empty() ? 0 : kernels.size() - 1;
+  std::vector<MemInterval> intervals;
+  std::unordered_map<const KernelRefCount *, size_t> output_index;
+  std::vector<bool> has_reader;
+  std::vector<bool> keep;
+  for (size_t pos = 0; pos < kernels.size(); ++pos) {
+    auto &kernel = kernels[pos];
+    MS_EXCEPTION_IF_NULL(kernel);
+    for (auto &input : kernel->input_refs()) {
+      auto iter = output_index.find(input.get());
+      if (iter == output_index.end()) {
+        MS_LOG(EXCEPTION) << "An input of kernel " << kernel->scope_full_name() << " is not written before";
+      }
+      intervals[iter->second].end = pos;
+      has_reader[iter->second] = true;
+    }
+    bool release = IsRelease(kernel->kernel_name());
+    for (auto &output : kernel->output_refs()) {
+      MS_EXCEPTION_IF_NULL(output);
+      output_index[output.get()] = intervals.size();
+      intervals.push_back({output, AlignMemorySize(output->size_), pos, pos, 0});
+      has_reader.push_back(false);
+      keep.push_back(!release || output->ref_count_ >= kMaxRefCount);
+    }
+    for (auto &workspace : kernel->wk_space_) {
+      for (auto &ref : workspace.second) {
+        MS_EXCEPTION_IF_NULL(ref);
+        intervals.push_back({ref, AlignMemorySize(ref->size_), pos, pos, 0});
+        has_reader.push_back(true);
+        keep.push_back(false);
+      }
+    }
+  }
+  for (size_t i = 0; i < intervals.size(); ++i) {
+    // a graph output is never released, nor an unread output of a kernel that can't release it
+    if (keep[i] && (!has_reader[i] || intervals[i].ref->ref_count_ >= kMaxRefCount)) {
+      intervals[i].end = last;
+    }
+  }
+  return intervals;
+}
+
+size_t GetMemLowerBound(const std::vector<MemInterval> &intervals) {
+  size_t positions = 0;
+  for (auto &interval : intervals) {
+    positions = std::max(positions, interval.end + 1);
+  }
+  // the live bytes change by delta[pos] at each position
+  std::vector<int64_t> delta(positions + 1, 0);
+  for (auto &interval : intervals) {
+    delta[interval.start] += SizeToLong(interval.size);
+    delta[interval.end + 1] -= SizeToLong(interval.size);
+  }
+  int64_t live = 0;
+  int64_t peak = 0;
+  for (auto bytes : delta) {
+    live += bytes;
+    peak = std::max(peak, live);
+  }
+  return LongToSize(peak);
+}
+
+void DumpMemIntervals(const std::string &file_path, const std::string &planner, size_t footprint,
+                      const std::vector<MemInterval> &intervals) {
+  std::ofstream ofs(file_path);
+  if (!ofs.is_open()) {
+    MS_LOG(ERROR) << "Open file [" << file_path << "] failed!";
+    return;
+  }
+  ofs << "# planner " << planner << "\n";
+  ofs << "# footprint " << footprint << "\n";
+  ofs << "# lower_bound " << GetMemLowerBound(intervals) << "\n";
+  ofs << "# size start end offset\n";
+  for (auto &interval : intervals) {
+    ofs << interval.size << " " << interval.start << " " << interval.end << " " << interval.offset << "\n";
+  }
+  ofs.close();
+}
+
+bool GreedyBySizeMemReuse::IsSupported(const MemReuseUtil *mem_reuse_util_ptr) {
+  MS_EXCEPTION_IF_NULL(mem_reuse_util_ptr);
+  auto kernels = mem_reuse_util_ptr->kernel_def_ptr_list();
+  return std::all_of(kernels.begin(), kernels.end(),
+                     [&kernels](const KernelDefPtr &kernel) { return kernel->stream_id() == kernels[0]->stream_id(); });
+}
+
+void GreedyBySizeMemReuse::Plan(std::vector<MemInterval> *intervals) {
+  MS_EXCEPTION_IF_NULL(intervals);
+  auto &items = *intervals;
+  std::vector<size_t> order(items.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&items](size_t a, size_t b) {
+    if (items[a].size != items[b].size) {
+      return items[a].size > items[b].size;
+    }
+    return items[a].start < items[b].start;
+  });
+  // the placed intervals by offset
+  std::vector<size_t> placed;
+  allocated_size_ = 0;
+  for (auto index : order) {
+    auto &item = items[index];
+    size_t best_offset = std::numeric_limits<size_t>::max();
+    size_t best_gap = std::numeric_limits<size_t>::max();
+    size_t prev_end = 0;
+    for (auto other_index : placed) {
+      auto &other = items[other_index];
+      if (!IsOverlap(item, other)) {
+        continue;
+      }
+      if (other.offset >= prev_end) {
+        auto gap = other.offset - prev_end;
+        if (gap >= item.size && gap < best_gap) {
+          best_gap = gap;
+          best_offset = prev_end;
+        }
+      }
+      prev_end = std::max(prev_end, other.offset + other.size);
+    }
+    item.offset = best_offset == std::numeric_limits<size_t>::max() ? prev_end : best_offset;
+    allocated_size_ = std::max(allocated_size_, item.offset + item.size);
+    auto pos = std::upper_bound(placed.begin(), placed.end(), item.offset, [&items](size_t offset, size_t other) {
+      return offset < items[other].offset;
+    });
+    (void)placed.insert(pos, index);
+  }
+  lower_bound_ = GetMemLowerBound(items);
+}
+
+void GreedyBySizeMemReuse::Reuse(const MemReuseUtil *mem_reuse_util_ptr) {
+  MS_EXCEPTION_IF_NULL(mem_reuse_util_ptr);
+  intervals_ = GetMemIntervals(mem_reuse_util_ptr);
+  Plan(&intervals_);
+  for (auto &interval : intervals_) {
+    interval.ref->offset_ = interval.offset;
+  }
+  MS_LOG(INFO) << "Greedy by size memory plan of " << intervals_.size() << " buffers: " << allocated_size_
+               << " bytes, lower bound " << lower_bound_ << " bytes";
+}
+}  // namespace memreuse
+}  // namespace mindspore
@@ -0,0 +1,69 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PRE_ACTIVATE_MEM_REUSE_MEM_REUSE_INTERVAL_PLANNER_H_
+#define MINDSPORE_CCSRC_PRE_ACTIVATE_MEM_REUSE_MEM_REUSE_INTERVAL_PLANNER_H_
+#include <string>
+#include <vector>
+#include "pre_activate/mem_reuse/kernel_refcount.h"
+#include "pre_activate/mem_reuse/mem_reuse.h"
+
+namespace mindspore {
+namespace memreuse {
+// A tensor or workspace with the positions of the first and last kernels using it, both included
+struct MemInterval {
+  KernelRefCountPtr ref;
+  size_t size = 0;
+  size_t start = 0;
+  size_t end = 0;
+  size_t offset = 0;
+};
+
+// Lifetimes of the tensors and workspaces of MemReuseUtil, as BestFitMemReuse sees them: an output lives from its
+// kernel to its last reader, a workspace only while its kernel runs. The sizes are aligned like BestFitMemReuse
+// aligns them. It reads the reference counts, so it must run before the counts are consumed by a planner.
+std::vector<MemInterval> GetMemIntervals(const MemReuseUtil *mem_reuse_util_ptr);
+// The peak of the live bytes, no offset assignment can use less memory
+size_t GetMemLowerBound(const std::vector<MemInterval> &intervals);
+// Write the intervals and the footprint of a planner as text, one "size start end offset" line per interval
+void DumpMemIntervals(const std::string &file_path, const std::string &planner, size_t footprint,
+                      const std::vector<MemInterval> &intervals);
+
+// Offline memory planner assigning the offsets from the lifetimes of the whole graph.
+// The intervals are placed from the largest, each one in the smallest gap left between the placed intervals it
+// overlaps with, or above them. It is an alternative to BestFitMemReuse for graphs on a single stream.
+class GreedyBySizeMemReuse {
+ public:
+  GreedyBySizeMemReuse() = default;
+  ~GreedyBySizeMemReuse() = default;
+  // the planner doesn't order the kernels of different streams, so it supports a single stream only
+  static bool IsSupported(const MemReuseUtil *mem_reuse_util_ptr);
+  // Memory reuse main program entry, set the offset_ of the tensors and workspaces
+  void Reuse(const MemReuseUtil *mem_reuse_util_ptr);
+  // Assign the offsets of the intervals
+  void Plan(std::vector<MemInterval> *intervals);
+  size_t GetAllocatedSize() const { return allocated_size_; }
+  size_t GetLowerBound() const { return lower_bound_; }
+  const std::vector<MemInterval> &intervals() const { return intervals_; }
+
+ private:
+  std::vector<MemInterval> intervals_;
+  size_t allocated_size_{0};
+  size_t lower_bound_{0};
+};
+}  // namespace memreuse
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PRE_ACTIVATE_MEM_REUSE_MEM_REUSE_INTERVAL_PLANNER_H_
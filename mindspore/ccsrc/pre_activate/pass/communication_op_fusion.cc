@@ -31,6 +31,7 @@ namespace opt {
 namespace {
 constexpr auto kAttrDefaultGroup = "default_group";
 constexpr auto kAttrDefaultOp = "default_op";
+constexpr auto kAttrDefaultAlgorithm = "mpi";
 
 kernel::KernelBuildInfoPtr GenerateKernelBuildInfo(const CommunicationOpInfo &communication_op_info, size_t start_index,
                                                    size_t end_index) {
@@ -79,15 +80,31 @@ std::string GetFusionGroupKey(const AnfNodePtr &node) {
   }
   std::string group = kAttrDefaultGroup;
   ValuePtr attr_group = primitive->GetAttr(kAttrGroup);
-  if (attr_group != nullptr) {
+  if (attr_group != nullptr && attr_group->isa<StringImm>()) {
     group = GetValue<std::string>(attr_group);
+  } else if (attr_group != nullptr) {
+    // the group of the host ops is the list of the ranks, such as "0_1_2"
+    group.clear();
+    for (auto rank : GetValue<std::vector<int>>(attr_group)) {
+      group += (group.empty() ? "" : "_") + std::to_string(rank);
+    }
   }
   std::string op = kAttrDefaultOp;
   ValuePtr attr_op = primitive->GetAttr(kAttrOp);
   if (attr_op != nullptr) {
     op = GetValue<std::string>(attr_op);
   }
-  return group + op + std::to_string(fusion);
+  std::string key = group + op + std::to_string(fusion);
+  // the ops of different algorithms are not fused
+  ValuePtr attr_algorithm = primitive->GetAttr(kAttrAlgorithm);
+  if (attr_algorithm != nullptr && GetValue<std::string>(attr_algorithm) != kAttrDefaultAlgorithm) {
+    key += GetValue<std::string>(attr_algorithm);
+  }
+  // the inputs of a fused op are reduced as one buffer, so the ops of different dtypes are not fused
+  if (AnfAlgo::GetInputTensorNum(node) > 0) {
+    key += "_" + std::to_string(static_cast<int>(AnfAlgo::GetInputDeviceDataType(node, 0)));
+  }
+  return key;
 }
 }  // namespace
 
@@ -172,6 +189,9 @@ AnfNodePtr CommunicationOpFusion::CreateFusedCommunicationOp(const FuncGraphPtr
     AnfAlgo::CopyNodeAttr("fusion", cnode, fused_node);
     AnfAlgo::CopyNodeAttr("op", cnode, fused_node);
     AnfAlgo::CopyNodeAttr("group", cnode, fused_node);
+    if (AnfAlgo::HasNodeAttr(kAttrAlgorithm, cnode)) {
+      AnfAlgo::CopyNodeAttr(kAttrAlgorithm, cnode, fused_node);
+    }
     abstract_list.push_back(cnode->abstract());
   }
   auto kernel_build_info = GenerateKernelBuildInfo(communication_op_info, start_index, end_index);
@@ -57,6 +57,13 @@ class AllReduceFusion : public CommunicationOpFusion {
   ~AllReduceFusion() override = default;
 };
 
+class HostAllReduceFusion : public CommunicationOpFusion {
+ public:
+  explicit HostAllReduceFusion(size_t groups = 1)
+      : CommunicationOpFusion("host_all_reduce_fusion", kHostAllReduceOpName, groups) {}
+  ~HostAllReduceFusion() override = default;
+};
+
 class AllGatherFusion : public CommunicationOpFusion {
  public:
   explicit AllGatherFusion(size_t groups = 1) : CommunicationOpFusion("all_gather_fusion", kAllGatherOpName, groups) {}
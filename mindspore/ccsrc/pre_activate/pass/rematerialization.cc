@@ -0,0 +1,248 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "pre_activate/pass/rematerialization.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <string>
+#include <unordered_set>
+#include "ir/dtype.h"
+#include "pre_activate/common/helper.h"
+#include "session/anf_runtime_algorithm.h"
+#include "utils/utils.h"
+
+namespace mindspore {
+namespace opt {
+namespace {
+const char kGradientsScope[] = "Gradients/";
+
+// flops per output element of the ops that are cheap to recompute
+const std::map<std::string, size_t> kRecomputeCost = {
+  {"Cast", 1},    {"ReLU", 1},   {"ReLU6", 1},    {"TensorAdd", 1},  {"Sub", 1}, {"Mul", 1},
+  {"Neg", 1},     {"Square", 1}, {"BiasAdd", 1},  {kRealDivOpName, 1}, {"Exp", 4}, {kSqrtOpName, 4},
+  {"Sigmoid", 6}, {"Tanh", 6},   {"LayerNorm", 8}, {"Gelu", 10}};
+
+bool IsBackward(const AnfNodePtr &node) {
+  MS_EXCEPTION_IF_NULL(node);
+  auto scope = node->scope();
+  return scope != nullptr && scope->name().compare(0, sizeof(kGradientsScope) - 1, kGradientsScope) == 0;
+}
+
+void GetOutputSize(const AnfNodePtr &node, size_t *elements, size_t *bytes) {
+  *elements = 0;
+  *bytes = 0;
+  for (size_t i = 0; i < AnfAlgo::GetOutputTensorNum(node); ++i) {
+    auto shape = AnfAlgo::GetOutputInferShape(node, i);
+    auto count = std::accumulate(shape.begin(), shape.end(), size_t(1), std::multiplies<size_t>());
+    *elements += count;
+    *bytes += count * GetTypeByte(TypeIdToType(AnfAlgo::GetOutputInferDataType(node, i)));
+  }
+}
+}  // namespace
+
+bool Rematerialization::CollectUses(const FuncGraphManagerPtr &manager, const AnfNodePtr &node,
+                                    const std::unordered_map<AnfNode *, size_t> &position,
+                                    std::vector<KernelUse> *uses) {
+  MS_EXCEPTION_IF_NULL(manager);
+  MS_EXCEPTION_IF_NULL(uses);
+  auto &node_users = manager->node_users();
+  auto iter = node_users.find(node);
+  if (iter == node_users.end()) {
+    return true;
+  }
+  for (auto &user : iter->second) {
+    auto cnode = user.first->cast<CNodePtr>();
+    if (cnode != nullptr && position.find(cnode.get()) != position.end()) {
+      uses->push_back({cnode, IntToSize(user.second), -1});
+      continue;
+    }
+    // the output is also read by a node that is not a kernel, such as the output of the graph
+    if (!AnfAlgo::CheckPrimitiveType(user.first, prim::kPrimTupleGetItem)) {
+      return false;
+    }
+    auto index_node = cnode->input(kInputNodeOutputIndexInTupleGetItem)->cast<ValueNodePtr>();
+    MS_EXCEPTION_IF_NULL(index_node);
+    auto output_index = GetValue<int>(index_node->value());
+    auto getitem_users = node_users.find(user.first);
+    if (getitem_users == node_users.end()) {
+      continue;
+    }
+    for (auto &getitem_user : getitem_users->second) {
+      auto user_cnode = getitem_user.first->cast<CNodePtr>();
+      if (user_cnode == nullptr || position.find(user_cnode.get()) == position.end()) {
+        return false;
+      }
+      uses->push_back({user_cnode, IntToSize(getitem_user.second), output_index});
+    }
+  }
+  return true;
+}
+
+std::vector<Rematerialization::Candidate> Rematerialization::FindCandidates(const session::KernelGraph &graph,
+                                                                            size_t *span_bytes) const {
+  MS_EXCEPTION_IF_NULL(span_bytes);
+  auto manager = graph.manager();
+  MS_EXCEPTION_IF_NULL(manager);
+  auto &order = graph.execution_order();
+  std::unordered_map<AnfNode *, size_t> position;
+  for (size_t i = 0; i < order.size(); ++i) {
+    position[order[i].get()] = i;
+  }
+  // the last position an output of a kernel is read at, but by the except kernel
+  auto last_read = [&](const AnfNodePtr &kernel, const CNodePtr &except) {
+    std::vector<KernelUse> uses;
+    if (!CollectUses(manager, kernel, position, &uses)) {
+      return order.size();
+    }
+    size_t last = position[kernel.get()];
+    for (auto &use : uses) {
+      if (use.user != except) {
+        last = std::max(last, position[use.user.get()]);
+      }
+    }
+    return last;
+  };
+
+  std::vector<Candidate> candidates;
+  for (size_t i = 0; i < order.size(); ++i) {
+    auto &node = order[i];
+    if (IsBackward(node)) {
+      continue;
+    }
+    Candidate candidate;
+    candidate.node = node;
+    std::vector<KernelUse> uses;
+    bool only_kernel_uses = CollectUses(manager, node, position, &uses);
+    auto first_backward = std::numeric_limits<size_t>::max();
+    for (auto &use : uses) {
+      if (IsBackward(use.user)) {
+        first_backward = std::min(first_backward, position[use.user.get()]);
+        candidate.backward_uses.push_back(use);
+      }
+    }
+    if (candidate.backward_uses.empty()) {
+      continue;
+    }
+    size_t elements = 0;
+    GetOutputSize(node, &elements, &candidate.bytes);
+    *span_bytes += candidate.bytes;
+    auto cost = kRecomputeCost.find(AnfAlgo::GetCNodeName(node));
+    if (!only_kernel_uses || cost == kRecomputeCost.end()) {
+      continue;
+    }
+    // nothing to save if the activation is read by the backward pass right away
+    if (first_backward == 0 || !IsBackward(order[first_backward - 1])) {
+      continue;
+    }
+    // the copy must not keep its inputs alive longer
+    bool inputs_alive = true;
+    for (size_t j = 1; j < node->inputs().size(); ++j) {
+      auto input = AnfAlgo::VisitKernel(node->input(j), 0).first;
+      if (!input->isa<CNode>()) {
+        continue;
+      }
+      if (position.find(input.get()) == position.end() || last_read(input, node) < first_backward) {
+        inputs_alive = false;
+        break;
+      }
+    }
+    if (!inputs_alive) {
+      continue;
+    }
+    candidate.flops = elements * cost->second;
+    candidate.anchor = order[first_backward - 1];
+    candidates.push_back(candidate);
+  }
+  return candidates;
+}
+
+void Rematerialization::Recompute(const KernelGraphPtr &graph, const Candidate &candidate) {
+  auto manager = graph->manager();
+  MS_EXCEPTION_IF_NULL(manager);
+  auto &node = candidate.node;
+  // the copy depends on the anchor, so that it runs in the backward pass
+  auto inputs = node->inputs();
+  auto depend = graph->NewCNode({NewValueNode(prim::kPrimDepend), inputs[1], candidate.anchor});
+  MS_EXCEPTION_IF_NULL(depend);
+  depend->set_abstract(inputs[1]->abstract());
+  inputs[1] = depend;
+  auto copy = graph->NewCNode(inputs);
+  MS_EXCEPTION_IF_NULL(copy);
+  copy->set_abstract(node->abstract());
+  copy->set_scope(candidate.anchor->scope());
+  for (auto &use : candidate.backward_uses) {
+    auto new_input = use.output_index < 0 ? copy : CreatTupleGetItemNode(graph, copy, IntToSize(use.output_index));
+    manager->SetEdge(use.user, SizeToInt(use.input_index), new_input);
+  }
+}
+
+bool Rematerialization::Run(const FuncGraphPtr &func_graph) {
+  MS_EXCEPTION_IF_NULL(func_graph);
+  auto kernel_graph = func_graph->cast<KernelGraphPtr>();
+  if (kernel_graph == nullptr) {
+    return false;
+  }
+  size_t span_bytes = 0;
+  auto candidates = FindCandidates(*kernel_graph, &span_bytes);
+  if (span_bytes <= memory_budget_ || candidates.empty()) {
+    MS_LOG(INFO) << "No rematerialization, the activations of the backward pass take " << span_bytes
+                 << " bytes for a budget of " << memory_budget_ << " bytes";
+    return false;
+  }
+  std::stable_sort(candidates.begin(), candidates.end(), [](const Candidate &a, const Candidate &b) {
+    return static_cast<double>(a.flops) * b.bytes < static_cast<double>(b.flops) * a.bytes;
+  });
+  // an activation read or recomputed by a copy is kept
+  std::unordered_set<AnfNodePtr> recomputed;
+  std::unordered_set<AnfNodePtr> read;
+  size_t count = 0;
+  for (auto &candidate : candidates) {
+    if (span_bytes <= memory_budget_) {
+      break;
+    }
+    auto &node = candidate.node;
+    if (read.find(node) != read.end()) {
+      continue;
+    }
+    std::vector<AnfNodePtr> inputs;
+    for (size_t i = 1; i < node->inputs().size(); ++i) {
+      inputs.push_back(AnfAlgo::VisitKernel(node->input(i), 0).first);
+    }
+    if (std::any_of(inputs.begin(), inputs.end(),
+                    [&recomputed](const AnfNodePtr &input) { return recomputed.find(input) != recomputed.end(); })) {
+      continue;
+    }
+    Recompute(kernel_graph, candidate);
+    (void)recomputed.insert(node);
+    read.insert(inputs.begin(), inputs.end());
+    span_bytes -= candidate.bytes;
+    saved_bytes_ += candidate.bytes;
+    extra_flops_ += candidate.flops;
+    count++;
+  }
+  if (count == 0) {
+    return false;
+  }
+  kernel_graph->SetExecOrderByDefault();
+  MS_LOG(INFO) << "Rematerialize " << count << " activations of graph " << kernel_graph->graph_id() << ", save "
+               << saved_bytes_ << " bytes for " << extra_flops_ << " extra flops, the activations of the backward "
+               << "pass take " << span_bytes << " bytes for a budget of " << memory_budget_ << " bytes";
+  return true;
+}
+}  // namespace opt
+}  // namespace mindspore
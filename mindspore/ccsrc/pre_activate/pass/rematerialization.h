@@ -0,0 +1,71 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_PRE_ACTIVATE_PASS_REMATERIALIZATION_H_
+#define MINDSPORE_CCSRC_PRE_ACTIVATE_PASS_REMATERIALIZATION_H_
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "pre_activate/common/pass.h"
+#include "ir/func_graph.h"
+#include "ir/anf.h"
+#include "ir/manager.h"
+#include "session/kernel_graph.h"
+
+namespace mindspore {
+namespace opt {
+// Recompute cheap forward activations in the backward pass instead of keeping them alive.
+// A forward kernel read by backward kernels, the kernels in the "Gradients" scope, is duplicated right before its
+// first backward reader if it is cheap (elementwise ops, casts, layernorm) and its inputs are alive then anyway.
+// The activations are picked by the least extra flops per saved byte, until the bytes of the activations alive from
+// the forward to the backward pass fit in the budget.
+class Rematerialization : public Pass {
+ public:
+  explicit Rematerialization(size_t memory_budget = 0) : Pass("rematerialization"), memory_budget_(memory_budget) {}
+  ~Rematerialization() override = default;
+  bool Run(const FuncGraphPtr &func_graph) override;
+
+  size_t saved_bytes() const { return saved_bytes_; }
+  size_t extra_flops() const { return extra_flops_; }
+
+ private:
+  // a kernel reading an output of a node, through a tuple_getitem if output_index >= 0
+  struct KernelUse {
+    CNodePtr user;
+    size_t input_index;
+    int output_index;
+  };
+  struct Candidate {
+    CNodePtr node;
+    std::vector<KernelUse> backward_uses;
+    size_t bytes = 0;
+    size_t flops = 0;
+    // the backward kernel right before the first backward reader, the copy runs after it
+    CNodePtr anchor;
+  };
+
+  static bool CollectUses(const FuncGraphManagerPtr &manager, const AnfNodePtr &node,
+                          const std::unordered_map<AnfNode *, size_t> &position, std::vector<KernelUse> *uses);
+  std::vector<Candidate> FindCandidates(const session::KernelGraph &graph, size_t *span_bytes) const;
+  static void Recompute(const KernelGraphPtr &graph, const Candidate &candidate);
+
+  size_t memory_budget_;
+  size_t saved_bytes_ = 0;
+  size_t extra_flops_ = 0;
+};
+}  // namespace opt
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PRE_ACTIVATE_PASS_REMATERIALIZATION_H_
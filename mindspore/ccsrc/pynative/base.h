@@ -28,6 +28,7 @@
 #include "pybind11/pybind11.h"
 #include "ir/primitive.h"
 #include "pipeline/static_analysis/abstract_value.h"
+#include "pynative/op_infer_cache.h"
 
 namespace mindspore {
 namespace pynative {
@@ -55,6 +56,8 @@ struct OpExecInfo {
   py::tuple op_inputs;
   py::tuple inputs_mask;
   py::dict op_attrs;
+  // entry of the op infer cache for the call, nullptr if the call isn't cached
+  OpInferCacheEntryPtr infer_cache_entry;
 };
 using OpExecInfoPtr = std::shared_ptr<OpExecInfo>;
 OpExecInfoPtr GenerateOpExecInfo(const py::args &args);
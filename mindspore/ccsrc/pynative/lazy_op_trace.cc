@@ -0,0 +1,290 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pynative/lazy_op_trace.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "securec/include/securec.h"
+#include "ir/dtype.h"
+#include "ir/func_graph.h"
+#include "pipeline/static_analysis/abstract_value.h"
+#include "pre_activate/pass/const_input_to_attr_registry.h"
+#include "utils/convert_utils_base.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace pynative {
+namespace {
+// The trace runs when it reaches this number of ops
+constexpr size_t kMaxTraceOps = 64;
+// The cached graphs are dropped when there are more than this number of them
+constexpr size_t kMaxCachedGraphs = 256;
+
+// the cpu runtime only binds float32 and int32 tensors to graph inputs and outputs
+bool IsTraceableType(TypeId type_id) { return type_id == kNumberTypeFloat32 || type_id == kNumberTypeInt32; }
+
+void FlattenOutputs(const BaseRef &base_ref, std::vector<tensor::TensorPtr> *tensors) {
+  if (utils::isa<VectorRef>(base_ref)) {
+    auto ref_list = utils::cast<VectorRef>(base_ref);
+    for (size_t i = 0; i < ref_list.size(); ++i) {
+      FlattenOutputs(ref_list[i], tensors);
+    }
+    return;
+  }
+  if (!utils::isa<tensor::TensorPtr>(base_ref)) {
+    MS_LOG(EXCEPTION) << "The outputs of a lazy trace should be tensors, but got " << base_ref.ToString();
+  }
+  tensors->push_back(utils::cast<tensor::TensorPtr>(base_ref));
+}
+}  // namespace
+
+LazyOpTrace &LazyOpTrace::GetInstance() {
+  static LazyOpTrace instance;
+  return instance;
+}
+
+bool LazyOpTrace::CanRecord(const OpExecInfoPtr &op_exec_info, const std::shared_ptr<session::SessionBasic> &session) {
+  MS_EXCEPTION_IF_NULL(op_exec_info);
+  MS_EXCEPTION_IF_NULL(session);
+  // the value of the output is read by the next op, so its shape and dtype must be known without running
+  auto abstract = dyn_cast<abstract::AbstractTensor>(op_exec_info->abstract);
+  if (abstract == nullptr || abstract->element() == nullptr || abstract->shape() == nullptr) {
+    return false;
+  }
+  auto &shape = abstract->shape()->shape();
+  if (std::any_of(shape.begin(), shape.end(), [](int dim) { return dim < 0; })) {
+    return false;
+  }
+  auto type = abstract->element()->BuildType();
+  if (type == nullptr || !IsTraceableType(type->type_id())) {
+    return false;
+  }
+  std::vector<tensor::TensorPtr> input_tensors;
+  for (const auto &input : op_exec_info->op_inputs) {
+    if (!py::isinstance<tensor::Tensor>(input)) {
+      return false;
+    }
+    auto tensor = py::cast<tensor::TensorPtr>(input);
+    if (tensor == nullptr || !IsTraceableType(tensor->data_type())) {
+      return false;
+    }
+    input_tensors.push_back(tensor);
+  }
+  auto prim = op_exec_info->py_primitive;
+  MS_EXCEPTION_IF_NULL(prim);
+  // ops updating their inputs must run in order with the reads of these inputs
+  const auto &signatures = prim->signatures();
+  if (std::any_of(signatures.begin(), signatures.end(),
+                  [](const Signature &sig) { return sig.rw == SignatureEnumRW::kRWWrite; })) {
+    return false;
+  }
+  // the inputs of the traced ops are parameters of the graph, they can't become attributes
+  opt::ConstInputToAttrInfoRegister reg;
+  if (opt::ConstInputToAttrInfoRegistry::Instance().GetRegisterByOpName(op_exec_info->op_name, &reg)) {
+    return false;
+  }
+  return session->IsOpSupported(*op_exec_info, input_tensors);
+}
+
+bool LazyOpTrace::Record(const OpExecInfoPtr &op_exec_info, const std::shared_ptr<session::SessionBasic> &session,
+                        py::tuple *result) {
+  MS_EXCEPTION_IF_NULL(result);
+  if (!CanRecord(op_exec_info, session)) {
+    return false;
+  }
+  if (session_ != session || ops_.size() >= kMaxTraceOps) {
+    Flush();
+  }
+  if (session_ != session) {
+    // the cached graphs belong to the previous session
+    ReleaseGraphs();
+    session_ = session;
+  }
+
+  TracedOp op;
+  op.prim = op_exec_info->py_primitive;
+  op.abstract = op_exec_info->abstract;
+  for (const auto &input : op_exec_info->op_inputs) {
+    auto tensor = py::cast<tensor::TensorPtr>(input);
+    if (tensor->is_pending()) {
+      auto iter = producers_.find(tensor->pending_sync().get());
+      if (iter != producers_.end()) {
+        op.inputs.push_back(SizeToLong(iter->second));
+        continue;
+      }
+    }
+    auto iter = std::find(externals_.begin(), externals_.end(), tensor);
+    auto index = std::distance(externals_.begin(), iter);
+    if (iter == externals_.end()) {
+      externals_.push_back(tensor);
+    }
+    op.inputs.push_back(-1 - index);
+  }
+
+  auto abstract = op.abstract->cast<abstract::AbstractTensorPtr>();
+  auto output = std::make_shared<tensor::Tensor>(abstract->element()->BuildType()->type_id(),
+                                                 abstract->shape()->shape());
+  // copies of the output share the pending state, reading any of them runs the trace
+  auto pending_sync = std::make_shared<std::function<void()>>([]() { LazyOpTrace::GetInstance().Flush(); });
+  output->set_pending_sync(pending_sync);
+  producers_[pending_sync.get()] = ops_.size();
+  op.output = output;
+  ops_.push_back(std::move(op));
+  *result = py::make_tuple(output);
+  MS_LOG(DEBUG) << "Trace op " << op_exec_info->op_name << ", the trace has " << ops_.size() << " ops";
+  return true;
+}
+
+std::vector<int64_t> LazyOpTrace::EncodeKey(const std::vector<TracedOp> &ops,
+                                            const std::vector<tensor::TensorPtr> &externals,
+                                            const std::vector<size_t> &live) {
+  std::vector<int64_t> key;
+  key.push_back(SizeToLong(externals.size()));
+  for (const auto &tensor : externals) {
+    const auto &shape = tensor->shape_ref();
+    key.push_back(static_cast<int64_t>(tensor->data_type()));
+    key.push_back(SizeToLong(shape.size()));
+    key.insert(key.end(), shape.begin(), shape.end());
+  }
+  key.push_back(SizeToLong(ops.size()));
+  for (const auto &op : ops) {
+    key.push_back(static_cast<int64_t>(reinterpret_cast<uintptr_t>(op.prim.get())));
+    key.push_back(static_cast<int64_t>(op.prim->attrs_version()));
+    key.push_back(SizeToLong(op.inputs.size()));
+    key.insert(key.end(), op.inputs.begin(), op.inputs.end());
+  }
+  key.insert(key.end(), live.begin(), live.end());
+  return key;
+}
+
+GraphId LazyOpTrace::CompileTrace(const std::vector<TracedOp> &ops, const std::vector<tensor::TensorPtr> &externals,
+                                  const std::vector<size_t> &live) {
+  MS_EXCEPTION_IF_NULL(session_);
+  auto func_graph = std::make_shared<FuncGraph>();
+  // the parameters are created in order of first use, the order of the inputs of the kernel graph
+  AnfNodePtrList parameters;
+  for (const auto &tensor : externals) {
+    auto parameter = func_graph->add_parameter();
+    parameter->set_abstract(
+      std::make_shared<abstract::AbstractTensor>(TypeIdToType(tensor->data_type()), tensor->shape()));
+    parameters.push_back(parameter);
+  }
+  AnfNodePtrList nodes;
+  for (const auto &op : ops) {
+    std::vector<AnfNodePtr> inputs{NewValueNode(op.prim)};
+    for (auto input : op.inputs) {
+      inputs.push_back(input >= 0 ? nodes[LongToSize(input)] : parameters[LongToSize(-1 - input)]);
+    }
+    auto cnode = func_graph->NewCNode(inputs);
+    cnode->set_abstract(op.abstract);
+    nodes.push_back(cnode);
+  }
+  AnfNodePtrList outputs;
+  (void)std::transform(live.begin(), live.end(), std::back_inserter(outputs),
+                       [&nodes](size_t index) { return nodes[index]; });
+  auto graph_id = session_->CompileGraph(nodes, outputs);
+  session_->BuildGraph(graph_id);
+  compiled_++;
+  MS_LOG(INFO) << "Compile lazy trace of " << ops.size() << " ops into graph " << graph_id;
+  return graph_id;
+}
+
+void LazyOpTrace::Flush() {
+  if (ops_.empty()) {
+    return;
+  }
+  // take the trace, so that the tensors read while it runs don't run it again
+  std::vector<TracedOp> ops;
+  std::vector<tensor::TensorPtr> externals;
+  ops.swap(ops_);
+  externals.swap(externals_);
+  producers_.clear();
+  for (auto &op : ops) {
+    *op.output->pending_sync() = nullptr;
+  }
+  // an output is dropped if only the trace refers to it and its pending state
+  std::vector<size_t> live;
+  for (size_t i = 0; i < ops.size(); ++i) {
+    if (ops[i].output.use_count() > 1 || ops[i].output->pending_sync().use_count() > 1) {
+      live.push_back(i);
+    }
+  }
+  if (live.empty()) {
+    MS_LOG(DEBUG) << "Drop lazy trace of " << ops.size() << " ops, none of its outputs is used";
+    return;
+  }
+
+  auto key = EncodeKey(ops, externals, live);
+  auto iter = graphs_.find(key);
+  if (iter == graphs_.end()) {
+    if (graphs_.size() >= kMaxCachedGraphs) {
+      ReleaseGraphs();
+    }
+    CachedGraph graph;
+    graph.graph_id = CompileTrace(ops, externals, live);
+    (void)std::transform(ops.begin(), ops.end(), std::back_inserter(graph.prims),
+                         [](const TracedOp &op) { return op.prim; });
+    iter = graphs_.emplace(std::move(key), std::move(graph)).first;
+  }
+
+  // the runtime binds the inputs to its own addresses, they are restored after the run
+  std::vector<DeviceAddressPtr> addresses;
+  (void)std::transform(externals.begin(), externals.end(), std::back_inserter(addresses),
+                       [](const tensor::TensorPtr &tensor) { return tensor->device_address(); });
+  VectorRef outputs;
+  session_->RunGraph(iter->second.graph_id, externals, &outputs);
+  for (size_t i = 0; i < externals.size(); ++i) {
+    externals[i]->set_device_address(addresses[i]);
+  }
+
+  std::vector<tensor::TensorPtr> results;
+  FlattenOutputs(outputs, &results);
+  if (results.size() != live.size()) {
+    MS_LOG(EXCEPTION) << "The lazy trace has " << live.size() << " outputs, but its graph returned " << results.size();
+  }
+  for (size_t i = 0; i < live.size(); ++i) {
+    auto &output = ops[live[i]].output;
+    auto size = LongToSize(output->data().nbytes());
+    auto ret = memcpy_s(output->data_c(true), size, results[i]->data_c(false), size);
+    if (ret != EOK) {
+      MS_LOG(EXCEPTION) << "memcpy_s error, errorno " << ret;
+    }
+  }
+  MS_LOG(DEBUG) << "Run lazy trace of " << ops.size() << " ops, " << live.size() << " outputs are used";
+}
+
+void LazyOpTrace::ReleaseGraphs() {
+  if (session_ != nullptr) {
+    for (const auto &graph : graphs_) {
+      session_->ClearGraph(graph.second.graph_id);
+    }
+  }
+  graphs_.clear();
+}
+
+void LazyOpTrace::Clear() {
+  Flush();
+  ReleaseGraphs();
+  session_ = nullptr;
+  MS_LOG(INFO) << "Clear lazy op trace, " << compiled_ << " graphs were compiled";
+  compiled_ = 0;
+}
+}  // namespace pynative
+}  // namespace mindspore
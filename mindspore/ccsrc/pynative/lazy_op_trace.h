@@ -0,0 +1,98 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PYNATIVE_LAZY_OP_TRACE_H_
+#define MINDSPORE_CCSRC_PYNATIVE_LAZY_OP_TRACE_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "pybind11/pybind11.h"
+#include "ir/tensor.h"
+#include "pynative/base.h"
+#include "session/session_basic.h"
+
+namespace mindspore {
+namespace pynative {
+namespace py = pybind11;
+
+// Trace of the single ops of PyNative lazy mode.
+// A traced op doesn't run, it returns a tensor whose value is still to be computed. The traced ops run together as
+// one graph compiled by the session when such a value is read, before an op that can't be traced runs, or when the
+// trace gets long. Only the outputs that are still referenced out of the trace are kept by the graph. The graphs
+// are cached by the primitives, attributes and input shapes of the traced ops, so the body of a loop compiles once.
+// The input tensors that are not computed by the trace are read when the trace runs, not when the op is called.
+class LazyOpTrace {
+ public:
+  static LazyOpTrace &GetInstance();
+
+  // Trace an op instead of running it.
+  // return false if the op can't be traced, it must then run eagerly after a Flush
+  bool Record(const OpExecInfoPtr &op_exec_info, const std::shared_ptr<session::SessionBasic> &session,
+              py::tuple *result);
+
+  // Run the traced ops and fill the tensors they returned
+  void Flush();
+
+  // Flush, then drop the cached graphs, they belong to the session
+  void Clear();
+
+  size_t size() const { return ops_.size(); }
+  size_t compiled() const { return compiled_; }
+
+ private:
+  struct TracedOp {
+    PrimitivePyPtr prim;
+    AbstractBasePtr abstract;
+    // index of the traced op that computes the input if >= 0, else -1 - index of the input in the external tensors
+    std::vector<int64_t> inputs;
+    tensor::TensorPtr output;
+  };
+
+  struct CachedGraph {
+    GraphId graph_id;
+    // keeps the primitives alive, so that their addresses in the key are not reused by other primitives
+    std::vector<PrimitivePyPtr> prims;
+  };
+
+  LazyOpTrace() = default;
+  ~LazyOpTrace() = default;
+
+  static bool CanRecord(const OpExecInfoPtr &op_exec_info, const std::shared_ptr<session::SessionBasic> &session);
+  static std::vector<int64_t> EncodeKey(const std::vector<TracedOp> &ops,
+                                        const std::vector<tensor::TensorPtr> &externals,
+                                        const std::vector<size_t> &live);
+  GraphId CompileTrace(const std::vector<TracedOp> &ops, const std::vector<tensor::TensorPtr> &externals,
+                       const std::vector<size_t> &live);
+  // drop the cached graphs and free them in the session
+  void ReleaseGraphs();
+
+  std::shared_ptr<session::SessionBasic> session_;
+  std::vector<TracedOp> ops_;
+  // input tensors of the traced ops that are not computed by the trace, in order of first use
+  std::vector<tensor::TensorPtr> externals_;
+  // traced op computing a tensor, by the pending state shared by the copies of the tensor
+  std::unordered_map<const void *, size_t> producers_;
+  std::map<std::vector<int64_t>, CachedGraph> graphs_;
+  size_t compiled_{0};
+};
+}  // namespace pynative
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PYNATIVE_LAZY_OP_TRACE_H_
@@ -0,0 +1,200 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pynative/op_infer_cache.h"
+
+#include <cstring>
+#include <iterator>
+
+#include "ir/tensor.h"
+#include "ir/dtype.h"
+#include "utils/hashing.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace pynative {
+namespace {
+// Tags of the inputs in a key
+enum InputTag : int64_t { kTagTensor = 1, kTagBool, kTagInt, kTagFloat, kTagNone, kTagType, kTagTuple, kTagList };
+
+// Position of the primitive attributes version in a key
+constexpr size_t kAttrsVersionIndex = 1;
+// Depth of the nested tuples and lists accepted in inputs
+constexpr size_t kMaxInputDepth = 2;
+// The least recently used entry is dropped when the cache has this number of entries
+constexpr size_t kMaxEntries = 4096;
+}  // namespace
+
+OpInferCache &OpInferCache::GetInstance() {
+  static OpInferCache instance;
+  return instance;
+}
+
+bool OpInferCache::EncodeInput(const py::handle &input, size_t depth) {
+  if (py::isinstance<tensor::Tensor>(input)) {
+    auto tensor = py::cast<tensor::Tensor *>(input);
+    MS_EXCEPTION_IF_NULL(tensor);
+    const auto &shape = tensor->shape_ref();
+    key_.push_back(kTagTensor);
+    key_.push_back(static_cast<int64_t>(tensor->data_type()));
+    key_.push_back(static_cast<int64_t>(shape.size()));
+    key_.insert(key_.end(), shape.begin(), shape.end());
+    return true;
+  }
+  // bool is a subclass of int in python, check it first
+  if (py::isinstance<py::bool_>(input)) {
+    key_.push_back(kTagBool);
+    key_.push_back(input.ptr() == Py_True ? 1 : 0);
+    return true;
+  }
+  if (py::isinstance<py::int_>(input)) {
+    int overflow = 0;
+    int64_t value = PyLong_AsLongLongAndOverflow(input.ptr(), &overflow);
+    if (overflow != 0 || (value == -1 && PyErr_Occurred() != nullptr)) {
+      PyErr_Clear();
+      return false;
+    }
+    key_.push_back(kTagInt);
+    key_.push_back(value);
+    return true;
+  }
+  if (py::isinstance<py::float_>(input)) {
+    double value = PyFloat_AsDouble(input.ptr());
+    int64_t bits = 0;
+    static_assert(sizeof(bits) == sizeof(value), "double is expected to be 64 bits");
+    (void)memcpy(&bits, &value, sizeof(bits));
+    key_.push_back(kTagFloat);
+    key_.push_back(bits);
+    return true;
+  }
+  if (input.is_none()) {
+    key_.push_back(kTagNone);
+    return true;
+  }
+  if (py::isinstance<Type>(input)) {
+    auto type = py::cast<Type *>(input);
+    MS_EXCEPTION_IF_NULL(type);
+    if (!type->isa<Number>()) {
+      return false;
+    }
+    key_.push_back(kTagType);
+    key_.push_back(static_cast<int64_t>(type->type_id()));
+    return true;
+  }
+  bool is_tuple = py::isinstance<py::tuple>(input);
+  if ((is_tuple || py::isinstance<py::list>(input)) && depth < kMaxInputDepth) {
+    auto seq = py::reinterpret_borrow<py::sequence>(input);
+    key_.push_back(is_tuple ? kTagTuple : kTagList);
+    key_.push_back(static_cast<int64_t>(seq.size()));
+    for (auto item : seq) {
+      if (!EncodeInput(item, depth + 1)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  return false;
+}
+
+bool OpInferCache::EncodeKey(const PrimitivePyPtr &prim, const py::tuple &inputs) {
+  key_.clear();
+  key_.push_back(static_cast<int64_t>(reinterpret_cast<uintptr_t>(prim.get())));
+  key_.push_back(static_cast<int64_t>(prim->attrs_version()));
+  key_.push_back(static_cast<int64_t>(inputs.size()));
+  for (auto input : inputs) {
+    if (!EncodeInput(input, 0)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t OpInferCache::HashKey(const std::vector<int64_t> &key) {
+  size_t hash = 0;
+  for (auto value : key) {
+    hash = hash_combine(hash, std::hash<int64_t>{}(value));
+  }
+  return hash;
+}
+
+OpInferCacheEntryPtr OpInferCache::Find(const PrimitivePyPtr &prim, const py::tuple &inputs) {
+  MS_EXCEPTION_IF_NULL(prim);
+  key_valid_ = EncodeKey(prim, inputs);
+  if (!key_valid_) {
+    return nullptr;
+  }
+  auto range = entries_.equal_range(HashKey(key_));
+  for (auto iter = range.first; iter != range.second; ++iter) {
+    auto lru_iter = iter->second;
+    if ((*lru_iter)->key != key_) {
+      continue;
+    }
+    if ((*lru_iter)->prim.expired()) {
+      // prim took the address of a released primitive
+      Erase(lru_iter);
+      break;
+    }
+    lru_.splice(lru_.begin(), lru_, lru_iter);
+    hits_++;
+    return *lru_iter;
+  }
+  misses_++;
+  return nullptr;
+}
+
+OpInferCacheEntryPtr OpInferCache::Insert(const PrimitivePyPtr &prim, const AbstractBasePtr &abstract) {
+  MS_EXCEPTION_IF_NULL(prim);
+  if (!key_valid_ || abstract == nullptr) {
+    return nullptr;
+  }
+  key_valid_ = false;
+  if (lru_.size() >= kMaxEntries) {
+    Erase(std::prev(lru_.end()));
+  }
+  // the inference may have added attributes to the primitive, the entry is valid for the attributes it left
+  key_[kAttrsVersionIndex] = static_cast<int64_t>(prim->attrs_version());
+  auto entry = std::make_shared<OpInferCacheEntry>();
+  entry->prim = prim;
+  entry->key = key_;
+  entry->abstract = abstract->Clone();
+  lru_.push_front(entry);
+  (void)entries_.emplace(HashKey(key_), lru_.begin());
+  return entry;
+}
+
+void OpInferCache::Erase(std::list<OpInferCacheEntryPtr>::iterator lru_iter) {
+  auto range = entries_.equal_range(HashKey((*lru_iter)->key));
+  for (auto iter = range.first; iter != range.second; ++iter) {
+    if (iter->second == lru_iter) {
+      (void)entries_.erase(iter);
+      break;
+    }
+  }
+  (void)lru_.erase(lru_iter);
+}
+
+void OpInferCache::Clear() {
+  if (hits_ + misses_ != 0) {
+    MS_LOG(INFO) << "Op infer cache hits: " << hits_ << ", misses: " << misses_ << ", entries: " << lru_.size();
+  }
+  entries_.clear();
+  lru_.clear();
+  key_valid_ = false;
+  hits_ = 0;
+  misses_ = 0;
+}
+}  // namespace pynative
+}  // namespace mindspore
@@ -0,0 +1,91 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PYNATIVE_OP_INFER_CACHE_H_
+#define MINDSPORE_CCSRC_PYNATIVE_OP_INFER_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "pybind11/pybind11.h"
+#include "ir/primitive.h"
+#include "pipeline/static_analysis/abstract_value.h"
+
+namespace mindspore {
+namespace pynative {
+namespace py = pybind11;
+
+// Result of the inference of one kind of single op call
+struct OpInferCacheEntry {
+  // the key holds the address of the primitive, an entry whose primitive was released never matches since another
+  // primitive may have been allocated at that address. The entry doesn't keep the primitive alive.
+  std::weak_ptr<PrimitivePy> prim;
+  std::vector<int64_t> key;
+  AbstractBasePtr abstract;
+  // key of the single op graph in the session, filled on the first run of the op
+  std::string graph_info;
+};
+using OpInferCacheEntryPtr = std::shared_ptr<OpInferCacheEntry>;
+
+// Cache of the abstract inferred for the single ops run in PyNative mode.
+// A call is identified by its primitive, the version of the primitive attributes, the dtype and shape of its tensor
+// inputs and the value of its scalar inputs. The key is encoded into a buffer that is reused from call to call, so a
+// lookup doesn't allocate. Calls with inputs of any other kind are not cached. The least recently used entries are
+// dropped when the cache is full.
+class OpInferCache {
+ public:
+  static OpInferCache &GetInstance();
+
+  // Look up a call. On a miss, the key of the call is kept for the following Insert.
+  // return the entry of the call, nullptr on a miss or if the call can't be cached
+  OpInferCacheEntryPtr Find(const PrimitivePyPtr &prim, const py::tuple &inputs);
+
+  // Add the abstract inferred for the call that was last looked up and missed.
+  // return the new entry, nullptr if the call can't be cached
+  OpInferCacheEntryPtr Insert(const PrimitivePyPtr &prim, const AbstractBasePtr &abstract);
+
+  void Clear();
+
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+  size_t size() const { return lru_.size(); }
+
+ private:
+  OpInferCache() = default;
+  ~OpInferCache() = default;
+
+  bool EncodeKey(const PrimitivePyPtr &prim, const py::tuple &inputs);
+  bool EncodeInput(const py::handle &input, size_t depth);
+  static size_t HashKey(const std::vector<int64_t> &key);
+  void Erase(std::list<OpInferCacheEntryPtr>::iterator lru_iter);
+
+  // entries, most recently used first
+  std::list<OpInferCacheEntryPtr> lru_;
+  std::unordered_multimap<size_t, std::list<OpInferCacheEntryPtr>::iterator> entries_;
+  // key of the last call looked up, valid if key_valid_
+  std::vector<int64_t> key_;
+  bool key_valid_{false};
+  size_t hits_{0};
+  size_t misses_{0};
+};
+}  // namespace pynative
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PYNATIVE_OP_INFER_CACHE_H_
@@ -39,6 +39,8 @@
 #include "pipeline/action.h"
 
 #include "pynative/base.h"
+#include "pynative/op_infer_cache.h"
+#include "pynative/lazy_op_trace.h"
 #include "pybind_api/api_register.h"
 #include "vm/transform.h"
 
@@ -196,9 +198,17 @@ OpExecInfoPtr GenerateOpExecInfo(const py::args &args) {
   op_exec_info->op_inputs = py::tuple(input_num);
 
   ConvertInputs(prim, args[PY_INPUTS], &op_exec_info->op_inputs);
-  // use python infer method
+  // use python infer method, unless the same kind of call was inferred before
   if (ignore_infer_prim.find(op_exec_info->op_name) == ignore_infer_prim.end()) {
-    PynativeInfer(prim, op_exec_info->op_inputs, op_exec_info.get());
+    auto &infer_cache = OpInferCache::GetInstance();
+    auto entry = infer_cache.Find(prim, op_exec_info->op_inputs);
+    if (entry != nullptr) {
+      op_exec_info->abstract = entry->abstract->Clone();
+    } else {
+      PynativeInfer(prim, op_exec_info->op_inputs, op_exec_info.get());
+      entry = infer_cache.Insert(prim, op_exec_info->abstract);
+    }
+    op_exec_info->infer_cache_entry = entry;
   }
   op_exec_info->py_primitive = prim;
   op_exec_info->op_attrs = py::getattr(args[PY_PRIM], "attrs");
@@ -210,18 +220,27 @@ OpExecInfoPtr GenerateOpExecInfo(const py::args &args) {
   return op_exec_info;
 }
 
+void AppendInputInfo(const py::handle &input, std::string *graph_info) {
+  if (py::isinstance<tensor::Tensor>(input)) {
+    auto tensor_ptr = py::cast<tensor::TensorPtr>(input);
+    (void)graph_info->append(tensor_ptr->GetShapeAndDataTypeInfo() + "_");
+  } else if (py::isinstance<py::tuple>(input) || py::isinstance<py::list>(input)) {
+    for (const auto &item : py::reinterpret_borrow<py::sequence>(input)) {
+      AppendInputInfo(item, graph_info);
+    }
+  } else {
+    // the other inputs become constants or attributes of the graph
+    (void)graph_info->append(std::string(py::str(input)) + "_");
+  }
+}
+
 std::string GetSingleOpGraphInfo(const OpExecInfoPtr &op_exec_info,
                                  const std::vector<tensor::TensorPtr> &input_tensors) {
   MS_EXCEPTION_IF_NULL(op_exec_info);
   std::string graph_info;
   // get input tensor info
-  size_t input_num = op_exec_info->op_inputs.size();
-  for (size_t index = 0; index < input_num; ++index) {
-    auto input = op_exec_info->op_inputs[index];
-    if (py::isinstance<tensor::Tensor>(input)) {
-      auto tensor_ptr = py::cast<tensor::TensorPtr>(input);
-      (void)graph_info.append(tensor_ptr->GetShapeAndDataTypeInfo() + "_");
-    }
+  for (const auto &input : op_exec_info->op_inputs) {
+    AppendInputInfo(input, &graph_info);
   }
   // get prim and abstract info
   MS_EXCEPTION_IF_NULL(op_exec_info->abstract);
@@ -421,14 +440,11 @@ void EraseValueNodeTensor(const std::vector<int> &tensors_mask, std::vector<tens
   *input_tensors = new_input_tensors;
 }
 
-py::object RunOpInMs(const OpExecInfoPtr &op_exec_info, PynativeStatusCode *status) {
-  MS_EXCEPTION_IF_NULL(op_exec_info);
-  MS_LOG(INFO) << "Start run op[" << op_exec_info->op_name << "] with backend policy ms";
+std::shared_ptr<session::SessionBasic> GetSession() {
   auto ms_context = MsContext::GetInstance();
   MS_EXCEPTION_IF_NULL(ms_context);
-  ms_context->set_enable_pynative_infer(true);
   std::string device_target = ms_context->device_target();
-  if (device_target != kAscendDevice && device_target != kGPUDevice) {
+  if (device_target != kAscendDevice && device_target != kGPUDevice && device_target != kCPUDevice) {
     MS_EXCEPTION(ArgumentError) << "Device target [" << device_target << "] is not supported in Pynative mode";
   }
 
@@ -437,12 +453,35 @@ py::object RunOpInMs(const OpExecInfoPtr &op_exec_info, PynativeStatusCode *stat
   }
   MS_EXCEPTION_IF_NULL(session);
   session->Init(ms_context->device_id());
+  return session;
+}
 
+py::object RunOpInMs(const OpExecInfoPtr &op_exec_info, PynativeStatusCode *status) {
+  MS_EXCEPTION_IF_NULL(op_exec_info);
+  MS_LOG(INFO) << "Start run op[" << op_exec_info->op_name << "] with backend policy ms";
+  auto ms_context = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(ms_context);
+  ms_context->set_enable_pynative_infer(true);
+  (void)GetSession();
+  std::string device_target = ms_context->device_target();
   std::vector<tensor::TensorPtr> input_tensors;
   std::vector<int> tensors_mask;
   ConstructInputTensor(op_exec_info, &tensors_mask, &input_tensors);
-  // get graph info for checking it whether existing in the cache
-  std::string graph_info = GetSingleOpGraphInfo(op_exec_info, input_tensors);
+  if (!session->IsOpSupported(*op_exec_info, input_tensors)) {
+    MS_LOG(INFO) << "Op[" << op_exec_info->op_name << "] is not supported by the " << device_target << " backend";
+    ms_context->set_enable_pynative_infer(false);
+    *status = PYNATIVE_OP_NOT_IMPLEMENTED_ERR;
+    py::tuple err_ret(0);
+    return std::move(err_ret);
+  }
+  // get graph info for checking it whether existing in the cache, it only depends on the inputs of the op infer cache
+  // key, so it is computed once for each entry of the cache
+  auto &entry = op_exec_info->infer_cache_entry;
+  if (entry != nullptr && entry->graph_info.empty()) {
+    entry->graph_info = GetSingleOpGraphInfo(op_exec_info, input_tensors);
+  }
+  const std::string graph_info =
+    entry != nullptr ? entry->graph_info : GetSingleOpGraphInfo(op_exec_info, input_tensors);
   session->BuildOp(*op_exec_info, graph_info, input_tensors, tensors_mask);
   EraseValueNodeTensor(tensors_mask, &input_tensors);
   py::tuple result = session->RunOp(*op_exec_info, graph_info, input_tensors);
@@ -477,6 +516,10 @@ py::object RunOpWithBackendPolicy(MsBackendPolicy backend_policy, const OpExecIn
       // use Ms fisrt,use others when ms failed
       MS_LOG(INFO) << "RunOp use Ms first backend";
       result = RunOpInMs(op_exec_info, status);
+      if (*status == PYNATIVE_OP_NOT_IMPLEMENTED_ERR) {
+        MS_LOG(INFO) << "RunOp use VM backend for op " << op_exec_info->op_name;
+        result = RunOpInVM(op_exec_info, status);
+      }
       if (*status != PYNATIVE_SUCCESS) {
         MS_LOG(ERROR) << "RunOp use Ms backend failed!!!";
       }
@@ -578,6 +621,16 @@ py::tuple RunOp(const py::args &args) {
   if (vm_operators.find(op_exec_info->op_name) != vm_operators.end()) {
     backend_policy = kMsBackendVmOnly;
   }
+  auto &lazy_trace = LazyOpTrace::GetInstance();
+  if (ms_context->enable_pynative_lazy() && backend_policy == kMsBackendMsPrior &&
+      ms_context->device_target() == kCPUDevice && !PynativeExecutor::GetInstance()->grad_flag()) {
+    py::tuple lazy_result;
+    if (lazy_trace.Record(op_exec_info, GetSession(), &lazy_result)) {
+      return lazy_result;
+    }
+  }
+  // the op runs now, after the ops traced before it
+  lazy_trace.Flush();
   result = RunOpWithBackendPolicy(backend_policy, op_exec_info, &status);
   if (status != PYNATIVE_SUCCESS) {
     MS_LOG(ERROR) << "Failed to run " << op_exec_info->op_name;
@@ -593,7 +646,13 @@ py::tuple RunOp(const py::args &args) {
   return result;
 }
 
-void ClearPyNativeSession() { session = nullptr; }
+void ClearPyNativeSession() {
+  // the traced ops run and their graphs are dropped with the session
+  LazyOpTrace::GetInstance().Clear();
+  session = nullptr;
+  // the cached graph infos refer to graphs of the session
+  OpInferCache::GetInstance().Clear();
+}
 
 PynativeExecutor::~PynativeExecutor() { Clean(); }
 
@@ -843,6 +902,7 @@ void PynativeExecutor::Clean() {
 }
 
 py::object PynativeExecutor::Run(const py::tuple &args, const py::object &phase) {
+  LazyOpTrace::GetInstance().Flush();
   VectorRef arg_list;
   pipeline::ProcessVmArgInner(args, resource_, &arg_list);
   if (resource_->results().find(pipeline::kOutput) == resource_->results().end() ||
@@ -892,7 +952,9 @@ REGISTER_PYBIND_DEFINE(PynativeExecutor_, ([](const py::module *m) {
                            .def("__call__", &PynativeExecutor::Run, py::arg("args"), py::arg("phase") = py::str(""),
                                 "Executor run function.")
                            .def("set_grad_flag", &PynativeExecutor::set_grad_flag, py::arg("flag") = py::bool_(false),
-                                "Executor set grad flag.");
+                                "Executor set grad flag.")
+                           .def_static("lazy_trace_compiled", []() { return LazyOpTrace::GetInstance().compiled(); },
+                                       "Number of graphs compiled by the lazy op trace.");
                        }));
 }  // namespace pynative
 }  // namespace mindspore
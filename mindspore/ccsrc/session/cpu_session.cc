@@ -16,6 +16,8 @@
 
 #include "session/cpu_session.h"
 #include <algorithm>
+#include <iterator>
+#include <string>
 #include "ir/tensor.h"
 #include "ir/anf.h"
 #include "kernel/kernel.h"
@@ -25,9 +27,39 @@
 #include "predict/predict.h"
 #include "kernel/cpu/cpu_kernel_factory.h"
 #include "device/cpu/kernel_select_cpu.h"
+#include "pre_activate/common/optimizer.h"
+#include "pre_activate/common/pass_manager.h"
+#include "pre_activate/mem_reuse/mem_aware_order.h"
+#include "pre_activate/pass/communication_op_fusion.h"
+#include "pre_activate/pass/rematerialization.h"
+#include "utils/context/ms_context.h"
 
 namespace mindspore {
 namespace session {
+namespace {
+constexpr double kGBToByte = 1024.0 * 1024.0 * 1024.0;
+
+// dtypes of the outputs of an op inferred as a tensor or a tuple of tensors
+bool GetInferredOutputTypes(const AbstractBasePtr &abstract, std::vector<TypeId> *output_types) {
+  MS_EXCEPTION_IF_NULL(output_types);
+  if (abstract == nullptr) {
+    return false;
+  }
+  AbstractBasePtrList elements{abstract};
+  if (abstract->isa<abstract::AbstractTuple>()) {
+    elements = abstract->cast<abstract::AbstractTuplePtr>()->elements();
+  }
+  for (const auto &element : elements) {
+    auto tensor = dyn_cast<abstract::AbstractTensor>(element);
+    if (tensor == nullptr || tensor->element() == nullptr || tensor->element()->BuildType() == nullptr) {
+      return false;
+    }
+    output_types->push_back(tensor->element()->BuildType()->type_id());
+  }
+  return true;
+}
+}  // namespace
+
 ParameterPtr CPUSession::CreateNewParameterFromParameter(const AnfNodePtr &anf, bool valid_input, KernelGraph *graph) {
   MS_EXCEPTION_IF_NULL(anf);
   if (!anf->isa<Parameter>()) {
@@ -49,16 +81,54 @@ GraphId CPUSession::CompileGraph(const AnfNodePtrList &lst, const AnfNodePtrList
   auto graph_id = graph_sum_;
   auto graph = ConstructKernelGraph(lst, outputs);
   MS_EXCEPTION_IF_NULL(graph);
+  auto context_ptr = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context_ptr);
+  if (context_ptr->remat_memory_budget() > 0) {
+    MS_LOG(INFO) << "Rematerialize activations";
+    Rematerialize(graph, context_ptr->remat_memory_budget());
+  }
   MS_LOG(INFO) << "Set kernel info";
   SetKernelInfo(graph.get());
+  FuseAllReduce(graph);
   predictmodel::StepConvertGraph(graph);
   MS_LOG(INFO) << "Build kernel";
   BuildKernel(graph.get());
+  if (context_ptr->enable_mem_aware_order()) {
+    MS_LOG(INFO) << "Reorder kernels for memory";
+    (void)memreuse::ReorderForMemory(graph.get());
+  }
   MS_LOG(INFO) << "Assign kernel address";
   runtime_.AssignKernelAddress(graph.get());
   return graph_id;
 }
 
+void CPUSession::Rematerialize(const std::shared_ptr<KernelGraph> &kernel_graph, float memory_budget) {
+  auto optimizer = std::make_shared<opt::GraphOptimizer>();
+  auto pm = std::make_shared<opt::PassManager>();
+  // the budget is in GB
+  auto budget = static_cast<size_t>(static_cast<double>(memory_budget) * kGBToByte);
+  pm->AddPass(std::make_shared<opt::Rematerialization>(budget));
+  optimizer->AddPassManager(pm);
+  (void)optimizer->Optimize(kernel_graph);
+}
+
+void CPUSession::FuseAllReduce(const std::shared_ptr<KernelGraph> &kernel_graph) {
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  auto &kernel_nodes = kernel_graph->execution_order();
+  if (std::none_of(kernel_nodes.begin(), kernel_nodes.end(), [](const CNodePtr &node) {
+        return AnfAlgo::GetCNodeName(node) == kHostAllReduceOpName;
+      })) {
+    return;
+  }
+  // the gradients are fused into the buckets of the split indices of the parallel context, or into one bucket
+  auto optimizer = std::make_shared<opt::GraphOptimizer>();
+  auto pm = std::make_shared<opt::PassManager>();
+  pm->AddPass(std::make_shared<opt::HostAllReduceFusion>());
+  optimizer->AddPassManager(pm);
+  (void)optimizer->Optimize(kernel_graph);
+  kernel_graph->SetExecOrderByDefault();
+}
+
 void CPUSession::RunGraph(const GraphId &graph_id, const std::vector<tensor::TensorPtr> &inputs, VectorRef *outputs) {
   auto &kernel_graph = graphs_[graph_id];
   MS_EXCEPTION_IF_NULL(kernel_graph);
@@ -76,6 +146,84 @@ void CPUSession::RunGraph(const GraphId &graph_id, const std::vector<tensor::Ten
   MS_LOG(INFO) << "Run graph end";
 }
 
+void CPUSession::ClearGraph(GraphId graph_id) {
+  if (graphs_.erase(graph_id) != 0) {
+    runtime_.ClearGraphRuntimeResource(graph_id);
+  }
+}
+
+bool CPUSession::IsOpSupported(const OpRunInfo &op_run_info,
+                               const std::vector<tensor::TensorPtr> &input_tensors) const {
+  auto &factory = kernel::CPUKernelFactory::GetInstance();
+  if (!factory.IsRegistered(op_run_info.op_name)) {
+    return false;
+  }
+  // the kernel selected by BuildOp must be registered for the dtypes of the inputs and of the inferred outputs, the
+  // outputs are not checked when they are not tensors
+  std::vector<TypeId> input_types;
+  (void)std::transform(input_tensors.begin(), input_tensors.end(), std::back_inserter(input_types),
+                       [](const tensor::TensorPtr &tensor) { return tensor->data_type(); });
+  std::vector<TypeId> output_types;
+  if (!GetInferredOutputTypes(op_run_info.abstract, &output_types)) {
+    output_types.clear();
+  }
+  kernel::KernelBuildInfo::KernelBuildInfoBuilder builder;
+  builder.SetInputsFormat(std::vector<std::string>(input_types.size(), kOpFormat_DEFAULT));
+  builder.SetInputsDeviceType(input_types);
+  builder.SetOutputsFormat(std::vector<std::string>(output_types.size(), kOpFormat_DEFAULT));
+  builder.SetOutputsDeviceType(output_types);
+  if (!factory.CPUKernelAttrCheck(op_run_info.op_name, *builder.Build()).first) {
+    MS_LOG(INFO) << "No CPU kernel of op " << op_run_info.op_name << " for the dtypes of its inputs and outputs";
+    return false;
+  }
+  return true;
+}
+
+void CPUSession::BuildOp(const OpRunInfo &op_run_info, const GraphInfo &graph_info,
+                         const std::vector<tensor::TensorPtr> &input_tensors, const std::vector<int> &tensors_mask) {
+  // the single op graphs are kept, the op runs again on inputs of the same shapes without being built again
+  if (run_op_graphs_.find(graph_info) != run_op_graphs_.end()) {
+    MS_LOG(INFO) << "Build op " << op_run_info.op_name << " graph cache has existed !";
+    return;
+  }
+  MS_LOG(INFO) << "Build op " << op_run_info.op_name << " start !";
+  auto kernel_graph = ConstructSingleOpGraph(op_run_info, input_tensors, tensors_mask);
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  SetKernelInfo(kernel_graph.get());
+  BuildKernel(kernel_graph.get());
+  runtime_.RunOpAssignKernelAddress(kernel_graph.get());
+  run_op_graphs_[graph_info] = kernel_graph;
+  MS_LOG(INFO) << "Build op " << op_run_info.op_name << " finish !";
+}
+
+py::tuple CPUSession::RunOp(const OpRunInfo &op_run_info, const GraphInfo &graph_info,
+                            const std::vector<tensor::TensorPtr> &input_tensors) {
+  auto iter = run_op_graphs_.find(graph_info);
+  if (iter == run_op_graphs_.end()) {
+    MS_LOG(EXCEPTION) << "Op " << op_run_info.op_name << " is not built";
+  }
+  auto &kernel_graph = iter->second;
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  MS_LOG(INFO) << "Run op " << op_run_info.op_name << " start!";
+  VectorRef outputs;
+  runtime_.BindInputOutput(kernel_graph.get(), input_tensors, &outputs);
+  bool ret = runtime_.Run(kernel_graph.get());
+  runtime_.UnbindInput(kernel_graph.get(), input_tensors);
+  if (!ret) {
+    MS_LOG(EXCEPTION) << "Run op " << op_run_info.op_name << " failed";
+  }
+  // trans output to tuple
+  auto output_tensors = TransformBaseRefListToTuple(outputs);
+  if (!utils::isa<PyObjectRef>(output_tensors) ||
+      !py::isinstance<py::tuple>(utils::cast<PyObjectRef>(output_tensors).object_)) {
+    MS_LOG(EXCEPTION) << "The output tensors should be a tuple !";
+  }
+  py::object tuple_obj = utils::cast<PyObjectRef>(output_tensors).object_;
+  py::tuple tuple_tensors = py::cast<py::tuple>(tuple_obj);
+  MS_LOG(INFO) << "Run op " << op_run_info.op_name << " finish!";
+  return tuple_tensors;
+}
+
 void CPUSession::SetKernelInfo(const KernelGraph *kernel_graph) {
   MS_EXCEPTION_IF_NULL(kernel_graph);
   auto &kernel_nodes = kernel_graph->execution_order();
@@ -34,11 +34,19 @@ class CPUSession : public SessionBasic {
   }
   GraphId CompileGraph(const AnfNodePtrList &lst, const AnfNodePtrList &outputs) override;
   void RunGraph(const GraphId &graph_id, const std::vector<tensor::TensorPtr> &inputs, VectorRef *outputs) override;
+  void ClearGraph(GraphId graph_id) override;
+  bool IsOpSupported(const OpRunInfo &op_run_info, const std::vector<tensor::TensorPtr> &input_tensors) const override;
+  void BuildOp(const OpRunInfo &op_run_info, const GraphInfo &graph_info,
+               const std::vector<tensor::TensorPtr> &input_tensors, const std::vector<int> &tensors_mask) override;
+  py::tuple RunOp(const OpRunInfo &op_run_info, const GraphInfo &graph_info,
+                  const std::vector<tensor::TensorPtr> &input_tensors) override;
 
  protected:
   ParameterPtr CreateNewParameterFromParameter(const AnfNodePtr &anf, bool valid_input, KernelGraph *graph) override;
 
  private:
+  void Rematerialize(const std::shared_ptr<KernelGraph> &kernel_graph, float memory_budget);
+  void FuseAllReduce(const std::shared_ptr<KernelGraph> &kernel_graph);
   void SetKernelInfo(const KernelGraph *kernel_graph);
   void BuildKernel(const KernelGraph *kernel_graph);
   device::cpu::CPUKernelRuntime runtime_;
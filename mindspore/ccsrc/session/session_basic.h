@@ -63,8 +63,15 @@ class SessionBasic {
   // build graph, used to handle multiple child graphs
   virtual void BuildGraph(GraphId) {}
 
+  // free a compiled graph, its id must not be run again
+  virtual void ClearGraph(GraphId) {}
+
   virtual void RunGraph(const GraphId &graph_id, const std::vector<tensor::TensorPtr> &inputs, VectorRef *outputs) = 0;
 
+  // whether the session has a kernel for the op and the dtypes of its inputs, ops it doesn't support are run by the
+  // VM in PyNative mode
+  virtual bool IsOpSupported(const OpRunInfo &, const std::vector<tensor::TensorPtr> &) const { return true; }
+
   virtual void BuildOp(const OpRunInfo &, const GraphInfo &, const std::vector<tensor::TensorPtr> &input_tensors,
                        const std::vector<int> &tensors_mask) {}
 
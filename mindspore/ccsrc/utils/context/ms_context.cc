@@ -81,6 +81,11 @@ MsContext::MsContext(const std::string &policy, const std::string &target) {
   profiling_mode_ = false;
   profiling_options_ = "training_trace";
   check_bprop_flag_ = false;
+  enable_pynative_lazy_ = false;
+  enable_compile_profile_ = false;
+  enable_mem_aware_order_ = false;
+  remat_memory_budget_ = 0;
+  mem_reuse_planner_ = kBestFitPlanner;
 }
 
 std::shared_ptr<MsContext> MsContext::GetInstance() {
@@ -140,6 +145,15 @@ bool MsContext::set_device_target(const std::string &target) {
   return true;
 }
 
+bool MsContext::set_mem_reuse_planner(const std::string &mem_reuse_planner) {
+  if (kMemReusePlannerSet.find(mem_reuse_planner) == kMemReusePlannerSet.end()) {
+    MS_LOG(ERROR) << "invalid memory reuse planner name: " << mem_reuse_planner;
+    return false;
+  }
+  mem_reuse_planner_ = mem_reuse_planner;
+  return true;
+}
+
 bool MsContext::set_device_id(uint32_t device_id) {
   device_id_ = device_id;
   MS_LOG(INFO) << "ms set context device id:" << device_id;
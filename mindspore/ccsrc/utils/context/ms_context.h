@@ -44,6 +44,9 @@ const char kAscendDevice[] = "Ascend";
 const char kDavinciDevice[] = "Davinci";
 const char KNpuLog[] = "_npu_log";
 const std::set<std::string> kTargetSet = {kCPUDevice, kGPUDevice, kAscendDevice, kDavinciDevice};
+const char kBestFitPlanner[] = "best_fit";
+const char kGreedyBySizePlanner[] = "greedy_by_size";
+const std::set<std::string> kMemReusePlannerSet = {kBestFitPlanner, kGreedyBySizePlanner};
 
 class MsContext {
  public:
@@ -142,6 +145,16 @@ class MsContext {
   std::string profiling_options() const { return profiling_options_; }
   bool check_bprop_flag() const { return check_bprop_flag_; }
   void set_check_bprop_flag(bool check_bprop_flag) { check_bprop_flag_ = check_bprop_flag; }
+  bool enable_pynative_lazy() const { return enable_pynative_lazy_; }
+  void set_enable_pynative_lazy(bool enable_pynative_lazy) { enable_pynative_lazy_ = enable_pynative_lazy; }
+  bool enable_compile_profile() const { return enable_compile_profile_; }
+  void set_enable_compile_profile(bool enable_compile_profile) { enable_compile_profile_ = enable_compile_profile; }
+  bool enable_mem_aware_order() const { return enable_mem_aware_order_; }
+  void set_enable_mem_aware_order(bool enable_mem_aware_order) { enable_mem_aware_order_ = enable_mem_aware_order; }
+  float remat_memory_budget() const { return remat_memory_budget_; }
+  void set_remat_memory_budget(float remat_memory_budget) { remat_memory_budget_ = remat_memory_budget; }
+  std::string mem_reuse_planner() const { return mem_reuse_planner_; }
+  bool set_mem_reuse_planner(const std::string &mem_reuse_planner);
 
  private:
   MsContext(const std::string &backend_policy, const std::string &target);
@@ -182,6 +195,11 @@ class MsContext {
   bool profiling_mode_;
   std::string profiling_options_;
   bool check_bprop_flag_;
+  bool enable_pynative_lazy_;
+  bool enable_compile_profile_;
+  bool enable_mem_aware_order_;
+  float remat_memory_budget_;
+  std::string mem_reuse_planner_;
 };
 
 }  // namespace mindspore
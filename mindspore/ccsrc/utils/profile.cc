@@ -25,6 +25,7 @@
 #include <list>
 #include <utility>
 #include <cfloat>
+#include "nlohmann/json.hpp"
 #include "utils/log_adapter.h"
 
 namespace mindspore {
@@ -335,8 +336,8 @@ static void PrintTimeStat(std::ostringstream &oss, const TimeInfoGroup &group, c
 
 void MsProfile::Print() {
   GetProfile()->Print();
-  std::vector<std::string> items = {"substitution.",          "renormalize.", "replace.", "match.",
-                                    "func_graph_cloner_run.", "meta_graph.",  "manager."};
+  std::vector<std::string> items = {"substitution.", "renormalize.",           "replace.",   "match.",
+                                    "infer.",        "func_graph_cloner_run.", "meta_graph.", "manager."};
   std::vector<TimeInfoGroup> groups(items.size() + 1);
   const auto &stat = GetSingleton().time_stat_;
   // group all time infos
@@ -363,4 +364,159 @@ void MsProfile::Print() {
   (void)fflush(stdout);
 }
 
+CompileProfiler &CompileProfiler::GetInstance() {
+  static CompileProfiler instance;
+  return instance;
+}
+
+void CompileProfiler::Start(const std::string &phase) {
+  phase_ = phase;
+  steps_.clear();
+  substitutions_.clear();
+  finished_substitutions_.clear();
+  total_time_ = 0.0;
+  start_time_ = GetTime();
+  active_ = true;
+}
+
+void CompileProfiler::Finish(const std::string &file_path) {
+  if (!active_) {
+    return;
+  }
+  total_time_ = GetTime() - start_time_;
+  finished_substitutions_ = SubstitutionTotals();
+  substitutions_.clear();
+  active_ = false;
+  std::ofstream file_out(file_path, std::ios::trunc | std::ios::out);
+  if (!file_out.is_open()) {
+    MS_LOG(ERROR) << "Open file " << file_path << " failed, the compile profile of " << phase_ << " is not saved.";
+    return;
+  }
+  file_out << ToJson() << std::endl;
+  file_out.close();
+  MS_LOG(INFO) << "Save the compile profile of " << phase_ << " to " << file_path << ", compile time " << total_time_
+               << "s.";
+}
+
+void CompileProfiler::AddStep(const CompileStep &step) {
+  if (active_) {
+    steps_.push_back(step);
+  }
+}
+
+void CompileProfiler::WatchSubstitution(const std::string &name, const SubstitutionStatPtr &stat) {
+  if (!active_ || stat == nullptr || substitutions_.count(stat.get()) != 0) {
+    return;
+  }
+  substitutions_[stat.get()] = WatchedSubstitution{name, stat, *stat};
+}
+
+std::map<std::string, SubstitutionStat> CompileProfiler::SubstitutionTotals() const {
+  // the runs in the compile, summed over the substitutions of the same name
+  std::map<std::string, SubstitutionStat> totals;
+  for (const auto &iter : substitutions_) {
+    auto &watched = iter.second;
+    if (watched.stat->tries == watched.start.tries) {
+      continue;
+    }
+    auto &total = totals[watched.name];
+    total.tries += watched.stat->tries - watched.start.tries;
+    total.hits += watched.stat->hits - watched.start.hits;
+    total.time += watched.stat->time - watched.start.time;
+  }
+  return totals;
+}
+
+std::string CompileProfiler::ToJson() const {
+  nlohmann::json json;
+  json["phase"] = phase_;
+  json["time"] = total_time_;
+  json["steps"] = nlohmann::json::array();
+  for (const auto &step : steps_) {
+    nlohmann::json item;
+    item["group"] = step.group;
+    item["name"] = step.name;
+    item["round"] = step.round;
+    item["time"] = step.time;
+    item["nodes_before"] = step.nodes_before;
+    item["nodes_after"] = step.nodes_after;
+    item["memory_before_kb"] = step.memory_before;
+    item["memory_after_kb"] = step.memory_after;
+    json["steps"].push_back(item);
+  }
+  auto substitutions = active_ ? SubstitutionTotals() : finished_substitutions_;
+  json["substitutions"] = nlohmann::json::array();
+  for (const auto &iter : substitutions) {
+    nlohmann::json item;
+    item["name"] = iter.first;
+    item["tries"] = iter.second.tries;
+    item["hits"] = iter.second.hits;
+    item["time"] = iter.second.time;
+    json["substitutions"].push_back(item);
+  }
+  return json.dump(2);
+}
+
+int64_t CompileProfiler::GetMemoryUsage() {
+  // the second field of statm is the number of resident pages
+  std::ifstream statm("/proc/self/statm");
+  int64_t size = 0;
+  int64_t resident = 0;
+  if (!(statm >> size >> resident)) {
+    return -1;
+  }
+  return resident * sysconf(_SC_PAGESIZE) / 1024;
+}
+
+CompileProfileGuard::CompileProfileGuard(bool enable, const std::string &phase, const std::string &file_path)
+    : enable_(enable), file_path_(file_path) {
+  if (enable_) {
+    CompileProfiler::GetInstance().Start(phase);
+  }
+}
+
+CompileProfileGuard::~CompileProfileGuard() {
+  if (!enable_) {
+    return;
+  }
+  try {
+    CompileProfiler::GetInstance().Finish(file_path_);
+  } catch (const std::exception &e) {
+    MS_LOG(ERROR) << "Save compile profile to " << file_path_ << " failed: " << e.what();
+  } catch (...) {
+    MS_LOG(ERROR) << "Save compile profile to " << file_path_ << " failed.";
+  }
+}
+
+CompileStepRecorder::CompileStepRecorder(const std::string &group, const std::string &name, int round,
+                                         const std::function<size_t()> &count_nodes)
+    : active_(CompileProfiler::GetInstance().active()) {
+  if (!active_) {
+    return;
+  }
+  count_nodes_ = count_nodes;
+  step_.group = group;
+  step_.name = name;
+  step_.round = round;
+  step_.nodes_before = count_nodes_ == nullptr ? 0 : count_nodes_();
+  step_.memory_before = CompileProfiler::GetMemoryUsage();
+  step_.time = GetTime();
+}
+
+CompileStepRecorder::~CompileStepRecorder() {
+  if (!active_) {
+    return;
+  }
+  try {
+    step_.time = GetTime() - step_.time;
+    step_.nodes_after = count_nodes_ == nullptr ? 0 : count_nodes_();
+    step_.memory_after = CompileProfiler::GetMemoryUsage();
+    CompileProfiler::GetInstance().AddStep(step_);
+  } catch (const std::exception &e) {
+    MS_LOG(ERROR) << "Record compile step " << step_.name << " failed: " << e.what();
+  } catch (...) {
+    MS_LOG(ERROR) << "Record compile step " << step_.name << " failed.";
+  }
+}
+
 }  // namespace mindspore
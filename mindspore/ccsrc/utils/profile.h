@@ -17,11 +17,15 @@
 #ifndef MINDSPORE_CCSRC_UTILS_PROFILE_H_
 #define MINDSPORE_CCSRC_UTILS_PROFILE_H_
 
+#include <cstdint>
+#include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
+#include <vector>
 #include "utils/log_adapter.h"
 
 namespace mindspore {
@@ -223,6 +227,98 @@ class MsProfile {
   ProfileBase *profile_ = nullptr;             // record hierarchical profile info
 };
 
+// A step of a compile: an action of the pipeline or a pass of an optimizer
+struct CompileStep {
+  // "action" or the name of the optimizer
+  std::string group;
+  std::string name;
+  int round = 0;
+  double time = 0.0;
+  size_t nodes_before = 0;
+  size_t nodes_after = 0;
+  // resident memory of the process in KB
+  int64_t memory_before = 0;
+  int64_t memory_after = 0;
+};
+
+// Statistics of the runs of a substitution of the optimizer, the substitution updates them and both its debug dump
+// and the compile profile read them
+struct SubstitutionStat {
+  size_t tries = 0;
+  size_t hits = 0;
+  double time = 0.0;
+};
+using SubstitutionStatPtr = std::shared_ptr<SubstitutionStat>;
+
+// Records of a compile, available without ENABLE_PROFILE. When the compile profile is enabled in the context, the
+// steps and the time of the substitutions of each compile are written as a json file.
+class CompileProfiler {
+ public:
+  static CompileProfiler &GetInstance();
+
+  // start recording a compile, the records of the previous compile are dropped
+  void Start(const std::string &phase);
+  // stop recording and write the records to the file
+  void Finish(const std::string &file_path);
+  bool active() const { return active_; }
+
+  void AddStep(const CompileStep &step);
+  // report the runs of the substitution from now on
+  void WatchSubstitution(const std::string &name, const SubstitutionStatPtr &stat);
+  std::string ToJson() const;
+
+  // return the resident memory of the process in KB, or -1 if it can't be read
+  static int64_t GetMemoryUsage();
+
+ private:
+  struct WatchedSubstitution {
+    std::string name;
+    SubstitutionStatPtr stat;
+    // the statistics when the substitution was first watched in the compile
+    SubstitutionStat start;
+  };
+
+  CompileProfiler() = default;
+  ~CompileProfiler() = default;
+  std::map<std::string, SubstitutionStat> SubstitutionTotals() const;
+
+  bool active_{false};
+  std::string phase_;
+  double start_time_{0.0};
+  double total_time_{0.0};
+  std::vector<CompileStep> steps_;
+  std::map<const SubstitutionStat *, WatchedSubstitution> substitutions_;
+  std::map<std::string, SubstitutionStat> finished_substitutions_;
+};
+
+// Record the compile of a phase over the scope of the guard, the profile is written even if the compile throws
+class CompileProfileGuard {
+ public:
+  CompileProfileGuard(bool enable, const std::string &phase, const std::string &file_path);
+  ~CompileProfileGuard();
+  CompileProfileGuard(const CompileProfileGuard &) = delete;
+  CompileProfileGuard &operator=(const CompileProfileGuard &) = delete;
+
+ private:
+  bool enable_;
+  std::string file_path_;
+};
+
+// Record a step of the compile over the scope of the recorder, if the compile profiler is active
+class CompileStepRecorder {
+ public:
+  CompileStepRecorder(const std::string &group, const std::string &name, int round,
+                      const std::function<size_t()> &count_nodes);
+  ~CompileStepRecorder();
+  CompileStepRecorder(const CompileStepRecorder &) = delete;
+  CompileStepRecorder &operator=(const CompileStepRecorder &) = delete;
+
+ private:
+  bool active_;
+  std::function<size_t()> count_nodes_;
+  CompileStep step_;
+};
+
 }  // namespace mindspore
 
 #ifdef ENABLE_PROFILE
@@ -332,6 +332,55 @@ class _Context:
     def check_bprop(self, check_bprop_flag):
         self._context_handle.set_check_bprop_flag(check_bprop_flag)
 
+    @property
+    def enable_pynative_lazy(self):
+        return self._context_handle.get_enable_pynative_lazy()
+
+    @enable_pynative_lazy.setter
+    def enable_pynative_lazy(self, enable_pynative_lazy):
+        self._context_handle.set_enable_pynative_lazy(enable_pynative_lazy)
+
+    @property
+    def enable_compile_profile(self):
+        return self._context_handle.get_enable_compile_profile()
+
+    @enable_compile_profile.setter
+    def enable_compile_profile(self, enable_compile_profile):
+        self._context_handle.set_enable_compile_profile(enable_compile_profile)
+
+    @property
+    def enable_mem_aware_order(self):
+        return self._context_handle.get_enable_mem_aware_order()
+
+    @enable_mem_aware_order.setter
+    def enable_mem_aware_order(self, enable_mem_aware_order):
+        self._context_handle.set_enable_mem_aware_order(enable_mem_aware_order)
+
+    @property
+    def remat_memory_budget(self):
+        budget = self._context_handle.get_remat_memory_budget()
+        return str(budget) + "GB" if budget > 0 else None
+
+    @remat_memory_budget.setter
+    def remat_memory_budget(self, remat_memory_budget):
+        if remat_memory_budget is None:
+            self._context_handle.set_remat_memory_budget(0)
+            return
+        if not check_input_format(remat_memory_budget):
+            raise ValueError("Context param remat_memory_budget should be in correct format! Such as \"5GB\"")
+        self._context_handle.set_remat_memory_budget(float(remat_memory_budget[:-2]))
+
+    @property
+    def mem_reuse_planner(self):
+        return self._context_handle.get_mem_reuse_planner()
+
+    @mem_reuse_planner.setter
+    def mem_reuse_planner(self, planner):
+        success = self._context_handle.set_mem_reuse_planner(planner)
+        if not success:
+            raise ValueError("Memory reuse planner should be 'best_fit' or 'greedy_by_size', "
+                             "but got {}".format(planner))
+
 def check_input_format(x):
     import re
     pattern = r'[1-9][0-9]*(\.)?[0-9]*GB|0\.[0-9]*GB'
@@ -367,7 +416,8 @@ def _context():
 
 
 @args_type_check(device_num=int, global_rank=int, mirror_mean=bool, cast_before_mirror=bool, parallel_mode=str,
-                 parameter_broadcast=bool, strategy_ckpt_load_file=str, strategy_ckpt_save_file=str)
+                 parameter_broadcast=bool, strategy_ckpt_load_file=str, strategy_ckpt_save_file=str,
+                 strategy_cache_dir=str)
 def set_auto_parallel_context(**kwargs):
     """
     Set auto parallel context.
@@ -404,6 +454,9 @@ def set_auto_parallel_context(**kwargs):
                        broadcast. Default: False.
         strategy_ckpt_load_file (str): The path to load parallel strategy checkpoint. Default: ''
         strategy_ckpt_save_file (str): The path to save parallel strategy checkpoint. Default: ''
+        strategy_cache_dir (str): The directory to cache the strategies searched by "auto_parallel", so that the
+                       next launches of the same network on the same devices skip the strategy search. The
+                       strategies are cached in memory only if it is empty. Default: ''
 
     Raises:
         ValueError: If input key is not attribute in auto parallel context.
@@ -417,6 +470,7 @@ def set_auto_parallel_context(**kwargs):
         >>> context.set_auto_parallel_context(parameter_broadcast=False)
         >>> context.set_auto_parallel_context(strategy_ckpt_load_file="./strategy_stage1.ckpt")
         >>> context.set_auto_parallel_context(strategy_ckpt_save_file="./strategy_stage1.ckpt")
+        >>> context.set_auto_parallel_context(strategy_cache_dir="./strategy_cache")
     """
     _set_auto_parallel_context(**kwargs)
 
@@ -449,6 +503,7 @@ def reset_auto_parallel_context():
     - parameter_broadcast: False.
     - strategy_ckpt_load_file: "".
     - strategy_ckpt_save_file: "".
+    - strategy_cache_dir: "".
     """
     _reset_auto_parallel_context()
 
@@ -457,7 +512,9 @@ def reset_auto_parallel_context():
                  save_graphs_path=str, save_ms_model=bool, save_ms_model_path=str, enable_dump=bool,
                  save_dump_path=str, enable_reduce_precision=bool, variable_memory_max_size=str,
                  enable_profiling=bool, profiling_options=str, enable_auto_mixed_precision=bool,
-                 check_bprop=bool)
+                 check_bprop=bool, enable_pynative_lazy=bool, enable_compile_profile=bool,
+                 enable_mem_aware_order=bool, remat_memory_budget=str,
+                 mem_reuse_planner=str)
 def set_context(**kwargs):
     """
     Sets context for running environment.
@@ -509,6 +566,19 @@ def set_context(**kwargs):
             separated by colons; single operator can choose op_trace, op_trace cannot be combined with
             training_trace and task_trace. Default: "training_trace".
         check_bprop (bool): Whether to check bprop. Default: False.
+        enable_pynative_lazy (bool): Whether to record PyNative ops instead of running them one by one, and to run
+            the recorded ops as one compiled graph when a result is read. Only supported on CPU. Default: False.
+        enable_compile_profile (bool): Whether to save the time, node count and memory of each step of a graph
+            compile as a json file named compile_profile_{phase}.json in `save_graphs_path`. Default: False.
+        enable_mem_aware_order (bool): Whether to reorder the kernels of a graph to lower the peak of the memory held
+            by their outputs and workspaces. Only supported on CPU. Default: False.
+        remat_memory_budget (str): Sets the memory budget of the activations kept from the forward to the backward
+            pass, such as "0.5GB". Cheap activations above the budget are recomputed in the backward pass instead.
+            Only supported on CPU. Default: None, no activation is recomputed.
+        mem_reuse_planner (str): Sets the planner of the reused memory of a graph, "best_fit" assigns the offsets in
+            execution order, "greedy_by_size" assigns them from the lifetimes of the whole graph, largest tensors
+            first. With `save_graphs`, the lifetimes and the footprint are saved as mem_reuse_intervals_{graph_id}.txt
+            in `save_graphs_path`. Default: "best_fit".
 
     Raises:
         ValueError: If input key is not an attribute in context.
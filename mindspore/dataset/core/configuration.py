@@ -125,6 +125,67 @@ class ConfigurationManager:
         """
         return self.config.get_num_parallel_workers()
 
+    def set_epoch_pipelining(self, enable):
+        """
+        Set whether the source operators under a repeat start the next epoch while the current one is still
+        draining through the pipeline.
+
+        Without epoch pipelining, a source waits at the end of every epoch until the repeat operator has received
+        its end of epoch and reset it, so the whole pipeline empties out between epochs. With it, the source
+        resets itself and starts sampling and reading the next epoch right away, at most one epoch ahead of the
+        repeat operator. The data and the order of every epoch are the same in both modes.
+
+        Args:
+            enable (bool): Whether to pipeline epochs.
+
+        Raises:
+            TypeError: If enable is not a boolean.
+
+        Examples:
+            >>> import mindspore.dataset as ds
+            >>> con = ds.engine.ConfigurationManager()
+            >>> # overlap the end of an epoch with the start of the next one
+            >>> con.set_epoch_pipelining(True)
+        """
+        if not isinstance(enable, bool):
+            raise TypeError("enable should be a boolean.")
+        self.config.set_epoch_pipelining(enable)
+
+    def get_epoch_pipelining(self):
+        """
+        Get whether epoch pipelining is enabled.
+
+        Returns:
+            Bool, True if the source operators start the next epoch without waiting for the repeat operator.
+        """
+        return self.config.get_epoch_pipelining()
+
+    def get_gil_wait_stats(self):
+        """
+        Get the time that the dataset operators calling into python spent waiting for the python GIL.
+
+        A wait time close to the run time means that the python parts of the pipeline are serialized on the GIL,
+        and more parallel workers will not help.
+
+        Returns:
+            Dict, maps the name of the operator (e.g. GeneratorOp, PyFuncOp) to a tuple of the total wait time in
+            seconds and the number of times the GIL was taken.
+
+        Examples:
+            >>> import mindspore.dataset as ds
+            >>> con = ds.engine.ConfigurationManager()
+            >>> # wait time and acquisitions of the python functions run by map
+            >>> wait_seconds, acquisitions = con.get_gil_wait_stats().get("PyFuncOp", (0.0, 0))
+        """
+        stats = cde.GilMonitor.get_instance().get_stats()
+        return {name: (wait_us / 1e6, acquisitions) for name, (wait_us, acquisitions) in stats.items()}
+
+    def reset_gil_wait_stats(self):
+        """
+        Clear the GIL wait time counted so far.
+        """
+        cde.GilMonitor.get_instance().reset()
+
     def __str__(self):
         """
         String representation of the configurations.
@@ -156,7 +217,8 @@ class ConfigurationManager:
             >>> #     "numParallelWorkers": 4,
             >>> #     "workerConnectorSize": 16,
             >>> #     "opConnectorSize": 16,
-            >>> #     "seed": 5489
+            >>> #     "seed": 5489,
+            >>> #     "epochPipelining": false
             >>> # }
         """
         self.config.load(file)
@@ -39,6 +39,7 @@ from mindspore._c_expression import typing
 from mindspore import log as logger
 from . import samplers
 from .iterators import DictIterator, TupleIterator
+from .predicates import Predicate
 from .validators import check_batch, check_shuffle, check_map, check_filter, check_repeat, check_skip, check_zip, \
     check_rename, \
     check_take, check_project, check_imagefolderdatasetv2, check_mnist_cifar_dataset, check_manifestdataset, \
@@ -479,9 +480,12 @@ class Dataset:
              If input_columns not provided or empty, all columns will be used.
 
         Args:
-            predicate(callable): python callable which returns a boolean value, if False then filter the element.
+            predicate(callable or Predicate): python callable which returns a boolean value, if False then
+                filter the element. A predicate from mindspore.dataset.engine.predicates is evaluated in C++
+                over whole buffers instead, without calling into Python.
             input_columns: (list[str], optional): List of names of the input columns, when
                 default=None, the predicate will be applied on all columns in the dataset.
+                Ignored by predicates from mindspore.dataset.engine.predicates, which name their columns.
             num_parallel_workers (int, optional): Number of workers to process the Dataset
                 in parallel (default=None).
 
@@ -493,6 +497,9 @@ class Dataset:
             >>> # generator data(0 ~ 63)
             >>> # filter the data that greater than or equal to 11
             >>> dataset_f = dataset.filter(predicate=lambda data: data < 11, input_columns = ["data"])
+            >>> # the same filter, evaluated in C++
+            >>> from mindspore.dataset.engine import predicates
+            >>> dataset_f = dataset.filter(predicate=predicates.value_between("data", max_value=10))
         """
         return FilterDataset(self, predicate, input_columns, num_parallel_workers)
 
@@ -953,7 +960,7 @@ class Dataset:
 
         return TransferDataset(self, queue_name, device_id, device_type, num_batch)
 
-    def create_tuple_iterator(self, columns=None):
+    def create_tuple_iterator(self, columns=None, state=None):
         """
         Create an Iterator over the dataset. The data retrieved will be a list of ndarray of data.
 
@@ -963,6 +970,9 @@ class Dataset:
         Args:
             columns (list[str], optional): List of columns to be used to specify the order of columns
                 (defaults=None, means all columns).
+            state (dict, optional): Position returned by get_state of an iterator over the same pipeline,
+                the iterator starts from there without reading the rows before it (default=None, start from
+                the first row).
 
         Returns:
             Iterator, list of ndarray.
@@ -977,15 +987,20 @@ class Dataset:
             >>>     # convert the returned tuple to a list and print
             >>>     print(list(item))
         """
-        return TupleIterator(self, columns)
+        return TupleIterator(self, columns, state)
 
-    def create_dict_iterator(self):
+    def create_dict_iterator(self, state=None):
         """
         Create an Iterator over the dataset.
 
         The data retrieved will be a dictionary. The order
         of the columns in the dictionary may not be the same as the original order.
 
+        Args:
+            state (dict, optional): Position returned by get_state of an iterator over the same pipeline,
+                the iterator starts from there without reading the rows before it (default=None, start from
+                the first row).
+
         Returns:
             Iterator, dictionary of column_name-ndarray pair.
 
@@ -998,9 +1013,12 @@ class Dataset:
             >>> for item in iterator:
             >>>     # print the data in column1
             >>>     print(item["column1"])
+            >>> # resume from a position saved by a previous iterator
+            >>> state = iterator.get_state()
+            >>> iterator = data.create_dict_iterator(state=state)
 
         """
-        return DictIterator(self)
+        return DictIterator(self, state)
 
     def __iter__(self):
         """Create an Iterator over the dataset."""
@@ -1846,7 +1864,8 @@ class FilterDataset(DatasetOp):
 
     Args:
         input_dataset: Input Dataset to be mapped.
-        predicate: python callable which returns a boolean value, if False then filter the element.
+        predicate (callable or Predicate): python callable which returns a boolean value, if False then filter the
+            element, or a predicate evaluated in C++.
         input_columns: (list[str]): List of names of the input columns, when
         default=None, the predicate will be applied all columns in the dataset.
         num_parallel_workers (int, optional): Number of workers to process the Dataset
@@ -1855,7 +1874,10 @@ class FilterDataset(DatasetOp):
 
     def __init__(self, input_dataset, predicate, input_columns=None, num_parallel_workers=None):
         super().__init__(num_parallel_workers)
-        self.predicate = lambda *args: bool(predicate(*args))
+        if isinstance(predicate, Predicate):
+            self.predicate = predicate
+        else:
+            self.predicate = lambda *args: bool(predicate(*args))
         self.input.append(input_dataset)
         input_dataset.output.append(self)
         if input_columns is not None and not isinstance(input_columns, list):
@@ -1864,7 +1886,7 @@ class FilterDataset(DatasetOp):
 
     def get_args(self):
         args = super().get_args()
-        args["predicate"] = self.predicate
+        args["predicate"] = self.predicate.create() if isinstance(self.predicate, Predicate) else self.predicate
         args["input_columns"] = self.input_columns
         return args
 
@@ -2165,10 +2187,10 @@ class TransferDataset(DatasetOp):
         args["num_batch"] = self.__num_batch
         return args
 
-    def create_dict_iterator(self):
+    def create_dict_iterator(self, state=None):
         raise RuntimeError("TransferDataset is not iterable")
 
-    def create_tuple_iterator(self, columns=None):
+    def create_tuple_iterator(self, columns=None, state=None):
         raise RuntimeError("TransferDataset is not iterable")
 
     def __iter__(self):
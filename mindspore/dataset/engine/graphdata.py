@@ -21,7 +21,7 @@ from mindspore._c_dataengine import Graph
 from mindspore._c_dataengine import Tensor
 
 from .validators import check_gnn_graphdata, check_gnn_get_all_nodes, check_gnn_get_all_neighbors, \
-    check_gnn_get_node_feature
+    check_gnn_get_node_feature, check_gnn_save_snapshot
 
 
 class GraphData:
@@ -29,7 +29,7 @@ class GraphData:
     Reads the graph dataset used for GNN training from the shared file and database.
 
     Args:
-        dataset_file (str): One of file names in dataset.
+        dataset_file (str): One of file names in dataset, or a snapshot written by `save_snapshot`.
         num_parallel_workers (int, optional): Number of workers to process the Dataset in parallel
             (default=None).
     """
@@ -111,3 +111,23 @@ class GraphData:
         if isinstance(node_list, list):
             node_list = np.array(node_list, dtype=np.int32)
         return [t.as_array() for t in self._graph.get_node_feature(Tensor(node_list), feature_types)]
+
+    @check_gnn_save_snapshot
+    def save_snapshot(self, snapshot_file):
+        """
+        Save the loaded graph to a binary snapshot. Passing the snapshot as `dataset_file` later loads the graph
+        without reading the MindRecord dataset again.
+
+        Args:
+            snapshot_file (str): The path of the snapshot to be written.
+
+        Examples:
+            >>> import mindspore.dataset as ds
+            >>> data_graph = ds.GraphData('dataset_file', 2)
+            >>> data_graph.save_snapshot('dataset_file.snapshot')
+            >>> data_graph = ds.GraphData('dataset_file.snapshot', 2)
+
+        Raises:
+            TypeError: If `snapshot_file` is not str.
+        """
+        self._graph.save_snapshot(snapshot_file)
@@ -78,15 +78,66 @@ def _alter_node(node):
     return node
 
 
+# Transforms without the Random prefix that draw random numbers
+_RANDOM_TRANSFORMS = ("CutOut", "Cutout", "MixUp", "UniformAugment")
+
+
+def _is_random_transform(operation):
+    """Check if a transform of a map draws random numbers, the draws of the skipped rows would not be replayed."""
+    name = operation.__class__.__name__
+    if name.startswith("Random") or name in _RANDOM_TRANSFORMS:
+        return True
+    return any(_is_random_transform(op) for op in getattr(operation, "transforms", []))
+
+
+def _get_resumable_source(dataset):
+    """
+    Check that a pipeline can start from a saved position, and return its source dataset, its batch size and the
+    number of epochs of its source (None if repeated forever).
+
+    Sources sampled by a sampler skip the rows before the position without reading them. Above them, only the
+    operations that keep one row for each row of their input are allowed, the batch being after the repeat.
+    Random transforms are rejected since their random numbers would not be where they were at the position.
+    """
+    batch_size = 1
+    num_epochs = 1
+    repeated = False
+    node = dataset
+    while node.input:
+        if isinstance(node, de.BatchDataset):
+            if repeated or batch_size != 1 or not isinstance(node.batch_size, int):
+                raise ValueError("Resumable pipeline can only have one batch with a fixed size after the repeat.")
+            batch_size = node.batch_size
+        elif isinstance(node, de.RepeatDataset):
+            repeated = True
+            num_epochs = None if num_epochs is None or node.count == -1 else num_epochs * node.count
+        elif isinstance(node, de.MapDataset):
+            random_ops = [op.__class__.__name__ for op in node.operations if _is_random_transform(op)]
+            if random_ops:
+                raise ValueError("Random transform {} can not be in a resumable pipeline.".format(random_ops[0]))
+        elif not isinstance(node, (de.ProjectDataset, de.RenameDataset, de.TransferDataset)):
+            raise ValueError("{} can not be in a resumable pipeline.".format(node.__class__.__name__))
+        node = node.input[0]
+    if isinstance(node, (de.TFRecordDataset, de.TextFileDataset, de.MindDataset, de.GeneratorDataset)):
+        # resuming would silently start them again from their first row
+        raise ValueError("{} can not be the source of a resumable pipeline, the file and row offsets of the "
+                         "streaming sources are not saved in the state.".format(node.__class__.__name__))
+    if not isinstance(node, (de.ImageFolderDatasetV2, de.MnistDataset, de.ManifestDataset, de.Cifar10Dataset,
+                             de.Cifar100Dataset, de.VOCDataset, de.CelebADataset)):
+        raise ValueError("{} can not be the source of a resumable pipeline.".format(node.__class__.__name__))
+    return node, batch_size, num_epochs
+
+
 class Iterator:
     """
     General Iterator over a dataset.
 
     Attributes:
         dataset: Dataset to be iterated over
+        state: Position to start from, returned by get_state (default=None, start from the first row)
     """
 
-    def __init__(self, dataset):
+    def __init__(self, dataset, state=None):
         ITERATORS_LIST.append(weakref.ref(self))
         # create a copy of tree and work on it.
         self.dataset = copy.deepcopy(dataset)
@@ -100,9 +151,26 @@ class Iterator:
 
         root = self.__convert_node_postorder(self.dataset)
         self.depipeline.AssignRootNode(root)
+        self._start_rows = 0
+        if state is not None:
+            self.__set_start_position(state)
         self.depipeline.LaunchTreeExec()
         self._index = 0
 
+    def __set_start_position(self, state):
+        """Make the pipeline start from a position returned by get_state, the rows before it are not read."""
+        if not isinstance(state, dict) or "rows" not in state or "rows_per_epoch" not in state:
+            raise TypeError("state should be a dict returned by get_state.")
+        source, _, num_epochs = _get_resumable_source(self.dataset)
+        rows_per_epoch = source.get_dataset_size()
+        if state["rows_per_epoch"] != rows_per_epoch:
+            raise ValueError("state was saved with {} rows per epoch, the dataset has {}."
+                             .format(state["rows_per_epoch"], rows_per_epoch))
+        if num_epochs is not None and state["rows"] >= num_epochs * rows_per_epoch:
+            raise ValueError("state is past the end of the dataset.")
+        self._start_rows = state["rows"]
+        self.depipeline.SetStartPosition(self._start_rows // rows_per_epoch, self._start_rows % rows_per_epoch)
+
     def __is_tree_node(self, node):
         """Check if a node is tree node."""
         if not node.input:
@@ -233,6 +301,21 @@ class Iterator:
         self._index += 1
         return data
 
+    def get_state(self):
+        """
+        Get the position of the iterator, to resume later from there without reading the rows before it.
+
+        Only the pipelines of a source sampled by a sampler (ImageFolderDatasetV2, MnistDataset, ManifestDataset,
+        Cifar10Dataset, Cifar100Dataset, VOCDataset, CelebADataset) followed by map, project, rename, repeat and at
+        most one batch with a fixed size after the repeat have a position. The maps can not use random transforms,
+        and python functions given to map should not draw random numbers either.
+
+        Returns:
+            Dict, the position, to be given to create_dict_iterator or create_tuple_iterator.
+        """
+        source, batch_size, _ = _get_resumable_source(self.dataset)
+        return {"rows": self._start_rows + self._index * batch_size, "rows_per_epoch": source.get_dataset_size()}
+
     def get_output_shapes(self):
         return [t for t in self.depipeline.GetOutputShapes()]
 
@@ -279,12 +362,12 @@ class TupleIterator(Iterator):
     The derived class of Iterator with list type.
     """
 
-    def __init__(self, dataset, columns=None):
+    def __init__(self, dataset, columns=None, state=None):
         if columns is not None:
             if not isinstance(columns, list):
                 columns = [columns]
             dataset = dataset.project(columns)
-        super().__init__(dataset)
+        super().__init__(dataset, state)
 
     def __iter__(self):
         return self
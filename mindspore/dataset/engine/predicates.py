@@ -0,0 +1,147 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+"""
+Predicates module provides simple filter predicates that are evaluated in C++,
+over a whole buffer of rows at once, without calling into Python.
+There are following predicates: length_between, value_between, value_in.
+Predicates can be combined with the & operator, the rows must satisfy all of them.
+"""
+
+import numbers
+
+import mindspore._c_dataengine as cde
+
+_INT64_MIN = -2 ** 63
+_INT64_MAX = 2 ** 63 - 1
+
+
+def _is_int64(value):
+    """Whether value is an integer that fits in int64, such values are compared exactly in C++."""
+    return isinstance(value, numbers.Integral) and _INT64_MIN <= value <= _INT64_MAX
+
+
+class Predicate:
+    """
+    A filter predicate evaluated in C++, to be passed to Dataset.filter instead of a python callable.
+
+    Use length_between, value_between and value_in to create one. Columns are given by name,
+    the input_columns argument of filter is ignored.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>> from mindspore.dataset.engine import predicates
+        >>> # keep the sentences of 1 to 128 bytes whose label is 0 or 2
+        >>> pred = predicates.length_between("text", 1, 128) & predicates.value_in("label", [0, 2])
+        >>> data = data.filter(predicate=pred, num_parallel_workers=4)
+    """
+
+    def __init__(self, clauses):
+        self.clauses = list(clauses)
+
+    def __and__(self, other):
+        if not isinstance(other, Predicate):
+            return NotImplemented
+        return Predicate(self.clauses + other.clauses)
+
+    def create(self):
+        """Create the C++ object of the predicate."""
+        predicate = cde.FilterPredicate()
+        for clause in self.clauses:
+            kind, column, args = clause
+            if kind == "length":
+                predicate.add_length_range(column, args[0], args[1])
+            elif kind == "range":
+                predicate.add_value_range(column, args[0], args[1])
+            elif kind == "integer_range":
+                predicate.add_integer_range(column, args[0], args[1])
+            elif kind == "in":
+                predicate.add_value_in(column, args)
+            elif kind == "integer_in":
+                predicate.add_integer_in(column, args)
+            else:
+                predicate.add_string_in(column, args)
+        return predicate
+
+
+def length_between(column, min_len=0, max_len=None):
+    """
+    Keep the rows whose column has a length in [min_len, max_len].
+
+    The length of a string scalar is its number of bytes, the length of any other tensor is its number of elements.
+
+    Args:
+        column (str): Name of the column.
+        min_len (int, optional): Smallest length kept (default=0).
+        max_len (int, optional): Largest length kept, no upper bound if None (default=None).
+
+    Returns:
+        Predicate, the predicate.
+    """
+    if max_len is None:
+        max_len = _INT64_MAX
+    if not isinstance(min_len, int) or not isinstance(max_len, int) or min_len > max_len:
+        raise ValueError("min_len and max_len should be integers and min_len should not be greater than max_len.")
+    return Predicate([("length", column, (min_len, max_len))])
+
+
+def value_between(column, min_value=None, max_value=None):
+    """
+    Keep the rows whose column, a numeric tensor with one element, is in [min_value, max_value].
+
+    Integer bounds are compared with integer columns exactly, also above 2**53.
+
+    Args:
+        column (str): Name of the column.
+        min_value (number, optional): Smallest value kept, no lower bound if None (default=None).
+        max_value (number, optional): Largest value kept, no upper bound if None (default=None).
+
+    Returns:
+        Predicate, the predicate.
+    """
+    bounds = [value for value in (min_value, max_value) if value is not None]
+    if bounds and all(_is_int64(value) for value in bounds):
+        min_value = _INT64_MIN if min_value is None else int(min_value)
+        max_value = _INT64_MAX if max_value is None else int(max_value)
+        if min_value > max_value:
+            raise ValueError("min_value should not be greater than max_value.")
+        return Predicate([("integer_range", column, (min_value, max_value))])
+    min_value = float("-inf") if min_value is None else float(min_value)
+    max_value = float("inf") if max_value is None else float(max_value)
+    if min_value > max_value:
+        raise ValueError("min_value should not be greater than max_value.")
+    return Predicate([("range", column, (min_value, max_value))])
+
+
+def value_in(column, values):
+    """
+    Keep the rows whose column, a tensor with one element, equals one of the values.
+
+    Integer values are compared with integer columns exactly, also above 2**53. An empty list keeps no row.
+
+    Args:
+        column (str): Name of the column.
+        values (list): Values kept, either all numbers or all strings.
+
+    Returns:
+        Predicate, the predicate.
+    """
+    values = list(values)
+    if all(isinstance(value, str) for value in values):
+        return Predicate([("string_in", column, values)])
+    if any(isinstance(value, (str, bytes)) for value in values):
+        raise ValueError("values should be either all numbers or all strings.")
+    if all(_is_int64(value) for value in values):
+        return Predicate([("integer_in", column, [int(value) for value in values])])
+    return Predicate([("in", column, [float(value) for value in values])])
@@ -23,6 +23,7 @@ import numpy as np
 from mindspore._c_expression import typing
 from . import samplers
 from . import datasets
+from . import predicates
 
 INT32_MAX = 2147483647
 valid_detype = [
@@ -824,8 +825,8 @@ def check_filter(method):
     def new_method(*args, **kwargs):
         param_dict = make_param_dict(method, args, kwargs)
         predicate = param_dict.get("predicate")
-        if not callable(predicate):
-            raise ValueError("Predicate should be a python function or a callable python object.")
+        if not callable(predicate) and not isinstance(predicate, predicates.Predicate):
+            raise ValueError("Predicate should be a python function, a callable python object or a Predicate.")
 
         nreq_param_int = ['num_parallel_workers']
         check_param_type(nreq_param_int, param_dict, int)
@@ -1226,3 +1227,18 @@ def check_gnn_get_node_feature(method):
         return method(*args, **kwargs)
 
     return new_method
+
+
+def check_gnn_save_snapshot(method):
+    """A wrapper that wrap a parameter checker to the GNN `save_snapshot` function."""
+
+    @wraps(method)
+    def new_method(*args, **kwargs):
+        param_dict = make_param_dict(method, args, kwargs)
+
+        # check snapshot_file; required argument
+        check_type(param_dict.get("snapshot_file"), 'snapshot_file', str)
+
+        return method(*args, **kwargs)
+
+    return new_method
@@ -13,10 +13,11 @@
 # limitations under the License.
 # ============================================================================
 """grad reducer cell for distributed training"""
+from mindspore import context
 from mindspore.nn.cell import Cell
 from mindspore.communication.management import GlobalComm, get_group_size
 from mindspore.ops import functional as F, composite as C, operations as P
-from mindspore.ops.operations.comm_ops import AllReduce, ReduceOp
+from mindspore.ops.operations.comm_ops import AllReduce, HostAllReduce, ReduceOp
 import mindspore.common.dtype as mstype
 
 reduce_opt = C.MultitypeFuncGraph("reduce_opt")
@@ -24,9 +25,36 @@ reduce_opt = C.MultitypeFuncGraph("reduce_opt")
 _all_reduce = AllReduce()
 
 
+def _is_host_reduce():
+    """AllReduce has no CPU kernel, so the gradients on CPU are reduced on host by MPI."""
+    return context.get_context("device_target") == "CPU"
+
+
+def _get_host_group_size():
+    """Get the number of the MPI processes, which reduce the gradients on host."""
+    try:
+        import mindspore._ms_mpi as mpi
+    except ImportError:
+        raise RuntimeError("DistributedGradReducer reduces the gradients on CPU by MPI, but MindSpore is built "
+                           "without MPI, build it with '-M on'.")
+    return mpi.get_rank_size()
+
+
+def _identity(grad):
+    """The gradients of a single process are already reduced."""
+    return grad
+
+
 def _init_optimizer_allreduce():
     global _all_reduce
-    _all_reduce = AllReduce(ReduceOp.SUM, GlobalComm.WORLD_COMM_GROUP)
+    if _is_host_reduce():
+        group_size = _get_host_group_size()
+        if group_size == 1:
+            _all_reduce = _identity
+            return
+        _all_reduce = HostAllReduce(ReduceOp.SUM, list(range(group_size)))
+    else:
+        _all_reduce = AllReduce(ReduceOp.SUM, GlobalComm.WORLD_COMM_GROUP)
     _all_reduce.add_prim_attr('fusion', 1)
 
 
@@ -111,6 +139,10 @@ class DistributedGradReducer(Cell):
     Constructs a gradient reducer Cell, which applies communication and average operations on
     single-process gradient values.
 
+    Note:
+        On CPU, the gradients are reduced by HostAllReduce among all the MPI processes, and degree defaults to
+        their number. A single process keeps its gradients as they are. MindSpore must be built with MPI.
+
     Args:
         parameters (list): the parameters to be updated.
         mean (bool): When mean is true, the mean coefficient (degree) would apply on gradients. Default: False.
@@ -118,6 +150,7 @@ class DistributedGradReducer(Cell):
 
     Raises:
         ValueError: If degree is not a int or less than 0.
+        RuntimeError: If the gradients are reduced on CPU and MindSpore is built without MPI.
 
     Examples:
         >>> from mindspore.communication import init, get_group_size
@@ -182,7 +215,7 @@ class DistributedGradReducer(Cell):
         self.hyper_map = C.HyperMap()
         self.mul = P.Mul()
         if degree is None:
-            self.degree = get_group_size()
+            self.degree = _get_host_group_size() if _is_host_reduce() else get_group_size()
         else:
             if not isinstance(degree, int) or degree <= 0:
                 raise ValueError("Parameter 'degree' in DistributedGradReducer should large than 0 and be int")
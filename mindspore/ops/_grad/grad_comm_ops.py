@@ -18,7 +18,7 @@ import mindspore.common.dtype as mstype
 from mindspore.ops import functional as F
 from .. import operations as P
 from ..composite.multitype_ops.zeros_like_impl import zeros_like
-from ..operations.comm_ops import (AllGather, HostAllGather, AllReduce, _AlltoAll, Broadcast,
+from ..operations.comm_ops import (AllGather, HostAllGather, AllReduce, HostAllReduce, _AlltoAll, Broadcast,
                                    _GetTensorSlice, _MirrorOperator, ReduceOp,
                                    ReduceScatter, HostReduceScatter, _VirtualDiv)
 from .grad_base import bprop_getters
@@ -55,6 +55,24 @@ def get_bprop_all_reduce(self):
     return bprop
 
 
+@bprop_getters.register(HostAllReduce)
+def get_bprop_host_all_reduce(self):
+    """Generate bprop for HostAllReduce."""
+    host_all_reduce_grad = HostAllReduce(ReduceOp.SUM, self.group, self.algorithm)
+    if self.instance_name:
+        instance_name = "grad" + self.instance_name
+        host_all_reduce_grad.set_prim_instance_name(instance_name)
+
+    if self.op != ReduceOp.SUM:
+        raise RuntimeError("The hostallreduce bprop only support ReduceOp.SUM until now.")
+
+    def bprop(x, out, dout):
+        dx = host_all_reduce_grad(dout)
+        return (dx,)
+
+    return bprop
+
+
 @bprop_getters.register(Broadcast)
 def get_bprop_broad_cast(self):
     """Generate bprop for Broadcast."""
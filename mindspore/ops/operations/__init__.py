@@ -34,7 +34,7 @@ from .array_ops import (Argmax, Argmin, Cast, Concat, Pack, Unpack,
 from .comm_ops import (AllGather, AllReduce, _AlltoAll, ReduceScatter, Broadcast,
                        _MirrorOperator, ReduceOp, _VirtualDataset,
                        _VirtualDiv, _GetTensorSlice,
-                       HostAllGather, HostReduceScatter)
+                       HostAllGather, HostAllReduce, HostReduceScatter)
 from .debug_ops import (ImageSummary, InsertGradientOf, HookBackward, ScalarSummary,
                         TensorSummary, HistogramSummary, Print)
 from .control_ops import ControlDepend, GeSwitch, Merge
@@ -230,6 +230,7 @@ __all__ = [
     "AllGather",
     "HostAllGather",
     "AllReduce",
+    "HostAllReduce",
     "ReduceScatter",
     "HostReduceScatter",
     "Broadcast",
@@ -108,6 +108,79 @@ class AllReduce(PrimitiveWithInfer):
         return x_dtype
 
 
+class HostAllReduce(PrimitiveWithInfer):
+    """
+    Reduces the tensor data across the specified communication group on host, by MPI.
+
+    Note:
+        Tensor must have the same shape and format in all processes participating in the collective.
+        The host allreduce operators with the same group, op, algorithm and a nonzero fusion attribute are fused
+        into buckets, which are split at the indices set by
+        auto_parallel_context().set_all_reduce_fusion_split_indices(indices, group) with the group of the ranks
+        joined by '_', the op and the fusion, such as "0_1_2sum1", or "0_1_2sum1ring" for the ring algorithm.
+
+    Args:
+        op (str): Specifies an operation used for element-wise reductions,
+                  like sum, max, min. Default: ReduceOp.SUM.
+        group (Union[tuple[int],list[int]]): The rand_ids of communication group to work on.
+        algorithm (str): "mpi" for the allreduce of MPI, or "ring" for the ring allreduce, which sends
+                         2 * (n - 1) / n of the data on each of the n ranks. Default: "mpi".
+
+    Raises:
+        TypeError: If op is not a string, group is not a list nor tuple, or elements of group are not int.
+        ValueError: If group is not set or has less than 2 ranks, a rank_id is negative, or algorithm is not "mpi"
+                    nor "ring". The rank_ids must be less than the number of the MPI processes, which the kernel
+                    checks.
+
+    Inputs:
+        - **input_x** (Tensor) - The shape of tensor is :math:`(x_1, x_2, ..., x_R)`,
+          the dtype is float16, float32 or int32.
+
+    Outputs:
+        Tensor, has the same shape of the input, i.e., :math:`(x_1, x_2, ..., x_R)`.
+
+    Examples:
+        >>> import mindspore.ops.operations as P
+        >>> class Net(nn.Cell):
+        >>>     def __init__(self):
+        >>>         super(Net, self).__init__()
+        >>>         self.hostallreduce = P.HostAllReduce(ReduceOp.SUM, group=[0, 1, 2, 3], algorithm="ring")
+        >>>         self.hostallreduce.add_prim_attr('fusion', 1)
+        >>>
+        >>>     def construct(self, x):
+        >>>         return self.hostallreduce(x)
+        >>>
+        >>> input_ = Tensor(np.ones([2, 8]).astype(np.float32))
+        >>> net = Net()
+        >>> output = net(input_)
+    """
+
+    @prim_attr_register
+    def __init__(self, op=ReduceOp.SUM, group=None, algorithm="mpi"):
+        if group is None:
+            raise ValueError(f"For '{self.name}' group must be set.")
+        validator.check_value_type('op', op, (type(ReduceOp.SUM),), self.name)
+        validator.check_value_type('group', group, (tuple, list), self.name)
+        validator.check_integer("group size", len(group), 2, Rel.GE, self.name)
+        for r in group:
+            validator.check_value_type("rank_id", r, (int,), self.name)
+            validator.check_integer("rank_id", r, 0, Rel.GE, self.name)
+        validator.check_string('algorithm', algorithm, ["mpi", "ring"], self.name)
+        self.op = op
+        self.add_prim_attr('group', group)
+        self.add_prim_attr('fusion', 0)
+
+    def infer_shape(self, x_shape):
+        return x_shape
+
+    def infer_dtype(self, x_dtype):
+        validator.check_tensor_type_same({'x': x_dtype}, (mstype.int32, mstype.float16, mstype.float32), self.name)
+        return x_dtype
+
+    def __call__(self, tensor):
+        raise NotImplementedError
+
+
 class AllGather(PrimitiveWithInfer):
     """
     Gathers tensors from the specified communication group.
@@ -13,6 +13,7 @@
 # limitations under the License.
 # ============================================================================
 """Context of auto parallel"""
+import os
 import threading
 import mindspore.context as context
 from mindspore.parallel._dp_allreduce_fusion import _set_fusion_strategy_by_idx, _set_fusion_strategy_by_size
@@ -240,6 +241,25 @@ class _AutoParallelContext:
         self.check_context_handle()
         return self._context_handle.get_strategy_ckpt_save_file()
 
+    def set_strategy_cache_dir(self, strategy_cache_dir):
+        """
+        Set the directory of the strategy cache.
+
+        Args:
+            strategy_cache_dir (str): Directory to keep the searched strategies of the graphs, so that the next
+                                      launches of the same graph on the same devices skip the strategy search.
+                                      Empty to keep them in memory only.
+        """
+        self.check_context_handle()
+        if strategy_cache_dir and not os.path.isdir(strategy_cache_dir):
+            raise ValueError("The strategy_cache_dir {} is not a directory.".format(strategy_cache_dir))
+        self._context_handle.set_strategy_cache_dir(strategy_cache_dir)
+
+    def get_strategy_cache_dir(self):
+        """Get the directory of the strategy cache."""
+        self.check_context_handle()
+        return self._context_handle.get_strategy_cache_dir()
+
     def get_parameter_broadcast_is_set(self):
         """Get parameter broadcast is set or not."""
         self.check_context_handle()
@@ -415,7 +435,8 @@ _set_auto_parallel_context_func_map = {
     "parallel_mode": auto_parallel_context().set_parallel_mode,
     "parameter_broadcast": auto_parallel_context().set_parameter_broadcast,
     "strategy_ckpt_load_file": auto_parallel_context().set_strategy_ckpt_load_file,
-    "strategy_ckpt_save_file": auto_parallel_context().set_strategy_ckpt_save_file}
+    "strategy_ckpt_save_file": auto_parallel_context().set_strategy_ckpt_save_file,
+    "strategy_cache_dir": auto_parallel_context().set_strategy_cache_dir}
 
 
 _get_auto_parallel_context_func_map = {
@@ -427,12 +448,13 @@ _get_auto_parallel_context_func_map = {
     "parallel_mode": auto_parallel_context().get_parallel_mode,
     "parameter_broadcast": auto_parallel_context().get_parameter_broadcast,
     "strategy_ckpt_load_file": auto_parallel_context().get_strategy_ckpt_load_file,
-    "strategy_ckpt_save_file": auto_parallel_context().get_strategy_ckpt_save_file}
+    "strategy_ckpt_save_file": auto_parallel_context().get_strategy_ckpt_save_file,
+    "strategy_cache_dir": auto_parallel_context().get_strategy_cache_dir}
 
 
 @args_type_check(device_num=int, global_rank=int, mirror_mean=bool, cast_before_mirror=bool,
                  loss_repeated_mean=bool, parallel_mode=str, parameter_broadcast=bool,
-                 strategy_ckpt_load_file=str, strategy_ckpt_save_file=str)
+                 strategy_ckpt_load_file=str, strategy_ckpt_save_file=str, strategy_cache_dir=str)
 def _set_auto_parallel_context(**kwargs):
     """
     Set auto parallel context.
@@ -465,6 +487,7 @@ def _set_auto_parallel_context(**kwargs):
                        broadcast. Default: False.
         strategy_ckpt_load_file (str): The path to load parallel strategy checkpoint. Default: ''
         strategy_ckpt_save_file (str): The path to save parallel strategy checkpoint. Default: ''
+        strategy_cache_dir (str): The directory to cache the searched strategies of auto parallel. Default: ''
 
     Raises:
         ValueError: If input key is not attribute in auto parallel context.
@@ -507,5 +530,6 @@ def _reset_auto_parallel_context():
     - parameter_broadcast: False.
     - strategy_ckpt_load_file: ""
     - strategy_ckpt_save_file: ""
+    - strategy_cache_dir: ""
     """
     auto_parallel_context().reset()
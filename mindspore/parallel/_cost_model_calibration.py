@@ -0,0 +1,228 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+"""
+Calibration of the computation costs of the auto parallel cost model.
+
+The computation cost of an operator is the number of bytes of its sliced tensors, so all the operators are weighted
+alike. The calibration runs the kernels of the operators on the sliced shapes of their strategies, fits the measured
+times against these costs, as the cost model computes them, and writes a coefficient of each operator to a profile,
+which the cost graph loads with set_cost_model_context(costmodel_calibration_file=profile).
+
+Usage:
+    python -m mindspore.parallel._cost_model_calibration profile.json [--device_num 8] [--repeat 20]
+"""
+import argparse
+import json
+import math
+import time
+
+import numpy as np
+
+import mindspore.nn as nn
+from mindspore import context
+from mindspore._c_expression import get_computation_cost, get_calibrated_computation_cost
+from mindspore.common.tensor import Tensor
+from mindspore.ops import operations as P
+
+
+def _slice_shape(shape, strategy):
+    return [dim // cut for dim, cut in zip(shape, strategy)]
+
+
+def computation_cost(op_type, shapes, strategy, calibrated=False):
+    """
+    The forward computation cost of the operator 'op_type' on the inputs of 'shapes' sliced by 'strategy', as the
+    cost graph computes it. If 'calibrated', it is multiplied by the coefficient of the loaded calibration profile.
+    """
+    shapes = [list(shape) for shape in shapes]
+    strategy = [list(stra) for stra in strategy]
+    if calibrated:
+        return get_calibrated_computation_cost(op_type, shapes, strategy)
+    return get_computation_cost(op_type, shapes, strategy)
+
+
+def _matmul_strategies(device_num):
+    cuts = [2 ** i for i in range(int(math.log2(device_num)) + 1)]
+    return [(((a, b), (b, c)), a * b * c) for a in cuts for b in cuts for c in cuts if a * b * c <= device_num]
+
+
+def _two_dims_strategies(device_num, inputs_num=1, split_last=True):
+    cuts = [2 ** i for i in range(int(math.log2(device_num)) + 1)]
+    last_cuts = cuts if split_last else [1]
+    return [(((a, b),) * inputs_num, a * b) for a in cuts for b in last_cuts if a * b <= device_num]
+
+
+def _bias_add_strategies(device_num):
+    return [(((a, b), (b,)), devices) for ((a, b),), devices in _two_dims_strategies(device_num)]
+
+
+class _UnaryNet(nn.Cell):
+    "A network of a single operator of one input."
+    def __init__(self, op):
+        super(_UnaryNet, self).__init__()
+        self.op = op
+
+    def construct(self, x):
+        return self.op(x)
+
+
+class _BinaryNet(nn.Cell):
+    "A network of a single operator of two inputs."
+    def __init__(self, op):
+        super(_BinaryNet, self).__init__()
+        self.op = op
+
+    def construct(self, x, y):
+        return self.op(x, y)
+
+
+class _TransposeNet(nn.Cell):
+    "A network of a single Transpose of two dimensions."
+    def __init__(self):
+        super(_TransposeNet, self).__init__()
+        self.op = P.Transpose()
+        self.perm = (1, 0)
+
+    def construct(self, x):
+        return self.op(x, self.perm)
+
+
+# the network, the shapes and the (strategy, devices) pairs of each calibrated operator
+_CALIBRATED_OPS = {
+    "MatMul": (lambda: _BinaryNet(P.MatMul()), [[1024, 1024], [1024, 1024]], _matmul_strategies),
+    "ReLU": (lambda: _UnaryNet(P.ReLU()), [[4096, 1024]], _two_dims_strategies),
+    "Softmax": (lambda: _UnaryNet(P.Softmax()), [[4096, 1024]],
+                lambda device_num: _two_dims_strategies(device_num, split_last=False)),
+    "Mul": (lambda: _BinaryNet(P.Mul()), [[4096, 1024], [4096, 1024]],
+            lambda device_num: _two_dims_strategies(device_num, inputs_num=2)),
+    "BiasAdd": (lambda: _BinaryNet(P.BiasAdd()), [[4096, 1024], [1024]], _bias_add_strategies),
+    "Transpose": (_TransposeNet, [[4096, 1024]], _two_dims_strategies),
+}
+
+
+def _measure(op_type, strategy, repeat):
+    "The median time of the kernel of 'op_type' on the sliced shapes of 'strategy', in seconds."
+    net_func, shapes, _ = _CALIBRATED_OPS[op_type]
+    net = net_func()
+    inputs = tuple(Tensor(np.random.rand(*_slice_shape(shape, stra)).astype(np.float32))
+                   for shape, stra in zip(shapes, strategy))
+    net(*inputs)
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        net(*inputs)
+        times.append(time.perf_counter() - start)
+    return float(np.median(times))
+
+
+def fit_coefficient(costs, times):
+    "The least squares (slope, intercept) of the times over the costs, the slope being positive."
+    costs = np.array(costs, dtype=np.float64)
+    times = np.array(times, dtype=np.float64)
+    if len(costs) > 1 and np.ptp(costs) > 0:
+        slope, intercept = np.polyfit(costs, times, 1)
+    else:
+        slope, intercept = 0.0, 0.0
+    if slope <= 0:
+        # no measurable trend, the times are assumed to be proportional to the costs
+        slope = float(np.sum(times)) / max(float(np.sum(costs)), 1.0)
+        intercept = 0.0
+    return float(slope), float(intercept)
+
+
+def normalize_coefficients(slopes):
+    "The slopes over their geometric mean, so that the calibration only changes the relative weights of the operators."
+    mean = math.exp(sum(math.log(slope) for slope in slopes.values()) / len(slopes))
+    return {op_type: slope / mean for op_type, slope in slopes.items()}, mean
+
+
+def _relative_error(predicted, measured):
+    return abs(predicted - measured) / measured if measured > 0 else 0.0
+
+
+def make_report(samples, uncalibrated, calibrated):
+    """
+    Compare the predicted and measured times. A step of n devices runs every sample whose strategy uses n devices,
+    the uncalibrated prediction is the best single fit of all the operators, as the byte costs weight them alike.
+    """
+    lines = ["{:<10} {:>8} {:>16} {:>16}".format("operator", "samples", "uncalibrated err", "calibrated err")]
+    for op_type in sorted(calibrated):
+        op_samples = [sample for sample in samples if sample["op"] == op_type]
+        errors = [[], []]
+        for sample in op_samples:
+            for i, (slope, intercept) in enumerate((uncalibrated, calibrated[op_type])):
+                errors[i].append(_relative_error(slope * sample["cost"] + intercept, sample["time"]))
+        lines.append("{:<10} {:>8} {:>15.1f}% {:>15.1f}%".format(op_type, len(op_samples), 100 * np.mean(errors[0]),
+                                                                  100 * np.mean(errors[1])))
+    lines.append("{:<10} {:>12} {:>24} {:>24}".format("step", "measured ms", "uncalibrated ms (err)",
+                                                       "calibrated ms (err)"))
+    for device_num in sorted({sample["devices"] for sample in samples}):
+        step = [sample for sample in samples if sample["devices"] == device_num]
+        measured = sum(sample["time"] for sample in step)
+        predicted = [sum(uncalibrated[0] * sample["cost"] + uncalibrated[1] for sample in step),
+                     sum(calibrated[sample["op"]][0] * sample["cost"] + calibrated[sample["op"]][1] for sample in step)]
+        lines.append("{:<10} {:>12.3f} {:>15.3f} ({:>5.1f}%) {:>15.3f} ({:>5.1f}%)".format(
+            "{} dev".format(device_num), 1000 * measured, 1000 * predicted[0],
+            100 * _relative_error(predicted[0], measured), 1000 * predicted[1],
+            100 * _relative_error(predicted[1], measured)))
+    return "\n".join(lines)
+
+
+def calibrate(profile_file, device_num=8, repeat=20, op_types=None, device_target="CPU"):
+    """
+    Measure the kernels on the sliced shapes of the strategies of up to 'device_num' devices, write the coefficients
+    of the computation costs to 'profile_file', and return the report of the predicted and measured times.
+    """
+    if device_num < 1 or device_num & (device_num - 1):
+        raise ValueError("The device_num {} must be a power of 2.".format(device_num))
+    context.set_context(mode=context.GRAPH_MODE, device_target=device_target)
+    op_types = sorted(_CALIBRATED_OPS) if op_types is None else op_types
+    samples = []
+    for op_type in op_types:
+        _, shapes, strategies_func = _CALIBRATED_OPS[op_type]
+        for strategy, devices in strategies_func(device_num):
+            samples.append({"op": op_type, "strategy": strategy, "devices": devices,
+                            "cost": computation_cost(op_type, shapes, strategy),
+                            "time": _measure(op_type, strategy, repeat)})
+
+    uncalibrated = fit_coefficient([sample["cost"] for sample in samples], [sample["time"] for sample in samples])
+    calibrated = {}
+    for op_type in op_types:
+        op_samples = [sample for sample in samples if sample["op"] == op_type]
+        calibrated[op_type] = fit_coefficient([sample["cost"] for sample in op_samples],
+                                              [sample["time"] for sample in op_samples])
+    coefficients, seconds_per_cost = normalize_coefficients({op: fit[0] for op, fit in calibrated.items()})
+    profile = {"device_target": device_target,
+               "device_num": device_num,
+               "seconds_per_cost": seconds_per_cost,
+               "computation_coefficients": coefficients,
+               "fits": {op: {"slope": fit[0], "intercept": fit[1]} for op, fit in calibrated.items()}}
+    with open(profile_file, "w") as f:
+        json.dump(profile, f, indent=2, sort_keys=True)
+    return make_report(samples, uncalibrated, calibrated)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Calibrate the computation costs of the auto parallel cost model.")
+    parser.add_argument("profile_file", help="the profile to write")
+    parser.add_argument("--device_num", type=int, default=8, help="the devices of the sliced shapes")
+    parser.add_argument("--repeat", type=int, default=20, help="the runs of each kernel")
+    parser.add_argument("--device_target", default="CPU", help="the target of the kernels")
+    args = parser.parse_args()
+    print(calibrate(args.profile_file, args.device_num, args.repeat, device_target=args.device_target))
+
+
+if __name__ == "__main__":
+    main()
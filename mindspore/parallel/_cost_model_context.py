@@ -13,6 +13,7 @@
 # limitations under the License.
 # ============================================================================
 """Context of cost_model in auto_parallel"""
+import os
 import threading
 from mindspore._c_expression import CostModelContext
 from mindspore._checkparam import args_type_check
@@ -443,6 +444,33 @@ class _CostModelContext:
             raise ValueError("Context handle is none in context!!!")
         return self._context_handle.get_costmodel_allreduce_fusion_computation_time_parameter()
 
+    def set_costmodel_calibration_file(self, calibration_file):
+        """
+        Set the calibration profile of the computation costs, written by _cost_model_calibration.calibrate().
+
+        Args:
+            calibration_file (str): The path of the profile. An empty string drops the calibration.
+
+        Raises:
+            ValueError: If context handle is none, or the profile does not exist.
+        """
+        if self._context_handle is None:
+            raise ValueError("Context handle is none in context!!!")
+        if calibration_file and not os.path.isfile(calibration_file):
+            raise ValueError("The calibration file {} does not exist.".format(calibration_file))
+        self._context_handle.set_costmodel_calibration_file(calibration_file)
+
+    def get_costmodel_calibration_file(self):
+        """
+        Get the calibration profile of the computation costs.
+
+        Raises:
+            ValueError: If context handle is none.
+        """
+        if self._context_handle is None:
+            raise ValueError("Context handle is none in context!!!")
+        return self._context_handle.get_costmodel_calibration_file()
+
     def reset_cost_model(self):
         """
         Reset cost model settings.
@@ -490,7 +518,8 @@ set_cost_model_context_func_map = {
     "costmodel_allreduce_fusion_allreduce_bandwidth":
         cost_model_context().set_costmodel_allreduce_fusion_allreduce_bandwidth,
     "costmodel_allreduce_fusion_computation_time_parameter":
-        cost_model_context().set_costmodel_allreduce_fusion_computation_time_parameter}
+        cost_model_context().set_costmodel_allreduce_fusion_computation_time_parameter,
+    "costmodel_calibration_file": cost_model_context().set_costmodel_calibration_file}
 
 
 get_cost_model_context_func_map = {
@@ -512,7 +541,8 @@ get_cost_model_context_func_map = {
     "costmodel_allreduce_fusion_allreduce_bandwidth":
         cost_model_context().get_costmodel_allreduce_fusion_allreduce_bandwidth,
     "costmodel_allreduce_fusion_computation_time_parameter":
-        cost_model_context().get_costmodel_allreduce_fusion_computation_time_parameter}
+        cost_model_context().get_costmodel_allreduce_fusion_computation_time_parameter,
+    "costmodel_calibration_file": cost_model_context().get_costmodel_calibration_file}
 
 
 @args_type_check(device_memory_capacity=float, costmodel_alpha=float, costmodel_beta=float, costmodel_gamma=float,
@@ -522,7 +552,7 @@ get_cost_model_context_func_map = {
                  costmodel_allreduce_fusion_tail_percent=float, costmodel_allreduce_fusion_tail_time=float,
                  costmodel_allreduce_fusion_allreduce_inherent_time=float,
                  costmodel_allreduce_fusion_allreduce_bandwidth=float,
-                 costmodel_allreduce_fusion_computation_time_parameter=float)
+                 costmodel_allreduce_fusion_computation_time_parameter=float, costmodel_calibration_file=str)
 def set_cost_model_context(**kwargs):
     """
     Set cost model context.
@@ -556,6 +586,8 @@ def set_cost_model_context(**kwargs):
             bandwidth of AllReduce.
         costmodel_allreduce_fusion_computation_time_parameter (float): A parameter used in allreduce fusion algorithm.
             The parameter used to compute backward computation time.
+        costmodel_calibration_file (str): The profile of the computation cost coefficients of the operators, written
+            by the calibration from the measured kernel times. Default: '', no calibration.
 
 
 
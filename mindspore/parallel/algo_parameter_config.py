@@ -88,6 +88,25 @@ class _AlgoParameterConfig():
         self.check_config_handle()
         return self._config_handle.get_tensor_slice_align_size()
 
+    def set_dp_algo_search_threads(self, threads):
+        """
+        Set the number of threads searching strategies in the DP algorithm.
+
+        Args:
+            threads (int): The number of threads, 0 means one thread per core.
+
+        Raises:
+            ValueError: If threads is negative.
+        """
+        self.check_config_handle()
+        if threads < 0:
+            raise ValueError('Dp_algo_search_threads must be nonnegative, but got {}'.format(threads))
+        self._config_handle.set_dp_algo_search_threads(threads)
+
+    def get_dp_algo_search_threads(self):
+        self.check_config_handle()
+        return self._config_handle.get_dp_algo_search_threads()
+
     def reset_algo_parameters(self):
         self.check_config_handle()
         self._config_handle.reset_algo_parameters()
@@ -113,18 +132,20 @@ set_algo_parameters_config_func_map = {
     "fully_use_devices": _algo_parameter_config().set_fully_use_devices,
     "elementwise_op_strategy_follow": _algo_parameter_config().set_elementwise_op_strategy_follow,
     "tensor_slice_align_enable": _algo_parameter_config().set_tensor_slice_align_enable,
-    "tensor_slice_align_size": _algo_parameter_config().set_tensor_slice_align_size}
+    "tensor_slice_align_size": _algo_parameter_config().set_tensor_slice_align_size,
+    "dp_algo_search_threads": _algo_parameter_config().set_dp_algo_search_threads}
 
 
 get_algo_parameters_config_func_map = {
     "fully_use_devices": _algo_parameter_config().get_fully_use_devices,
     "elementwise_op_strategy_follow": _algo_parameter_config().get_elementwise_op_strategy_follow,
     "tensor_slice_align_enable": _algo_parameter_config().get_tensor_slice_align_enable,
-    "tensor_slice_align_size": _algo_parameter_config().get_tensor_slice_align_size}
+    "tensor_slice_align_size": _algo_parameter_config().get_tensor_slice_align_size,
+    "dp_algo_search_threads": _algo_parameter_config().get_dp_algo_search_threads}
 
 
 @args_type_check(tensor_slice_align_enable=bool, tensor_slice_align_size=int,
-                 fully_use_devices=bool, elementwise_op_strategy_follow=bool)
+                 fully_use_devices=bool, elementwise_op_strategy_follow=bool, dp_algo_search_threads=int)
 def set_algo_parameters(**kwargs):
     """
     Set algo parameter config.
@@ -139,6 +160,8 @@ def set_algo_parameters(**kwargs):
         fully_use_devices (bool): Whether ONLY generating strategies that fully use all available devices. Default: True
         elementwise_op_strategy_follow (bool): Whether the elementwise operator have the same strategies as its
             subsequent operators. Default: False
+        dp_algo_search_threads (int): The number of threads creating the cost lists in the DP algorithm, 0 means one
+            thread per core. Default: 0
 
     Raises:
         ValueError: If context keyword is not recognized.
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+# coding=UTF-8
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+"""
+Function:
+    Compare the memory footprint of the reuse planners with the theoretical minimum, on the mem_reuse_intervals_*.txt
+    files dumped when save_graphs is set. The minimum is the peak of the live bytes, the greedy by size plan is
+    recomputed from the intervals whatever planner made the dump.
+Usage:
+    python mem_plan_compare.py file_or_dir [file_or_dir ...]
+"""
+import os
+import sys
+
+
+def load_intervals(file_name):
+    "Load the header and the (size, start, end, offset) intervals of a dump."
+    header = {}
+    intervals = []
+    with open(file_name, 'r') as f:
+        for line in f:
+            fields = line.split()
+            if not fields:
+                continue
+            if fields[0] == '#':
+                if len(fields) == 3:
+                    header[fields[1]] = fields[2]
+                continue
+            intervals.append(tuple(int(field) for field in fields))
+    return header, intervals
+
+
+def lower_bound(intervals):
+    "Peak of the live bytes."
+    delta = {}
+    for size, start, end, _ in intervals:
+        delta[start] = delta.get(start, 0) + size
+        delta[end + 1] = delta.get(end + 1, 0) - size
+    live = 0
+    peak = 0
+    for pos in sorted(delta):
+        live += delta[pos]
+        peak = max(peak, live)
+    return peak
+
+
+def greedy_by_size(intervals):
+    "Footprint of the greedy by size plan, the same as GreedyBySizeMemReuse::Plan."
+    order = sorted(range(len(intervals)), key=lambda i: (-intervals[i][0], intervals[i][1]))
+    placed = []
+    footprint = 0
+    for index in order:
+        size, start, end, _ = intervals[index]
+        best_offset = None
+        best_gap = None
+        prev_end = 0
+        for other_offset, other_size, other_start, other_end in placed:
+            if other_start > end or start > other_end:
+                continue
+            gap = other_offset - prev_end
+            if size <= gap and (best_gap is None or gap < best_gap):
+                best_gap = gap
+                best_offset = prev_end
+            prev_end = max(prev_end, other_offset + other_size)
+        offset = prev_end if best_offset is None else best_offset
+        footprint = max(footprint, offset + size)
+        placed.append((offset, size, start, end))
+        placed.sort(key=lambda item: item[0])
+    return footprint
+
+
+def ratio(footprint, bound):
+    "Footprint over the lower bound."
+    return '{:.3f}'.format(float(footprint) / bound) if bound else '-'
+
+
+def compare(file_name):
+    "Print the footprints of a dump."
+    header, intervals = load_intervals(file_name)
+    bound = lower_bound(intervals)
+    greedy = greedy_by_size(intervals)
+    planner = header.get('planner', 'unknown')
+    footprint = int(header.get('footprint', 0))
+    print('{}: {} buffers, lower bound {}, {} {} ({}), greedy_by_size {} ({})'.format(
+        file_name, len(intervals), bound, planner, footprint, ratio(footprint, bound), greedy, ratio(greedy, bound)))
+
+
+def main(paths):
+    "Compare the dumps found in the paths."
+    for path in paths:
+        if os.path.isdir(path):
+            for file_name in sorted(os.listdir(path)):
+                if file_name.startswith('mem_reuse_intervals_') and file_name.endswith('.txt'):
+                    compare(os.path.join(path, file_name))
+        else:
+            compare(path)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+    main(sys.argv[1:])
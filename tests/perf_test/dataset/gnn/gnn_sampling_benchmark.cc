@@ -0,0 +1,238 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Throughput benchmark of the GNN graph sampling APIs.
+//
+// Usage: gnn_sampling_benchmark --dataset=<graph mindrecord file> [--workers=1,4,8] [--batch=1024,10240]
+//                               [--neighbor_nums=10,5] [--neg_num=5] [--walk_length=10] [--p=0.5] [--q=2]
+//                               [--repeat=20]
+//                               [--output=result.json]
+//
+// The dataset can be produced by example/graph_to_mindrecord. The first two node types found in the graph are used
+// as source and neighbor type. Results are emitted as json, to stdout if no output file is given.
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "dataset/engine/gnn/graph.h"
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+namespace {
+struct BenchmarkConfig {
+  std::string dataset;
+  std::vector<int32_t> workers = {1, 4, 8};
+  std::vector<int32_t> batches = {1024, 10240};
+  std::vector<NodeIdType> neighbor_nums = {10, 5};
+  NodeIdType neg_num = 5;
+  int32_t walk_length = 10;
+  float p = 0.5;
+  float q = 2.0;
+  int32_t repeat = 20;
+  std::string output;
+};
+
+template <typename T>
+std::vector<T> ParseList(const std::string &value) {
+  std::vector<T> result;
+  std::stringstream ss(value);
+  std::string item;
+  while (std::getline(ss, item, ',')) result.push_back(static_cast<T>(std::stoi(item)));
+  return result;
+}
+
+bool ParseArgs(int argc, char **argv, BenchmarkConfig *config) {
+  for (int i = 1; i < argc; ++i) {
+    std::string arg(argv[i]);
+    auto pos = arg.find('=');
+    std::string key = arg.substr(0, pos);
+    std::string value = pos == std::string::npos ? "" : arg.substr(pos + 1);
+    try {
+      if (key == "--dataset") {
+        config->dataset = value;
+      } else if (key == "--workers") {
+        config->workers = ParseList<int32_t>(value);
+      } else if (key == "--batch") {
+        config->batches = ParseList<int32_t>(value);
+      } else if (key == "--neighbor_nums") {
+        config->neighbor_nums = ParseList<NodeIdType>(value);
+      } else if (key == "--neg_num") {
+        config->neg_num = std::stoi(value);
+      } else if (key == "--walk_length") {
+        config->walk_length = std::stoi(value);
+      } else if (key == "--p") {
+        config->p = std::stof(value);
+      } else if (key == "--q") {
+        config->q = std::stof(value);
+      } else if (key == "--repeat") {
+        config->repeat = std::stoi(value);
+      } else if (key == "--output") {
+        config->output = value;
+      } else {
+        std::cerr << "Unknown argument: " << arg << std::endl;
+        return false;
+      }
+    } catch (std::exception &e) {
+      std::cerr << "Illegal value of argument: " << arg << std::endl;
+      return false;
+    }
+  }
+  if (config->dataset.empty() || config->workers.empty() || config->batches.empty() ||
+      config->neighbor_nums.empty() || config->neg_num <= 0 || config->walk_length <= 0 || config->p <= 0 ||
+      config->q <= 0 || config->repeat <= 0) {
+    std::cerr << "Illegal benchmark configuration." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Run one sampling call repeat times and report the number of sampled ids per second
+Status Measure(const std::string &api, int32_t repeat, int64_t ids_per_call,
+               const std::function<Status(std::shared_ptr<Tensor> *)> &sample, nlohmann::json *result) {
+  std::shared_ptr<Tensor> out;
+  RETURN_IF_NOT_OK(sample(&out));  // warm up
+  auto start = std::chrono::steady_clock::now();
+  for (int32_t i = 0; i < repeat; ++i) {
+    RETURN_IF_NOT_OK(sample(&out));
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  (*result)["api"] = api;
+  (*result)["seconds_per_call"] = seconds / repeat;
+  (*result)["sampled_edges_per_second"] = seconds > 0 ? static_cast<double>(ids_per_call) * repeat / seconds : 0.0;
+  return Status::OK();
+}
+
+Status RunBenchmark(const BenchmarkConfig &config, nlohmann::json *report) {
+  (*report)["config"] = {{"dataset", config.dataset},     {"neighbor_nums", config.neighbor_nums},
+                         {"neg_num", config.neg_num},     {"walk_length", config.walk_length},
+                         {"p", config.p},                 {"q", config.q},
+                         {"repeat", config.repeat}};
+  (*report)["results"] = nlohmann::json::array();
+  for (int32_t num_workers : config.workers) {
+    Graph graph(config.dataset, num_workers);
+    auto start = std::chrono::steady_clock::now();
+    RETURN_IF_NOT_OK(graph.Init());
+    double init_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<NodeMetaInfo> node_info;
+    std::vector<EdgeMetaInfo> edge_info;
+    RETURN_IF_NOT_OK(graph.GetMetaInfo(&node_info, &edge_info));
+    CHECK_FAIL_RETURN_UNEXPECTED(!node_info.empty(), "No node found in " + config.dataset);
+    NodeType src_type = node_info[0].type;
+    NodeType neighbor_type = node_info.size() > 1 ? node_info[1].type : src_type;
+    std::shared_ptr<Tensor> nodes;
+    RETURN_IF_NOT_OK(graph.GetNodes(src_type, -1, &nodes));
+    std::vector<NodeIdType> all_nodes(nodes->begin<NodeIdType>(), nodes->end<NodeIdType>());
+
+    std::vector<NodeType> neighbor_types(config.neighbor_nums.size(), neighbor_type);
+    int64_t sampled_per_node = 0, layer = 1;
+    for (auto num : config.neighbor_nums) {
+      layer *= num;
+      sampled_per_node += layer;
+    }
+    std::vector<NodeType> meta_path(config.walk_length, neighbor_type);
+
+    std::mt19937 rnd(0);
+    for (int32_t batch : config.batches) {
+      std::uniform_int_distribution<size_t> dist(0, all_nodes.size() - 1);
+      std::vector<NodeIdType> node_list(batch);
+      for (auto &node : node_list) node = all_nodes[dist(rnd)];
+
+      nlohmann::json results = nlohmann::json::array();
+      nlohmann::json result;
+      RETURN_IF_NOT_OK(Measure("GetSampledNeighbor", config.repeat, sampled_per_node * batch,
+                               [&](std::shared_ptr<Tensor> *out) {
+                                 return graph.GetSampledNeighbor(node_list, config.neighbor_nums, neighbor_types, out);
+                               },
+                               &result));
+      results.push_back(result);
+      RETURN_IF_NOT_OK(Measure("GetNegSampledNeighbor", config.repeat, static_cast<int64_t>(config.neg_num) * batch,
+                               [&](std::shared_ptr<Tensor> *out) {
+                                 return graph.GetNegSampledNeighbor(node_list, config.neg_num, neighbor_type, out);
+                               },
+                               &result));
+      results.push_back(result);
+      RETURN_IF_NOT_OK(Measure("RandomWalk", config.repeat, static_cast<int64_t>(config.walk_length) * batch,
+                               [&](std::shared_ptr<Tensor> *out) {
+                                 return graph.RandomWalk(node_list, meta_path, 1.0, 1.0, kDefaultNodeId, out);
+                               },
+                               &result));
+      results.push_back(result);
+      RETURN_IF_NOT_OK(Measure("RandomWalkNode2vec", config.repeat, static_cast<int64_t>(config.walk_length) * batch,
+                               [&](std::shared_ptr<Tensor> *out) {
+                                 return graph.RandomWalk(node_list, meta_path, config.p, config.q, kDefaultNodeId, out);
+                               },
+                               &result));
+      results.push_back(result);
+      if (!node_info[0].feature_type.empty()) {
+        std::shared_ptr<Tensor> node_tensor;
+        RETURN_IF_NOT_OK(Tensor::CreateTensor(&node_tensor, TensorImpl::kFlexible, TensorShape({batch}),
+                                              DataType(DataType::DE_INT32),
+                                              reinterpret_cast<const unsigned char *>(node_list.data())));
+        RETURN_IF_NOT_OK(Measure("GetNodeFeature", config.repeat, batch,
+                                 [&](std::shared_ptr<Tensor> *out) {
+                                   TensorRow features;
+                                   RETURN_IF_NOT_OK(graph.GetNodeFeature(node_tensor, node_info[0].feature_type,
+                                                                         &features));
+                                   *out = features[0];
+                                   return Status::OK();
+                                 },
+                                 &result));
+        results.push_back(result);
+      }
+      for (auto &item : results) {
+        item["num_workers"] = num_workers;
+        item["batch"] = batch;
+        item["init_seconds"] = init_seconds;
+        (*report)["results"].push_back(item);
+      }
+    }
+  }
+  return Status::OK();
+}
+}  // namespace
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
+
+int main(int argc, char **argv) {
+  mindspore::dataset::gnn::BenchmarkConfig config;
+  if (!mindspore::dataset::gnn::ParseArgs(argc, argv, &config)) {
+    return 1;
+  }
+  nlohmann::json report;
+  mindspore::dataset::Status rc = mindspore::dataset::gnn::RunBenchmark(config, &report);
+  if (rc.IsError()) {
+    std::cerr << "Benchmark failed: " << rc.ToString() << std::endl;
+    return 1;
+  }
+  if (config.output.empty()) {
+    std::cout << report.dump(2) << std::endl;
+  } else {
+    std::ofstream out(config.output);
+    out << report.dump(2) << std::endl;
+  }
+  return 0;
+}
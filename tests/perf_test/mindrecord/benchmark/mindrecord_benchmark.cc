@@ -0,0 +1,332 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Synthetic read/write benchmark of MindRecord.
+//
+// Usage: mindrecord_benchmark [--dir=/tmp/mindrecord_benchmark] [--rows=100000] [--row_bytes=4096]
+//                             [--shards=4] [--page_size=33554432] [--classes=1000] [--write_batch=1000]
+//                             [--consumers=1,4,8] [--output=result.json] [--keep_files]
+//
+// A dataset of the given schema size is generated in dir, then every combination of consumer count, row/block
+// reader and sample operator is read once. Results are emitted as json, to stdout if no output file is given.
+
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/utils.h"
+#include "mindrecord/include/shard_distributed_sample.h"
+#include "mindrecord/include/shard_index_generator.h"
+#include "mindrecord/include/shard_reader.h"
+#include "mindrecord/include/shard_shuffle.h"
+#include "mindrecord/include/shard_writer.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+struct BenchmarkConfig {
+  std::string dir = "/tmp/mindrecord_benchmark";
+  int64_t rows = 100000;
+  int64_t row_bytes = 4096;
+  int shards = 4;
+  uint64_t page_size = kDefaultPageSize;
+  int classes = 1000;
+  int64_t write_batch = 1000;
+  std::vector<int> consumers = {1, 4, 8};
+  std::string output;
+  bool keep_files = false;
+};
+
+double SecondsSince(const std::chrono::steady_clock::time_point &start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+double MegaBytes(uint64_t bytes) { return static_cast<double>(bytes) / (1024.0 * 1024.0); }
+
+bool ParseArgs(int argc, char **argv, BenchmarkConfig *config) {
+  for (int i = 1; i < argc; ++i) {
+    std::string arg(argv[i]);
+    auto pos = arg.find('=');
+    std::string key = arg.substr(0, pos);
+    std::string value = pos == std::string::npos ? "" : arg.substr(pos + 1);
+    try {
+      if (key == "--dir") {
+        config->dir = value;
+      } else if (key == "--rows") {
+        config->rows = std::stoll(value);
+      } else if (key == "--row_bytes") {
+        config->row_bytes = std::stoll(value);
+      } else if (key == "--shards") {
+        config->shards = std::stoi(value);
+      } else if (key == "--page_size") {
+        config->page_size = std::stoull(value);
+      } else if (key == "--classes") {
+        config->classes = std::stoi(value);
+      } else if (key == "--write_batch") {
+        config->write_batch = std::stoll(value);
+      } else if (key == "--consumers") {
+        config->consumers.clear();
+        std::stringstream ss(value);
+        std::string item;
+        while (std::getline(ss, item, ',')) config->consumers.push_back(std::stoi(item));
+      } else if (key == "--output") {
+        config->output = value;
+      } else if (key == "--keep_files") {
+        config->keep_files = true;
+      } else {
+        std::cerr << "Unknown argument: " << arg << std::endl;
+        return false;
+      }
+    } catch (std::exception &e) {
+      std::cerr << "Illegal value of argument: " << arg << std::endl;
+      return false;
+    }
+  }
+  if (config->rows <= 0 || config->row_bytes <= 0 || config->shards < kMinShardCount ||
+      config->shards > kMaxShardCount || config->classes <= 0 || config->write_batch <= 0 ||
+      config->consumers.empty()) {
+    std::cerr << "Illegal benchmark configuration." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+std::vector<std::string> ShardFileNames(const BenchmarkConfig &config) {
+  std::vector<std::string> file_names;
+  for (int i = 0; i < config.shards; ++i) {
+    file_names.emplace_back(config.dir + "/benchmark.mindrecord" + std::to_string(i));
+  }
+  return file_names;
+}
+
+void RemoveFiles(const std::vector<std::string> &file_names) {
+  for (const auto &file_name : file_names) {
+    (void)remove(common::SafeCStr(file_name));
+    (void)remove(common::SafeCStr(file_name + ".db"));
+  }
+}
+
+MSRStatus WriteDataset(const BenchmarkConfig &config, json *result) {
+  ShardHeader header_data;
+  json schema_json = R"({"file_name": {"type": "string"}, "label": {"type": "int32"}, "data": {"type": "bytes"}})"_json;
+  std::shared_ptr<Schema> schema = Schema::Build("benchmark", schema_json);
+  if (schema == nullptr) {
+    MS_LOG(ERROR) << "Build benchmark schema failed.";
+    return FAILED;
+  }
+  auto schema_id = header_data.AddSchema(schema);
+  std::vector<std::pair<uint64_t, std::string>> fields = {{schema_id, "file_name"}, {schema_id, "label"}};
+  if (header_data.AddIndexFields(fields) != SUCCESS) {
+    return FAILED;
+  }
+
+  auto file_names = ShardFileNames(config);
+  auto start = std::chrono::steady_clock::now();
+  ShardWriter writer;
+  if (writer.Open(file_names) != SUCCESS || writer.SetPageSize(config.page_size) != SUCCESS ||
+      writer.SetShardHeader(std::make_shared<ShardHeader>(header_data)) != SUCCESS) {
+    MS_LOG(ERROR) << "Open benchmark writer failed.";
+    return FAILED;
+  }
+  double open_seconds = SecondsSince(start);
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<int> byte_dis(0, 255);
+  std::vector<uint8_t> blob_template(config.row_bytes);
+  for (auto &byte : blob_template) byte = static_cast<uint8_t>(byte_dis(gen));
+
+  double write_seconds = 0.0;
+  uint64_t write_bytes = 0;
+  for (int64_t first_row = 0; first_row < config.rows; first_row += config.write_batch) {
+    int64_t last_row = std::min(config.rows, first_row + config.write_batch);
+    std::map<uint64_t, std::vector<json>> raw_data;
+    std::vector<std::vector<uint8_t>> blob_data;
+    for (int64_t row = first_row; row < last_row; ++row) {
+      json label;
+      label["file_name"] = "sample_" + std::to_string(row) + ".bin";
+      label["label"] = static_cast<int32_t>(row % config.classes);
+      raw_data[schema_id].push_back(label);
+      blob_template[row % config.row_bytes] ^= static_cast<uint8_t>(row);  // keep rows distinct
+      blob_data.push_back(blob_template);
+      write_bytes += config.row_bytes + label.dump().size();
+    }
+    auto batch_start = std::chrono::steady_clock::now();
+    if (writer.WriteRawData(raw_data, blob_data) != SUCCESS) {
+      MS_LOG(ERROR) << "Write benchmark rows [" << first_row << ", " << last_row << ") failed.";
+      return FAILED;
+    }
+    write_seconds += SecondsSince(batch_start);
+  }
+  start = std::chrono::steady_clock::now();
+  if (writer.Commit() != SUCCESS) {
+    return FAILED;
+  }
+  double commit_seconds = SecondsSince(start);
+
+  start = std::chrono::steady_clock::now();
+  ShardIndexGenerator index_generator(file_names[0]);
+  if (index_generator.Build() != SUCCESS || index_generator.WriteToDatabase() != SUCCESS) {
+    MS_LOG(ERROR) << "Generate benchmark index failed.";
+    return FAILED;
+  }
+  double index_seconds = SecondsSince(start);
+
+  uint64_t file_bytes = 0;
+  for (const auto &file_name : file_names) {
+    struct stat file_stat;
+    if (stat(common::SafeCStr(file_name), &file_stat) == 0) file_bytes += static_cast<uint64_t>(file_stat.st_size);
+  }
+  double total_seconds = open_seconds + write_seconds + commit_seconds;
+  (*result)["open_seconds"] = open_seconds;
+  (*result)["write_seconds"] = write_seconds;
+  (*result)["commit_seconds"] = commit_seconds;
+  (*result)["index_seconds"] = index_seconds;
+  (*result)["written_mb"] = MegaBytes(write_bytes);
+  (*result)["file_mb"] = MegaBytes(file_bytes);
+  (*result)["write_mb_per_second"] = total_seconds > 0 ? MegaBytes(write_bytes) / total_seconds : 0.0;
+  (*result)["write_rows_per_second"] = total_seconds > 0 ? config.rows / total_seconds : 0.0;
+  return SUCCESS;
+}
+
+std::vector<std::shared_ptr<ShardOperator>> MakeOperators(const std::string &sampler) {
+  std::vector<std::shared_ptr<ShardOperator>> operators;
+  if (sampler == "shuffle") {
+    operators.push_back(std::make_shared<ShardShuffle>(1, kShuffleSample));
+  } else if (sampler == "distributed_shuffle") {
+    const int kNumShards = 4;
+    operators.push_back(std::make_shared<ShardDistributedSample>(kNumShards, 0, 0, true, 1));
+  }
+  return operators;
+}
+
+MSRStatus ReadDataset(const BenchmarkConfig &config, int n_consumer, bool block_reader, const std::string &sampler,
+                      json *result) {
+  auto file_names = ShardFileNames(config);
+  auto start = std::chrono::steady_clock::now();
+  ShardReader reader;
+  if (reader.Open({file_names[0]}, true, n_consumer, {"file_name", "label"}, MakeOperators(sampler), block_reader) !=
+      SUCCESS) {
+    MS_LOG(ERROR) << "Open benchmark reader failed.";
+    return FAILED;
+  }
+  double open_seconds = SecondsSince(start);
+  start = std::chrono::steady_clock::now();
+  if (reader.Launch() != SUCCESS) {
+    MS_LOG(ERROR) << "Launch benchmark reader failed.";
+    return FAILED;
+  }
+  double launch_seconds = SecondsSince(start);
+
+  start = std::chrono::steady_clock::now();
+  double first_row_seconds = 0.0;
+  uint64_t rows = 0;
+  uint64_t bytes = 0;
+  while (true) {
+    auto batch = reader.GetNext();
+    if (batch.empty()) break;
+    if (rows == 0) first_row_seconds = SecondsSince(start);
+    for (const auto &row : batch) {
+      bytes += std::get<0>(row).size();
+      rows++;
+    }
+  }
+  double read_seconds = SecondsSince(start);
+  reader.Finish();
+
+  (*result)["n_consumer"] = n_consumer;
+  (*result)["reader"] = block_reader ? "block" : "row";
+  (*result)["sampler"] = sampler;
+  (*result)["open_seconds"] = open_seconds;
+  (*result)["launch_seconds"] = launch_seconds;
+  (*result)["first_row_seconds"] = first_row_seconds;
+  (*result)["read_seconds"] = read_seconds;
+  (*result)["rows"] = rows;
+  (*result)["read_mb"] = MegaBytes(bytes);
+  (*result)["rows_per_second"] = read_seconds > 0 ? rows / read_seconds : 0.0;
+  (*result)["mb_per_second"] = read_seconds > 0 ? MegaBytes(bytes) / read_seconds : 0.0;
+  return SUCCESS;
+}
+
+int RunBenchmark(const BenchmarkConfig &config) {
+  (void)mkdir(common::SafeCStr(config.dir), S_IRWXU);
+  auto file_names = ShardFileNames(config);
+  RemoveFiles(file_names);
+
+  json report;
+  report["config"] = {{"rows", config.rows},       {"row_bytes", config.row_bytes}, {"shards", config.shards},
+                      {"page_size", config.page_size}, {"classes", config.classes},  {"consumers", config.consumers}};
+  json write_result;
+  if (WriteDataset(config, &write_result) != SUCCESS) {
+    RemoveFiles(file_names);
+    return 1;
+  }
+  report["write"] = write_result;
+
+  report["read"] = json::array();
+  for (int n_consumer : config.consumers) {
+    for (bool block_reader : {false, true}) {
+      for (const std::string sampler : {"none", "shuffle", "distributed_shuffle"}) {
+        // block-reader mode delivers whole row groups, shuffle operators are ignored by it
+        if (block_reader && sampler != "none") continue;
+        json read_result;
+        if (ReadDataset(config, n_consumer, block_reader, sampler, &read_result) != SUCCESS) {
+          RemoveFiles(file_names);
+          return 1;
+        }
+        MS_LOG(INFO) << "Benchmark read: " << read_result.dump();
+        report["read"].push_back(read_result);
+      }
+    }
+  }
+  if (!config.keep_files) {
+    RemoveFiles(file_names);
+  }
+
+  if (config.output.empty()) {
+    std::cout << report.dump(2) << std::endl;
+  } else {
+    std::ofstream out(config.output);
+    out << report.dump(2) << std::endl;
+    if (!out.good()) {
+      std::cerr << "Write benchmark result to " << config.output << " failed." << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+}  // namespace
+}  // namespace mindrecord
+}  // namespace mindspore
+
+int main(int argc, char **argv) {
+  mindspore::mindrecord::BenchmarkConfig config;
+  if (!mindspore::mindrecord::ParseArgs(argc, argv, &config)) {
+    return 1;
+  }
+  return mindspore::mindrecord::RunBenchmark(config);
+}
@@ -0,0 +1,128 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+import numpy as np
+
+import mindspore.context as context
+import mindspore.nn as nn
+from mindspore import Tensor
+from mindspore.common import dtype as mstype
+from mindspore.nn import Dense, TrainOneStepCell, WithLossCell
+from mindspore.nn.optim import Momentum
+from mindspore.ops import operations as P
+from mindspore.train import ParallelMode
+from mindspore.ops.operations.comm_ops import ReduceOp
+import mindspore._ms_mpi as mpi
+# run comand:
+# mpirun -np 3 python test_all_reduce.py
+
+context.set_context(mode=context.GRAPH_MODE, device_target='CPU')
+
+_GROUP = [0, 1, 2]
+
+
+class Net(nn.Cell):
+    def __init__(self, op=ReduceOp.SUM, algorithm="mpi"):
+        super(Net, self).__init__()
+        self.hostallreduce = P.HostAllReduce(op=op, group=_GROUP, algorithm=algorithm)
+
+    def construct(self, x):
+        return self.hostallreduce(x)
+
+
+class FusionNet(nn.Cell):
+    def __init__(self, algorithm="mpi"):
+        super(FusionNet, self).__init__()
+        self.hostallreduce1 = P.HostAllReduce(group=_GROUP, algorithm=algorithm)
+        self.hostallreduce1.add_prim_attr('fusion', 1)
+        self.hostallreduce2 = P.HostAllReduce(group=_GROUP, algorithm=algorithm)
+        self.hostallreduce2.add_prim_attr('fusion', 1)
+
+    def construct(self, x, y):
+        return self.hostallreduce1(x), self.hostallreduce2(y)
+
+
+class DenseNet(nn.Cell):
+    def __init__(self):
+        super(DenseNet, self).__init__()
+        self.reshape = P.Reshape()
+        weight = Tensor(np.ones([10, 16]).astype(np.float32) * 0.01)
+        self.fc1 = Dense(16, 10, weight_init=weight)
+
+    def construct(self, x):
+        output = self.reshape(x, (1, -1))
+        return self.fc1(output)
+
+
+def check(output, expect, error=1.0e-6):
+    diff = abs(output.asnumpy().astype(np.float32) - expect)
+    assert np.all(diff < error)
+
+
+def test_net_all_reduce():
+    rankid = mpi.get_rank_id()
+    print("self rankid:", rankid)
+    # 35 elements are not divided by 3 ranks, so the chunks of the ring differ
+    x = np.ones([5, 7]).astype(np.float32) * 0.1 * (rankid + 1)
+    for algorithm in ["mpi", "ring"]:
+        output = Net(algorithm=algorithm)(Tensor(x, mstype.float32))
+        check(output, np.ones([5, 7]).astype(np.float32) * 0.6)
+
+        output = Net(op=ReduceOp.MAX, algorithm=algorithm)(Tensor(x, mstype.float32))
+        check(output, np.ones([5, 7]).astype(np.float32) * 0.3)
+
+        output = Net(algorithm=algorithm)(Tensor(np.ones([5, 7]).astype(np.int32) * (rankid + 1)))
+        check(output, np.ones([5, 7]).astype(np.float32) * 6)
+
+        output = Net(algorithm=algorithm)(Tensor(x, mstype.float16))
+        check(output, np.ones([5, 7]).astype(np.float32) * 0.6, 1.0e-3)
+
+
+def test_net_all_reduce_fusion():
+    rankid = mpi.get_rank_id()
+    x = np.ones([3, 4]).astype(np.float32) * (rankid + 1)
+    y = np.ones([2, 5]).astype(np.float32) * 0.5 * (rankid + 1)
+    for algorithm in ["mpi", "ring"]:
+        output_x, output_y = FusionNet(algorithm)(Tensor(x, mstype.float32), Tensor(y, mstype.float32))
+        check(output_x, np.ones([3, 4]).astype(np.float32) * 6)
+        check(output_y, np.ones([2, 5]).astype(np.float32) * 3)
+
+
+def test_train_with_grad_reducer():
+    rankid = mpi.get_rank_id()
+    context.set_auto_parallel_context(parallel_mode=ParallelMode.DATA_PARALLEL, device_num=len(_GROUP))
+    net = DenseNet()
+    optimizer = Momentum(net.trainable_params(), learning_rate=0.1, momentum=0.9)
+    criterion = nn.SoftmaxCrossEntropyWithLogits(is_grad=False, sparse=True)
+    # the DistributedGradReducer of the data parallel TrainOneStepCell reduces the gradients by HostAllReduce
+    train_network = TrainOneStepCell(WithLossCell(net, criterion), optimizer)
+    train_network.set_train()
+    for _ in range(3):
+        # each rank trains with its own data
+        data = Tensor(np.arange(0, 16).reshape(1, 1, 4, 4).astype(np.float32) * 0.01 * (rankid + 1))
+        label = Tensor(np.array([rankid]).astype(np.int32))
+        train_network(data, label)
+    context.reset_auto_parallel_context()
+    weight = net.fc1.weight.data.asnumpy()
+    assert not np.allclose(weight, np.ones([10, 16]).astype(np.float32) * 0.01)
+    # the weights updated by the same reduced gradients are the same on all the ranks
+    output = Net()(Tensor(weight, mstype.float32))
+    check(output, weight * len(_GROUP), 1.0e-5)
+
+
+if __name__ == '__main__':
+    test_net_all_reduce()
+    test_net_all_reduce_fusion()
+    test_train_with_grad_reducer()
@@ -0,0 +1,76 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+import numpy as np
+import pytest
+
+import mindspore.context as context
+from mindspore import Tensor
+from mindspore.common import dtype as mstype
+from mindspore._c_expression import PynativeExecutor_
+from mindspore.ops import operations as P
+
+context.set_context(mode=context.PYNATIVE_MODE, device_target='CPU')
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_lazy_chain():
+    context.set_context(enable_pynative_lazy=True)
+    relu = P.ReLU()
+    mul = P.Mul()
+    x = np.random.uniform(-2, 2, (3, 4)).astype(np.float32)
+    y = np.random.uniform(-2, 2, (3, 4)).astype(np.float32)
+    compiled = PynativeExecutor_.lazy_trace_compiled()
+    for _ in range(3):
+        # the ops run as one graph when out is read, the graph is compiled on the first iteration only
+        hidden = relu(mul(Tensor(x), Tensor(y)))
+        out = mul(hidden, Tensor(y))
+        assert np.allclose(out.asnumpy(), np.maximum(x * y, 0) * y)
+        # hidden is still referenced, so it is computed too
+        assert np.allclose(hidden.asnumpy(), np.maximum(x * y, 0))
+        x, y = y, out.asnumpy()
+    assert PynativeExecutor_.lazy_trace_compiled() == compiled + 1
+    context.set_context(enable_pynative_lazy=False)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_lazy_mixed_with_eager():
+    context.set_context(enable_pynative_lazy=True)
+    relu = P.ReLU()
+    reshape = P.Reshape()
+    x = np.arange(-6, 6).reshape(3, 4).astype(np.float32)
+    # Reshape takes a constant input, it runs eagerly after the traced ReLU
+    out = reshape(relu(Tensor(x)), (4, 3))
+    assert (out.asnumpy() == np.maximum(x, 0).reshape(4, 3)).all()
+    context.set_context(enable_pynative_lazy=False)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_lazy_set_dtype():
+    context.set_context(enable_pynative_lazy=True)
+    relu = P.ReLU()
+    x = np.arange(-6, 6).reshape(3, 4).astype(np.float32)
+    out = relu(Tensor(x))
+    # the traced value is computed before it is converted, not the uninitialized buffer
+    out.set_dtype(mstype.int32)
+    assert out.dtype() == mstype.int32
+    assert (out.asnumpy() == np.maximum(x, 0).astype(np.int32)).all()
+    context.set_context(enable_pynative_lazy=False)
@@ -0,0 +1,54 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+import numpy as np
+import pytest
+
+import mindspore.context as context
+from mindspore import Tensor
+from mindspore.ops import operations as P
+
+context.set_context(mode=context.PYNATIVE_MODE, device_target='CPU')
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_relu_pynative():
+    relu = P.ReLU()
+    x = np.array([[-1, 1, 10], [1, -1, 1]]).astype(np.float32)
+    y = np.array([[2, -2, 0], [-3, 3, -1]]).astype(np.float32)
+    # the second call on the same shape reuses the kernel built by the first one
+    out_x = relu(Tensor(x))
+    out_y = relu(Tensor(y))
+    assert (out_x.asnumpy() == np.maximum(x, 0)).all()
+    assert (out_y.asnumpy() == np.maximum(y, 0)).all()
+
+    z = np.arange(-6, 6).reshape(3, 4).astype(np.float32)
+    out_z = relu(Tensor(z))
+    assert (out_z.asnumpy() == np.maximum(z, 0)).all()
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_mul_pynative():
+    mul = P.Mul()
+    x = np.random.uniform(-2, 2, (2, 3, 4)).astype(np.float32)
+    y = np.random.uniform(-2, 2, (2, 3, 4)).astype(np.float32)
+    for _ in range(3):
+        out = mul(Tensor(x), Tensor(y))
+        assert np.allclose(out.asnumpy(), x * y)
+        x, y = y, out.asnumpy()
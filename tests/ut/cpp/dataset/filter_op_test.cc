@@ -51,3 +51,92 @@ TEST_F(MindDataTestfilter_op, Testfilter_opFuntions) {
   ASSERT_NE(parent_op, nullptr);
   ASSERT_NE(leaf_op, nullptr);
 }
+
+TEST_F(MindDataTestfilter_op, TestNativePredicate) {
+  MS_LOG(INFO) << "Doing MindDataTest filter_op native predicate.";
+  std::vector<std::string> texts = {"", "a", "abc", "abcdef", "abcdefgh", "ab"};
+  TensorTable table;
+  for (int32_t i = 0; i < static_cast<int32_t>(texts.size()); i++) {
+    std::shared_ptr<Tensor> label;
+    std::shared_ptr<Tensor> text;
+    Status rc = Tensor::CreateTensor(&label, TensorImpl::kFlexible, TensorShape::CreateScalar(),
+                                     DataType(DataType::DE_INT32), reinterpret_cast<const unsigned char *>(&i));
+    EXPECT_TRUE(rc.IsOk());
+    rc = Tensor::CreateTensor(&text, std::vector<std::string>{texts[i]}, TensorShape::CreateScalar());
+    EXPECT_TRUE(rc.IsOk());
+    table.push_back({text, label});
+  }
+  std::unordered_map<std::string, int32_t> col_map = {{"text", 0}, {"label", 1}};
+
+  FilterPredicate length_pred;
+  EXPECT_TRUE(length_pred.AddLengthRange("text", 1, 3).IsOk());
+  std::vector<uint8_t> selected;
+  EXPECT_TRUE(length_pred.Evaluate(table, col_map, &selected).IsOk());
+  EXPECT_EQ(selected, std::vector<uint8_t>({0, 1, 1, 0, 0, 1}));
+
+  // Clauses are combined with and
+  EXPECT_TRUE(length_pred.AddValueIn("label", {2, 4, 5}).IsOk());
+  EXPECT_TRUE(length_pred.Evaluate(table, col_map, &selected).IsOk());
+  EXPECT_EQ(selected, std::vector<uint8_t>({0, 0, 1, 0, 0, 1}));
+
+  FilterPredicate range_pred;
+  EXPECT_TRUE(range_pred.AddValueRange("label", 1, 3.5).IsOk());
+  EXPECT_TRUE(range_pred.Evaluate(table, col_map, &selected).IsOk());
+  EXPECT_EQ(selected, std::vector<uint8_t>({0, 1, 1, 1, 0, 0}));
+
+  FilterPredicate string_pred;
+  EXPECT_TRUE(string_pred.AddStringIn("text", {"ab", "abcdef", "x"}).IsOk());
+  EXPECT_TRUE(string_pred.Evaluate(table, col_map, &selected).IsOk());
+  EXPECT_EQ(selected, std::vector<uint8_t>({0, 0, 0, 1, 0, 1}));
+
+  // An empty set keeps no row, also when its type differs from the column
+  FilterPredicate empty_pred;
+  EXPECT_TRUE(empty_pred.AddStringIn("label", {}).IsOk());
+  EXPECT_TRUE(empty_pred.Evaluate(table, col_map, &selected).IsOk());
+  EXPECT_EQ(selected, std::vector<uint8_t>(texts.size(), 0));
+  FilterPredicate empty_value_pred;
+  EXPECT_TRUE(empty_value_pred.AddIntegerIn("text", {}).IsOk());
+  EXPECT_TRUE(empty_value_pred.Evaluate(table, col_map, &selected).IsOk());
+  EXPECT_EQ(selected, std::vector<uint8_t>(texts.size(), 0));
+
+  // A value range needs a numeric column, a missing column is an error
+  FilterPredicate bad_pred;
+  EXPECT_TRUE(bad_pred.AddValueRange("text", 0, 1).IsOk());
+  EXPECT_FALSE(bad_pred.Evaluate(table, col_map, &selected).IsOk());
+  FilterPredicate missing_pred;
+  EXPECT_TRUE(missing_pred.AddValueRange("image", 0, 1).IsOk());
+  EXPECT_FALSE(missing_pred.Evaluate(table, col_map, &selected).IsOk());
+}
+
+TEST_F(MindDataTestfilter_op, TestNativePredicateInt64) {
+  MS_LOG(INFO) << "Doing MindDataTest filter_op native predicate with int64 values.";
+  // 2^53 and its neighbours are not distinct as double
+  const int64_t base = int64_t(1) << 53;
+  TensorTable table;
+  for (int64_t i = 0; i < 3; i++) {
+    int64_t value = base + i;
+    std::shared_ptr<Tensor> label;
+    Status rc = Tensor::CreateTensor(&label, TensorImpl::kFlexible, TensorShape::CreateScalar(),
+                                     DataType(DataType::DE_INT64), reinterpret_cast<const unsigned char *>(&value));
+    EXPECT_TRUE(rc.IsOk());
+    table.push_back({label});
+  }
+  std::unordered_map<std::string, int32_t> col_map = {{"label", 0}};
+  std::vector<uint8_t> selected;
+
+  FilterPredicate in_pred;
+  EXPECT_TRUE(in_pred.AddIntegerIn("label", {base + 1}).IsOk());
+  EXPECT_TRUE(in_pred.Evaluate(table, col_map, &selected).IsOk());
+  EXPECT_EQ(selected, std::vector<uint8_t>({0, 1, 0}));
+
+  FilterPredicate range_pred;
+  EXPECT_TRUE(range_pred.AddIntegerRange("label", base + 1, base + 2).IsOk());
+  EXPECT_TRUE(range_pred.Evaluate(table, col_map, &selected).IsOk());
+  EXPECT_EQ(selected, std::vector<uint8_t>({0, 1, 1}));
+
+  // double bounds are compared with the integers exactly too
+  FilterPredicate double_pred;
+  EXPECT_TRUE(double_pred.AddValueRange("label", 0, static_cast<double>(base)).IsOk());
+  EXPECT_TRUE(double_pred.Evaluate(table, col_map, &selected).IsOk());
+  EXPECT_EQ(selected, std::vector<uint8_t>({1, 0, 0}));
+}
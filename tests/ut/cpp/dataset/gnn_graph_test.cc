@@ -13,12 +13,15 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <string>
 #include <memory>
 
 #include "common/common.h"
 #include "gtest/gtest.h"
 #include "dataset/util/status.h"
+#include "dataset/engine/gnn/csr_adjacency.h"
+#include "dataset/engine/gnn/graph_snapshot.h"
 #include "dataset/engine/gnn/node.h"
 #include "dataset/engine/gnn/graph_loader.h"
 
@@ -28,6 +31,45 @@ using namespace mindspore::dataset::gnn;
 class MindDataTestGNNGraph : public UT::Common {
  protected:
   MindDataTestGNNGraph() = default;
+
+  // Return the first 10 nodes of node_info[1].type and the meta info of the test graph
+  void LoadTestNodes(Graph *graph, std::vector<NodeMetaInfo> *node_info, std::vector<NodeIdType> *node_list) {
+    std::vector<EdgeMetaInfo> edge_info;
+    ASSERT_TRUE(graph->Init().IsOk());
+    ASSERT_TRUE(graph->GetMetaInfo(node_info, &edge_info).IsOk());
+    ASSERT_TRUE(node_info->size() == 2);
+    std::shared_ptr<Tensor> nodes;
+    ASSERT_TRUE(graph->GetNodes((*node_info)[1].type, -1, &nodes).IsOk());
+    for (auto itr = nodes->begin<NodeIdType>(); itr != nodes->end<NodeIdType>() && node_list->size() < 10; ++itr) {
+      node_list->push_back(*itr);
+    }
+  }
+
+  // Check that every id in columns [begin, end) of each row is -1 or one of the neighbors of the row's node
+  void CheckNeighbors(const std::shared_ptr<Tensor> &neighbors, const std::shared_ptr<Tensor> &samples, dsize_t begin,
+                      dsize_t end, bool expect_neighbor) {
+    dsize_t rows = samples->shape()[0];
+    for (dsize_t i = 0; i < rows; ++i) {
+      NodeIdType node_id;
+      ASSERT_TRUE(samples->GetItemAt(&node_id, {i, 0}).IsOk());
+      NodeIdType expect_id;
+      ASSERT_TRUE(neighbors->GetItemAt(&expect_id, {i, 0}).IsOk());
+      EXPECT_EQ(node_id, expect_id);
+      std::vector<NodeIdType> all;
+      for (dsize_t k = 1; k < neighbors->shape()[1]; ++k) {
+        NodeIdType id;
+        ASSERT_TRUE(neighbors->GetItemAt(&id, {i, k}).IsOk());
+        if (id != kDefaultNodeId) all.push_back(id);
+      }
+      for (dsize_t k = begin; k < end; ++k) {
+        NodeIdType id;
+        ASSERT_TRUE(samples->GetItemAt(&id, {i, k}).IsOk());
+        if (id == kDefaultNodeId) continue;
+        EXPECT_EQ(std::find(all.begin(), all.end(), id) != all.end(), expect_neighbor);
+        if (!expect_neighbor) EXPECT_NE(id, node_id);
+      }
+    }
+  }
 };
 
 TEST_F(MindDataTestGNNGraph, TestGraphLoader) {
@@ -91,3 +133,254 @@ TEST_F(MindDataTestGNNGraph, TestGetAllNeighbors) {
   EXPECT_TRUE(features[2]->shape().ToString() == "<10>");
   EXPECT_TRUE(features[2]->ToString() == "Tensor (shape: <10>, Type: int32)\n[1,2,3,1,4,3,5,3,5,4]");
 }
+
+TEST_F(MindDataTestGNNGraph, TestGetNodeFeatureBatch) {
+  std::string path = "data/mindrecord/testGraphData/testdata";
+  Graph graph(path, 4);
+  std::vector<NodeMetaInfo> node_info;
+  std::vector<NodeIdType> node_list;
+  LoadTestNodes(&graph, &node_info, &node_list);
+
+  std::shared_ptr<Tensor> nodes;
+  EXPECT_TRUE(Tensor::CreateTensor(&nodes, TensorImpl::kFlexible,
+                                   TensorShape({static_cast<dsize_t>(node_list.size())}), DataType(DataType::DE_INT32),
+                                   reinterpret_cast<const unsigned char *>(node_list.data()))
+                .IsOk());
+  TensorRow expect;
+  EXPECT_TRUE(graph.GetNodeFeature(nodes, node_info[1].feature_type, &expect).IsOk());
+  ASSERT_TRUE(expect.size() == 3);
+
+  // Large enough to be gathered by several workers, every second column asks for the default feature
+  const dsize_t rows = 3000;
+  std::vector<NodeIdType> batch;
+  for (dsize_t i = 0; i < rows; ++i) {
+    batch.push_back(node_list[i % node_list.size()]);
+    batch.push_back(kDefaultNodeId);
+  }
+  std::shared_ptr<Tensor> batch_nodes;
+  EXPECT_TRUE(Tensor::CreateTensor(&batch_nodes, TensorImpl::kFlexible, TensorShape({rows, 2}),
+                                   DataType(DataType::DE_INT32), reinterpret_cast<const unsigned char *>(batch.data()))
+                .IsOk());
+  TensorRow features;
+  EXPECT_TRUE(graph.GetNodeFeature(batch_nodes, node_info[1].feature_type, &features).IsOk());
+  ASSERT_TRUE(features.size() == 3);
+  EXPECT_TRUE(features[0]->shape().ToString() == "<3000,2,5>");
+  EXPECT_TRUE(features[2]->shape().ToString() == "<3000,2>");
+  for (dsize_t i = 0; i < rows; ++i) {
+    int32_t value, default_value, expect_value;
+    ASSERT_TRUE(features[2]->GetItemAt(&value, {i, 0}).IsOk());
+    ASSERT_TRUE(features[2]->GetItemAt(&default_value, {i, 1}).IsOk());
+    ASSERT_TRUE(expect[2]->GetItemAt(&expect_value, {i % static_cast<dsize_t>(node_list.size())}).IsOk());
+    EXPECT_EQ(value, expect_value);
+    EXPECT_EQ(default_value, 0);
+  }
+
+  batch[1] = 99999;
+  EXPECT_TRUE(Tensor::CreateTensor(&batch_nodes, TensorImpl::kFlexible, TensorShape({rows, 2}),
+                                   DataType(DataType::DE_INT32), reinterpret_cast<const unsigned char *>(batch.data()))
+                .IsOk());
+  EXPECT_FALSE(graph.GetNodeFeature(batch_nodes, node_info[1].feature_type, &features).IsOk());
+}
+
+TEST_F(MindDataTestGNNGraph, TestGetSampledNeighbors) {
+  std::string path = "data/mindrecord/testGraphData/testdata";
+  Graph graph(path, 2);
+  std::vector<NodeMetaInfo> node_info;
+  std::vector<NodeIdType> node_list;
+  LoadTestNodes(&graph, &node_info, &node_list);
+
+  std::shared_ptr<Tensor> neighbors;
+  EXPECT_TRUE(graph.GetAllNeighbors(node_list, node_info[0].type, &neighbors).IsOk());
+  std::shared_ptr<Tensor> samples;
+  Status s = graph.GetSampledNeighbor(node_list, {2, 3}, {node_info[0].type, node_info[1].type}, &samples);
+  EXPECT_TRUE(s.IsOk());
+  EXPECT_TRUE(samples->shape().ToString() == "<10,9>");
+  CheckNeighbors(neighbors, samples, 1, 3, true);
+
+  s = graph.GetSampledNeighbor(node_list, {2}, {node_info[0].type, node_info[1].type}, &samples);
+  EXPECT_FALSE(s.IsOk());
+  s = graph.GetSampledNeighbor(node_list, {0}, {node_info[0].type}, &samples);
+  EXPECT_FALSE(s.IsOk());
+  s = graph.GetSampledNeighbor({-100}, {2}, {node_info[0].type}, &samples);
+  EXPECT_FALSE(s.IsOk());
+}
+
+TEST_F(MindDataTestGNNGraph, TestGetNegSampledNeighbors) {
+  std::string path = "data/mindrecord/testGraphData/testdata";
+  Graph graph(path, 2);
+  std::vector<NodeMetaInfo> node_info;
+  std::vector<NodeIdType> node_list;
+  LoadTestNodes(&graph, &node_info, &node_list);
+
+  std::shared_ptr<Tensor> neighbors;
+  EXPECT_TRUE(graph.GetAllNeighbors(node_list, node_info[0].type, &neighbors).IsOk());
+  std::shared_ptr<Tensor> samples;
+  Status s = graph.GetNegSampledNeighbor(node_list, 3, node_info[0].type, &samples);
+  EXPECT_TRUE(s.IsOk());
+  EXPECT_TRUE(samples->shape().ToString() == "<10,4>");
+  CheckNeighbors(neighbors, samples, 1, 4, false);
+
+  s = graph.GetNegSampledNeighbor(node_list, 0, node_info[0].type, &samples);
+  EXPECT_FALSE(s.IsOk());
+}
+
+TEST_F(MindDataTestGNNGraph, TestRandomWalk) {
+  std::string path = "data/mindrecord/testGraphData/testdata";
+  Graph graph(path, 2);
+  std::vector<NodeMetaInfo> node_info;
+  std::vector<NodeIdType> node_list;
+  LoadTestNodes(&graph, &node_info, &node_list);
+
+  std::shared_ptr<Tensor> neighbors;
+  EXPECT_TRUE(graph.GetAllNeighbors(node_list, node_info[0].type, &neighbors).IsOk());
+  std::shared_ptr<Tensor> walks;
+  Status s = graph.RandomWalk(node_list, {node_info[0].type, node_info[1].type}, 1.0, 1.0, -1, &walks);
+  EXPECT_TRUE(s.IsOk());
+  EXPECT_TRUE(walks->shape().ToString() == "<10,3>");
+  CheckNeighbors(neighbors, walks, 1, 2, true);
+
+  s = graph.RandomWalk(node_list, {node_info[0].type, node_info[1].type}, 0.5, 2.0, -1, &walks);
+  EXPECT_TRUE(s.IsOk());
+  EXPECT_TRUE(walks->shape().ToString() == "<10,3>");
+  CheckNeighbors(neighbors, walks, 1, 2, true);
+
+  s = graph.RandomWalk(node_list, {}, 1.0, 1.0, -1, &walks);
+  EXPECT_FALSE(s.IsOk());
+  s = graph.RandomWalk(node_list, {node_info[0].type}, 0.0, 1.0, -1, &walks);
+  EXPECT_FALSE(s.IsOk());
+}
+
+TEST_F(MindDataTestGNNGraph, TestCsrAdjacencyWeightedSample) {
+  CsrAdjacency adjacency;
+  std::vector<std::pair<NodeIndexType, NodeIndexType>> edges = {{0, 3}, {0, 1}, {0, 2}, {2, 0}};
+  std::vector<EdgeWeightType> weights = {7.0, 1.0, 2.0, 5.0};
+  EXPECT_TRUE(adjacency.Build(4, &edges, &weights).IsOk());
+  EXPECT_TRUE(adjacency.weighted());
+  EXPECT_EQ(adjacency.num_edges(), 4);
+  EXPECT_EQ(adjacency.Degree(0), 3);
+  EXPECT_EQ(adjacency.Degree(1), 0);
+  EXPECT_TRUE(adjacency.HasNeighbor(0, 3));
+  EXPECT_FALSE(adjacency.HasNeighbor(1, 0));
+
+  std::mt19937 rnd(0);
+  std::vector<int> counts(4, 0);
+  const int kSamples = 100000;
+  for (int i = 0; i < kSamples; ++i) {
+    counts[adjacency.SampleNeighbor(0, &rnd)]++;
+  }
+  EXPECT_EQ(counts[0], 0);
+  EXPECT_NEAR(counts[1] / static_cast<double>(kSamples), 0.1, 0.01);
+  EXPECT_NEAR(counts[2] / static_cast<double>(kSamples), 0.2, 0.01);
+  EXPECT_NEAR(counts[3] / static_cast<double>(kSamples), 0.7, 0.01);
+
+  edges = {{0, 1}};
+  weights = {-1.0};
+  EXPECT_FALSE(adjacency.Build(2, &edges, &weights).IsOk());
+
+  // Zero-weight edges are kept but never drawn, a row of zero weights is drawn uniformly
+  edges = {{0, 1}, {0, 2}, {0, 3}, {1, 0}, {1, 2}};
+  weights = {0.0, 3.0, 0.0, 0.0, 0.0};
+  EXPECT_TRUE(adjacency.Build(4, &edges, &weights).IsOk());
+  EXPECT_TRUE(adjacency.HasNeighbor(0, 1));
+  counts.assign(4, 0);
+  for (int i = 0; i < kSamples; ++i) {
+    counts[adjacency.SampleNeighbor(0, &rnd)]++;
+  }
+  EXPECT_EQ(counts[2], kSamples);
+  counts.assign(4, 0);
+  for (int i = 0; i < kSamples; ++i) {
+    counts[adjacency.SampleNeighbor(1, &rnd)]++;
+  }
+  EXPECT_NEAR(counts[0] / static_cast<double>(kSamples), 0.5, 0.01);
+  EXPECT_NEAR(counts[2] / static_cast<double>(kSamples), 0.5, 0.01);
+}
+
+TEST_F(MindDataTestGNNGraph, TestCsrAdjacencyAttachCorrupted) {
+  CsrAdjacency adjacency;
+  std::vector<int64_t> offsets = {0, 2, 2, 3};
+  std::vector<NodeIndexType> neighbors = {1, 2, 0};
+  EXPECT_TRUE(adjacency.Attach(3, 3, offsets.data(), neighbors.data(), nullptr, nullptr).IsOk());
+  EXPECT_EQ(adjacency.Degree(0), 2);
+
+  // Offsets which go backwards
+  std::vector<int64_t> bad_offsets = {0, 3, 1, 3};
+  EXPECT_FALSE(adjacency.Attach(3, 3, bad_offsets.data(), neighbors.data(), nullptr, nullptr).IsOk());
+  // Neighbors out of the node range
+  std::vector<NodeIndexType> bad_neighbors = {1, 3, 0};
+  EXPECT_FALSE(adjacency.Attach(3, 3, offsets.data(), bad_neighbors.data(), nullptr, nullptr).IsOk());
+  bad_neighbors = {1, -1, 0};
+  EXPECT_FALSE(adjacency.Attach(3, 3, offsets.data(), bad_neighbors.data(), nullptr, nullptr).IsOk());
+
+  std::vector<float> alias_prob = {0.5, 1.0, 1.0};
+  std::vector<NodeIndexType> alias = {1, 1, 0};
+  EXPECT_TRUE(adjacency.Attach(3, 3, offsets.data(), neighbors.data(), alias_prob.data(), alias.data()).IsOk());
+  EXPECT_TRUE(adjacency.weighted());
+  // Alias slots past the row of the node
+  std::vector<NodeIndexType> bad_alias = {1, 1, 1};
+  EXPECT_FALSE(adjacency.Attach(3, 3, offsets.data(), neighbors.data(), alias_prob.data(), bad_alias.data()).IsOk());
+  bad_alias = {-1, 1, 0};
+  EXPECT_FALSE(adjacency.Attach(3, 3, offsets.data(), neighbors.data(), alias_prob.data(), bad_alias.data()).IsOk());
+  // Probabilities out of [0, 1]
+  std::vector<float> bad_alias_prob = {1.5, 1.0, 1.0};
+  EXPECT_FALSE(adjacency.Attach(3, 3, offsets.data(), neighbors.data(), bad_alias_prob.data(), alias.data()).IsOk());
+}
+
+TEST_F(MindDataTestGNNGraph, TestGraphSnapshot) {
+  std::string path = "data/mindrecord/testGraphData/testdata";
+  std::string snapshot_file = "./test_graph.snapshot";
+  Graph graph(path, 2);
+  EXPECT_TRUE(graph.Init().IsOk());
+  EXPECT_TRUE(graph.SaveSnapshot(snapshot_file).IsOk());
+  EXPECT_TRUE(GraphSnapshotReader::IsSnapshot(snapshot_file));
+  EXPECT_FALSE(GraphSnapshotReader::IsSnapshot(path));
+
+  Graph snapshot_graph(snapshot_file, 2);
+  EXPECT_TRUE(snapshot_graph.Init().IsOk());
+  std::vector<NodeMetaInfo> node_info, snapshot_node_info;
+  std::vector<EdgeMetaInfo> edge_info, snapshot_edge_info;
+  EXPECT_TRUE(graph.GetMetaInfo(&node_info, &edge_info).IsOk());
+  EXPECT_TRUE(snapshot_graph.GetMetaInfo(&snapshot_node_info, &snapshot_edge_info).IsOk());
+  ASSERT_EQ(node_info.size(), snapshot_node_info.size());
+  EXPECT_EQ(edge_info.size(), snapshot_edge_info.size());
+
+  for (const auto &info : node_info) {
+    std::shared_ptr<Tensor> nodes, snapshot_nodes;
+    EXPECT_TRUE(graph.GetNodes(info.type, -1, &nodes).IsOk());
+    EXPECT_TRUE(snapshot_graph.GetNodes(info.type, -1, &snapshot_nodes).IsOk());
+    std::vector<NodeIdType> node_list(nodes->begin<NodeIdType>(), nodes->end<NodeIdType>());
+    std::vector<NodeIdType> snapshot_list(snapshot_nodes->begin<NodeIdType>(), snapshot_nodes->end<NodeIdType>());
+    std::sort(node_list.begin(), node_list.end());
+    EXPECT_EQ(node_list, snapshot_list);
+
+    std::shared_ptr<Tensor> neighbors, snapshot_neighbors;
+    EXPECT_TRUE(graph.GetAllNeighbors(node_list, node_info[0].type, &neighbors).IsOk());
+    EXPECT_TRUE(snapshot_graph.GetAllNeighbors(node_list, node_info[0].type, &snapshot_neighbors).IsOk());
+    EXPECT_EQ(neighbors->ToString(), snapshot_neighbors->ToString());
+
+    std::shared_ptr<Tensor> node_tensor;
+    EXPECT_TRUE(Tensor::CreateTensor(&node_tensor, TensorImpl::kFlexible,
+                                     TensorShape({static_cast<dsize_t>(node_list.size())}),
+                                     DataType(DataType::DE_INT32),
+                                     reinterpret_cast<const unsigned char *>(node_list.data()))
+                  .IsOk());
+    TensorRow features, snapshot_features;
+    EXPECT_TRUE(graph.GetNodeFeature(node_tensor, info.feature_type, &features).IsOk());
+    EXPECT_TRUE(snapshot_graph.GetNodeFeature(node_tensor, info.feature_type, &snapshot_features).IsOk());
+    ASSERT_EQ(features.size(), snapshot_features.size());
+    for (size_t i = 0; i < features.size(); ++i) {
+      EXPECT_EQ(features[i]->ToString(), snapshot_features[i]->ToString());
+    }
+  }
+
+  // A graph served from the mapped tables writes the same snapshot again
+  std::string resaved_file = "./test_graph_resaved.snapshot";
+  EXPECT_TRUE(snapshot_graph.SaveSnapshot(resaved_file).IsOk());
+  Graph resaved_graph(resaved_file, 1);
+  EXPECT_TRUE(resaved_graph.Init().IsOk());
+  std::shared_ptr<Tensor> nodes, resaved_nodes;
+  EXPECT_TRUE(snapshot_graph.GetNodes(node_info[0].type, -1, &nodes).IsOk());
+  EXPECT_TRUE(resaved_graph.GetNodes(node_info[0].type, -1, &resaved_nodes).IsOk());
+  EXPECT_EQ(nodes->ToString(), resaved_nodes->ToString());
+  (void)remove(resaved_file.c_str());
+  (void)remove(snapshot_file.c_str());
+}
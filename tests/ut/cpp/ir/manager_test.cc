@@ -21,6 +21,7 @@
 #include "pipeline/parse/parse.h"
 #include "operator/ops.h"
 #include "utils/log_adapter.h"
+#include "utils/profile.h"
 #include "debug/draw.h"
 #include "debug/label.h"
 #include "./common.h"
@@ -406,6 +407,35 @@ std::vector<FuncGraphPtr> MakeNestedGraph2() {
   return result;
 }
 
+std::vector<FuncGraphPtr> MakeChainOfClosures(size_t num, std::vector<CNodePtr> *calls) {
+  /* build a chain of closures */
+  /*
+   *def root(x):
+   *    def sub_i(y):
+   *         return y + x
+   *    c_0 = sub_0(x)
+   *    c_i = sub_i(c_{i-1})
+   *    return c_{num-1}
+   */
+  FuncGraphPtr root = std::make_shared<FuncGraph>();
+  ParameterPtr x = root->add_parameter();
+  std::vector<FuncGraphPtr> result = {root};
+  AnfNodePtr arg = x;
+  for (size_t i = 0; i < num; ++i) {
+    FuncGraphPtr sub = std::make_shared<FuncGraph>();
+    ParameterPtr y = sub->add_parameter();
+    CNodePtr cnode_add = sub->NewCNode({NewValueNode(prim::kPrimScalarAdd), y, x});
+    sub->set_return(sub->NewCNode({NewValueNode(prim::kPrimReturn), cnode_add}));
+    result.push_back(sub);
+
+    CNodePtr cnode_call = root->NewCNode({NewValueNode(sub), arg});
+    calls->push_back(cnode_call);
+    arg = cnode_call;
+  }
+  root->set_return(root->NewCNode({NewValueNode(prim::kPrimReturn), arg}));
+  return result;
+}
+
 // Add TestManager::CheckManager function to checkout the result
 void TestManager::CheckAnalysisSize(std::shared_ptr<FuncGraphManager> mng) {
   auto size = mng->func_graphs().size();
@@ -687,4 +717,73 @@ TEST_F(TestManager, test_keep_roots_recursion) {
   ASSERT_EQ(mng->func_graphs().size(), 1);
 }
 
+TEST_F(TestManager, test_replace_cost) {
+  constexpr size_t kNumClosures = 512;
+
+  // inline every other call of a chain of closures, reading the used graphs of the live graphs after each replace as
+  // the optimizer passes do, return the number of recomputes and the time taken
+  auto inline_calls = [kNumClosures](bool reset_all, std::vector<FuncGraphPtr> *graphs, FuncGraphManagerPtr *mng,
+                                     size_t *recomputes, double *cost) {
+    std::vector<CNodePtr> calls;
+    *graphs = MakeChainOfClosures(kNumClosures, &calls);
+    FuncGraphPtr root = (*graphs)[0];
+    AnfNodePtr x = root->parameters()[0];
+    *mng = Manage(root);
+    ASSERT_EQ((*mng)->func_graphs().size(), kNumClosures + 1);
+    for (auto &fg : *graphs) {
+      (void)(*mng)->func_graphs_used_total(fg);
+    }
+    auto &used_total = (*mng)->func_graphs_used_total_computer();
+    ASSERT_EQ(used_total->recompute_count(), kNumClosures + 1);
+
+    double start = GetTime();
+    for (size_t i = 0; i < kNumClosures; i += 2) {
+      AnfNodePtr arg = i == 0 ? x : calls[i - 1];
+      CNodePtr cnode_add = root->NewCNode({NewValueNode(prim::kPrimScalarAdd), arg, x});
+      ASSERT_TRUE((*mng)->Replace(calls[i], cnode_add));
+      if (reset_all) {
+        // what an edge change did before the analyses were invalidated per graph
+        used_total->Reset();
+      }
+      ASSERT_EQ((*mng)->func_graphs_used_total(root).size(), kNumClosures - i / 2 - 1);
+      FuncGraphSet live = (*mng)->func_graphs();
+      for (auto &fg : live) {
+        if (fg != root) {
+          ASSERT_TRUE((*mng)->func_graphs_used_total(fg).empty());
+        }
+      }
+    }
+    *cost = GetTime() - start;
+    *recomputes = used_total->recompute_count() - (kNumClosures + 1);
+  };
+
+  std::vector<FuncGraphPtr> graphs;
+  FuncGraphManagerPtr mng = nullptr;
+  size_t before_recomputes = 0;
+  double before_cost = 0;
+  inline_calls(true, &graphs, &mng, &before_recomputes, &before_cost);
+  size_t recomputes = 0;
+  double cost = 0;
+  inline_calls(false, &graphs, &mng, &recomputes, &cost);
+  size_t inlined = kNumClosures / 2;
+  MS_LOG(INFO) << "Replace " << inlined << " calls of " << kNumClosures << " closures, resetting the analyses: "
+               << before_recomputes << " recomputes in " << before_cost << "s, invalidating the changed graphs: "
+               << recomputes << " recomputes in " << cost << "s";
+  // only the root is recomputed after each replace, rather than every live graph
+  ASSERT_EQ(recomputes, inlined);
+  ASSERT_GT(before_recomputes, inlined * (kNumClosures / 2));
+  FuncGraphPtr root = graphs[0];
+
+  // parent, children and scopes are still recomputed as a whole, they are only checked once
+  ASSERT_EQ(mng->func_graphs().size(), kNumClosures - inlined + 1);
+  ASSERT_EQ(mng->children(root).size(), kNumClosures - inlined);
+  for (size_t i = 1; i < kNumClosures; i += 2) {
+    ASSERT_TRUE(mng->func_graphs().contains(graphs[i + 1]));
+    ASSERT_EQ(mng->parent(graphs[i + 1]), root);
+    ASSERT_EQ(mng->scopes(graphs[i + 1]).size(), 1);
+    ASSERT_FALSE(mng->recursive(graphs[i + 1]));
+  }
+  ASSERT_EQ(mng->free_variables_total()[graphs[2]].size(), 1);
+}
+
 }  // namespace mindspore
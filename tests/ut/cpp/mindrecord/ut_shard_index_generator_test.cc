@@ -33,6 +33,7 @@
 #include "mindrecord/include/shard_index_generator.h"
 #include "mindrecord/include/shard_index.h"
 #include "mindrecord/include/shard_statistics.h"
+#include "mindrecord/include/shard_zone_map.h"
 #include "securec.h"
 #include "ut_common.h"
 
@@ -81,5 +82,40 @@ TEST_F(TestShardIndexGenerator, TakeFieldType) {
   auto type5 = ShardIndexGenerator::TakeFieldType("label", schema2);
   ASSERT_EQ("array", type5);
 }
+
+TEST_F(TestShardIndexGenerator, ZoneMapMayContain) {
+  MS_LOG(INFO) << FormatInfo("Test ShardZoneMap: skip row groups by statistics");
+
+  ShardZoneMap zone_map;
+  zone_map.AddStatistics(0, 0, "label_0", "3", "17", 5, true);
+  zone_map.AddStatistics(0, 1, "file_name_0", "image_00010.jpg", "image_00019.jpg", 10, false);
+  ASSERT_EQ(zone_map.Size(), 2);
+
+  ASSERT_TRUE(zone_map.MayContain(0, 0, "label_0", "3"));
+  ASSERT_TRUE(zone_map.MayContain(0, 0, "label_0", "10"));
+  ASSERT_FALSE(zone_map.MayContain(0, 0, "label_0", "2"));
+  ASSERT_FALSE(zone_map.MayContain(0, 0, "label_0", "18"));
+
+  ASSERT_TRUE(zone_map.MayContain(0, 1, "file_name_0", "image_00015.jpg"));
+  ASSERT_FALSE(zone_map.MayContain(0, 1, "file_name_0", "image_00020.jpg"));
+
+  // no statistics, every row group may match
+  ASSERT_TRUE(zone_map.MayContain(1, 0, "label_0", "100"));
+  ASSERT_TRUE(zone_map.MayContain(0, 0, "file_name_0", "image_00099.jpg"));
+  ASSERT_EQ(zone_map.GetDistinctCount(0, 0, "label_0"), 5);
+  ASSERT_EQ(zone_map.GetDistinctCount(1, 0, "label_0"), -1);
+
+  // int64 bounds above 2^53 are kept exactly
+  zone_map.AddStatistics(1, 0, "id", "9007199254740993", "9007199254740995", 3, true);
+  ASSERT_FALSE(zone_map.MayContain(1, 0, "id", "9007199254740992"));
+  ASSERT_TRUE(zone_map.MayContain(1, 0, "id", "9007199254740993"));
+  ASSERT_FALSE(zone_map.MayContain(1, 0, "id", "9007199254740996"));
+
+  // dropping a shard keeps the statistics of the others
+  zone_map.Erase(1);
+  ASSERT_EQ(zone_map.Size(), 2);
+  ASSERT_TRUE(zone_map.MayContain(1, 0, "id", "9007199254740992"));
+  ASSERT_FALSE(zone_map.MayContain(0, 0, "label_0", "2"));
+}
 }  // namespace mindrecord
 }  // namespace mindspore
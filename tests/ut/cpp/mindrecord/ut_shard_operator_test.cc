@@ -18,6 +18,7 @@
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -519,5 +520,48 @@ TEST_F(TestShardOperator, TestShardCategorySampleShuffle) {
   ASSERT_EQ(category_no, 0);
   ASSERT_TRUE(i <= kSampleSize);
 }
+
+TEST_F(TestShardOperator, TestShardTaskFeistelPermute) {
+  MS_LOG(INFO) << common::SafeCStr(FormatInfo("Test feistel permutation of shard task"));
+  for (uint64_t n : {1, 2, 3, 10, 255, 1000, 4097}) {
+    for (uint32_t seed = 0; seed < 3; ++seed) {
+      std::set<uint64_t> ids;
+      for (uint64_t i = 0; i < n; ++i) {
+        auto id = ShardTask::FeistelPermute(i, n, seed);
+        ASSERT_LT(id, n);
+        ids.insert(id);
+      }
+      ASSERT_EQ(ids.size(), n);
+    }
+  }
+}
+
+TEST_F(TestShardOperator, TestShardTaskLazyRowGroup) {
+  MS_LOG(INFO) << common::SafeCStr(FormatInfo("Test lazy task list of shard task"));
+  ShardTask tasks;
+  tasks.InsertRowGroup(0, 0, 0, 10);
+  tasks.InsertRowGroup(0, 1, 10, 0);
+  tasks.InsertRowGroup(1, 0, 0, 5);
+  tasks.InsertPaddedTask(2);
+  ASSERT_TRUE(tasks.IsLazy());
+  ASSERT_EQ(tasks.Size(), 17);
+
+  auto row = tasks.GetRowByID(12);
+  ASSERT_EQ(std::get<0>(row), TaskType::kCommonTask);
+  ASSERT_EQ(std::get<0>(std::get<1>(row)), 1);
+  ASSERT_EQ(std::get<2>(row), 2);
+  ASSERT_EQ(std::get<0>(tasks.GetRowByID(15)), TaskType::kPaddedTask);
+
+  ShardShuffle shuffle(1, kShuffleSample);
+  ShardSample sample(1, 4, 1);
+  ASSERT_EQ(shuffle(tasks), SUCCESS);
+  ASSERT_EQ(sample(tasks), SUCCESS);
+  ASSERT_EQ(tasks.Size(), 5);
+  std::set<uint64_t> ids;
+  for (uint64_t i = 0; i < tasks.Size(); ++i) {
+    ids.insert(tasks.GetPermutedID(i));
+  }
+  ASSERT_EQ(ids.size(), 5);
+}
 }  // namespace mindrecord
 }  // namespace mindspore
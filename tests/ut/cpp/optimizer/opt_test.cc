@@ -167,6 +167,21 @@ TEST_F(TestOptOpt, idempotent) {
   ASSERT_TRUE(CheckOpt(before_2, after, std::vector<SubstitutionPtr>({idempotent_P})));
 }
 
+TEST_F(TestOptOpt, IndexedList) {
+  FuncGraphPtr before = getPyFun.CallAndParseRet("test_idempotent", "before_2");
+  FuncGraphPtr after = getPyFun.CallAndParseRet("test_idempotent", "after");
+
+  ASSERT_TRUE(nullptr != before);
+  ASSERT_TRUE(nullptr != after);
+  ASSERT_TRUE(CheckOpt(before, after, std::vector<SubstitutionPtr>({elim_Z, elim_R, idempotent_P})));
+
+  // only the substitution of the primitive of the nodes is tried on them
+  ASSERT_GT(idempotent_P->stat_->hits, 0);
+  ASSERT_GE(idempotent_P->stat_->tries, idempotent_P->stat_->hits);
+  ASSERT_EQ(elim_Z->stat_->tries, 0);
+  ASSERT_EQ(elim_R->stat_->tries, 0);
+}
+
 TEST_F(TestOptOpt, ConstantVariable) {
   FuncGraphPtr before = getPyFun.CallAndParseRet("test_constant_variable", "before_1");
   FuncGraphPtr after = getPyFun.CallAndParseRet("test_constant_variable", "after");
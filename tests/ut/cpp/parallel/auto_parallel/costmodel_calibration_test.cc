@@ -0,0 +1,158 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utime.h>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_test.h"
+#include "parallel/device_manager.h"
+#include "parallel/costmodel_context.h"
+#include "parallel/auto_parallel/costmodel_calibration.h"
+#include "parallel/auto_parallel/graph_costmodel.h"
+#include "parallel/ops_info/matmul_info.h"
+
+namespace mindspore {
+namespace parallel {
+
+class TestCostModelCalibration : public UT::Common {
+ public:
+  TestCostModelCalibration() {}
+  void SetUp();
+  void TearDown();
+  void WriteProfile(const std::string &content);
+  std::vector<double> MatMulComputationCosts(double coefficient);
+
+  std::string profile_ = "./costmodel_calibration_test.json";
+};
+
+void TestCostModelCalibration::SetUp() {
+  std::vector<int32_t> dev_list;
+  for (int32_t i = 0; i < 10; i++) {
+    dev_list.push_back(i);
+  }
+  std::vector<int32_t> stage_map = {8, 2};
+  int32_t local_dev = 0;
+
+  // create a new g_device_manager
+  g_device_manager = std::make_shared<DeviceManager>();
+  g_device_manager->Init(dev_list, local_dev, stage_map, "hccl");
+}
+
+void TestCostModelCalibration::TearDown() {
+  CostModelContext::GetInstance()->set_costmodel_calibration_file("");
+  CostModelCalibration::GetInstance().Clear();
+  (void)remove(profile_.c_str());
+}
+
+void TestCostModelCalibration::WriteProfile(const std::string &content) {
+  std::ofstream fout(profile_);
+  fout << content;
+}
+
+std::vector<double> TestCostModelCalibration::MatMulComputationCosts(double coefficient) {
+  std::unordered_map<std::string, ValuePtr> attr = {{"transpose_a", MakeValue(false)},
+                                                    {"transpose_b", MakeValue(false)}};
+  Shapes inputs_shape = {{64, 32}, {32, 64}};
+  Shapes outputs_shape = {{64, 64}};
+  auto matmul = std::make_shared<MatMulInfo>("matmul_info", inputs_shape, outputs_shape, attr);
+  matmul->set_outputs_type({kFloat32});
+  matmul->operator_cost()->set_computation_coefficient(coefficient);
+  EXPECT_EQ(matmul->GenerateStrategies(0), SUCCESS);
+  std::vector<double> costs;
+  for (auto &swc : matmul->GetStrategyCost()) {
+    costs.push_back(swc->cost_list[0]->computation_cost_);
+  }
+  return costs;
+}
+
+TEST_F(TestCostModelCalibration, test_load_coefficients) {
+  WriteProfile(R"({"device_target": "CPU", "computation_coefficients": {"MatMul": 2.5, "ReLU": 0.5}})");
+  CostModelContext::GetInstance()->set_costmodel_calibration_file(profile_);
+  CostGraph cost_graph;
+  cost_graph.SetDeviceMemoryAndCostParameter();
+  auto &calibration = CostModelCalibration::GetInstance();
+  ASSERT_EQ(calibration.computation_coefficients().size(), 2);
+  ASSERT_DOUBLE_EQ(calibration.computation_coefficient("MatMul"), 2.5);
+  ASSERT_DOUBLE_EQ(calibration.computation_coefficient("ReLU"), 0.5);
+  ASSERT_DOUBLE_EQ(calibration.computation_coefficient("Softmax"), DEFAULT_COMPUTATION_COEFFICIENT);
+
+  // an empty file drops the coefficients
+  CostModelContext::GetInstance()->set_costmodel_calibration_file("");
+  cost_graph.SetDeviceMemoryAndCostParameter();
+  ASSERT_TRUE(calibration.computation_coefficients().empty());
+  ASSERT_DOUBLE_EQ(calibration.computation_coefficient("MatMul"), DEFAULT_COMPUTATION_COEFFICIENT);
+}
+
+TEST_F(TestCostModelCalibration, test_reload_modified_profile) {
+  auto &calibration = CostModelCalibration::GetInstance();
+  WriteProfile(R"({"computation_coefficients": {"MatMul": 2.5}})");
+  calibration.Load(profile_);
+  ASSERT_DOUBLE_EQ(calibration.computation_coefficient("MatMul"), 2.5);
+
+  // the same file is read again once it is modified
+  WriteProfile(R"({"computation_coefficients": {"MatMul": 4.0}})");
+  struct utimbuf times = {0, 0};
+  times.modtime = time(nullptr) + 10;
+  times.actime = times.modtime;
+  ASSERT_EQ(utime(profile_.c_str(), &times), 0);
+  calibration.Load(profile_);
+  ASSERT_DOUBLE_EQ(calibration.computation_coefficient("MatMul"), 4.0);
+}
+
+TEST_F(TestCostModelCalibration, test_computation_cost) {
+  // the reduced dimension is split, so the sliced output is added
+  double cost = CostModelCalibration::ComputationCost("MatMul", {{64, 32}, {32, 64}}, {{2, 2}, {2, 1}});
+  ASSERT_DOUBLE_EQ(cost, (32 * 16 + 16 * 64 + 32 * 64) * 4);
+  cost = CostModelCalibration::ComputationCost("BiasAdd", {{64, 32}, {32}}, {{2, 4}, {4}});
+  ASSERT_DOUBLE_EQ(cost, (32 * 8 + 8) * 4);
+  EXPECT_ANY_THROW(CostModelCalibration::ComputationCost("MatMul", {{64, 32}, {32, 64}}, {{3, 1}, {1, 1}}));
+
+  WriteProfile(R"({"computation_coefficients": {"MatMul": 2.5}})");
+  auto &calibration = CostModelCalibration::GetInstance();
+  calibration.Load(profile_);
+  ASSERT_DOUBLE_EQ(calibration.CalibratedComputationCost("MatMul", {{64, 32}, {32, 64}}, {{2, 2}, {2, 1}}),
+                   2.5 * (32 * 16 + 16 * 64 + 32 * 64) * 4);
+}
+
+TEST_F(TestCostModelCalibration, test_invalid_profile) {
+  WriteProfile(R"({"computation_coefficients": {"MatMul": -1.0}})");
+  EXPECT_ANY_THROW(CostModelCalibration::GetInstance().Load(profile_));
+  CostModelCalibration::GetInstance().Clear();
+  WriteProfile(R"({"coefficients": {"MatMul": 1.0}})");
+  EXPECT_ANY_THROW(CostModelCalibration::GetInstance().Load(profile_));
+  CostModelCalibration::GetInstance().Clear();
+  EXPECT_ANY_THROW(CostModelCalibration::GetInstance().Load("./costmodel_calibration_not_exist.json"));
+}
+
+TEST_F(TestCostModelCalibration, test_scaled_computation_cost) {
+  auto costs = MatMulComputationCosts(1.0);
+  auto scaled_costs = MatMulComputationCosts(2.5);
+  ASSERT_FALSE(costs.empty());
+  ASSERT_EQ(costs.size(), scaled_costs.size());
+  for (size_t i = 0; i < costs.size(); ++i) {
+    // the cost of the data parallel strategy is 1.0 lower for breaking ties, after it is scaled
+    double tie = (scaled_costs[i] - 2.5 * costs[i]) / 1.5;
+    ASSERT_TRUE(std::abs(tie) < 1e-6 || std::abs(tie - 1.0) < 1e-6);
+  }
+}
+}  // namespace parallel
+}  // namespace mindspore
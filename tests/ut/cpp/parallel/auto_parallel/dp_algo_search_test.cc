@@ -0,0 +1,177 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_test.h"
+#include "parallel/device_manager.h"
+#include "parallel/costmodel_context.h"
+#include "parallel/auto_parallel/costlist_memo.h"
+#include "parallel/auto_parallel/dp_algo_costmodel.h"
+#include "parallel/auto_parallel/graph_costmodel.h"
+#include "parallel/ops_info/matmul_info.h"
+
+namespace mindspore {
+namespace parallel {
+
+class TestDPAlgoSearch : public UT::Common {
+ public:
+  TestDPAlgoSearch() {}
+  void SetUp();
+  void TearDown();
+  // 'layers' diamonds of matmuls a -> {b, c} -> d, the d of a layer feeding the a of the next one
+  CostGraphPtr ConstructRepeatedDiamonds(size_t layers, std::vector<OperatorInfoPtr> *ops);
+  double SearchTime(size_t layers, int32_t threads, std::vector<OperatorInfoPtr> *ops);
+};
+
+void TestDPAlgoSearch::SetUp() {
+  std::vector<int32_t> dev_list;
+  for (int32_t i = 0; i < 10; i++) {
+    dev_list.push_back(i);
+  }
+  std::vector<int32_t> stage_map = {8, 2};
+  int32_t local_dev = 0;
+
+  // create a new g_device_manager
+  g_device_manager = std::make_shared<DeviceManager>();
+  g_device_manager->Init(dev_list, local_dev, stage_map, "hccl");
+}
+
+void TestDPAlgoSearch::TearDown() {
+  CostModelContext::GetInstance()->set_dp_algo_search_threads(DEFAULT_DP_ALGO_SEARCH_THREADS);
+  DP_ALGO_SEARCH_THREADS = DEFAULT_DP_ALGO_SEARCH_THREADS;
+}
+
+CostGraphPtr TestDPAlgoSearch::ConstructRepeatedDiamonds(size_t layers, std::vector<OperatorInfoPtr> *ops) {
+  auto cost_graph = std::make_shared<CostGraph>();
+  cost_graph->SetDeviceMemoryAndCostParameter();
+  ValuePtr transpose_a = MakeValue(false);
+  ValuePtr transpose_b = MakeValue(false);
+  std::unordered_map<std::string, ValuePtr> attr = {{"transpose_a", transpose_a}, {"transpose_b", transpose_b}};
+  Shapes inputs_shape = {{64, 64}, {64, 64}};
+  Shapes outputs_shape = {{64, 64}};
+
+  auto new_matmul = [&]() {
+    auto matmul = std::make_shared<MatMulInfo>("matmul_info", inputs_shape, outputs_shape, attr);
+    matmul->set_outputs_type({kFloat32});
+    matmul->GenerateStrategies(0);
+    cost_graph->AddOperator(matmul);
+    ops->push_back(matmul);
+    return matmul;
+  };
+  auto connect = [&cost_graph](const OperatorInfoPtr &prev, const OperatorInfoPtr &next, size_t input_index) {
+    auto edge = std::make_shared<Edge>("MatMul-MatMul", prev, next, 0, input_index, false);
+    edge->InitEdgeCost();
+    prev->AddSuccEdge(edge);
+    next->AddPrevEdge(edge);
+    cost_graph->AddEdge(prev, next, edge);
+  };
+
+  OperatorInfoPtr last = nullptr;
+  for (size_t i = 0; i < layers; ++i) {
+    auto a = new_matmul();
+    auto b = new_matmul();
+    auto c = new_matmul();
+    auto d = new_matmul();
+    if (last != nullptr) {
+      connect(last, a, 0);
+    }
+    connect(a, b, 0);
+    connect(a, c, 0);
+    connect(b, d, 0);
+    connect(c, d, 1);
+    last = d;
+  }
+  return cost_graph;
+}
+
+double TestDPAlgoSearch::SearchTime(size_t layers, int32_t threads, std::vector<OperatorInfoPtr> *ops) {
+  CostModelContext::GetInstance()->set_dp_algo_search_threads(threads);
+  auto cost_graph = ConstructRepeatedDiamonds(layers, ops);
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(GetStrategy(cost_graph), SUCCESS);
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+TEST_F(TestDPAlgoSearch, test_memo_reuses_positions) {
+  auto new_cost = [](double computation, double communication) {
+    auto cost = std::make_shared<Cost>(computation, communication);
+    cost->communication_without_parameter_ = communication;
+    return cost;
+  };
+  auto create_cost = [](const std::vector<CostListMemo::Factors> &products) {
+    return [&products](size_t product, const std::vector<size_t> &indexes) {
+      auto &left = products[product][0][indexes[0]];
+      auto &right = products[product][1][indexes[1]];
+      auto cost = std::make_shared<Cost>(left->computation_cost_ + right->computation_cost_,
+                                         left->communication_cost_ + right->communication_cost_);
+      cost->communication_without_parameter_ = cost->communication_cost_;
+      cost->communication_with_partial_para_ = cost->communication_cost_;
+      cost->decision_ptr_ = std::make_shared<EdgeEliminationDecision>(CostPtrList{left, right});
+      return cost;
+    };
+  };
+  auto &memo = CostListMemo::GetInstance();
+  memo.Clear();
+  std::vector<CostListMemo::Factors> first = {{{new_cost(1, 4), new_cost(2, 1)}, {new_cost(1, 2), new_cost(3, 0)}}};
+  std::vector<CostListMemo::Factors> second = {{{new_cost(1, 4), new_cost(2, 1)}, {new_cost(1, 2), new_cost(3, 0)}}};
+  auto first_list = memo.CreateCostList(EDGE_ELIMINATION_COSTLIST, first, create_cost(first));
+  auto second_list = memo.CreateCostList(EDGE_ELIMINATION_COSTLIST, second, create_cost(second));
+  ASSERT_EQ(memo.misses(), 1);
+  ASSERT_EQ(memo.hits(), 1);
+  // {2, 6}, {4, 4}, {3, 3}, {5, 1} are simplified into {2, 6}, {3, 3}, {5, 1}
+  ASSERT_EQ(first_list.size(), 3);
+  ASSERT_EQ(second_list.size(), first_list.size());
+  for (size_t i = 0; i < first_list.size(); ++i) {
+    ASSERT_DOUBLE_EQ(second_list[i]->computation_cost_, first_list[i]->computation_cost_);
+    ASSERT_DOUBLE_EQ(second_list[i]->communication_cost_, first_list[i]->communication_cost_);
+    // the decisions of a hit refer to its own costs
+    auto decision = second_list[i]->decision_ptr_->cast<EdgeEliminationDecisionPtr>();
+    ASSERT_TRUE(decision->edges_cost_list_[0] == second[0][0][0] || decision->edges_cost_list_[0] == second[0][0][1]);
+  }
+  memo.Clear();
+}
+
+TEST_F(TestDPAlgoSearch, test_threads_select_same_strategies) {
+  std::vector<OperatorInfoPtr> serial_ops;
+  std::vector<OperatorInfoPtr> parallel_ops;
+  (void)SearchTime(4, 1, &serial_ops);
+  (void)SearchTime(4, 4, &parallel_ops);
+  ASSERT_EQ(serial_ops.size(), parallel_ops.size());
+  for (size_t i = 0; i < serial_ops.size(); ++i) {
+    ASSERT_NE(serial_ops[i]->selected_strategy(), nullptr);
+    ASSERT_TRUE(serial_ops[i]->selected_strategy()->IsEqual(parallel_ops[i]->selected_strategy()));
+  }
+}
+
+// Benchmark of the strategy search on synthetic cost graphs of repeated layers
+TEST_F(TestDPAlgoSearch, test_search_time_of_repeated_layers) {
+  for (size_t layers : {8, 32}) {
+    for (int32_t threads : {1, 0}) {
+      std::vector<OperatorInfoPtr> ops;
+      auto time = SearchTime(layers, threads, &ops);
+      MS_LOG(INFO) << "Searching strategies for " << ops.size() << " operators with " << threads
+                   << " threads costs " << time << " ms.";
+    }
+  }
+}
+}  // namespace parallel
+}  // namespace mindspore
@@ -0,0 +1,152 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/common_test.h"
+#include "parallel/context.h"
+#include "parallel/strategy_cache/strategy_cache.h"
+
+namespace mindspore {
+namespace parallel {
+
+class TestStrategyCache : public UT::Common {
+ public:
+  TestStrategyCache() {}
+  void SetUp() { StrategyCache::GetInstance().Clear(); }
+  void TearDown();
+  CachedStrategies MakeStrategies();
+};
+
+void TestStrategyCache::TearDown() {
+  ParallelContext::GetInstance()->set_strategy_cache_dir("");
+  StrategyCache::GetInstance().Clear();
+}
+
+CachedStrategies TestStrategyCache::MakeStrategies() {
+  std::vector<Dimensions> matmul = {{2, 4}, {4, 1}};
+  std::vector<Dimensions> reshape = {{8, 1}};
+  std::vector<Dimensions> relu = {{8, 1}};
+  // the input layout of the reshape is taken from the matmul, the output layout is not set
+  auto input_layout = std::make_shared<TensorLayout>();
+  (void)input_layout->InitFromVector({2, 4}, {1, -1}, {128, 64});
+  CachedStrategy reshape_strategy{NewStrategy(0, reshape), input_layout, nullptr};
+  return {{NewStrategy(0, matmul), nullptr, nullptr}, reshape_strategy, {nullptr, nullptr, nullptr},
+          {NewStrategy(0, relu), nullptr, nullptr}};
+}
+
+void ExpectSameLayout(const std::shared_ptr<TensorLayout> &expected, const std::shared_ptr<TensorLayout> &actual) {
+  if (expected == nullptr) {
+    ASSERT_EQ(actual, nullptr);
+    return;
+  }
+  ASSERT_NE(actual, nullptr);
+  ASSERT_EQ(expected->device_arrangement_origin().array(), actual->device_arrangement_origin().array());
+  ASSERT_EQ(expected->origin_tensor_map().array(), actual->origin_tensor_map().array());
+  ASSERT_EQ(expected->tensor_shape_origin().array(), actual->tensor_shape_origin().array());
+  ASSERT_TRUE(*expected == *actual);
+}
+
+void ExpectSameStrategies(const CachedStrategies &expected, const CachedStrategies &actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ExpectSameLayout(expected[i].input_layout, actual[i].input_layout);
+    ExpectSameLayout(expected[i].output_layout, actual[i].output_layout);
+    if (expected[i].strategy == nullptr) {
+      ASSERT_EQ(actual[i].strategy, nullptr);
+      continue;
+    }
+    ASSERT_NE(actual[i].strategy, nullptr);
+    ASSERT_EQ(expected[i].strategy->GetInputStage(), actual[i].strategy->GetInputStage());
+    ASSERT_EQ(expected[i].strategy->GetInputDim(), actual[i].strategy->GetInputDim());
+  }
+}
+
+TEST_F(TestStrategyCache, test_signature_key) {
+  auto key = StrategyCache::SignatureKey("%0 = MatMul %1 %2");
+  ASSERT_EQ(key, StrategyCache::SignatureKey("%0 = MatMul %1 %2"));
+  ASSERT_NE(key, StrategyCache::SignatureKey("%0 = MatMul %2 %1"));
+  ASSERT_EQ(key.substr(key.find('_')), "_17");
+}
+
+TEST_F(TestStrategyCache, test_find_in_memory) {
+  auto strategies = MakeStrategies();
+  CachedStrategies found;
+  ASSERT_FALSE(StrategyCache::GetInstance().Find("signature", &found));
+  StrategyCache::GetInstance().Insert("signature", strategies);
+  ASSERT_TRUE(StrategyCache::GetInstance().Find("signature", &found));
+  ExpectSameStrategies(strategies, found);
+  ASSERT_FALSE(StrategyCache::GetInstance().Find("other signature", &found));
+}
+
+TEST_F(TestStrategyCache, test_find_in_file) {
+  ParallelContext::GetInstance()->set_strategy_cache_dir(".");
+  auto strategies = MakeStrategies();
+  std::string signature = "devices 8 8\n%0 = MatMul %1 %2\n";
+  StrategyCache::GetInstance().Insert(signature, strategies);
+  // a new launch only has the file
+  StrategyCache::GetInstance().Clear();
+  CachedStrategies found;
+  ASSERT_TRUE(StrategyCache::GetInstance().Find(signature, &found));
+  ExpectSameStrategies(strategies, found);
+  auto file = "./strategy_cache_" + StrategyCache::SignatureKey(signature) + ".txt";
+  ASSERT_EQ(remove(file.c_str()), 0);
+}
+
+TEST_F(TestStrategyCache, test_file_of_other_signature) {
+  ParallelContext::GetInstance()->set_strategy_cache_dir(".");
+  std::string signature = "devices 8 8\n%0 = MatMul %1 %2\n";
+  std::string other_signature = "devices 8 8\n%0 = MatMul %2 %1\n";
+  StrategyCache::GetInstance().Insert(signature, MakeStrategies());
+  StrategyCache::GetInstance().Clear();
+  // the file of the other signature holds the strategies of the first one, as if their keys collided
+  auto file = "./strategy_cache_" + StrategyCache::SignatureKey(signature) + ".txt";
+  auto other_file = "./strategy_cache_" + StrategyCache::SignatureKey(other_signature) + ".txt";
+  ASSERT_EQ(rename(file.c_str(), other_file.c_str()), 0);
+  CachedStrategies found;
+  ASSERT_FALSE(StrategyCache::GetInstance().Find(other_signature, &found));
+  ASSERT_EQ(remove(other_file.c_str()), 0);
+}
+
+TEST_F(TestStrategyCache, test_file_of_other_version) {
+  ParallelContext::GetInstance()->set_strategy_cache_dir(".");
+  std::string signature = "%0 = ReLU %1\n";
+  auto file = "./strategy_cache_" + StrategyCache::SignatureKey(signature) + ".txt";
+  {
+    // the files written before the signature was kept in them
+    std::ofstream fout(file);
+    fout << "strategy_cache 2\n1\n0 1 2 8 1 -1 -1\n";
+  }
+  CachedStrategies found;
+  ASSERT_FALSE(StrategyCache::GetInstance().Find(signature, &found));
+  ASSERT_EQ(remove(file.c_str()), 0);
+}
+
+TEST_F(TestStrategyCache, test_count_lookup) {
+  StrategyCache::GetInstance().CountLookup(false);
+  StrategyCache::GetInstance().CountLookup(true);
+  StrategyCache::GetInstance().CountLookup(true);
+  ASSERT_EQ(StrategyCache::GetInstance().hits(), 2);
+  ASSERT_EQ(StrategyCache::GetInstance().misses(), 1);
+  StrategyCache::GetInstance().Clear();
+  ASSERT_EQ(StrategyCache::GetInstance().hits(), 0);
+}
+}  // namespace parallel
+}  // namespace mindspore
@@ -598,6 +598,74 @@ TEST_F(TestPrim, test_biasAdd) {
   ASSERT_TRUE(*(res->GetShapeTrack()) == *(expected->GetShapeTrack()));
 }
 
+TEST_F(TestPrim, test_py_infer_cache) {
+  std::shared_ptr<py::scoped_interpreter> env = python_adapter::set_python_scoped();
+  auto &infer_cache = PyInferCache::GetInstance();
+  infer_cache.Clear();
+  py::tuple kernel_size(2);
+  kernel_size[0] = 5;
+  kernel_size[1] = 5;
+  auto input = ArrayOfTensor(UTPrimUtils::kF32, {2, 20, 32, 32});
+  auto weight = ArrayOfTensor(UTPrimUtils::kF32, {64, 20, 5, 5});
+  AbstractBasePtrList args_spec_list = {input, weight};
+
+  // each graph has its own Conv2D instance, the second one reuses the result of the first
+  FuncGraphPtr func_graph = getPyFun.CallAndParseRet("test_conv2d", 64, kernel_size, 0, 2, 1);
+  ASSERT_TRUE(func_graph != nullptr);
+  AbstractBasePtr first = engine_->Run(func_graph, args_spec_list).inferred->abstract();
+  ASSERT_EQ(infer_cache.hits(), 0);
+  ASSERT_EQ(infer_cache.size(), 1);
+
+  FuncGraphPtr other_graph = getPyFun.CallAndParseRet("test_conv2d", 64, kernel_size, 0, 2, 1);
+  ASSERT_TRUE(other_graph != nullptr);
+  AbstractBasePtr second = engine_->Run(other_graph, args_spec_list).inferred->abstract();
+  ASSERT_EQ(infer_cache.hits(), 1);
+  ASSERT_TRUE(*second == *first);
+
+  // a different attribute misses
+  FuncGraphPtr stride_graph = getPyFun.CallAndParseRet("test_conv2d", 64, kernel_size, 0, 1, 1);
+  ASSERT_TRUE(stride_graph != nullptr);
+  AbstractBasePtr third = engine_->Run(stride_graph, args_spec_list).inferred->abstract();
+  ASSERT_EQ(infer_cache.hits(), 1);
+  ASSERT_EQ(infer_cache.size(), 2);
+  auto expected = ArrayOfTensor(UTPrimUtils::kF32, {2, 64, 28, 28});
+  ASSERT_TRUE(*(third->GetShapeTrack()) == *(expected->GetShapeTrack()));
+
+  // a hit sets the attributes the infer adds on the instance, Conv2D adds pad_list
+  auto conv2d_class = py::module::import("mindspore.ops.operations").attr("Conv2D");
+  auto first_conv = conv2d_class(64, kernel_size, 1, "pad", 1, 2, 1).cast<PrimitivePyPtr>();
+  auto second_conv = conv2d_class(64, kernel_size, 1, "pad", 1, 2, 1).cast<PrimitivePyPtr>();
+  ASSERT_TRUE(first_conv != nullptr && second_conv != nullptr);
+  auto first_result = std::make_shared<PythonPrimEvaluator>(first_conv)->EvalPrim(nullptr, args_spec_list);
+  ASSERT_EQ(infer_cache.hits(), 1);
+  ASSERT_FALSE(second_conv->HasAttr("pad_list"));
+  auto second_result = std::make_shared<PythonPrimEvaluator>(second_conv)->EvalPrim(nullptr, args_spec_list);
+  ASSERT_EQ(infer_cache.hits(), 2);
+  ASSERT_TRUE(*second_result->abstract() == *first_result->abstract());
+  ASSERT_TRUE(second_conv->HasAttr("pad_list"));
+  ASSERT_TRUE(*second_conv->GetAttr("pad_list") == *first_conv->GetAttr("pad_list"));
+  ASSERT_TRUE(py::cast<py::tuple>(second_conv->GetPyObj().attr("pad_list")).equal(
+    first_conv->GetPyObj().attr("pad_list")));
+  ASSERT_TRUE(py::cast<py::dict>(second_conv->GetPyObj().attr("attrs")).contains("pad_list"));
+
+  // the python attributes of the instance are part of the key
+  auto conv = prim::GetPythonOps("conv2d_prim", "gtest_input.pynative").cast<PrimitivePyPtr>();
+  ASSERT_TRUE(conv != nullptr);
+  PyInferKey key;
+  ASSERT_TRUE(infer_cache.MakeKey(conv, args_spec_list, &key));
+  py::setattr(conv->GetPyObj(), "is_ge", py::bool_(true));
+  PyInferKey ge_key;
+  ASSERT_TRUE(infer_cache.MakeKey(conv, args_spec_list, &ge_key));
+  ASSERT_FALSE(*ge_key.instance_state == *key.instance_state);
+  py::delattr(conv->GetPyObj(), "is_ge");
+
+  // a constant tensor is not cached, as the cache would hold its data
+  auto const_input = ArrayOfTensor(UTPrimUtils::kF32, {2, 20, 32, 32});
+  const_input->set_value(std::make_shared<tensor::Tensor>(kNumberTypeFloat32, std::vector<int>{2, 20, 32, 32}));
+  ASSERT_FALSE(infer_cache.MakeKey(conv, {const_input, weight}, &key));
+  infer_cache.Clear();
+}
+
 TEST_F(TestPrim, test_softmax_cross_entropy_with_logits) {
   FuncGraphPtr func_graph = getPyFun("get_softmax_cross_entropy_with_logits");
   ASSERT_TRUE(func_graph != nullptr);
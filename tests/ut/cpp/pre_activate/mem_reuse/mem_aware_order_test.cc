@@ -0,0 +1,78 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "pre_activate/mem_reuse/mem_aware_order.h"
+#include "pre_activate/mem_reuse/mem_reuse.h"
+#include "common/common_test.h"
+
+using mindspore::memreuse::KernelRefCount;
+using mindspore::memreuse::KernelRefCountPtr;
+using mindspore::memreuse::MemAwareOrder;
+using mindspore::memreuse::OrderKernel;
+namespace mindspore {
+class TestMemAwareOrder : public UT::Common {
+ public:
+  TestMemAwareOrder() {}
+};
+
+static KernelRefCountPtr NewRef(size_t size) {
+  auto ref = std::make_shared<KernelRefCount>();
+  ref->size_ = size;
+  return ref;
+}
+
+static OrderKernel NewKernel(const std::vector<size_t> &preds, const std::vector<KernelRefCountPtr> &inputs,
+                             const KernelRefCountPtr &output, size_t workspace = 0) {
+  OrderKernel kernel;
+  kernel.preds = preds;
+  kernel.inputs = inputs;
+  kernel.outputs = {output};
+  kernel.workspace = workspace;
+  return kernel;
+}
+
+TEST_F(TestMemAwareOrder, test_schedule_branches) {
+  // a1 -> a2 and b1 -> b2, joined by c, the default order runs a1 and b1 first
+  auto a1 = NewRef(100);
+  auto b1 = NewRef(100);
+  auto a2 = NewRef(1);
+  auto b2 = NewRef(1);
+  auto c = NewRef(1);
+  std::vector<OrderKernel> kernels = {NewKernel({}, {}, a1), NewKernel({}, {}, b1), NewKernel({0}, {a1}, a2),
+                                      NewKernel({1}, {b1}, b2), NewKernel({2, 3}, {a2, b2}, c)};
+  MemAwareOrder scheduler(kernels);
+  ASSERT_EQ(scheduler.Peak({0, 1, 2, 3, 4}), 201);
+  auto order = scheduler.Schedule();
+  std::vector<size_t> expect = {0, 2, 1, 3, 4};
+  ASSERT_EQ(order, expect);
+  ASSERT_EQ(scheduler.Peak(order), 102);
+}
+
+TEST_F(TestMemAwareOrder, test_peak_workspace_and_graph_output) {
+  auto r0 = NewRef(50);
+  auto r1 = NewRef(10);
+  auto r2 = NewRef(60);
+  std::vector<OrderKernel> kernels = {NewKernel({}, {}, r0), NewKernel({0}, {r0, r0}, r1, 30),
+                                      NewKernel({1}, {r1}, r2)};
+  ASSERT_EQ(MemAwareOrder(kernels).Peak({0, 1, 2}), 90);
+  // a graph output stays live to the end
+  r0->ref_count_ = memreuse::kMaxRefCount;
+  ASSERT_EQ(MemAwareOrder(kernels).Peak({0, 1, 2}), 120);
+}
+}  // namespace mindspore
@@ -0,0 +1,64 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "pre_activate/mem_reuse/mem_reuse_interval_planner.h"
+#include "common/common_test.h"
+
+using mindspore::memreuse::GreedyBySizeMemReuse;
+using mindspore::memreuse::MemInterval;
+namespace mindspore {
+class TestMemReuseIntervalPlanner : public UT::Common {
+ public:
+  TestMemReuseIntervalPlanner() {}
+};
+
+static MemInterval NewInterval(size_t size, size_t start, size_t end) {
+  MemInterval interval;
+  interval.size = size;
+  interval.start = start;
+  interval.end = end;
+  return interval;
+}
+
+TEST_F(TestMemReuseIntervalPlanner, test_greedy_by_size_chain) {
+  // every buffer overlaps with the next one only, so two slots are enough
+  std::vector<MemInterval> intervals = {NewInterval(512, 0, 1), NewInterval(512, 1, 2), NewInterval(512, 2, 3),
+                                        NewInterval(512, 3, 4)};
+  ASSERT_EQ(memreuse::GetMemLowerBound(intervals), 1024);
+  GreedyBySizeMemReuse planner;
+  planner.Plan(&intervals);
+  ASSERT_EQ(planner.GetAllocatedSize(), 1024);
+  ASSERT_EQ(planner.GetLowerBound(), 1024);
+  ASSERT_EQ(intervals[0].offset, intervals[2].offset);
+  ASSERT_EQ(intervals[1].offset, intervals[3].offset);
+  ASSERT_NE(intervals[0].offset, intervals[1].offset);
+}
+
+TEST_F(TestMemReuseIntervalPlanner, test_greedy_by_size_gap) {
+  // the small buffers live apart, so they share the slot above the large ones
+  std::vector<MemInterval> intervals = {NewInterval(1024, 0, 4), NewInterval(512, 0, 1), NewInterval(1024, 0, 4),
+                                        NewInterval(512, 2, 4)};
+  GreedyBySizeMemReuse planner;
+  planner.Plan(&intervals);
+  ASSERT_EQ(planner.GetLowerBound(), 2560);
+  ASSERT_EQ(planner.GetAllocatedSize(), 2560);
+  ASSERT_EQ(intervals[1].offset, intervals[3].offset);
+  ASSERT_EQ(intervals[1].offset, 2048);
+}
+}  // namespace mindspore
@@ -171,5 +171,90 @@ TEST_F(TestHWAllReduceFusion, test_fusion_op) {
   EXPECT_NE(g_after, nullptr);
   EXPECT_TRUE(CheckEqualGraph(new_graph, g_after));
 }
+
+TEST_F(TestHWAllReduceFusion, test_host_fusion) {
+  getPyFun_.SetDoResolve(true);
+  FuncGraphPtr g = getPyFun_.CallAndParseRet("test_host_all_reduce_fusion", "before");
+  EXPECT_NE(g, nullptr);
+  std::vector<int> shp_x{64, 32};
+  auto x_abstract = std::make_shared<abstract::AbstractTensor>(kFloat32, shp_x);
+  AbstractBasePtrList args_spec_list{x_abstract, x_abstract, x_abstract, x_abstract};
+  auto func_graph = GetKernelGraph(g, args_spec_list);
+  EXPECT_NE(func_graph, nullptr);
+  // set kernel build info
+  kernel::KernelBuildInfo::KernelBuildInfoBuilder builder;
+  builder.SetInputsFormat({kOpFormat_DEFAULT});
+  builder.SetOutputsFormat({kOpFormat_DEFAULT});
+  builder.SetInputsDeviceType({kFloat32->type_id()});
+  builder.SetOutputsDeviceType({kFloat32->type_id()});
+  auto node_list = TopoSort(func_graph->get_return());
+  for (auto& node : node_list) {
+    if (node == nullptr) {
+      continue;
+    }
+    if ((node->isa<CNode>() && AnfAlgo::GetCNodeName(node) == kHostAllReduceOpName) || node->isa<Parameter>()) {
+      node->set_kernel_info(std::make_shared<device::KernelInfo>());
+      AnfAlgo::SetSelectKernelBuildInfo(builder.Build(), node.get());
+    }
+  }
+  // the ops of the mpi and the ring algorithms are fused into different buckets
+  auto optimizer = std::make_shared<opt::GraphOptimizer>();
+  auto pm = std::make_shared<opt::PassManager>();
+  pm->AddPass(std::make_shared<opt::HostAllReduceFusion>());
+  optimizer->AddPassManager(pm);
+  FuncGraphPtr new_graph = optimizer->Optimize(func_graph);
+  EXPECT_NE(new_graph, nullptr);
+  // check result
+  FuncGraphPtr g_after = getPyFun_.CallAndParseRet("test_host_all_reduce_fusion", "after");
+  EXPECT_NE(g_after, nullptr);
+  EXPECT_TRUE(CheckEqualGraph(new_graph, g_after));
+}
+
+TEST_F(TestHWAllReduceFusion, test_host_fusion_dtype) {
+  getPyFun_.SetDoResolve(true);
+  FuncGraphPtr g = getPyFun_.CallAndParseRet("test_host_all_reduce_fusion_dtype", "before");
+  EXPECT_NE(g, nullptr);
+  std::vector<int> shp_x{64, 32};
+  auto x_abstract = std::make_shared<abstract::AbstractTensor>(kFloat32, shp_x);
+  AbstractBasePtrList args_spec_list{x_abstract, x_abstract, x_abstract, x_abstract};
+  auto func_graph = GetKernelGraph(g, args_spec_list);
+  EXPECT_NE(func_graph, nullptr);
+  // set kernel build info, the first two ops reduce float32 and the last two float16
+  auto build_info = [](const TypePtr &type) {
+    kernel::KernelBuildInfo::KernelBuildInfoBuilder builder;
+    builder.SetInputsFormat({kOpFormat_DEFAULT});
+    builder.SetOutputsFormat({kOpFormat_DEFAULT});
+    builder.SetInputsDeviceType({type->type_id()});
+    builder.SetOutputsDeviceType({type->type_id()});
+    return builder.Build();
+  };
+  auto node_list = TopoSort(func_graph->get_return());
+  int count = 0;
+  for (auto& node : node_list) {
+    if (node == nullptr) {
+      continue;
+    }
+    if (node->isa<Parameter>()) {
+      node->set_kernel_info(std::make_shared<device::KernelInfo>());
+      AnfAlgo::SetSelectKernelBuildInfo(build_info(kFloat32), node.get());
+    }
+    if (node->isa<CNode>() && AnfAlgo::GetCNodeName(node) == kHostAllReduceOpName) {
+      node->set_kernel_info(std::make_shared<device::KernelInfo>());
+      AnfAlgo::SetSelectKernelBuildInfo(build_info(count < 2 ? kFloat32 : kFloat16), node.get());
+      count++;
+    }
+  }
+  // the ops of different dtypes are fused into different buckets
+  auto optimizer = std::make_shared<opt::GraphOptimizer>();
+  auto pm = std::make_shared<opt::PassManager>();
+  pm->AddPass(std::make_shared<opt::HostAllReduceFusion>());
+  optimizer->AddPassManager(pm);
+  FuncGraphPtr new_graph = optimizer->Optimize(func_graph);
+  EXPECT_NE(new_graph, nullptr);
+  // check result
+  FuncGraphPtr g_after = getPyFun_.CallAndParseRet("test_host_all_reduce_fusion_dtype", "after");
+  EXPECT_NE(g_after, nullptr);
+  EXPECT_TRUE(CheckEqualGraph(new_graph, g_after));
+}
 }  // namespace opt
 }  // namespace mindspore
@@ -0,0 +1,90 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "common/backend_common_test.h"
+#include "common/py_func_graph_fetcher.h"
+#include "ir/scope.h"
+#include "operator/ops.h"
+#include "pre_activate/common/optimizer.h"
+#include "pre_activate/common/pass_manager.h"
+#include "pre_activate/pass/rematerialization.h"
+#include "session/anf_runtime_algorithm.h"
+
+namespace mindspore {
+namespace opt {
+class TestHWRematerialization : public BackendCommon {
+ public:
+  TestHWRematerialization() : get_py_fun_("gtest_input.pre_activate.rematerialization_test", true) {}
+  ~TestHWRematerialization() override = default;
+
+ public:
+  UT::PyFuncGraphFetcher get_py_fun_;
+};
+
+TEST_F(TestHWRematerialization, test_rematerialization) {
+  FuncGraphPtr g = get_py_fun_.CallAndParseRet("test_rematerialization", "before");
+  std::vector<int> shp{2, 32};
+  auto x_abstract = std::make_shared<abstract::AbstractTensor>(kFloat32, shp);
+  AbstractBasePtrList args_spec_list{x_abstract, x_abstract};
+  auto kernel_graph = GetKernelGraph(g, args_spec_list);
+  EXPECT_NE(kernel_graph, nullptr);
+  // relu, mul of the forward pass, then the two muls of the backward pass
+  auto &order = kernel_graph->execution_order();
+  ASSERT_EQ(order.size(), 4);
+  auto grad_scope = std::make_shared<Scope>("Gradients/Default/gradMul");
+  order[2]->set_scope(grad_scope);
+  order[3]->set_scope(grad_scope);
+
+  auto optimizer = std::make_shared<opt::GraphOptimizer>();
+  auto pm = std::make_shared<opt::PassManager>();
+  auto pass = std::make_shared<opt::Rematerialization>();
+  pm->AddPass(pass);
+  optimizer->AddPassManager(pm);
+  FuncGraphPtr new_graph = optimizer->Optimize(kernel_graph);
+  ASSERT_EQ(pass->saved_bytes(), 2 * 32 * sizeof(float));
+  ASSERT_EQ(pass->extra_flops(), 2 * 32);
+  // the copy of relu runs in the backward pass
+  ASSERT_EQ(kernel_graph->execution_order().size(), 5);
+  EXPECT_EQ(AnfAlgo::GetCNodeName(kernel_graph->execution_order()[3]), prim::kPrimRelu->name());
+
+  FuncGraphPtr g_after = get_py_fun_.CallAndParseRet("test_rematerialization", "after");
+  EXPECT_TRUE(CheckEqualGraph(g_after, new_graph));
+}
+
+TEST_F(TestHWRematerialization, test_rematerialization_budget) {
+  FuncGraphPtr g = get_py_fun_.CallAndParseRet("test_rematerialization", "before");
+  std::vector<int> shp{2, 32};
+  auto x_abstract = std::make_shared<abstract::AbstractTensor>(kFloat32, shp);
+  AbstractBasePtrList args_spec_list{x_abstract, x_abstract};
+  auto kernel_graph = GetKernelGraph(g, args_spec_list);
+  EXPECT_NE(kernel_graph, nullptr);
+  auto &order = kernel_graph->execution_order();
+  ASSERT_EQ(order.size(), 4);
+  auto grad_scope = std::make_shared<Scope>("Gradients/Default/gradMul");
+  order[2]->set_scope(grad_scope);
+  order[3]->set_scope(grad_scope);
+
+  // the two activations read by the backward pass fit in the budget
+  auto optimizer = std::make_shared<opt::GraphOptimizer>();
+  auto pm = std::make_shared<opt::PassManager>();
+  auto pass = std::make_shared<opt::Rematerialization>(2 * 2 * 32 * sizeof(float));
+  pm->AddPass(pass);
+  optimizer->AddPassManager(pm);
+  (void)optimizer->Optimize(kernel_graph);
+  ASSERT_EQ(pass->saved_bytes(), 0);
+  ASSERT_EQ(kernel_graph->execution_order().size(), 4);
+}
+}  // namespace opt
+}  // namespace mindspore
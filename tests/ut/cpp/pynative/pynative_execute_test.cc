@@ -20,6 +20,7 @@
 #include "pipeline/parse/data_converter.h"
 #include "operator/ops.h"
 #include "pynative/pynative_execute.h"
+#include "pynative/op_infer_cache.h"
 #include "utils/context/ms_context.h"
 #include "utils/utils.h"
 
@@ -87,6 +88,37 @@ TEST_F(TestPynativeExecute, TestRunOp) {
   }
 }
 
+TEST_F(TestPynativeExecute, TestOpInferCache) {
+  auto &infer_cache = OpInferCache::GetInstance();
+  infer_cache.Clear();
+  auto first = ConstructOpExecInfo();
+  ASSERT_EQ(infer_cache.misses(), 1);
+  ASSERT_EQ(infer_cache.hits(), 0);
+  ASSERT_TRUE(first->infer_cache_entry != nullptr);
+  // the entry refers to the primitive without owning it
+  ASSERT_EQ(first->infer_cache_entry->prim.lock(), first->py_primitive);
+  ASSERT_EQ(infer_cache.size(), 1);
+
+  // same primitive and inputs of the same shapes, the inference is skipped
+  auto second = ConstructOpExecInfo();
+  ASSERT_EQ(infer_cache.hits(), 1);
+  ASSERT_EQ(second->infer_cache_entry, first->infer_cache_entry);
+  ASSERT_EQ(second->abstract->ToString(), first->abstract->ToString());
+
+  // setting an attribute to the same value keeps the entry, a new value invalidates it
+  auto prim = first->py_primitive;
+  prim->set_attr("infer_cache_test", MakeValue(1));
+  (void)ConstructOpExecInfo();
+  ASSERT_EQ(infer_cache.misses(), 2);
+  prim->set_attr("infer_cache_test", MakeValue(1));
+  (void)ConstructOpExecInfo();
+  ASSERT_EQ(infer_cache.hits(), 2);
+  prim->EraseAttr("infer_cache_test");
+  (void)ConstructOpExecInfo();
+  ASSERT_EQ(infer_cache.misses(), 3);
+  infer_cache.Clear();
+}
+
 TEST_F(TestPynativeExecute, TestCreateContext) {
   auto ctx3 = MsContext::GetInstance();
   ASSERT_EQ(ctx3->backend_policy(), "vm");
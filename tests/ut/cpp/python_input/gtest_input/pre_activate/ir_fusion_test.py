@@ -22,6 +22,10 @@ tuple_getitem = Primitive('tuple_getitem')
 add = P.TensorAdd()
 allreduce = P.AllReduce()
 allreduce.add_prim_attr('fusion', 1)
+host_allreduce = P.HostAllReduce(group=[0, 1])
+host_allreduce.add_prim_attr('fusion', 1)
+host_allreduce_ring = P.HostAllReduce(group=[0, 1], algorithm="ring")
+host_allreduce_ring.add_prim_attr('fusion', 1)
 make_tuple = Primitive('make_tuple')
 conv = P.Conv2D(out_channel=64, kernel_size=7, mode=1, pad_mode="valid", pad=0, stride=1, dilation=1, group=1)
 bn = P.FusedBatchNorm()
@@ -241,6 +245,58 @@ def test_all_reduce_fusion_all(tag):
     return fns[tag]
 
 
+def test_host_all_reduce_fusion(tag):
+    """ test_host_all_reduce_fusion """
+    fns = FnDict()
+
+    @fns
+    def before(x1, x2, x3, x4):
+        y1 = host_allreduce(x1)
+        y2 = host_allreduce(x2)
+        y3 = host_allreduce_ring(x3)
+        y4 = host_allreduce_ring(x4)
+        return make_tuple(y1, y2, y3, y4)
+
+    @fns
+    def after(x1, x2, x3, x4):
+        ar_ring = host_allreduce_ring(x4, x3)
+        y4 = tuple_getitem(ar_ring, 0)
+        y3 = tuple_getitem(ar_ring, 1)
+        ar = host_allreduce(x2, x1)
+        y2 = tuple_getitem(ar, 0)
+        y1 = tuple_getitem(ar, 1)
+        res = make_tuple(y1, y2, y3, y4)
+        return make_tuple(res)
+
+    return fns[tag]
+
+
+def test_host_all_reduce_fusion_dtype(tag):
+    """ test_host_all_reduce_fusion_dtype """
+    fns = FnDict()
+
+    @fns
+    def before(x1, x2, x3, x4):
+        y1 = host_allreduce(x1)
+        y2 = host_allreduce(x2)
+        y3 = host_allreduce(x3)
+        y4 = host_allreduce(x4)
+        return make_tuple(y1, y2, y3, y4)
+
+    @fns
+    def after(x1, x2, x3, x4):
+        ar_fp16 = host_allreduce(x4, x3)
+        y4 = tuple_getitem(ar_fp16, 0)
+        y3 = tuple_getitem(ar_fp16, 1)
+        ar_fp32 = host_allreduce(x2, x1)
+        y2 = tuple_getitem(ar_fp32, 0)
+        y1 = tuple_getitem(ar_fp32, 1)
+        res = make_tuple(y1, y2, y3, y4)
+        return make_tuple(res)
+
+    return fns[tag]
+
+
 def test_all_reduce_fusion_group(tag):
     """ test_all_reduce_fusion_group """
     fns = FnDict()
@@ -0,0 +1,58 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+from mindspore.ops import Primitive
+from mindspore.ops import operations as P
+
+make_tuple = Primitive('make_tuple')
+depend = Primitive('depend')
+relu = P.ReLU()
+mul = P.Mul()
+
+
+class FnDict:
+    def __init__(self):
+        self.fnDict = {}
+
+    def __call__(self, fn):
+        self.fnDict[fn.__name__] = fn
+
+    def __getitem__(self, name):
+        return self.fnDict[name]
+
+
+def test_rematerialization(tag):
+    """ test_rematerialization """
+    fns = FnDict()
+
+    @fns
+    def before(x, w):
+        act = relu(x)
+        out = mul(act, w)
+        # the backward pass, the scope of its nodes is set by the test
+        grad = mul(out, w)
+        grad_x = mul(grad, act)
+        return grad_x
+
+    @fns
+    def after(x, w):
+        act = relu(x)
+        out = mul(act, w)
+        grad = mul(out, w)
+        act_copy = relu(depend(x, grad))
+        grad_x = mul(grad, act_copy)
+        return make_tuple(grad_x)
+
+    return fns[tag]
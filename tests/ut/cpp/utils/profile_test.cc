@@ -13,7 +13,9 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cstdio>
 #include <iostream>
+#include <memory>
 #include <string>
 #include "common/common_test.h"
 
@@ -21,6 +23,7 @@
 #define ENABLE_PROFILE
 #endif
 
+#include "nlohmann/json.hpp"
 #include "utils/profile.h"
 
 namespace mindspore {
@@ -89,4 +92,48 @@ TEST_F(TestProfile, Test02) {
   EXPECT_GT(t6 - t1, 0);
 }
 
+TEST_F(TestProfile, TestCompileProfiler) {
+  auto &profiler = CompileProfiler::GetInstance();
+  size_t nodes = 10;
+  auto inline_stat = std::make_shared<SubstitutionStat>();
+  // runs before the compile are not reported
+  inline_stat->tries = 3;
+  {
+    // not recorded, no compile was started
+    CompileStepRecorder recorder("action", "parse", 0, [&nodes]() { return nodes; });
+  }
+  profiler.Start("train.0");
+  ASSERT_TRUE(profiler.active());
+  {
+    CompileStepRecorder recorder("action", "parse", 0, [&nodes]() { return nodes; });
+    nodes = 4;
+  }
+  {
+    CompileStepRecorder recorder("opt_a", "a_1", 1, [&nodes]() { return nodes; });
+  }
+  profiler.WatchSubstitution("inline", inline_stat);
+  inline_stat->tries += 2;
+  inline_stat->hits += 1;
+  inline_stat->time += 0.75;
+  profiler.Finish("./compile_profile_test.json");
+  ASSERT_FALSE(profiler.active());
+  // nor are the runs after it
+  inline_stat->tries++;
+
+  auto json = nlohmann::json::parse(profiler.ToJson());
+  EXPECT_EQ(json["phase"], "train.0");
+  ASSERT_EQ(json["steps"].size(), 2);
+  EXPECT_EQ(json["steps"][0]["name"], "parse");
+  EXPECT_EQ(json["steps"][0]["nodes_before"], 10);
+  EXPECT_EQ(json["steps"][0]["nodes_after"], 4);
+  EXPECT_EQ(json["steps"][1]["group"], "opt_a");
+  EXPECT_EQ(json["steps"][1]["round"], 1);
+  ASSERT_EQ(json["substitutions"].size(), 1);
+  EXPECT_EQ(json["substitutions"][0]["tries"], 2);
+  EXPECT_EQ(json["substitutions"][0]["hits"], 1);
+  EXPECT_DOUBLE_EQ(json["substitutions"][0]["time"].get<double>(), 0.75);
+  EXPECT_GT(CompileProfiler::GetMemoryUsage(), 0);
+  (void)remove("./compile_profile_test.json");
+}
+
 }  // namespace mindspore
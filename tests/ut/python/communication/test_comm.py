@@ -26,7 +26,7 @@ from mindspore.nn import Momentum
 from mindspore.nn import ReLU
 from mindspore.nn import TrainOneStepCell, WithLossCell
 from mindspore.ops.operations.comm_ops import AllReduce, AllGather, _AlltoAll, ReduceOp, ReduceScatter
-from mindspore.ops.operations.comm_ops import HostAllGather, HostReduceScatter
+from mindspore.ops.operations.comm_ops import HostAllGather, HostAllReduce, HostReduceScatter
 from mindspore.ops.operations.comm_ops import Broadcast
 
 # pylint: disable=W0212
@@ -102,6 +102,21 @@ class HostAllGatherNet(nn.Cell):
         return self.relu(x)
 
 
+class HostAllReduceNet(nn.Cell):
+    """HostAllReduceNet definition"""
+
+    def __init__(self, input_channel, out_channel, algorithm):
+        super(HostAllReduceNet, self).__init__()
+        self.dense = Dense(input_channel, out_channel)
+        self.hostallreduce = HostAllReduce(ReduceOp.SUM, (0, 1), algorithm)
+        self.relu = ReLU()
+
+    def construct(self, x):
+        x = self.dense(x)
+        x = self.hostallreduce(x)
+        return self.relu(x)
+
+
 class ReduceScatterNet(nn.Cell):
     """ReduceScatterNet definition"""
 
@@ -200,6 +215,28 @@ def test_hostallgather():
     _executor.compile(network, input_tensor, label_tensor)
 
 
+def run_hostallreduce(algorithm):
+    """run_hostallreduce"""
+    context.set_context(mode=context.GRAPH_MODE)
+    input_tensor = Tensor(np.array([[1.2, 2.1], [2.2, 3.2]], dtype=np.float32))
+    label_tensor = Tensor(np.array([[1.2], [2.2]], dtype=np.float32))
+    network = HostAllReduceNet(2, 1, algorithm)
+    loss_fn = nn.SoftmaxCrossEntropyWithLogits()
+    optimizer = Momentum(filter(lambda x: x.requires_grad, network.get_parameters()),
+                         learning_rate=0.1,
+                         momentum=0.9)
+    network = WithLossCell(network, loss_fn)
+    network = TrainOneStepCell(network, optimizer)
+    _executor.compile(network, input_tensor, label_tensor)
+
+
+def test_hostallreduce():
+    """test_hostallreduce"""
+    context.set_context(mode=context.GRAPH_MODE)
+    run_hostallreduce("mpi")
+    run_hostallreduce("ring")
+
+
 def run_reducescatter(op):
     """run_reducescatter"""
     context.set_context(mode=context.GRAPH_MODE)
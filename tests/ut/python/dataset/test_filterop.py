@@ -17,6 +17,7 @@ import numpy as np
 
 import mindspore.dataset as ds
 import mindspore.dataset.transforms.vision.c_transforms as cde
+from mindspore.dataset.engine import predicates
 
 DATA_DIR = ["../data/dataset/test_tf_file_3_images/train-0000-of-0001.data"]
 SCHEMA_DIR = "../data/dataset/test_tf_file_3_images/datasetSchema.json"
@@ -519,6 +520,52 @@ def test_filter_by_generator_with_map_all_sort():
     assert ret_data[9]["col6"] == 509
 
 
+def generator_seq():
+    for i in range(64):
+        yield (np.array(i), np.arange(i % 8))
+
+
+# test with a predicate evaluated in C++
+def test_filter_by_generator_with_native_predicate():
+    dataset = ds.GeneratorDataset(generator_seq, ["data", "seq"])
+    predicate = predicates.value_between("data", 10, 40) & predicates.length_between("seq", 2, 5) & \
+                predicates.value_in("data", [11, 12, 13, 26, 27, 33, 34, 35, 36])
+    dataset_f = dataset.filter(predicate=predicate, num_parallel_workers=4)
+    ret_data = []
+    for item in dataset_f.create_dict_iterator():
+        ret_data.append(int(item["data"]))
+    # same result as the python predicate
+    dataset = ds.GeneratorDataset(generator_seq, ["data", "seq"])
+    dataset_p = dataset.filter(predicate=lambda data, seq: 10 <= data <= 40 and 2 <= len(seq) <= 5 and
+                               data in [11, 12, 13, 26, 27, 33, 34, 35, 36], num_parallel_workers=4)
+    expected_rs = [int(item["data"]) for item in dataset_p.create_dict_iterator()]
+    assert ret_data == [11, 12, 13, 26, 27, 34, 35, 36]
+    assert ret_data == expected_rs
+
+
+def generator_int64():
+    for i in range(4):
+        yield (np.array(2 ** 53 + i, dtype=np.int64),)
+
+
+# int64 values above 2**53 are compared exactly
+def test_filter_by_generator_with_native_predicate_int64():
+    dataset = ds.GeneratorDataset(generator_int64, ["data"])
+    predicate = predicates.value_between("data", 2 ** 53 + 1) & predicates.value_in("data", [2 ** 53 + 1, 2 ** 53 + 3])
+    dataset = dataset.filter(predicate=predicate, num_parallel_workers=2)
+    ret_data = [int(item["data"]) for item in dataset.create_dict_iterator()]
+    assert ret_data == [2 ** 53 + 1, 2 ** 53 + 3]
+
+
+
+# an empty list keeps no row, also for a numeric column
+def test_filter_by_generator_with_native_predicate_empty_in():
+    dataset = ds.GeneratorDataset(generator_seq, ["data", "seq"])
+    dataset = dataset.filter(predicate=predicates.value_in("data", []), num_parallel_workers=2)
+    ret_data = [int(item["data"]) for item in dataset.create_dict_iterator()]
+    assert ret_data == []
+
+
 if __name__ == '__main__':
     test_diff_predicate_func()
     test_filte_case_dataset_cifar10()
@@ -540,3 +587,5 @@ if __name__ == '__main__':
     test_filter_by_generator_with_zip()
     test_filter_by_generator_with_zip_after()
     test_filter_by_generator_Partial()
+    test_filter_by_generator_with_native_predicate()
+    test_filter_by_generator_with_native_predicate_int64()
@@ -16,10 +16,12 @@ import numpy as np
 import pytest
 
 import mindspore.dataset as ds
+import mindspore.dataset.transforms.vision.c_transforms as vision
 from mindspore.dataset.engine.iterators import ITERATORS_LIST, _cleanup
 
 DATA_DIR = ["../data/dataset/testTFTestAllTypes/test.data"]
 SCHEMA_DIR = "../data/dataset/testTFTestAllTypes/datasetSchema.json"
+CIFAR10_DIR = "../data/dataset/testCifar10Data"
 COLUMNS = ["col_1d", "col_2d", "col_3d", "col_binary", "col_float",
            "col_sint16", "col_sint32", "col_sint64"]
 
@@ -109,5 +111,57 @@ def test_tree_copy():
     itr.release()
 
 
+def test_iterator_resume():
+    """
+    Test resuming a pipeline from the state of a previous iterator
+    """
+    original_seed = ds.config.get_seed()
+    ds.config.set_seed(5)
+    data = ds.Cifar10Dataset(CIFAR10_DIR, num_samples=20, shuffle=True)
+    data = data.repeat(3)
+    data = data.batch(4)
+    expected = [item["image"] for item in data.create_dict_iterator()]
+    assert len(expected) == 15
+
+    itr = data.create_dict_iterator()
+    for _ in range(7):
+        next(itr)
+    state = itr.get_state()
+    assert state == {"rows": 28, "rows_per_epoch": 20}
+
+    # starts in the middle of the second epoch, with the same shuffled order as before
+    resumed = [item["image"] for item in data.create_dict_iterator(state=state)]
+    assert len(resumed) == 8
+    assert all([np.array_equal(d1, d2) for d1, d2 in zip(resumed, expected[7:])])
+
+    # a shuffle buffer does not keep the order of the rows of the source
+    data = ds.Cifar10Dataset(CIFAR10_DIR, num_samples=20).shuffle(4)
+    itr = data.create_dict_iterator()
+    with pytest.raises(ValueError) as info:
+        itr.get_state()
+    assert "ShuffleDataset can not be in a resumable pipeline" in str(info.value)
+
+    # a random transform would not redo the draws of the skipped rows
+    data = ds.Cifar10Dataset(CIFAR10_DIR, num_samples=20)
+    data = data.map(input_columns=["image"], operations=[vision.RandomHorizontalFlip()])
+    itr = data.create_dict_iterator()
+    with pytest.raises(ValueError) as info:
+        itr.get_state()
+    assert "Random transform RandomHorizontalFlip can not be in a resumable pipeline" in str(info.value)
+
+    # the offsets of a streaming source are not saved, so resuming from a state is an error rather than a restart
+    data = ds.TFRecordDataset(DATA_DIR, SCHEMA_DIR, columns_list=COLUMNS, shuffle=False)
+    itr = data.create_dict_iterator()
+    next(itr)
+    with pytest.raises(ValueError) as info:
+        itr.get_state()
+    assert "TFRecordDataset can not be the source of a resumable pipeline" in str(info.value)
+    with pytest.raises(ValueError) as info:
+        data.create_dict_iterator(state={"rows": 1, "rows_per_epoch": 12})
+    assert "streaming sources are not saved" in str(info.value)
+    ds.config.set_seed(original_seed)
+
+
 if __name__ == '__main__':
     test_tree_copy()
+    test_iterator_resume()
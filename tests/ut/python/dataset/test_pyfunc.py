@@ -266,6 +266,31 @@ def test_pyfunc_execption():
         assert "Pyfunc Throw" in str(info.value)
 
 
+def test_pyfunc_in_place():
+    """
+    Test PyFunc that modifies its input, the input is passed without a copy
+    """
+    logger.info("Test 1-1 PyFunc in place : x += 1")
+
+    def pyfunc(x):
+        x += 1
+        return x
+
+    ds.config.reset_gil_wait_stats()
+    data1 = ds.GeneratorDataset(lambda: ((np.array([i, i + 1], dtype=np.int64),) for i in range(64)), ["col0"])
+    data1 = data1.map(input_columns="col0", output_columns="out", operations=pyfunc, num_parallel_workers=4)
+
+    i = 0
+    for item in data1.create_dict_iterator():
+        assert np.array_equal(item["out"], np.array([i + 1, i + 2]))
+        i = i + 1
+    assert i == 64
+
+    stats = ds.config.get_gil_wait_stats()
+    assert stats["PyFuncOp"][1] > 0
+    assert stats["GeneratorOp"][1] > 0
+
+
 def skip_test_pyfunc_execption_multiprocess():
     logger.info("Test Multiprocess PyFunc Execption Throw: lambda x : raise Execption()")
 
@@ -294,4 +319,5 @@ if __name__ == "__main__":
     test_case_8()
     test_case_9()
     test_pyfunc_execption()
+    test_pyfunc_in_place()
     skip_test_pyfunc_execption_multiprocess()
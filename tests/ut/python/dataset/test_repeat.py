@@ -244,6 +244,67 @@ def test_nested_repeat11():
     assert sum([1 for _ in data]) == 2 * 3 * 4 * 5 * 3
 
 
+def test_repeat_epoch_pipelining():
+    """
+    Test that epoch pipelining does not change the data of the epochs.
+    """
+    logger.info("Test Repeat with epoch pipelining")
+
+    def get_data():
+        data1 = ds.TFRecordDataset(DATA_DIR_TF, SCHEMA_DIR_TF, columns_list=["col_sint64"], shuffle=False)
+        data1 = data1.repeat(2)
+        data1 = data1.repeat(3)
+        data2 = ds.GeneratorDataset(generator, ["data"])
+        data2 = data2.repeat(4)
+        data2 = data2.repeat(5)
+        return [d["col_sint64"].tolist() for d in data1.create_dict_iterator()], \
+               [d["data"].tolist() for d in data2.create_dict_iterator()]
+
+    expected_tf, expected_gen = get_data()
+    ds.config.set_epoch_pipelining(True)
+    try:
+        assert ds.config.get_epoch_pipelining()
+        result_tf, result_gen = get_data()
+    finally:
+        ds.config.set_epoch_pipelining(False)
+
+    assert len(result_tf) == len(expected_tf)
+    assert result_tf == expected_tf
+    assert len(result_gen) == 4 * 5 * 3
+    assert result_gen == expected_gen
+
+
+def test_repeat_epoch_pipelining_map_batch():
+    """
+    Test that epoch pipelining does not change the data when map and batch ops drain the epochs.
+    """
+    logger.info("Test Repeat with epoch pipelining, map and batch")
+
+    def get_data():
+        data1 = ds.MnistDataset("../data/dataset/testMnistData", num_samples=20, shuffle=False)
+        data1 = data1.map(input_columns=["label"], operations=(lambda x: x * 2), num_parallel_workers=2)
+        data1 = data1.batch(3)
+        data1 = data1.repeat(3)
+        data2 = ds.GeneratorDataset(generator, ["data"])
+        data2 = data2.map(input_columns=["data"], operations=(lambda x: x + 1), num_parallel_workers=2)
+        data2 = data2.batch(2, drop_remainder=True)
+        data2 = data2.repeat(4)
+        return [d["label"].tolist() for d in data1.create_dict_iterator()], \
+               [d["data"].tolist() for d in data2.create_dict_iterator()]
+
+    expected_mnist, expected_gen = get_data()
+    ds.config.set_epoch_pipelining(True)
+    try:
+        result_mnist, result_gen = get_data()
+    finally:
+        ds.config.set_epoch_pipelining(False)
+
+    assert len(result_mnist) == 7 * 3
+    assert result_mnist == expected_mnist
+    assert result_gen == [[[1], [2]]] * 4
+    assert result_gen == expected_gen
+
+
 if __name__ == "__main__":
     test_tf_repeat_01()
     test_tf_repeat_02()
@@ -260,3 +321,5 @@ if __name__ == "__main__":
     test_nested_repeat9()
     test_nested_repeat10()
     test_nested_repeat11()
+    test_repeat_epoch_pipelining()
+    test_repeat_epoch_pipelining_map_batch()
@@ -0,0 +1,55 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+""" test grad reducer on host """
+import sys
+
+import numpy as np
+import pytest
+
+from mindspore import Parameter, Tensor
+from mindspore.nn import DistributedGradReducer
+from mindspore.nn.wrap import grad_reducer
+from mindspore.ops.operations.comm_ops import HostAllReduce
+
+
+def get_parameters():
+    return [Parameter(Tensor(np.ones([2, 2]).astype(np.float32)), name="weight")]
+
+
+def test_host_reduce_of_single_process(monkeypatch):
+    monkeypatch.setattr(grad_reducer, "_is_host_reduce", lambda: True)
+    monkeypatch.setattr(grad_reducer, "_get_host_group_size", lambda: 1)
+    reducer = DistributedGradReducer(get_parameters())
+    # a single process has nothing to reduce with
+    assert reducer.degree == 1
+    assert grad_reducer._all_reduce is grad_reducer._identity
+
+
+def test_host_reduce_of_many_processes(monkeypatch):
+    monkeypatch.setattr(grad_reducer, "_is_host_reduce", lambda: True)
+    monkeypatch.setattr(grad_reducer, "_get_host_group_size", lambda: 16)
+    reducer = DistributedGradReducer(get_parameters())
+    assert reducer.degree == 16
+    assert isinstance(grad_reducer._all_reduce, HostAllReduce)
+    assert grad_reducer._all_reduce.group == list(range(16))
+
+
+def test_host_reduce_without_mpi(monkeypatch):
+    monkeypatch.setattr(grad_reducer, "_is_host_reduce", lambda: True)
+    # the import of a module set to None fails
+    monkeypatch.setitem(sys.modules, "mindspore._ms_mpi", None)
+    with pytest.raises(RuntimeError) as info:
+        DistributedGradReducer(get_parameters())
+    assert "built without MPI" in str(info.value)
@@ -0,0 +1,153 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import json
+import os
+
+import numpy as np
+import pytest
+
+import mindspore as ms
+import mindspore.nn as nn
+from mindspore import Tensor
+from mindspore import context
+from mindspore.common.api import _executor
+from mindspore.ops import composite as C
+from mindspore.ops import operations as P
+from mindspore.parallel import _cost_model_calibration as calibration
+from mindspore.parallel import _cost_model_context as cost_model_context
+from mindspore.parallel._utils import _reset_op_id as reset_op_id
+from tests.ut.python.ops.test_math_ops import VirtualLoss
+
+
+class NetWithLoss(nn.Cell):
+    def __init__(self, network):
+        super(NetWithLoss, self).__init__()
+        self.loss = VirtualLoss()
+        self.network = network
+
+    def construct(self, x, y, b):
+        predict = self.network(x, y, b)
+        return self.loss(predict)
+
+
+class GradWrap(nn.Cell):
+    def __init__(self, network):
+        super(GradWrap, self).__init__()
+        self.network = network
+
+    def construct(self, x, y, b):
+        return C.grad_all(self.network)(x, y, b)
+
+
+class Net(nn.Cell):
+    def __init__(self):
+        super().__init__()
+        self.matmul = P.MatMul()
+        self.mul = P.Mul()
+
+    def construct(self, x, y, b):
+        out = self.matmul(x, y)
+        out = self.mul(out, b)
+        return out
+
+
+def test_fit_coefficient():
+    slope, intercept = calibration.fit_coefficient([100.0, 200.0, 400.0], [1.5, 2.5, 4.5])
+    assert abs(slope - 0.01) < 1e-9
+    assert abs(intercept - 0.5) < 1e-9
+    # no trend, the times are taken as proportional to the costs
+    slope, intercept = calibration.fit_coefficient([100.0, 100.0], [2.0, 2.0])
+    assert abs(slope - 0.02) < 1e-9
+    assert intercept == 0.0
+
+    coefficients, mean = calibration.normalize_coefficients({"MatMul": 4.0, "ReLU": 1.0})
+    assert abs(mean - 2.0) < 1e-9
+    assert abs(coefficients["MatMul"] - 2.0) < 1e-9
+    assert abs(coefficients["ReLU"] - 0.5) < 1e-9
+
+
+def test_calibrated_cost_formulas():
+    # the reduced dimension is split, so the sliced output is added as in MatMulCost
+    cost = calibration.computation_cost("MatMul", [[64, 32], [32, 64]], ((2, 2), (2, 1)))
+    assert cost == (32 * 16 + 16 * 64 + 32 * 64) * 4
+    cost = calibration.computation_cost("BiasAdd", [[64, 32], [32]], ((2, 4), (4,)))
+    assert cost == (32 * 8 + 8) * 4
+
+
+def compile_net(net, x, y, b):
+    net.set_auto_parallel()
+    reset_op_id()
+    _executor.compile(net, x, y, b, phase='train')
+
+
+def matmul_strategy(net):
+    strategies = _executor._get_strategy(net)
+    return [strategy for name, strategy in strategies.items() if "MatMul" in name][0]
+
+
+def test_two_matmul_with_calibration_file(tmp_path):
+    profile = os.path.join(str(tmp_path), "calibration.json")
+    with open(profile, "w") as f:
+        json.dump({"device_target": "CPU", "computation_coefficients": {"MatMul": 3.0, "Mul": 0.5}}, f)
+    with pytest.raises(ValueError):
+        cost_model_context.set_cost_model_context(costmodel_calibration_file=profile + ".not_exist")
+    cost_model_context.set_cost_model_context(costmodel_calibration_file=profile)
+    assert cost_model_context.get_cost_model_context("costmodel_calibration_file") == profile
+
+    context.set_auto_parallel_context(device_num=8, global_rank=0)
+    x = Tensor(np.ones([128, 32]), dtype=ms.float32)
+    y = Tensor(np.ones([32, 64]), dtype=ms.float32)
+    b = Tensor(np.ones([128, 64]), dtype=ms.float32)
+    net = GradWrap(NetWithLoss(Net()))
+    context.set_auto_parallel_context(parallel_mode="auto_parallel")
+    compile_net(net, x, y, b)
+
+    # the search of the compile weighted the costs of the operators by the profile
+    matmul_args = ("MatMul", [[128, 32], [32, 64]], ((8, 1), (1, 1)))
+    mul_args = ("Mul", [[128, 64], [128, 64]], ((8, 1), (8, 1)))
+    matmul_cost = calibration.computation_cost(*matmul_args)
+    mul_cost = calibration.computation_cost(*mul_args)
+    assert calibration.computation_cost(*matmul_args, calibrated=True) == 3.0 * matmul_cost
+    assert calibration.computation_cost(*mul_args, calibrated=True) == 0.5 * mul_cost
+
+    # the modified profile is read again by the next compile
+    with open(profile, "w") as f:
+        json.dump({"device_target": "CPU", "computation_coefficients": {"MatMul": 6.0}}, f)
+    modified = os.stat(profile).st_mtime + 10
+    os.utime(profile, (modified, modified))
+    compile_net(net, x, y, b)
+    assert calibration.computation_cost(*matmul_args, calibrated=True) == 6.0 * matmul_cost
+    assert calibration.computation_cost(*mul_args, calibrated=True) == mul_cost
+
+    # the search follows the coefficients: uncalibrated, the MatMul is data parallel, which needs no communication.
+    # When the MatMul costs a million times more, its computation decides and the strategy of the cheapest slices wins
+    cost_model_context.set_cost_model_context(costmodel_calibration_file="")
+    compile_net(net, x, y, b)
+    uncalibrated = matmul_strategy(net)
+    assert uncalibrated == [[8, 1], [1, 1]]
+    with open(profile, "w") as f:
+        json.dump({"device_target": "CPU", "computation_coefficients": {"MatMul": 1000000.0}}, f)
+    cost_model_context.set_cost_model_context(costmodel_calibration_file=profile)
+    compile_net(net, x, y, b)
+    calibrated = matmul_strategy(net)
+    cuts = (1, 2, 4, 8)
+    cheapest = min((((i, k), (k, j)) for i in cuts for j in cuts for k in cuts if i * j * k == 8),
+                   key=lambda strategy: calibration.computation_cost("MatMul", [[128, 32], [32, 64]], strategy))
+    assert calibrated == [list(stra) for stra in cheapest]
+    assert calibrated != uncalibrated
+
+    cost_model_context.reset_cost_model_context()
+    assert cost_model_context.get_cost_model_context("costmodel_calibration_file") == ""
+    context.reset_auto_parallel_context()
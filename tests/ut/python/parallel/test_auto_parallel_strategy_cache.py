@@ -0,0 +1,126 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+
+import numpy as np
+import pytest
+
+import mindspore as ms
+import mindspore.nn as nn
+from mindspore import Tensor
+from mindspore import context
+from mindspore._c_expression import get_strategy_cache_hits
+from mindspore.common.api import _executor
+from mindspore.ops import composite as C
+from mindspore.ops import operations as P
+from mindspore.parallel._utils import _reset_op_id as reset_op_id
+from tests.ut.python.ops.test_math_ops import VirtualLoss
+
+
+class NetWithLoss(nn.Cell):
+    def __init__(self, network):
+        super(NetWithLoss, self).__init__()
+        self.loss = VirtualLoss()
+        self.network = network
+
+    def construct(self, x, y, b):
+        predict = self.network(x, y, b)
+        return self.loss(predict)
+
+
+class GradWrap(nn.Cell):
+    def __init__(self, network):
+        super(GradWrap, self).__init__()
+        self.network = network
+
+    def construct(self, x, y, b):
+        return C.grad_all(self.network)(x, y, b)
+
+
+class Net(nn.Cell):
+    def __init__(self):
+        super().__init__()
+        self.matmul1 = P.MatMul()
+        self.matmul2 = P.MatMul()
+        self.relu = P.ReLU()
+
+    def construct(self, x, y, b):
+        out = self.matmul1(x, y)
+        out = self.relu(out)
+        out = self.matmul2(out, b)
+        return out
+
+
+class ReshapeNet(nn.Cell):
+    def __init__(self):
+        super().__init__()
+        self.matmul1 = P.MatMul()
+        self.matmul2 = P.MatMul()
+        self.relu = P.ReLU()
+        self.reshape = P.Reshape()
+
+    def construct(self, x, y, b):
+        out = self.matmul1(x, y)
+        out = self.relu(out)
+        out = self.reshape(out, (256, 32))
+        out = self.matmul2(out, b)
+        return out
+
+
+def compile_net(network=Net, b_shape=(64, 64)):
+    x = Tensor(np.ones([128, 32]), dtype=ms.float32)
+    y = Tensor(np.ones([32, 64]), dtype=ms.float32)
+    b = Tensor(np.ones(b_shape), dtype=ms.float32)
+    net = GradWrap(NetWithLoss(network()))
+    net.set_auto_parallel()
+    reset_op_id()
+    _executor.compile(net, x, y, b, phase='train')
+    return _executor._get_strategy(net)
+
+
+def test_strategy_cache_dir():
+    with pytest.raises(ValueError):
+        context.set_auto_parallel_context(strategy_cache_dir="./strategy_cache_not_exist")
+    context.set_auto_parallel_context(strategy_cache_dir=".")
+    assert context.get_auto_parallel_context("strategy_cache_dir") == "."
+    context.reset_auto_parallel_context()
+    assert context.get_auto_parallel_context("strategy_cache_dir") == ""
+
+
+def test_two_matmul_with_strategy_cache(tmp_path):
+    cache_dir = str(tmp_path)
+    context.set_auto_parallel_context(device_num=8, global_rank=0, parallel_mode="auto_parallel",
+                                      strategy_cache_dir=cache_dir)
+    searched = compile_net()
+    cache_files = [name for name in os.listdir(cache_dir) if name.startswith("strategy_cache_")]
+    assert len(cache_files) == 1
+    # the second compiling applies the cached strategies
+    hits = get_strategy_cache_hits()
+    cached = compile_net()
+    assert get_strategy_cache_hits() == hits + 1
+    assert searched == cached
+    assert len(os.listdir(cache_dir)) == 1
+    context.reset_auto_parallel_context()
+
+
+def test_reshape_with_strategy_cache():
+    context.set_auto_parallel_context(device_num=8, global_rank=0, parallel_mode="auto_parallel")
+    searched = compile_net(ReshapeNet, (32, 64))
+    # the layouts of the reshape are restored as the search chose them, without searching again
+    hits = get_strategy_cache_hits()
+    cached = compile_net(ReshapeNet, (32, 64))
+    assert get_strategy_cache_hits() == hits + 1
+    assert searched == cached
+    context.reset_auto_parallel_context()
@@ -81,6 +81,9 @@ def test_set_auto_parallel_context():
     with pytest.raises(ValueError):
         set_algo_parameters(tensor_slice_align_size=1025)
 
+    with pytest.raises(ValueError):
+        set_algo_parameters(dp_algo_search_threads=-1)
+
 
 def test_reset_auto_parallel_context():
     context.reset_auto_parallel_context()